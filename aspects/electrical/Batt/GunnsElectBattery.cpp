@@ -110,6 +110,7 @@ GunnsElectBattery::GunnsElectBattery()
     mCurrent(0.0),
     mVoltage(0.0),
     mHeat(0.0),
+    mCellVoc(0),
     mThermalRunawayCell(0),
     mThermalRunawayTimer(0.0)
 {
@@ -177,6 +178,7 @@ void GunnsElectBattery::initialize(GunnsElectBatteryConfigData&  configData,
 void GunnsElectBattery::allocateArrays()
 {
     TS_NEW_CLASS_ARRAY_EXT(mCells, static_cast<int>(mNumCells), GunnsElectBatteryCell, (), std::string(mName) + ".mCells");
+    TS_NEW_PRIM_ARRAY_EXT (mCellVoc, static_cast<int>(mNumCells), double, std::string(mName) + ".mCellVoc");
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -184,6 +186,9 @@ void GunnsElectBattery::allocateArrays()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsElectBattery::cleanup()
 {
+    if (mCellVoc) {
+        TS_DELETE_ARRAY(mCellVoc);
+    }
     if (mCells) {
         TS_DELETE_ARRAY(mCells);
     }
@@ -283,6 +288,7 @@ void GunnsElectBattery::updateState(const double timeStep __attribute__((unused)
 
     /// - Link source potential comes from the cells open-circuit voltage based on their States of
     ///   Charge.  All cells share the same Voc/Soc table.
+    updateCellVoltages();
     if (mCellsInParallel) {
         mSourcePotential = computeParallelVoc();
     } else {
@@ -320,19 +326,40 @@ double GunnsElectBattery::computeSeriesResistance() const
     return std::max(resistance, DBL_EPSILON);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Looks up the open-circuit voltage of all cells from their States of Charge in one
+///           batch call to the shared Voc/Soc table, then zeroes the voltage of failed cells, the
+///           same as GunnsElectBatteryCell::getEffectiveVoltage.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsElectBattery::updateCellVoltages()
+{
+    for (unsigned int i = 0; i < mNumCells; i++ )
+    {
+        mCellVoc[i] = mCells[i].getEffectiveSoc();
+    }
+    mSocVocTable->get(mCellVoc, 0, mCellVoc, mNumCells);
+    for (unsigned int i = 0; i < mNumCells; i++ )
+    {
+        const GunnsElectBatteryCell& cell = mCells[i];
+        if (cell.mMalfOpenCircuit or cell.mMalfShortCircuit or cell.mMalfThermalRunawayFlag) {
+            mCellVoc[i] = 0.0;
+        }
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @returns  double (V) Open-circuit voltage of the cells in parallel.
 ///
 /// @details  Since the cells are in parallel, the battery's Voc is the cell with the highest Voc.
+///           The cell voltages are from the last updateCellVoltages.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 double GunnsElectBattery::computeParallelVoc() const
 {
     double Voc = 0.0;
     for (unsigned int i = 0; i < mNumCells; i++ )
     {
-        const double cellVoc = mCells[i].getEffectiveVoltage(mSocVocTable);
-        if (cellVoc > Voc) {
-            Voc = cellVoc;
+        if (mCellVoc[i] > Voc) {
+            Voc = mCellVoc[i];
         }
     }
     return Voc;
@@ -342,13 +369,14 @@ double GunnsElectBattery::computeParallelVoc() const
 /// @returns  double (V) Open-circuit voltage of the cells in series.
 ///
 /// @details  Since the cells are in series, the battery's Voc is the sum of all the cell's Voc.
+///           The cell voltages are from the last updateCellVoltages.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 double GunnsElectBattery::computeSeriesVoc() const
 {
     double Voc = 0.0;
     for (unsigned int i = 0; i < mNumCells; i++ )
     {
-        Voc += mCells[i].getEffectiveVoltage(mSocVocTable);
+        Voc += mCellVoc[i];
     }
     return Voc;
 }
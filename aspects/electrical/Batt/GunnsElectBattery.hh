@@ -169,6 +169,7 @@ class GunnsElectBattery: public GunnsBasicPotential
         double                mCurrent;                /**< (amp)    trick_chkpnt_io(**) Battery current. */
         double                mVoltage;                /**< (V)      trick_chkpnt_io(**) Output closed-circuit voltage under load. */
         double                mHeat;                   /**< (W)      trick_chkpnt_io(**) Heat created by the battery. */
+        double*               mCellVoc;                /**< (V)      trick_chkpnt_io(**) Effective open-circuit voltage of each cell. */
         unsigned int          mThermalRunawayCell;     /**< (1)                          Current cell index for the thermal runaway cascade. */
         double                mThermalRunawayTimer;    /**< (s)                          Elapsed time of the thermal runaway malfunction. */
         /// @brief   Validates the link's configuration and input data.
@@ -184,6 +185,8 @@ class GunnsElectBattery: public GunnsBasicPotential
         double       computeParallelResistance() const;
         /// @brief   Finds resistance of all cells in series.
         double       computeSeriesResistance() const;
+        /// @brief   Updates the effective open-circuit voltage of all cells.
+        void         updateCellVoltages();
         /// @brief   Finds total Voc of all cells in parallel.
         double       computeParallelVoc() const;
         /// @brief   Finds total Voc of all cells in series.
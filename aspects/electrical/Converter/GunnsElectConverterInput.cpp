@@ -154,7 +154,8 @@ GunnsElectConverterInput::GunnsElectConverterInput()
     mOverloadedState(false),
     mLastOverloadedState(false)
 {
-    // nothing to do
+    /// - Stepped serially since it reads and writes its paired output link in minorStep.
+    mSerialOnly = true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
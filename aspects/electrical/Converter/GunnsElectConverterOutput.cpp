@@ -185,7 +185,8 @@ GunnsElectConverterOutput::GunnsElectConverterOutput()
     mLimitStateFlips(0),
     mSourceVoltage(0.0)
 {
-    // nothing to do
+    /// - Stepped serially since it reads and writes its paired input link in minorStep.
+    mSerialOnly = true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
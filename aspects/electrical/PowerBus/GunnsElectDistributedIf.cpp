@@ -120,7 +120,8 @@ GunnsElectDistributedIf::GunnsElectDistributedIf()
     mSupplyMonitorIndex(0),
     mSupplyMonitor(0)
 {
-    // nothing to do
+    /// - Stepped serially since it sets its node's network capacitance request in step.
+    mSerialOnly = true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
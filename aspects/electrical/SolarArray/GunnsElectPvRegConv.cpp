@@ -148,6 +148,9 @@ GunnsElectPvRegConv::GunnsElectPvRegConv()
     mStateSource(),
     mStateUpmodeLatch(false)
 {
+    /// - Stepped serially since it reads and loads its PV array link in step and minorStep.
+    mSerialOnly = true;
+
     for (unsigned int i=0; i<N_STATES; ++i) {
         mStateAdmittance[i] = 0.0;
         mStateSource[i]     = 0.0;
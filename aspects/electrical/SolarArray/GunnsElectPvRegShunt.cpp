@@ -226,7 +226,8 @@ GunnsElectPvRegShunt::GunnsElectPvRegShunt()
     mMaxRegCurrent(0.0),
     mOffToRegOccurred(false)
 {
-    // nothing to do
+    /// - Stepped serially since it reads and loads its PV array link in step and minorStep.
+    mSerialOnly = true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
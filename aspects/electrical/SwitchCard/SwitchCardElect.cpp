@@ -302,7 +302,8 @@ SwitchCardElect::SwitchCardElect()
                             mUserLoadPowerValid(0),
                             mThermWasteHeat(0.0),
                             mThermalTuning(0.05) {
-    // nothing to do
+    /// - Stepped serially since it reads its power supply link in step.
+    mSerialOnly = true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
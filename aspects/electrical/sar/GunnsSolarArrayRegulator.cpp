@@ -189,7 +189,8 @@ GunnsSolarArrayRegulator::GunnsSolarArrayRegulator():
     mMinInVoltage(0.0),
     mMarginTurnOnVoltage(0.0)
 {
-    // nothing to do
+    /// - Stepped serially since it reads its battery link's vectors in step.
+    mSerialOnly = true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
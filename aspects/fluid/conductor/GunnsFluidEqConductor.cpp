@@ -127,7 +127,8 @@ GunnsFluidEqConductor::GunnsFluidEqConductor()
     mPort1LeakConductance(0.0),
     mLastPotentialDrop(0.0)
 {
-    // nothing to do
+    /// - Stepped serially since it sets its nodes' network capacitance requests in step.
+    mSerialOnly = true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -18,7 +18,7 @@ ASSUMPTIONS AND LIMITATIONS:
  (
   (aspects/fluid/fluid/MonoFluid.o)
   (aspects/fluid/fluid/GunnsFluidTraceCompounds.o)
-  (math/approximation/LinearFit.o)
+  (aspects/fluid/fluid/PolyFluidPropertyEngine.o)
  )
 
  PROGRAMMERS:
@@ -34,7 +34,6 @@ ASSUMPTIONS AND LIMITATIONS:
 #include "software/exceptions/TsHsException.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
-#include "math/approximation/LinearFit.hh"
 
 #include "PolyFluid.hh"
 
@@ -200,7 +199,11 @@ PolyFluid::PolyFluid()
     mPrandtlNumber(0.0),
     mAdiabaticIndex(0.0),
     mTraceCompounds(0),
-    mInitFlag(false)
+    mInitFlag(false),
+    mPropertyEngine(),
+    mMassFractions(),
+    mMoleFractions(),
+    mPropertyCache()
 {
     // nothing to do
 }
@@ -238,7 +241,11 @@ PolyFluid::PolyFluid(const PolyFluidConfigData& configData,
     mPrandtlNumber(0.0),
     mAdiabaticIndex(0.0),
     mTraceCompounds(0),
-    mInitFlag(false)
+    mInitFlag(false),
+    mPropertyEngine(),
+    mMassFractions(),
+    mMoleFractions(),
+    mPropertyCache()
 {
     initializeName("Unnamed PolyFluid");
     initialize(configData, inputData);
@@ -276,7 +283,11 @@ PolyFluid::PolyFluid(const PolyFluid& that, const std::string& name, const bool
     mPrandtlNumber(that.mPrandtlNumber),
     mAdiabaticIndex(that.mAdiabaticIndex),
     mTraceCompounds(0),
-    mInitFlag(that.mInitFlag)
+    mInitFlag(that.mInitFlag),
+    mPropertyEngine(),
+    mMassFractions(),
+    mMoleFractions(),
+    mPropertyCache()
 {
     /// - Throw an exception if empty name.
     if (name.empty()) {
@@ -301,6 +312,7 @@ PolyFluid::PolyFluid(const PolyFluid& that, const std::string& name, const bool
         mConstituents[i].mMassFraction = that.mConstituents[i].mMassFraction;
         mConstituents[i].mMoleFraction = that.mConstituents[i].mMoleFraction;
     }
+    initializePropertyEngine();
 
     /// - Copy the trace compounds if it exists.  This is a deep copy so the new fluid's trace
     ///   compounds has its own memory and reference to this fluid's mMole term.
@@ -414,6 +426,8 @@ void PolyFluid::initialize(const PolyFluidConfigData& configData,
     try {
         /// - Validate the initial data.
         validate();
+        /// - Pack the constituent curve fits for the mixture property computations.
+        initializePropertyEngine();
     } catch (...) {
         /// - Catch any exceptions and delete the constituent fluids and array
         TS_DELETE_ARRAY(mConstituents);
@@ -457,6 +471,46 @@ void PolyFluid::initializeName(const std::string& name)
     mName = name;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   void
+///
+/// @throws   TsInitializationException
+///
+/// @details  Initializes the property engine with the constituent fluid properties, and sizes and
+///           fills the contiguous fraction arrays it is given.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void PolyFluid::initializePropertyEngine()
+{
+    std::vector<const FluidProperties*> properties(mNConstituents);
+    for (int i = 0; i < mNConstituents; ++i) {
+        properties[i] = mConstituents[i].mFluid.getProperties();
+    }
+    mPropertyEngine.initialize(mNConstituents > 0 ? &properties[0] : 0, mNConstituents,
+                               mName + ".mPropertyEngine");
+    mMassFractions.assign(mNConstituents, 0.0);
+    mMoleFractions.assign(mNConstituents, 0.0);
+    updateComposition();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   void
+///
+/// @details  Copies the constituent mass & mole fractions into the contiguous arrays used by the
+///           property engine, and advances the property cache revision so that no results computed
+///           for the previous composition are reused.  This must be called whenever the constituent
+///           fractions change.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void PolyFluid::updateComposition()
+{
+    if (static_cast<int>(mMassFractions.size()) == mNConstituents) {
+        for (int i = 0; i < mNConstituents; ++i) {
+            mMassFractions[i] = mConstituents[i].mMassFraction;
+            mMoleFractions[i] = mConstituents[i].mMoleFraction;
+        }
+    }
+    mPropertyCache.invalidate();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @return   void
 ///
@@ -530,6 +584,7 @@ void PolyFluid::derive()
         mConstituents[i].mMoleFraction /= molesPerUnitMass;
         mConstituents[i].mFluid.setPressure(mConstituents[i].mMoleFraction * mPressure);
     }
+    updateComposition();
 
     /// - Then update the composite properties from the constituent properties.
     mMWeight             = 1.0 / molesPerUnitMass;
@@ -656,13 +711,7 @@ void PolyFluid::setPressure(const double pressure)
     mPressure  = pressure;
 
     /// - Update the density of the composite fluid from the constituent fluid densities.
-    mDensity   = 0.0;
-    for (int i = 0; i < mNConstituents; ++i) {
-        if (fabs(mConstituents[i].mMoleFraction) > DBL_EPSILON) {
-            mDensity += mConstituents[i].mFluid.getProperties()->
-                        getDensity(mTemperature, mPressure * mConstituents[i].mMoleFraction);
-        }
-    }
+    mDensity   = computeDensity(mTemperature, mPressure);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -727,6 +776,7 @@ void PolyFluid::setMassAndMassFractions(const double mass, double* massFraction)
         mConstituents[i].mFluid.setMole(mConstituents[i].mMoleFraction * mMole);
         mConstituents[i].mFluid.setFlowRate(mConstituents[i].mMassFraction * mFlowRate);
     }
+    updateComposition();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -792,6 +842,7 @@ void PolyFluid::setMoleAndMoleFractions(const double mole, double* moleFraction)
         mConstituents[i].mFluid.setMass(mConstituents[i].mMassFraction * mMass);
         mConstituents[i].mFluid.setFlowRate(mConstituents[i].mMassFraction * mFlowRate);
     }
+    updateComposition();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -858,6 +909,7 @@ void PolyFluid::updateMass()
     /// - And finally update the composite moles and molecular weight.
     mMWeight          = mMass / moles;
     mMole             = moles;
+    updateComposition();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -882,6 +934,7 @@ void PolyFluid::resetState()
         mConstituents[i].mMassFraction = 0.0;
         mConstituents[i].mMoleFraction = 0.0;
     }
+    updateComposition();
 
     /// - Reset the composite properties.
     mMWeight             = 0.0;
@@ -936,6 +989,7 @@ void PolyFluid::setState(const PolyFluid* src)
         mConstituents[i].mMoleFraction = src->mConstituents[i].mMoleFraction;
         mConstituents[i].mFluid.setState(&(src->mConstituents[i].mFluid));
     }
+    updateComposition();
 
     /// - Set the composite properties.
     mMWeight             = src->mMWeight;
@@ -1030,6 +1084,7 @@ void PolyFluid::addState(const PolyFluid* src, const double flowRate)
         mPressure                      += mConstituents[i].mFluid.getPressure() *
                                           mConstituents[i].mMoleFraction;
     }
+    updateComposition();
 
     /// - And update the composite specific enthalpy and temperature
     mSpecificEnthalpy    = src->getSpecificEnthalpy() * srcFlowRate / mFlowRate +
@@ -1161,25 +1216,15 @@ double PolyFluid::computeTemperature(const double specificEnthalpy) const
     /// - Since the specific heat curve fit for each of the constituents is linear, the composite
     ///   temperature is the root of a quadratic equation whose coefficients are the mass
     ///   fraction weighted coefficients of the constituent curve fits and the composite specific
-    ///   enthalpy: a * x^2 + b * x - h.
-    double a        = 0.0;
-    double b        = 0.0;
-    for (int i = 0; i < mNConstituents; ++i) {
-        const double massFraction = mConstituents[i].mMassFraction;
-        if (fabs(massFraction) > DBL_EPSILON) {
-            const LinearFit* cpFit = dynamic_cast<const LinearFit*>(mConstituents[i].mFluid.
-                                                                    mProperties->mSpecificHeat);
-            a += massFraction * cpFit->getB(); // scale factor in linear curve fit
-            b += massFraction * cpFit->getA(); // bias in linear curve fit
-        }
-    };
-
-    /// - Specific Heat Cp = b + a * T.  Specific Enthalpy h = Cp * T = b * T + a * T^2.
-    ///   Quadratic: a * T^2 + b * T - h = 0.  Hence the 'c' term in the quadratic equation = -h,
-    ///   so -4ac = +4ah.
-    // Protect for square root of negative number
-    const double temp = std::max( (b * b + 4.0 * a * specificEnthalpy), 0.0);
-    return 0.5 * (-b + sqrt(temp)) / a;
+    ///   enthalpy, which the property engine solves from its packed coefficients.
+    double temperature;
+    if (not mPropertyCache.find(PolyFluidPropertyCache::TEMPERATURE, specificEnthalpy, 0.0,
+                                temperature)) {
+        temperature = mPropertyEngine.computeTemperature(specificEnthalpy, getMassFractionArray());
+        mPropertyCache.store(PolyFluidPropertyCache::TEMPERATURE, specificEnthalpy, 0.0,
+                             temperature);
+    }
+    return temperature;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1194,21 +1239,23 @@ double PolyFluid::computeTemperature(const double specificEnthalpy) const
 ///           constituent specific enthalpies) computed at the specified temperature and pressure.
 ///           The constituent and PolyFluid states are not updated.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-double PolyFluid::computeSpecificEnthalpy(const double temperature, const double pressure) const
+double PolyFluid::computeSpecificEnthalpy(const double temperature,
+                                          const double pressure __attribute__((unused))) const
 {
-    /// - Compute composite specific heat as the mass fraction weighted sum of the constituent
-    ///   specific heats.
-    double specificHeat = 0.0;
-    for (int i = 0; i < mNConstituents; ++i) {
-        const double massFraction = mConstituents[i].mMassFraction;
-        if (fabs(massFraction) > DBL_EPSILON) {
-            specificHeat += mConstituents[i].mFluid.mProperties->mSpecificHeat->get(temperature,
-                            pressure) * massFraction;
-        }
+    double specificEnthalpy;
+    if (not mPropertyCache.find(PolyFluidPropertyCache::SPECIFIC_ENTHALPY, temperature, 0.0,
+                                specificEnthalpy)) {
+        /// - Compute composite specific heat as the mass fraction weighted sum of the constituent
+        ///   specific heats, which are linear in temperature only.
+        const double specificHeat = mPropertyEngine.computeSpecificHeat(temperature,
+                                                                        getMassFractionArray());
+
+        /// - The composite specific enthalpy at the requested temperature and pressure.
+        specificEnthalpy = specificHeat * temperature;
+        mPropertyCache.store(PolyFluidPropertyCache::SPECIFIC_ENTHALPY, temperature, 0.0,
+                             specificEnthalpy);
     }
-
-    /// - Return the composite specific enthalpy at the requested temperature and pressure.
-    return specificHeat * temperature;
+    return specificEnthalpy;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1226,15 +1273,12 @@ double PolyFluid::computeSpecificEnthalpy(const double temperature, const double
 double PolyFluid::computePressure(const double temperature, const double density) const
 {
     /// - Compute composite pressure as the sum of the constituent pressures.
-    double pressure   = 0.0;
-    for (int i = 0; i < mNConstituents; ++i) {
-        const double massFraction = mConstituents[i].mMassFraction;
-        if (fabs(massFraction) > DBL_EPSILON) {
-            pressure += mConstituents[i].mFluid.computePressure(temperature,
-                                                                 density * massFraction);
-        }
+    double pressure;
+    if (not mPropertyCache.find(PolyFluidPropertyCache::PRESSURE, temperature, density,
+                                pressure)) {
+        pressure = mPropertyEngine.computePressure(temperature, density, getMassFractionArray());
+        mPropertyCache.store(PolyFluidPropertyCache::PRESSURE, temperature, density, pressure);
     }
-
     return pressure;
 }
 
@@ -1253,15 +1297,12 @@ double PolyFluid::computePressure(const double temperature, const double density
 double PolyFluid::computeDensity(const double temperature, const double pressure) const
 {
     /// - Compute composite density as the sum of the constituent densities.
-    double density = 0.0;
-    for (int i = 0; i < mNConstituents; ++i) {
-        const double moleFraction = mConstituents[i].mMoleFraction;
-        if (fabs(moleFraction) > DBL_EPSILON) {
-            density += mConstituents[i].mFluid.computeDensity(temperature,
-                                                               pressure * moleFraction);
-        }
+    double density;
+    if (not mPropertyCache.find(PolyFluidPropertyCache::DENSITY, temperature, pressure,
+                                density)) {
+        density = mPropertyEngine.computeDensity(temperature, pressure, getMoleFractionArray());
+        mPropertyCache.store(PolyFluidPropertyCache::DENSITY, temperature, pressure, density);
     }
-
     return density;
 }
 
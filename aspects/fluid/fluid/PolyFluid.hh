@@ -40,6 +40,7 @@ ASSUMPTIONS AND LIMITATIONS:
 
 #include "aspects/fluid/fluid/MonoFluid.hh"
 #include "aspects/fluid/fluid/GunnsFluidTraceCompounds.hh"
+#include "aspects/fluid/fluid/PolyFluidPropertyEngine.hh"
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -264,6 +265,10 @@ class PolyFluid
         double computeDensity(const double temperature, const double pressure = 0.0) const;
         /// @brief Deletes dynamic memory allocated by this PolyFluid
         void cleanup();
+        /// @brief Enables or disables the cache of computed mixture properties.
+        void setPropertyCacheEnabled(const bool enabled);
+        /// @brief Returns the cache of computed mixture properties, for its hit & miss counters.
+        const PolyFluidPropertyCache& getPropertyCache() const;
 
     protected:
         static const double FRACTION_TOLERANCE;   /**<    (--)                     Fraction normalization threshold */
@@ -287,10 +292,22 @@ class PolyFluid
         double              mAdiabaticIndex;      /**<    (--)                     Adiabatic index (gamma) of the fluid */
         GunnsFluidTraceCompounds* mTraceCompounds; /**<   (--)                     Trace compounds in the fluid. */
         bool                mInitFlag;            /**< *o (--) trick_chkpnt_io(**) Init status: T- if initialized and valid */
+        PolyFluidPropertyEngine mPropertyEngine;  /**< ** (--) trick_chkpnt_io(**) Packed constituent curve fits for mixture properties */
+        std::vector<double> mMassFractions;       /**< ** (--) trick_chkpnt_io(**) Constituent mass fractions in a contiguous array for the property engine */
+        std::vector<double> mMoleFractions;       /**< ** (--) trick_chkpnt_io(**) Constituent mole fractions in a contiguous array for the property engine */
+        mutable PolyFluidPropertyCache mPropertyCache; /**< (--) trick_chkpnt_io(**) Recent computed mixture properties */
         /// @brief Validates this PolyFluid Model initial state.
         void validate();
         /// @brief Computes this PolyFluid derived state and properties.
         void derive();
+        /// @brief Initializes the property engine from the constituent properties.
+        void initializePropertyEngine();
+        /// @brief Updates the contiguous constituent fractions and the property cache revision.
+        void updateComposition();
+        /// @brief Returns the constituent mass fractions in a contiguous array.
+        const double* getMassFractionArray() const;
+        /// @brief Returns the constituent mole fractions in a contiguous array.
+        const double* getMoleFractionArray() const;
     private:
         /// @details The assignment operator is unavailable since it is declared private and not
         ///          implemented.
@@ -608,4 +625,49 @@ inline void PolyFluid::setMole(const double mole)
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]   enabled  (--)  True to enable the cache.
+///
+/// @return   void
+///
+/// @details  Enables or disables the cache of the results of the compute methods.  The cache isn't
+///           thread-safe, so it must not be enabled for a fluid whose compute methods may be called
+///           from more than one thread at once.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void PolyFluid::setPropertyCacheEnabled(const bool enabled)
+{
+    mPropertyCache.setEnabled(enabled);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   PolyFluidPropertyCache& (--) The cache of computed mixture properties.
+///
+/// @details  Returns a reference to the cache of the results of the compute methods, for access to
+///           its hit & miss counters.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const PolyFluidPropertyCache& PolyFluid::getPropertyCache() const
+{
+    return mPropertyCache;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   const double* (--) Pointer to the constituent mass fractions, or null if none.
+///
+/// @details  Returns the contiguous array of constituent mass fractions kept by updateComposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const double* PolyFluid::getMassFractionArray() const
+{
+    return mMassFractions.empty() ? 0 : &mMassFractions[0];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   const double* (--) Pointer to the constituent mole fractions, or null if none.
+///
+/// @details  Returns the contiguous array of constituent mole fractions kept by updateComposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const double* PolyFluid::getMoleFractionArray() const
+{
+    return mMoleFractions.empty() ? 0 : &mMoleFractions[0];
+}
+
 #endif
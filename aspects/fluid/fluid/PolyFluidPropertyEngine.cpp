@@ -0,0 +1,482 @@
+/*
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+ (Provides the classes for evaluating PolyFluid mixture properties from packed curve fits, and for
+  caching recent results.)
+
+REQUIREMENTS:
+ ()
+
+REFERENCE:
+ ()
+
+ASSUMPTIONS AND LIMITATIONS:
+ ()
+
+ LIBRARY DEPENDENCY:
+ (
+  (math/approximation/LinearFit.o)
+  (math/approximation/ProductFit.o)
+  (math/approximation/QuadLinFit.o)
+  (math/approximation/QuadLinInvFit.o)
+  (math/approximation/QuotientFit.o)
+  (properties/FluidProperties.o)
+ )
+
+ PROGRAMMERS:
+ ((agent) (agent@local) (2026-10) (Initial))
+
+*/
+
+#include <cmath>
+#include <cfloat>
+#include <sstream>
+
+#include "math/MsMath.hh"
+#include "math/approximation/LinearFit.hh"
+#include "math/approximation/ProductFit.hh"
+#include "math/approximation/QuadLinFit.hh"
+#include "math/approximation/QuadLinInvFit.hh"
+#include "math/approximation/QuotientFit.hh"
+#include "simulation/hs/TsHsMsg.hh"
+#include "software/exceptions/TsHsException.hh"
+#include "software/exceptions/TsInitializationException.hh"
+
+#include "PolyFluidPropertyEngine.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this PolyFluid Property Engine Fit Group, empty.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PolyFluidPropertyFitGroup::PolyFluidPropertyFitGroup()
+    :
+    mIndex(),
+    mMinX(),
+    mMaxX(),
+    mMinY(),
+    mMaxY(),
+    mA(),
+    mB(),
+    mC(),
+    mD(),
+    mE(),
+    mF(),
+    mFit()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this PolyFluid Property Engine Fit Group.  The fits are not owned.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PolyFluidPropertyFitGroup::~PolyFluidPropertyFitGroup()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Removes all fits from this group.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void PolyFluidPropertyFitGroup::clear()
+{
+    mIndex.clear();
+    mMinX.clear();
+    mMaxX.clear();
+    mMinY.clear();
+    mMaxY.clear();
+    mA.clear();
+    mB.clear();
+    mC.clear();
+    mD.clear();
+    mE.clear();
+    mF.clear();
+    mFit.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  index  (--)  Index of the constituent.
+/// @param[in]  fit    (--)  Pointer to the constituent's curve fit.
+/// @param[in]  a      (--)  First coefficient of the fit.
+/// @param[in]  b      (--)  Second coefficient of the fit.
+/// @param[in]  c      (--)  Third coefficient of the fit.
+/// @param[in]  d      (--)  Fourth coefficient of the fit.
+/// @param[in]  e      (--)  Fifth coefficient of the fit.
+/// @param[in]  f      (--)  Sixth coefficient of the fit.
+///
+/// @details  Appends the constituent's fit, its valid ranges and coefficients to this group.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void PolyFluidPropertyFitGroup::add(const int index, TsApproximation* fit, const double a,
+                                    const double b, const double c, const double d,
+                                    const double e, const double f)
+{
+    mIndex.push_back(index);
+    mMinX.push_back(fit->getMinX());
+    mMaxX.push_back(fit->getMaxX());
+    mMinY.push_back(fit->getMinY());
+    mMaxY.push_back(fit->getMaxY());
+    mA.push_back(a);
+    mB.push_back(b);
+    mC.push_back(c);
+    mD.push_back(d);
+    mE.push_back(e);
+    mF.push_back(f);
+    mFit.push_back(fit);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this PolyFluid Property Engine, uninitialized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PolyFluidPropertyEngine::PolyFluidPropertyEngine()
+    :
+    mName(),
+    mNConstituents(0),
+    mCpA(),
+    mCpB(),
+    mCpMinT(),
+    mCpMaxT(),
+    mDensityGas(),
+    mDensityLiquid(),
+    mDensityOther(),
+    mPressureGas(),
+    mPressureLiquid(),
+    mPressureOther(),
+    mDensityKind(),
+    mDensitySlot(),
+    mPressureKind(),
+    mPressureSlot(),
+    mInitFlag(false)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this PolyFluid Property Engine.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PolyFluidPropertyEngine::~PolyFluidPropertyEngine()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  properties     (--)  Array of pointers to the constituent fluid properties.
+/// @param[in]  nConstituents  (--)  Number of constituents.
+/// @param[in]  name           (--)  Instance name for messages.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Classifies each constituent's curve fits by kind and packs their ranges and
+///           coefficients into the fit groups.  The classification uses RTTI once, here, so that
+///           evaluation doesn't need it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void PolyFluidPropertyEngine::initialize(const FluidProperties* const* properties,
+                                         const int nConstituents, const std::string& name)
+{
+    mName          = name;
+    mInitFlag      = false;
+    mNConstituents = 0;
+    mCpA.clear();
+    mCpB.clear();
+    mCpMinT.clear();
+    mCpMaxT.clear();
+    mDensityGas.clear();
+    mDensityLiquid.clear();
+    mDensityOther.clear();
+    mPressureGas.clear();
+    mPressureLiquid.clear();
+    mPressureOther.clear();
+    mDensityKind.clear();
+    mDensitySlot.clear();
+    mPressureKind.clear();
+    mPressureSlot.clear();
+
+    for (int i = 0; i < nConstituents; ++i) {
+        const FluidProperties* fluid = properties[i];
+        if (0 == fluid or 0 == fluid->mSpecificHeat or 0 == fluid->mDensity
+                or 0 == fluid->mPressure) {
+            TS_HS_EXCEPTION(TS_HS_ERROR, "GUNNS", "Missing constituent fluid properties.",
+                            TsInitializationException, "Invalid Configuration Data", mName);
+        }
+
+        /// - Specific heat is a linear fit in temperature, which computeTemperature relies on.
+        const LinearFit* cp = dynamic_cast<const LinearFit*>(fluid->mSpecificHeat);
+        if (0 == cp) {
+            std::ostringstream msg;
+            msg << "Specific heat of constituent " << i << " is not a linear curve fit.";
+            TS_HS_EXCEPTION(TS_HS_ERROR, "GUNNS", msg.str(),
+                            TsInitializationException, "Invalid Configuration Data", mName);
+        }
+        mCpA.push_back(cp->getA());
+        mCpB.push_back(cp->getB());
+        mCpMinT.push_back(cp->getMinX());
+        mCpMaxT.push_back(cp->getMaxX());
+
+        TsApproximation*     density = fluid->mDensity;
+        const QuotientFit*   gasRho  = dynamic_cast<const QuotientFit*>(density);
+        const QuadLinFit*    liqRho  = dynamic_cast<const QuadLinFit*>(density);
+        if (gasRho) {
+            mDensityKind.push_back(IDEAL_GAS);
+            mDensitySlot.push_back(mDensityGas.size());
+            mDensityGas.add(i, density, gasRho->getA());
+        } else if (liqRho) {
+            mDensityKind.push_back(LIQUID);
+            mDensitySlot.push_back(mDensityLiquid.size());
+            mDensityLiquid.add(i, density, liqRho->getA(), liqRho->getB(), liqRho->getC(),
+                               liqRho->getD(), liqRho->getE(), liqRho->getF());
+        } else {
+            mDensityKind.push_back(OTHER);
+            mDensitySlot.push_back(mDensityOther.size());
+            mDensityOther.add(i, density);
+        }
+
+        TsApproximation*     pressure = fluid->mPressure;
+        const ProductFit*    gasP     = dynamic_cast<const ProductFit*>(pressure);
+        const QuadLinInvFit* liqP     = dynamic_cast<const QuadLinInvFit*>(pressure);
+        if (gasP) {
+            mPressureKind.push_back(IDEAL_GAS);
+            mPressureSlot.push_back(mPressureGas.size());
+            mPressureGas.add(i, pressure, gasP->getA());
+        } else if (liqP) {
+            mPressureKind.push_back(LIQUID);
+            mPressureSlot.push_back(mPressureLiquid.size());
+            mPressureLiquid.add(i, pressure, liqP->getA(), liqP->getB(), liqP->getC(),
+                                liqP->getD(), liqP->getE(), liqP->getF());
+        } else {
+            mPressureKind.push_back(OTHER);
+            mPressureSlot.push_back(mPressureOther.size());
+            mPressureOther.add(i, pressure);
+        }
+        ++mNConstituents;
+    }
+
+    mInitFlag = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  temperature    (K)   Temperature to compute specific heat at.
+/// @param[in]  massFractions  (--)  Constituent mass fractions.
+///
+/// @returns  double  (J/kg/K)  Mass fraction weighted sum of the constituent specific heats.
+///
+/// @details  Evaluates the linear specific heat fits of the constituents with non-negligible
+///           fractions, with the temperature bounded to each fit's range, summed in constituent
+///           order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double PolyFluidPropertyEngine::computeSpecificHeat(const double  temperature,
+                                                    const double* massFractions) const
+{
+    double sum = 0.0;
+    for (int i = 0; i < mNConstituents; ++i) {
+        if (std::fabs(massFractions[i]) > DBL_EPSILON) {
+            const double t = MsMath::limitRange(mCpMinT[i], temperature, mCpMaxT[i]);
+            sum += (mCpA[i] + mCpB[i] * t) * massFractions[i];
+        }
+    }
+    return sum;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  specificEnthalpy  (J/kg)  Specific enthalpy to compute temperature at.
+/// @param[in]  massFractions     (--)    Constituent mass fractions.
+///
+/// @returns  double  (K)  Mixture temperature at the specific enthalpy.
+///
+/// @details  With linear specific heats Cp = b + a * T, specific enthalpy h = Cp * T is quadratic
+///           in T, with coefficients the mass fraction weighted sums of the constituent
+///           coefficients, and T is its positive root.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double PolyFluidPropertyEngine::computeTemperature(const double  specificEnthalpy,
+                                                   const double* massFractions) const
+{
+    double a = 0.0;
+    double b = 0.0;
+    for (int i = 0; i < mNConstituents; ++i) {
+        const double massFraction = massFractions[i];
+        if (std::fabs(massFraction) > DBL_EPSILON) {
+            a += massFraction * mCpB[i];
+            b += massFraction * mCpA[i];
+        }
+    }
+
+    /// - Protect for square root of negative number.
+    const double temp = std::max( (b * b + 4.0 * a * specificEnthalpy), 0.0);
+    return 0.5 * (-b + std::sqrt(temp)) / a;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  temperature    (K)    Temperature to compute density at.
+/// @param[in]  pressure       (kPa)  Pressure to compute density at.
+/// @param[in]  moleFractions  (--)   Constituent mole fractions.
+///
+/// @returns  double  (kg/m3)  Sum of the constituent densities at their partial pressures.
+///
+/// @details  Evaluates the density fits of the constituents with non-negligible fractions at the
+///           temperature and their partial pressures, bounded to each fit's range, summed in
+///           constituent order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double PolyFluidPropertyEngine::computeDensity(const double  temperature,
+                                               const double  pressure,
+                                               const double* moleFractions) const
+{
+    double sum = 0.0;
+    for (int i = 0; i < mNConstituents; ++i) {
+        const double moleFraction = moleFractions[i];
+        if (std::fabs(moleFraction) > DBL_EPSILON) {
+            const int j = mDensitySlot[i];
+            switch (mDensityKind[i]) {
+                case IDEAL_GAS: {
+                    /// - Ideal gas: a * p / T.
+                    const PolyFluidPropertyFitGroup& fit = mDensityGas;
+                    const double t = MsMath::limitRange(fit.mMinX[j], temperature, fit.mMaxX[j]);
+                    const double p = MsMath::limitRange(fit.mMinY[j], pressure * moleFraction,
+                                                        fit.mMaxY[j]);
+                    sum += fit.mA[j] * p / t;
+                    break;
+                }
+                case LIQUID: {
+                    /// - Liquid: (a + b * p) + ((c + d * p) + (e + f * p) * T) * T.
+                    const PolyFluidPropertyFitGroup& fit = mDensityLiquid;
+                    const double t = MsMath::limitRange(fit.mMinX[j], temperature, fit.mMaxX[j]);
+                    const double p = MsMath::limitRange(fit.mMinY[j], pressure * moleFraction,
+                                                        fit.mMaxY[j]);
+                    sum += (fit.mA[j] + fit.mB[j] * p)
+                         + ((fit.mC[j] + fit.mD[j] * p) + (fit.mE[j] + fit.mF[j] * p) * t) * t;
+                    break;
+                }
+                default:
+                    /// - Other fits, such as tables.
+                    sum += mDensityOther.mFit[j]->get(temperature, pressure * moleFraction);
+                    break;
+            }
+        }
+    }
+    return sum;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  temperature    (K)      Temperature to compute pressure at.
+/// @param[in]  density        (kg/m3)  Density to compute pressure at.
+/// @param[in]  massFractions  (--)     Constituent mass fractions.
+///
+/// @returns  double  (kPa)  Sum of the constituent pressures at their partial densities.
+///
+/// @details  Evaluates the pressure fits of the constituents with non-negligible fractions at the
+///           temperature and their partial densities, bounded to each fit's range, summed in
+///           constituent order.  Each constituent's pressure is bounded below by DBL_EPSILON, as in
+///           FluidProperties::getPressure.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double PolyFluidPropertyEngine::computePressure(const double  temperature,
+                                                const double  density,
+                                                const double* massFractions) const
+{
+    double sum = 0.0;
+    for (int i = 0; i < mNConstituents; ++i) {
+        const double massFraction = massFractions[i];
+        if (std::fabs(massFraction) > DBL_EPSILON) {
+            const int j = mPressureSlot[i];
+            double    p = 0.0;
+            switch (mPressureKind[i]) {
+                case IDEAL_GAS: {
+                    /// - Ideal gas: a * T * rho.
+                    const PolyFluidPropertyFitGroup& fit = mPressureGas;
+                    const double t   = MsMath::limitRange(fit.mMinX[j], temperature, fit.mMaxX[j]);
+                    const double rho = MsMath::limitRange(fit.mMinY[j], density * massFraction,
+                                                          fit.mMaxY[j]);
+                    p = fit.mA[j] * t * rho;
+                    break;
+                }
+                case LIQUID: {
+                    /// - Liquid: (rho - a - (c + e * T) * T) / (b + (d + f * T) * T).
+                    const PolyFluidPropertyFitGroup& fit = mPressureLiquid;
+                    const double t   = MsMath::limitRange(fit.mMinX[j], temperature, fit.mMaxX[j]);
+                    const double rho = MsMath::limitRange(fit.mMinY[j], density * massFraction,
+                                                          fit.mMaxY[j]);
+                    p = (rho - fit.mA[j] - (fit.mC[j] + fit.mE[j] * t) * t)
+                      / (fit.mB[j] + (fit.mD[j] + fit.mF[j] * t) * t);
+                    break;
+                }
+                default:
+                    /// - Other fits, such as tables.
+                    p = mPressureOther.mFit[j]->get(temperature, density * massFraction);
+                    break;
+            }
+            sum += (p < DBL_EPSILON) ? DBL_EPSILON : p;
+        }
+    }
+    return sum;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this PolyFluid Property Cache, empty and disabled.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PolyFluidPropertyCache::PolyFluidPropertyCache()
+    :
+    mEnabled(false),
+    mRevision(1)
+{
+    clearEntries();
+    resetCounters();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this PolyFluid Property Cache.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+PolyFluidPropertyCache::~PolyFluidPropertyCache()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  enabled  (--)  True to enable this cache.
+///
+/// @details  Enables or disables this cache.  Either way the entries are invalidated, since they
+///           aren't kept up to date while disabled.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void PolyFluidPropertyCache::setEnabled(const bool enabled)
+{
+    mEnabled = enabled;
+    invalidate();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   double (--) Fraction of lookups of all properties that hit, zero if none.
+///
+/// @details  Returns the total hits over the total hits & misses of all properties.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double PolyFluidPropertyCache::getHitRate() const
+{
+    double hits    = 0.0;
+    double lookups = 0.0;
+    for (int i = 0; i < NUM_PROPERTIES; ++i) {
+        hits    += static_cast<double>(mHits[i]);
+        lookups += static_cast<double>(mHits[i] + mMisses[i]);
+    }
+    return (lookups > 0.0) ? hits / lookups : 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Zeroes the hit & miss counters of all properties.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void PolyFluidPropertyCache::resetCounters()
+{
+    for (int i = 0; i < NUM_PROPERTIES; ++i) {
+        mHits[i]   = 0;
+        mMisses[i] = 0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Empties all entries by zeroing their revisions, which the current revision never is.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void PolyFluidPropertyCache::clearEntries()
+{
+    for (int i = 0; i < NUM_PROPERTIES; ++i) {
+        for (int j = 0; j < NUM_ENTRIES; ++j) {
+            mEntryRevision[i][j] = 0;
+            mEntryX[i][j]        = 0.0;
+            mEntryY[i][j]        = 0.0;
+            mEntryValue[i][j]    = 0.0;
+        }
+        mNextEntry[i] = 0;
+    }
+}
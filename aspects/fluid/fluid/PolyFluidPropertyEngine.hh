@@ -0,0 +1,387 @@
+#ifndef PolyFluidPropertyEngine_EXISTS
+#define PolyFluidPropertyEngine_EXISTS
+
+/**
+@defgroup  TSM_GUNNS_FLUID_FLUID_POLY_FLUID_PROPERTY_ENGINE PolyFluid Property Engine
+@ingroup   TSM_GUNNS_FLUID_FLUID
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Provides the classes for evaluating the mixture properties of a PolyFluid from the curve fit
+   coefficients of its constituents, packed into contiguous arrays when the PolyFluid is
+   initialized, without a virtual call per constituent, and for caching recent results.)
+
+REQUIREMENTS:
+- ()
+
+REFERENCE:
+- ()
+
+ASSUMPTIONS AND LIMITATIONS:
+- ((The specific heat of every constituent is a linear curve fit in temperature, as PolyFluid
+    computeTemperature already assumes.)
+   (Density and pressure fits other than the ideal gas and liquid curve fits, such as the real-gas
+    tables, are evaluated by their virtual get method.)
+   (Results are identical to the constituent-by-constituent evaluation, since each constituent's
+    value is computed the same way and summed in the same order.)
+   (The property cache is not thread-safe, since finding and storing results writes to it.))
+
+ LIBRARY DEPENDENCY:
+- ((PolyFluidPropertyEngine.o))
+
+ PROGRAMMERS:
+- ((agent) (agent@local) (2026-10) (Initial))
+
+@{
+*/
+
+#include "properties/FluidProperties.hh"
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    PolyFluid Property Engine Fit Group
+///
+/// @details  Holds the ranges and coefficients of one kind of bivariate curve fit for some of the
+///           constituents, in structure-of-arrays form, indexed by position in the group.  The
+///           fits that aren't packed keep their pointer in mFit for evaluation by virtual call.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class PolyFluidPropertyFitGroup
+{
+    public:
+        std::vector<int>              mIndex; /**< ** (--) trick_chkpnt_io(**) Constituent index of each fit. */
+        std::vector<double>           mMinX;  /**< ** (--) trick_chkpnt_io(**) Lower limit of the first variable of each fit. */
+        std::vector<double>           mMaxX;  /**< ** (--) trick_chkpnt_io(**) Upper limit of the first variable of each fit. */
+        std::vector<double>           mMinY;  /**< ** (--) trick_chkpnt_io(**) Lower limit of the second variable of each fit. */
+        std::vector<double>           mMaxY;  /**< ** (--) trick_chkpnt_io(**) Upper limit of the second variable of each fit. */
+        std::vector<double>           mA;     /**< ** (--) trick_chkpnt_io(**) First coefficient of each fit. */
+        std::vector<double>           mB;     /**< ** (--) trick_chkpnt_io(**) Second coefficient of each fit. */
+        std::vector<double>           mC;     /**< ** (--) trick_chkpnt_io(**) Third coefficient of each fit. */
+        std::vector<double>           mD;     /**< ** (--) trick_chkpnt_io(**) Fourth coefficient of each fit. */
+        std::vector<double>           mE;     /**< ** (--) trick_chkpnt_io(**) Fifth coefficient of each fit. */
+        std::vector<double>           mF;     /**< ** (--) trick_chkpnt_io(**) Sixth coefficient of each fit. */
+        std::vector<TsApproximation*> mFit;   /**< ** (--) trick_chkpnt_io(**) Pointer to each fit. */
+        /// @brief Default constructs this fit group.
+        PolyFluidPropertyFitGroup();
+        /// @brief Default destructs this fit group.
+        virtual ~PolyFluidPropertyFitGroup();
+        /// @brief Removes all fits from this group.
+        void clear();
+        /// @brief Adds a constituent's fit and its coefficients to this group.
+        void add(const int index, TsApproximation* fit, const double a = 0.0, const double b = 0.0,
+                 const double c = 0.0, const double d = 0.0, const double e = 0.0,
+                 const double f = 0.0);
+        /// @brief Returns the number of fits in this group.
+        int  size() const;
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        PolyFluidPropertyFitGroup(const PolyFluidPropertyFitGroup&);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        PolyFluidPropertyFitGroup& operator =(const PolyFluidPropertyFitGroup&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    PolyFluid Property Engine
+///
+/// @details  Evaluates the mixture specific heat, temperature, density and pressure of a PolyFluid
+///           for given constituent mass or mole fractions.  At initialization, each constituent's
+///           specific heat, density and pressure curve fits are classified by kind and their
+///           coefficients copied into a fit group of that kind:
+///           - density: ideal gas QuotientFit, liquid QuadLinFit, or other (by virtual call),
+///           - pressure: ideal gas ProductFit, liquid QuadLinInvFit, or other (by virtual call).
+///
+///           Each constituent also records the kind of its fits and their position in the group.
+///           Evaluation walks the constituents in order, skips those with negligible fractions, and
+///           evaluates the rest from their packed coefficients with no virtual dispatch or RTTI,
+///           so the results equal the constituent-by-constituent evaluation exactly.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class PolyFluidPropertyEngine
+{
+    TS_MAKE_SIM_COMPATIBLE(PolyFluidPropertyEngine);
+    public:
+        /// @brief Enumeration of the kinds of density & pressure curve fits.
+        enum FitKind {
+            IDEAL_GAS = 0, ///< Ideal gas QuotientFit density or ProductFit pressure.
+            LIQUID    = 1, ///< Liquid QuadLinFit density or QuadLinInvFit pressure.
+            OTHER     = 2  ///< Any other fit, evaluated by virtual call.
+        };
+        /// @brief Default constructs this PolyFluid Property Engine.
+        PolyFluidPropertyEngine();
+        /// @brief Default destructs this PolyFluid Property Engine.
+        virtual ~PolyFluidPropertyEngine();
+        /// @brief Initializes this PolyFluid Property Engine from the constituent properties.
+        void   initialize(const FluidProperties* const* properties, const int nConstituents,
+                          const std::string& name);
+        /// @brief Returns whether this PolyFluid Property Engine is initialized.
+        bool   isInitialized() const;
+        /// @brief Returns the number of constituents.
+        int    getNConstituents() const;
+        /// @brief Returns the number of density & pressure fits evaluated by virtual call.
+        int    getNumVirtualFits() const;
+        /// @brief Returns the mixture specific heat at the given temperature.
+        double computeSpecificHeat(const double temperature, const double* massFractions) const;
+        /// @brief Returns the mixture temperature at the given specific enthalpy.
+        double computeTemperature(const double specificEnthalpy, const double* massFractions) const;
+        /// @brief Returns the mixture density at the given temperature and pressure.
+        double computeDensity(const double temperature, const double pressure,
+                              const double* moleFractions) const;
+        /// @brief Returns the mixture pressure at the given temperature and density.
+        double computePressure(const double temperature, const double density,
+                               const double* massFractions) const;
+
+    protected:
+        std::string               mName;             /**< *o (--) trick_chkpnt_io(**) Instance name for messages. */
+        int                       mNConstituents;    /**<    (--) trick_chkpnt_io(**) Number of constituents. */
+        std::vector<double>       mCpA;              /**< ** (--) trick_chkpnt_io(**) Specific heat bias coefficient of each constituent. */
+        std::vector<double>       mCpB;              /**< ** (--) trick_chkpnt_io(**) Specific heat scale coefficient of each constituent. */
+        std::vector<double>       mCpMinT;           /**< ** (K)  trick_chkpnt_io(**) Specific heat lower temperature limit of each constituent. */
+        std::vector<double>       mCpMaxT;           /**< ** (K)  trick_chkpnt_io(**) Specific heat upper temperature limit of each constituent. */
+        PolyFluidPropertyFitGroup mDensityGas;       /**< ** (--) trick_chkpnt_io(**) Ideal gas density fits, a * p / T. */
+        PolyFluidPropertyFitGroup mDensityLiquid;    /**< ** (--) trick_chkpnt_io(**) Liquid density fits, quadratic in T and linear in p. */
+        PolyFluidPropertyFitGroup mDensityOther;     /**< ** (--) trick_chkpnt_io(**) Other density fits, evaluated by virtual call. */
+        PolyFluidPropertyFitGroup mPressureGas;      /**< ** (--) trick_chkpnt_io(**) Ideal gas pressure fits, a * T * rho. */
+        PolyFluidPropertyFitGroup mPressureLiquid;   /**< ** (--) trick_chkpnt_io(**) Liquid pressure fits, the inverse of the liquid density fits. */
+        PolyFluidPropertyFitGroup mPressureOther;    /**< ** (--) trick_chkpnt_io(**) Other pressure fits, evaluated by virtual call. */
+        std::vector<FitKind>      mDensityKind;      /**< ** (--) trick_chkpnt_io(**) Kind of density fit of each constituent. */
+        std::vector<int>          mDensitySlot;      /**< ** (--) trick_chkpnt_io(**) Position of each constituent's density fit in its group. */
+        std::vector<FitKind>      mPressureKind;     /**< ** (--) trick_chkpnt_io(**) Kind of pressure fit of each constituent. */
+        std::vector<int>          mPressureSlot;     /**< ** (--) trick_chkpnt_io(**) Position of each constituent's pressure fit in its group. */
+        bool                      mInitFlag;         /**< *o (--) trick_chkpnt_io(**) Initialization complete flag. */
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        PolyFluidPropertyEngine(const PolyFluidPropertyEngine&);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        PolyFluidPropertyEngine& operator =(const PolyFluidPropertyEngine&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    PolyFluid Property Cache
+///
+/// @details  Remembers the last few results of each of the PolyFluid computed mixture properties,
+///           keyed on the exact arguments they were computed at and the composition revision they
+///           were computed for.  The owner advances the revision whenever its composition changes,
+///           which invalidates all entries at once.  Results are only returned for exactly equal
+///           arguments, so a hit returns the same value that computing would.
+///
+///           Entries are replaced round-robin.  The hits & misses of each property are counted for
+///           tuning.  The cache is disabled by default, and it is not thread-safe: an owner whose
+///           compute methods can be called from more than one thread at once must not enable it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class PolyFluidPropertyCache
+{
+    TS_MAKE_SIM_COMPATIBLE(PolyFluidPropertyCache);
+    public:
+        /// @brief Enumeration of the cached properties.
+        enum Property {
+            DENSITY           = 0, ///< Density at temperature & pressure.
+            PRESSURE          = 1, ///< Pressure at temperature & density.
+            SPECIFIC_ENTHALPY = 2, ///< Specific enthalpy at temperature.
+            TEMPERATURE       = 3, ///< Temperature at specific enthalpy.
+            NUM_PROPERTIES    = 4  ///< Number of cached properties.
+        };
+        /// @brief Number of entries cached for each property.
+        static const int NUM_ENTRIES = 4;
+        /// @brief Default constructs this PolyFluid Property Cache.
+        PolyFluidPropertyCache();
+        /// @brief Default destructs this PolyFluid Property Cache.
+        virtual ~PolyFluidPropertyCache();
+        /// @brief Enables or disables this cache, invalidating it.
+        void          setEnabled(const bool enabled);
+        /// @brief Returns whether this cache is enabled.
+        bool          isEnabled() const;
+        /// @brief Advances the composition revision, invalidating all entries.
+        void          invalidate();
+        /// @brief Returns the current composition revision.
+        unsigned int  getRevision() const;
+        /// @brief Finds a cached result at the given arguments.
+        bool          find(const Property property, const double x, const double y, double& value);
+        /// @brief Stores a result at the given arguments.
+        void          store(const Property property, const double x, const double y,
+                            const double value);
+        /// @brief Returns the number of hits of the given property.
+        unsigned long getHits(const Property property) const;
+        /// @brief Returns the number of misses of the given property.
+        unsigned long getMisses(const Property property) const;
+        /// @brief Returns the fraction of lookups of all properties that hit.
+        double        getHitRate() const;
+        /// @brief Zeroes the hit & miss counters.
+        void          resetCounters();
+
+    protected:
+        bool          mEnabled;                                 /**<    (--) trick_chkpnt_io(**) Cache is enabled. */
+        unsigned int  mRevision;                                /**< ** (--) trick_chkpnt_io(**) Current composition revision. */
+        unsigned int  mEntryRevision[NUM_PROPERTIES][NUM_ENTRIES]; /**< ** (--) trick_chkpnt_io(**) Composition revision of each entry, zero if empty. */
+        double        mEntryX[NUM_PROPERTIES][NUM_ENTRIES];     /**< ** (--) trick_chkpnt_io(**) First argument of each entry. */
+        double        mEntryY[NUM_PROPERTIES][NUM_ENTRIES];     /**< ** (--) trick_chkpnt_io(**) Second argument of each entry. */
+        double        mEntryValue[NUM_PROPERTIES][NUM_ENTRIES]; /**< ** (--) trick_chkpnt_io(**) Result of each entry. */
+        int           mNextEntry[NUM_PROPERTIES];               /**< ** (--) trick_chkpnt_io(**) Next entry of each property to replace. */
+        unsigned long mHits[NUM_PROPERTIES];                    /**<    (--) trick_chkpnt_io(**) Number of hits of each property. */
+        unsigned long mMisses[NUM_PROPERTIES];                  /**<    (--) trick_chkpnt_io(**) Number of misses of each property. */
+        /// @brief Empties all entries.
+        void clearEntries();
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        PolyFluidPropertyCache(const PolyFluidPropertyCache&);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        PolyFluidPropertyCache& operator =(const PolyFluidPropertyCache&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   int (--) Number of fits in this group.
+///
+/// @details  Returns the size of the constituent index array.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int PolyFluidPropertyFitGroup::size() const
+{
+    return static_cast<int>(mIndex.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   bool (--) True if this PolyFluid Property Engine is initialized.
+///
+/// @details  Returns mInitFlag.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool PolyFluidPropertyEngine::isInitialized() const
+{
+    return mInitFlag;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   int (--) Number of constituents.
+///
+/// @details  Returns mNConstituents.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int PolyFluidPropertyEngine::getNConstituents() const
+{
+    return mNConstituents;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   int (--) Number of density & pressure fits evaluated by virtual call.
+///
+/// @details  Returns the sizes of the other density & pressure fit groups, which hold fits the
+///           engine doesn't pack, such as the real-gas tables.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int PolyFluidPropertyEngine::getNumVirtualFits() const
+{
+    return mDensityOther.size() + mPressureOther.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   bool (--) True if this cache is enabled.
+///
+/// @details  Returns mEnabled.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool PolyFluidPropertyCache::isEnabled() const
+{
+    return mEnabled;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   unsigned int (--) Current composition revision.
+///
+/// @details  Returns mRevision.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned int PolyFluidPropertyCache::getRevision() const
+{
+    return mRevision;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Advances the composition revision, so that no entry matches it.  When the revision
+///           wraps around, the entries are emptied so that none can match it again.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void PolyFluidPropertyCache::invalidate()
+{
+    if (0 == ++mRevision) {
+        clearEntries();
+        mRevision = 1;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  property  (--)  The property to find.
+/// @param[in]  x         (--)  First argument the property is computed at.
+/// @param[in]  y         (--)  Second argument the property is computed at, or zero.
+/// @param[out] value     (--)  The cached result, if found.
+///
+/// @return   bool (--) True if a result at exactly these arguments and the current revision is
+///                     cached.
+///
+/// @details  Searches the property's entries and counts the hit or miss.  Always misses, without
+///           counting, when disabled.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool PolyFluidPropertyCache::find(const Property property, const double x, const double y,
+                                         double& value)
+{
+    if (not mEnabled) {
+        return false;
+    }
+    for (int i = 0; i < NUM_ENTRIES; ++i) {
+        if (mRevision == mEntryRevision[property][i] and x == mEntryX[property][i]
+                and y == mEntryY[property][i]) {
+            value = mEntryValue[property][i];
+            ++mHits[property];
+            return true;
+        }
+    }
+    ++mMisses[property];
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  property  (--)  The property to store.
+/// @param[in]  x         (--)  First argument the property was computed at.
+/// @param[in]  y         (--)  Second argument the property was computed at, or zero.
+/// @param[in]  value     (--)  The computed result.
+///
+/// @details  Replaces the property's oldest entry with this result at the current revision.  Does
+///           nothing when disabled.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void PolyFluidPropertyCache::store(const Property property, const double x, const double y,
+                                          const double value)
+{
+    if (mEnabled) {
+        const int i = mNextEntry[property];
+        mEntryRevision[property][i] = mRevision;
+        mEntryX[property][i]        = x;
+        mEntryY[property][i]        = y;
+        mEntryValue[property][i]    = value;
+        mNextEntry[property]        = (i + 1) % NUM_ENTRIES;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  property  (--)  The property.
+///
+/// @return   unsigned long (--) Number of hits of the property.
+///
+/// @details  Returns the property's hit counter.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long PolyFluidPropertyCache::getHits(const Property property) const
+{
+    return mHits[property];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  property  (--)  The property.
+///
+/// @return   unsigned long (--) Number of misses of the property.
+///
+/// @details  Returns the property's miss counter.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long PolyFluidPropertyCache::getMisses(const Property property) const
+{
+    return mMisses[property];
+}
+
+#endif
@@ -2666,6 +2666,75 @@ void UtPolyFluid::testFractionNormalization()
     UT_PASS;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for the computed property cache.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtPolyFluid::testPropertyCache()
+{
+    UT_RESULT;
+
+    /// @test    The cache is disabled by default and doesn't count lookups.
+    const PolyFluidPropertyCache& cache = mArticle1->getPropertyCache();
+    CPPUNIT_ASSERT(false == cache.isEnabled());
+    const double density = mArticle1->computeDensity(mTemperature, mPressure);
+    CPPUNIT_ASSERT(0     == cache.getMisses(PolyFluidPropertyCache::DENSITY));
+
+    /// @test    Repeated computations at the same arguments hit and return the same results.
+    mArticle1->setPropertyCacheEnabled(true);
+    CPPUNIT_ASSERT(true  == cache.isEnabled());
+    CPPUNIT_ASSERT_EQUAL(density, mArticle1->computeDensity(mTemperature, mPressure));
+    CPPUNIT_ASSERT_EQUAL(density, mArticle1->computeDensity(mTemperature, mPressure));
+    CPPUNIT_ASSERT(1     == cache.getMisses(PolyFluidPropertyCache::DENSITY));
+    CPPUNIT_ASSERT(1     == cache.getHits(PolyFluidPropertyCache::DENSITY));
+    const double pressure    = mArticle1->computePressure(mTemperature, density);
+    const double enthalpy    = mArticle1->computeSpecificEnthalpy(mTemperature);
+    const double temperature = mArticle1->computeTemperature(enthalpy);
+    CPPUNIT_ASSERT_EQUAL(pressure,    mArticle1->computePressure(mTemperature, density));
+    CPPUNIT_ASSERT_EQUAL(enthalpy,    mArticle1->computeSpecificEnthalpy(mTemperature));
+    CPPUNIT_ASSERT_EQUAL(temperature, mArticle1->computeTemperature(enthalpy));
+    CPPUNIT_ASSERT(1     == cache.getHits(PolyFluidPropertyCache::PRESSURE));
+    CPPUNIT_ASSERT(1     == cache.getHits(PolyFluidPropertyCache::SPECIFIC_ENTHALPY));
+    CPPUNIT_ASSERT(1     == cache.getHits(PolyFluidPropertyCache::TEMPERATURE));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5, cache.getHitRate(), DBL_EPSILON);
+
+    /// @test    Different arguments miss.
+    const double density2 = mArticle1->computeDensity(mTemperature, 2.0 * mPressure);
+    CPPUNIT_ASSERT(2     == cache.getMisses(PolyFluidPropertyCache::DENSITY));
+    CPPUNIT_ASSERT(density2 != density);
+
+    /// @test    Temperature & pressure changes keep the cached results, since they are keyed on
+    ///          their arguments.
+    const unsigned int revision = cache.getRevision();
+    mArticle1->setTemperature(mTemperature + 10.0);
+    mArticle1->setPressure(mPressure);
+    CPPUNIT_ASSERT(revision == cache.getRevision());
+    CPPUNIT_ASSERT_EQUAL(density, mArticle1->computeDensity(mTemperature, mPressure));
+
+    /// @test    Composition changes invalidate the cached results, which are then computed for the
+    ///          new composition, the same as an uncached fluid.
+    double fractions[UtPolyFluid::NMULTI] = {0.50, 0.40, 0.04, 0.01, 0.02, 0.02, 0.01};
+    mArticle1->setMassAndMassFractions(mMass, fractions);
+    CPPUNIT_ASSERT(revision != cache.getRevision());
+    const unsigned long misses = cache.getMisses(PolyFluidPropertyCache::DENSITY);
+    const double density3 = mArticle1->computeDensity(mTemperature, mPressure);
+    CPPUNIT_ASSERT(misses + 1 == cache.getMisses(PolyFluidPropertyCache::DENSITY));
+    PolyFluid uncached(*mArticle1, "uncached");
+    CPPUNIT_ASSERT(false == uncached.getPropertyCache().isEnabled());
+    CPPUNIT_ASSERT_EQUAL(uncached.computeDensity(mTemperature, mPressure), density3);
+    CPPUNIT_ASSERT(density3 != density);
+    mArticle1->updateMass();
+    mArticle1->computeDensity(mTemperature, mPressure);
+    CPPUNIT_ASSERT(misses + 2 == cache.getMisses(PolyFluidPropertyCache::DENSITY));
+
+    /// @test    Disabling the cache invalidates it.
+    mArticle1->setPropertyCacheEnabled(false);
+    mArticle1->setPropertyCacheEnabled(true);
+    mArticle1->computeDensity(mTemperature, mPressure);
+    CPPUNIT_ASSERT(misses + 3 == cache.getMisses(PolyFluidPropertyCache::DENSITY));
+
+    UT_PASS;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Tests for init construction exceptions.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
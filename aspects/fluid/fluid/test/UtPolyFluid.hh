@@ -88,6 +88,7 @@ class UtPolyFluid : public CppUnit::TestFixture
         void testLiquidPressureDensity();
         void testMultipleInitialization();
         void testFractionNormalization();
+        void testPropertyCache();
         void testConfigAndInputConstructionExceptions();
         void testConstructionExceptions();
         void testInitializationExceptions();
@@ -121,6 +122,7 @@ class UtPolyFluid : public CppUnit::TestFixture
         CPPUNIT_TEST(testLiquidPressureDensity);
         CPPUNIT_TEST(testMultipleInitialization);
         CPPUNIT_TEST(testFractionNormalization);
+        CPPUNIT_TEST(testPropertyCache);
         CPPUNIT_TEST(testConfigAndInputConstructionExceptions);
         CPPUNIT_TEST(testConstructionExceptions);
         CPPUNIT_TEST(testInitializationExceptions);
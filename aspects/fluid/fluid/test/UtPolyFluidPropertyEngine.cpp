@@ -0,0 +1,346 @@
+/*
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+*/
+
+#include "software/exceptions/TsInitializationException.hh"
+#include "strings/UtResult.hh"
+#include <cfloat>
+#include <cmath>
+
+#include "UtPolyFluidPropertyEngine.hh"
+
+/// @details  Test identification number.
+int UtPolyFluidPropertyEngine::TEST_ID = 0;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this PolyFluid Property Engine unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtPolyFluidPropertyEngine::UtPolyFluidPropertyEngine()
+    :
+    CppUnit::TestFixture(),
+    tProperties(0),
+    tArticle()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this PolyFluid Property Engine unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtPolyFluidPropertyEngine::~UtPolyFluidPropertyEngine()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtPolyFluidPropertyEngine::setUp()
+{
+    tProperties = new DefinedFluidProperties();
+
+    /// - Increment the test identification number.
+    ++TEST_ID;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtPolyFluidPropertyEngine::tearDown()
+{
+    delete tProperties;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  types  (--)  Array of constituent fluid types.
+/// @param[in]  n      (--)  Number of constituents.
+///
+/// @details  Initializes the test article with the defined properties of the given fluid types.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtPolyFluidPropertyEngine::initArticle(const FluidProperties::FluidType* types, const int n)
+{
+    std::vector<const FluidProperties*> properties(n);
+    for (int i = 0; i < n; ++i) {
+        properties[i] = tProperties->getProperties(types[i]);
+    }
+    tArticle.initialize(&properties[0], n, "tArticle");
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  types      (--)  Array of constituent fluid types.
+/// @param[in]  fractions  (--)  Array of constituent mass or mole fractions.
+/// @param[in]  n          (--)  Number of constituents.
+///
+/// @details  Initializes the test article and verifies that its computations over a range of
+///           temperatures, pressures and densities, including values outside of the fit ranges,
+///           exactly equal the constituent-by-constituent sums of the fluid properties.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtPolyFluidPropertyEngine::checkComputes(const FluidProperties::FluidType* types,
+                                              const double* fractions, const int n)
+{
+    initArticle(types, n);
+
+    const double temperatures[] = {1.0, 200.0, 273.15, 294.261, 350.0, 600.0, 2000.0};
+    const double pressures[]    = {0.0, 0.01, 50.0, 101.325, 689.0, 5000.0};
+    const double densities[]    = {0.0, 0.001, 1.2, 10.0, 998.0, 1200.0};
+
+    for (unsigned int it = 0; it < sizeof(temperatures) / sizeof(double); ++it) {
+        const double temperature = temperatures[it];
+
+        double expectedCp = 0.0;
+        for (int i = 0; i < n; ++i) {
+            if (std::fabs(fractions[i]) > DBL_EPSILON) {
+                const FluidProperties* fluid = tProperties->getProperties(types[i]);
+                expectedCp += fractions[i] * fluid->getSpecificHeat(temperature);
+            }
+        }
+        CPPUNIT_ASSERT_EQUAL(expectedCp, tArticle.computeSpecificHeat(temperature, fractions));
+
+        for (unsigned int ip = 0; ip < sizeof(pressures) / sizeof(double); ++ip) {
+            double expected = 0.0;
+            for (int i = 0; i < n; ++i) {
+                if (std::fabs(fractions[i]) > DBL_EPSILON) {
+                    expected += tProperties->getProperties(types[i])->
+                                getDensity(temperature, pressures[ip] * fractions[i]);
+                }
+            }
+            CPPUNIT_ASSERT_EQUAL(expected,
+                                 tArticle.computeDensity(temperature, pressures[ip], fractions));
+        }
+
+        for (unsigned int id = 0; id < sizeof(densities) / sizeof(double); ++id) {
+            double expected = 0.0;
+            for (int i = 0; i < n; ++i) {
+                if (std::fabs(fractions[i]) > DBL_EPSILON) {
+                    expected += tProperties->getProperties(types[i])->
+                                getPressure(temperature, densities[id] * fractions[i]);
+                }
+            }
+            CPPUNIT_ASSERT_EQUAL(expected,
+                                 tArticle.computePressure(temperature, densities[id], fractions));
+        }
+    }
+
+    /// - Temperature from specific enthalpy round-trips through the constituent specific heats
+    ///   within their fit ranges.
+    for (double temperature = 290.0; temperature < 360.0; temperature += 10.0) {
+        const double h = tArticle.computeSpecificHeat(temperature, fractions) * temperature;
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(temperature, tArticle.computeTemperature(h, fractions),
+                                     1.0e-8);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests default construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtPolyFluidPropertyEngine::testDefaultConstruction()
+{
+    UT_RESULT_FIRST;
+
+    /// @test    Default values of the article's attributes.
+    FriendlyPolyFluidPropertyEngine article;
+    CPPUNIT_ASSERT(""    == article.mName);
+    CPPUNIT_ASSERT(0     == article.mNConstituents);
+    CPPUNIT_ASSERT(0     == article.mDensityGas.size());
+    CPPUNIT_ASSERT(0     == article.mPressureOther.size());
+    CPPUNIT_ASSERT(0     == article.mDensityKind.size());
+    CPPUNIT_ASSERT(false == article.isInitialized());
+    CPPUNIT_ASSERT(0     == article.getNConstituents());
+    CPPUNIT_ASSERT(0     == article.getNumVirtualFits());
+
+    /// @test    New/delete for code coverage.
+    PolyFluidPropertyEngine* article2 = new PolyFluidPropertyEngine();
+    delete article2;
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests initialization and the sorting of constituent fits into groups.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtPolyFluidPropertyEngine::testInitialize()
+{
+    UT_RESULT;
+
+    /// @test    Ideal gases, a liquid and a real gas.
+    const FluidProperties::FluidType types[] = {FluidProperties::GUNNS_N2,
+                                                FluidProperties::GUNNS_O2,
+                                                FluidProperties::GUNNS_WATER,
+                                                FluidProperties::GUNNS_N2_REAL_GAS};
+    initArticle(types, 4);
+    CPPUNIT_ASSERT("tArticle" == tArticle.mName);
+    CPPUNIT_ASSERT(true       == tArticle.isInitialized());
+    CPPUNIT_ASSERT(4          == tArticle.getNConstituents());
+    CPPUNIT_ASSERT(4u         == tArticle.mDensityKind.size());
+    CPPUNIT_ASSERT(4u         == tArticle.mPressureSlot.size());
+    CPPUNIT_ASSERT(4u         == tArticle.mCpA.size());
+    CPPUNIT_ASSERT(2          == tArticle.mDensityGas.size());
+    CPPUNIT_ASSERT(1          == tArticle.mDensityLiquid.size());
+    CPPUNIT_ASSERT(1          == tArticle.mDensityOther.size());
+    CPPUNIT_ASSERT(2          == tArticle.mPressureGas.size());
+    CPPUNIT_ASSERT(1          == tArticle.mPressureLiquid.size());
+    CPPUNIT_ASSERT(1          == tArticle.mPressureOther.size());
+    CPPUNIT_ASSERT(2          == tArticle.getNumVirtualFits());
+    CPPUNIT_ASSERT(0          == tArticle.mDensityGas.mIndex[0]);
+    CPPUNIT_ASSERT(1          == tArticle.mDensityGas.mIndex[1]);
+    CPPUNIT_ASSERT(2          == tArticle.mDensityLiquid.mIndex[0]);
+    CPPUNIT_ASSERT(3          == tArticle.mDensityOther.mIndex[0]);
+    CPPUNIT_ASSERT(PolyFluidPropertyEngine::IDEAL_GAS == tArticle.mDensityKind[1]);
+    CPPUNIT_ASSERT(PolyFluidPropertyEngine::LIQUID    == tArticle.mDensityKind[2]);
+    CPPUNIT_ASSERT(PolyFluidPropertyEngine::OTHER     == tArticle.mPressureKind[3]);
+    CPPUNIT_ASSERT(1          == tArticle.mDensitySlot[1]);
+    CPPUNIT_ASSERT(0          == tArticle.mDensitySlot[2]);
+    CPPUNIT_ASSERT(0          == tArticle.mPressureSlot[3]);
+
+    /// @test    Packed ranges and coefficients match the fits.
+    const FluidProperties* o2  = tProperties->getProperties(FluidProperties::GUNNS_O2);
+    TsApproximation*       fit = tArticle.mDensityGas.mFit[1];
+    CPPUNIT_ASSERT_EQUAL(fit->getMinX(), tArticle.mDensityGas.mMinX[1]);
+    CPPUNIT_ASSERT_EQUAL(fit->getMaxX(), tArticle.mDensityGas.mMaxX[1]);
+    CPPUNIT_ASSERT_EQUAL(fit->getMinY(), tArticle.mDensityGas.mMinY[1]);
+    CPPUNIT_ASSERT_EQUAL(fit->getMaxY(), tArticle.mDensityGas.mMaxY[1]);
+    CPPUNIT_ASSERT_EQUAL(o2->getDensity(300.0, 100.0),
+                         tArticle.mDensityGas.mA[1] * 100.0 / 300.0);
+
+    /// @test    Re-initialization replaces the previous groups.
+    const FluidProperties::FluidType air[] = {FluidProperties::GUNNS_N2,
+                                              FluidProperties::GUNNS_O2,
+                                              FluidProperties::GUNNS_CO2,
+                                              FluidProperties::GUNNS_H2O};
+    initArticle(air, 4);
+    CPPUNIT_ASSERT(4 == tArticle.mDensityGas.size());
+    CPPUNIT_ASSERT(4 == tArticle.mPressureGas.size());
+    CPPUNIT_ASSERT(0 == tArticle.mDensityLiquid.size());
+    CPPUNIT_ASSERT(0 == tArticle.getNumVirtualFits());
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests initialization exceptions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtPolyFluidPropertyEngine::testInitializeExceptions()
+{
+    UT_RESULT;
+
+    /// @test    Exception on missing constituent properties, and the article is left
+    ///          uninitialized.
+    const FluidProperties* properties[] = {
+            tProperties->getProperties(FluidProperties::GUNNS_N2), 0};
+    CPPUNIT_ASSERT_THROW(tArticle.initialize(properties, 2, "tArticle"),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(false == tArticle.isInitialized());
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the specific heat, temperature, density and pressure computations against the
+///           constituent fluid properties, for ideal gas, liquid and real gas mixtures.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtPolyFluidPropertyEngine::testComputes()
+{
+    UT_RESULT;
+
+    /// @test    Ideal gas mixture with a negligible and a zero fraction.
+    {
+        const FluidProperties::FluidType types[] = {FluidProperties::GUNNS_N2,
+                                                    FluidProperties::GUNNS_O2,
+                                                    FluidProperties::GUNNS_CO2,
+                                                    FluidProperties::GUNNS_H2O,
+                                                    FluidProperties::GUNNS_CH4};
+        const double fractions[] = {0.755, 0.232, 0.013, 1.0e-20, 0.0};
+        checkComputes(types, fractions, 5);
+    }
+
+    /// @test    Single liquid.
+    {
+        const FluidProperties::FluidType types[] = {FluidProperties::GUNNS_WATER};
+        const double fractions[] = {1.0};
+        checkComputes(types, fractions, 1);
+    }
+
+    /// @test    Liquid mixture.
+    {
+        const FluidProperties::FluidType types[] = {FluidProperties::GUNNS_WATER,
+                                                    FluidProperties::GUNNS_PG40};
+        const double fractions[] = {0.4, 0.6};
+        checkComputes(types, fractions, 2);
+    }
+
+    /// @test    Real gas mixture, evaluated by virtual call.
+    {
+        const FluidProperties::FluidType types[] = {FluidProperties::GUNNS_N2_REAL_GAS,
+                                                    FluidProperties::GUNNS_O2_REAL_GAS,
+                                                    FluidProperties::GUNNS_HE};
+        const double fractions[] = {0.7, 0.0, 0.3};
+        checkComputes(types, fractions, 3);
+        CPPUNIT_ASSERT(4 == tArticle.getNumVirtualFits());
+    }
+
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the property cache entries, revision and counters.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtPolyFluidPropertyEngine::testCache()
+{
+    UT_RESULT;
+
+    /// @test    Default construction.
+    FriendlyPolyFluidPropertyCache cache;
+    CPPUNIT_ASSERT(false == cache.isEnabled());
+    CPPUNIT_ASSERT(1     == cache.getRevision());
+    CPPUNIT_ASSERT(0     == cache.mEntryRevision[PolyFluidPropertyCache::DENSITY][0]);
+    CPPUNIT_ASSERT(0.0   == cache.getHitRate());
+
+    /// @test    Disabled cache neither stores nor finds.
+    double value = 0.0;
+    cache.store(PolyFluidPropertyCache::DENSITY, 300.0, 100.0, 1.5);
+    CPPUNIT_ASSERT(false == cache.find(PolyFluidPropertyCache::DENSITY, 300.0, 100.0, value));
+    CPPUNIT_ASSERT(0     == cache.getMisses(PolyFluidPropertyCache::DENSITY));
+
+    /// @test    Enabled cache finds exactly matching arguments only.
+    cache.setEnabled(true);
+    CPPUNIT_ASSERT(2     == cache.getRevision());
+    cache.store(PolyFluidPropertyCache::DENSITY, 300.0, 100.0, 1.5);
+    CPPUNIT_ASSERT(true  == cache.find(PolyFluidPropertyCache::DENSITY, 300.0, 100.0, value));
+    CPPUNIT_ASSERT(1.5   == value);
+    CPPUNIT_ASSERT(false == cache.find(PolyFluidPropertyCache::DENSITY, 300.0, 100.000001, value));
+    CPPUNIT_ASSERT(false == cache.find(PolyFluidPropertyCache::PRESSURE, 300.0, 100.0, value));
+    CPPUNIT_ASSERT(1     == cache.getHits(PolyFluidPropertyCache::DENSITY));
+    CPPUNIT_ASSERT(1     == cache.getMisses(PolyFluidPropertyCache::DENSITY));
+    CPPUNIT_ASSERT(1     == cache.getMisses(PolyFluidPropertyCache::PRESSURE));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0 / 3.0, cache.getHitRate(), DBL_EPSILON);
+
+    /// @test    Entries are replaced round-robin.
+    for (int i = 1; i <= PolyFluidPropertyCache::NUM_ENTRIES; ++i) {
+        cache.store(PolyFluidPropertyCache::DENSITY, 300.0 + i, 100.0, 1.5 + i);
+    }
+    CPPUNIT_ASSERT(false == cache.find(PolyFluidPropertyCache::DENSITY, 300.0, 100.0, value));
+    CPPUNIT_ASSERT(true  == cache.find(PolyFluidPropertyCache::DENSITY, 301.0, 100.0, value));
+    CPPUNIT_ASSERT(2.5   == value);
+
+    /// @test    Invalidation empties the cache.
+    cache.invalidate();
+    CPPUNIT_ASSERT(3     == cache.getRevision());
+    CPPUNIT_ASSERT(false == cache.find(PolyFluidPropertyCache::DENSITY, 301.0, 100.0, value));
+
+    /// @test    Revision wrap-around clears the entries and skips the empty revision.
+    cache.store(PolyFluidPropertyCache::DENSITY, 301.0, 100.0, 2.5);
+    cache.mRevision = 0xFFFFFFFF;
+    cache.store(PolyFluidPropertyCache::PRESSURE, 300.0, 1.0, 86.0);
+    cache.invalidate();
+    CPPUNIT_ASSERT(1     == cache.getRevision());
+    CPPUNIT_ASSERT(0     == cache.mEntryRevision[PolyFluidPropertyCache::PRESSURE][0]);
+    CPPUNIT_ASSERT(false == cache.find(PolyFluidPropertyCache::PRESSURE, 300.0, 1.0, value));
+
+    /// @test    Counter reset.
+    cache.resetCounters();
+    CPPUNIT_ASSERT(0     == cache.getHits(PolyFluidPropertyCache::DENSITY));
+    CPPUNIT_ASSERT(0     == cache.getMisses(PolyFluidPropertyCache::PRESSURE));
+
+    UT_PASS_LAST;
+}
@@ -0,0 +1,107 @@
+#ifndef UtPolyFluidPropertyEngine_EXISTS
+#define UtPolyFluidPropertyEngine_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_TSM_GUNNS_FLUID_FLUID_POLY_FLUID_PROPERTY_ENGINE PolyFluid Property Engine Unit Tests
+/// @ingroup  UT_TSM_GUNNS_FLUID_FLUID
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the PolyFluid Property Engine.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <vector>
+
+#include "aspects/fluid/fluid/PolyFluidPropertyEngine.hh"
+#include "properties/FluidProperties.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from PolyFluidPropertyCache and befriend UtPolyFluidPropertyEngine.
+///
+/// @details  Class derived from the unit under test.  It just has a default constructor and
+///           destructor, but it befriends the unit test case driver class to allow it access to
+///           protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyPolyFluidPropertyCache : public PolyFluidPropertyCache
+{
+    public:
+        FriendlyPolyFluidPropertyCache() : PolyFluidPropertyCache() {;}
+        virtual ~FriendlyPolyFluidPropertyCache() {;}
+        friend class UtPolyFluidPropertyEngine;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from PolyFluidPropertyEngine and befriend UtPolyFluidPropertyEngine.
+///
+/// @details  Class derived from the unit under test.  It just has a default constructor and
+///           destructor, but it befriends the unit test case driver class to allow it access to
+///           protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyPolyFluidPropertyEngine : public PolyFluidPropertyEngine
+{
+    public:
+        FriendlyPolyFluidPropertyEngine() : PolyFluidPropertyEngine() {;}
+        virtual ~FriendlyPolyFluidPropertyEngine() {;}
+        friend class UtPolyFluidPropertyEngine;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    PolyFluid Property Engine unit tests.
+///
+/// @details  This class provides the unit tests for the PolyFluidPropertyEngine class within the
+///           CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtPolyFluidPropertyEngine : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this unit test.
+        UtPolyFluidPropertyEngine();
+        /// @brief    Default destructs this unit test.
+        virtual ~UtPolyFluidPropertyEngine();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests default construction.
+        void testDefaultConstruction();
+        /// @brief    Tests initialization and the fit groups.
+        void testInitialize();
+        /// @brief    Tests initialization exceptions.
+        void testInitializeExceptions();
+        /// @brief    Tests the property computations against the constituent fits.
+        void testComputes();
+        /// @brief    Tests the property cache.
+        void testCache();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtPolyFluidPropertyEngine);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitialize);
+        CPPUNIT_TEST(testInitializeExceptions);
+        CPPUNIT_TEST(testComputes);
+        CPPUNIT_TEST(testCache);
+        CPPUNIT_TEST_SUITE_END();
+
+        DefinedFluidProperties*         tProperties; /**< (--) Defined fluid properties. */
+        FriendlyPolyFluidPropertyEngine tArticle;    /**< (--) Test article. */
+        static int                      TEST_ID;     /**< (--) Test identification number. */
+
+        /// @brief Initializes the test article with the given constituent types.
+        void initArticle(const FluidProperties::FluidType* types, const int n);
+        /// @brief Checks the article's computations against the constituent fits.
+        void checkComputes(const FluidProperties::FluidType* types, const double* fractions,
+                           const int n);
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtPolyFluidPropertyEngine(const UtPolyFluidPropertyEngine& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtPolyFluidPropertyEngine& operator =(const UtPolyFluidPropertyEngine& that);
+};
+
+///@}
+
+#endif
@@ -10,6 +10,7 @@
 
 #include "UtMonoFluid.hh"
 #include "UtPolyFluid.hh"
+#include "UtPolyFluidPropertyEngine.hh"
 #include "UtGunnsFluidTraceCompounds.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +26,7 @@ int main(int, char**) {
 
     runner.addTest(UtMonoFluid::suite());
     runner.addTest(UtPolyFluid::suite());
+    runner.addTest(UtPolyFluidPropertyEngine::suite());
     runner.addTest(UtGunnsFluidTraceCompounds::suite());
 
     runner.run();
@@ -134,7 +134,8 @@ GunnsFluidEvaporation::GunnsFluidEvaporation()
     mEvaporationFluid(0),
     mLiquidPoolMass(0.0)
 {
-    // nothing to do
+    /// - Stepped serially since it reads and sets its liquid pool accumulator link in step.
+    mSerialOnly = true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
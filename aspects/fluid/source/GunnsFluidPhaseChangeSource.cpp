@@ -123,7 +123,9 @@ GunnsFluidPhaseChangeSource::GunnsFluidPhaseChangeSource()
     mDh(0.0),
     mL(0.0)
 {
-    // nothing to do
+    /// - Stepped serially since it computes properties of its node's contents in step, which
+    ///   updates the contents' property cache.
+    mSerialOnly = true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
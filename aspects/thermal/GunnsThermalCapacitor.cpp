@@ -114,6 +114,9 @@ GunnsThermalCapacitor::GunnsThermalCapacitor()
     mExternalHeatFlux(),
     mSumExternalHeatFluxes(0.0)
 {
+    /// - Stepped serially since it can set its node's potential in step.
+    mSerialOnly = true;
+
     /** Initialize every index of the mExternalHeatFlux[] array to zero. */
     for (int i = 0; i < NUM_EXT_HEATFLUXES; ++i)
     {
@@ -115,6 +115,9 @@ GunnsThermalPhaseChangeBattery::GunnsThermalPhaseChangeBattery()
     mSumExternalHeatFluxes(0.0),
     mAdmittance(0.0)
 {
+    /// - Stepped serially since it sets its node's potential in step.
+    mSerialOnly = true;
+
     zeroExternalFluxes();
 }
 
@@ -113,7 +113,8 @@ GunnsThermalRadiationInputData::~GunnsThermalRadiationInputData()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 GunnsThermalRadiation::GunnsThermalRadiation():
     GunnsBasicConductor(),
-    mViewScalar(1.0)
+    mViewScalar(1.0),
+    mBatchConductivity(0)
 {
     // Nothing to do
 }
@@ -193,6 +194,12 @@ void GunnsThermalRadiation::updateState(const double dt __attribute__((unused)))
 ///           Potential analog for the thermal aspect.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    /// - Use the conductivity computed by a radiation batch from the same terms, if any.
+    if (mBatchConductivity) {
+        mEffectiveConductivity = *mBatchConductivity;
+        return;
+    }
+
     /// - Conditional Statement to ensure a division by zero does not take place. DBL_EPSILON is
     ///   used for tolerance comparison.
     if (fabs(mPotentialVector[0] - mPotentialVector[1]) > DBL_EPSILON)
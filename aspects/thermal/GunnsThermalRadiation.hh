@@ -113,6 +113,9 @@ class GunnsThermalRadiation : public GunnsBasicConductor
 {
         TS_MAKE_SIM_COMPATIBLE(GunnsThermalRadiation);
 
+        /// - The radiation batch gathers the link's coefficient and temperatures.
+        friend class GunnsThermalRadiationBatch;
+
     public:
 
         /// @brief   Default Constructor
@@ -134,9 +137,14 @@ class GunnsThermalRadiation : public GunnsBasicConductor
         /// @brief   Returns the mViewScalar value
         double getViewScalar() const;
 
+        /// @brief   Sets the batch-computed conductivity to use instead of computing it
+        void   setBatchConductivity(const double* conductivity);
+
     protected:
         double mViewScalar; /**< (--) view scalar, which scales mEffectiveConductivity;
                                       used to simulate operations like radiator retraction */
+        const double* mBatchConductivity; /**< ** (--) trick_chkpnt_io(**) conductivity computed by a
+                                                      GunnsThermalRadiationBatch, or null to compute */
 
         /// @brief   Calculates the Admittance for the Radiation Link
         virtual void updateState(const double dt);
@@ -174,4 +182,16 @@ inline double GunnsThermalRadiation::getViewScalar() const
     return mViewScalar;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  conductivity  (--)  Pointer to the batch-computed conductivity, or null.
+///
+/// @details  Sets the pointer to this link's effective conductivity as computed by a
+///           GunnsThermalRadiationBatch, which updateState then uses instead of computing its own.
+///           Null returns the link to computing its own effective conductivity.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsThermalRadiation::setBatchConductivity(const double* conductivity)
+{
+    mBatchConductivity = conductivity;
+}
+
 #endif
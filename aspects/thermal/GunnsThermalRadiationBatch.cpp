@@ -0,0 +1,159 @@
+/************************** TRICK HEADER **********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+  (Computes the linearized effective conductivities of an array of GunnsThermalRadiation links in
+   one pass over contiguous arrays.)
+
+REFERENCE:
+  ()
+
+ASSUMPTIONS AND LIMITATIONS:
+  ()
+
+LIBRARY_DEPENDENCY:
+  (
+   (aspects/thermal/GunnsThermalRadiation.o)
+  )
+
+PROGRAMMERS:
+  (
+   ((agent) (agent@local) (2026-10) (Initial))
+  )
+**************************************************************************************************/
+
+#include "GunnsThermalRadiationBatch.hh"
+#include "GunnsThermalRadiation.hh"
+#include "core/GunnsMacros.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <cfloat>
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Thermal Radiation Batch.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationBatch::GunnsThermalRadiationBatch()
+    :
+    mName(),
+    mLinks(0),
+    mNumLinks(0),
+    mCoefficient(0),
+    mDefault(0),
+    mTemperature0(0),
+    mTemperature1(0),
+    mConductivity(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Thermal Radiation Batch, detaching any attached links.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationBatch::~GunnsThermalRadiationBatch()
+{
+    release();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name      (--)  Instance name for messages.
+/// @param[in]  links     (--)  Array of initialized radiation links to attach.
+/// @param[in]  numLinks  (--)  Number of links in the array.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Releases any previously attached links, allocates the arrays for the new links, points
+///           each link at its element of the conductivity array, and computes the initial
+///           conductivities so the links are consistent with their current temperatures.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBatch::initialize(const std::string& name, GunnsThermalRadiation* links,
+                                            const int numLinks)
+{
+    release();
+    mName = name;
+
+    /// - Throw an exception on a missing links array or a negative number of links.
+    if (numLinks < 0 or (numLinks > 0 and not links)) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "missing links array or negative number of links.");
+    }
+
+    if (0 == numLinks) {
+        return;
+    }
+
+    mLinks        = links;
+    mNumLinks     = numLinks;
+    mCoefficient  = new double[numLinks];
+    mDefault      = new double[numLinks];
+    mTemperature0 = new double[numLinks];
+    mTemperature1 = new double[numLinks];
+    mConductivity = new double[numLinks];
+    update();
+    for (int i = 0; i < mNumLinks; ++i) {
+        mLinks[i].setBatchConductivity(&mConductivity[i]);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Returns the attached links to computing their own effective conductivities, and
+///           deletes the arrays.  The links array itself is not owned and isn't deleted.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBatch::release()
+{
+    for (int i = 0; i < mNumLinks; ++i) {
+        mLinks[i].setBatchConductivity(0);
+    }
+    delete [] mConductivity;
+    mConductivity = 0;
+    delete [] mTemperature1;
+    mTemperature1 = 0;
+    delete [] mTemperature0;
+    mTemperature0 = 0;
+    delete [] mDefault;
+    mDefault = 0;
+    delete [] mCoefficient;
+    mCoefficient = 0;
+    mLinks    = 0;
+    mNumLinks = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Gathers each link's radiation coefficient & port temperatures, then computes all of
+///           the effective conductivities in one loop:
+///
+///                A = C * (T0^4 - T1^4) / (T0 - T1)
+///
+///           where C is the link's view scalar times its default conductivity.  As in
+///           GunnsThermalRadiation::updateState, links whose port temperatures are within
+///           DBL_EPSILON of each other keep their default conductivity.  The coefficient is
+///           gathered every update since the view scalar and default conductivity can be changed
+///           at run-time.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBatch::update()
+{
+    /// - Gather the link terms into the contiguous arrays.
+    for (int i = 0; i < mNumLinks; ++i) {
+        const GunnsThermalRadiation& link = mLinks[i];
+        mCoefficient[i]  = link.mViewScalar * link.mDefaultConductivity;
+        mDefault[i]      = link.mDefaultConductivity;
+        mTemperature0[i] = link.mPotentialVector[0];
+        mTemperature1[i] = link.mPotentialVector[1];
+    }
+
+    /// - Linearize all links in one pass over the arrays.
+    const double* coefficient  = mCoefficient;
+    const double* defaultValue = mDefault;
+    const double* temperature0 = mTemperature0;
+    const double* temperature1 = mTemperature1;
+    double*       conductivity = mConductivity;
+    for (int i = 0; i < mNumLinks; ++i) {
+        const double t0   = temperature0[i];
+        const double t1   = temperature1[i];
+        const double dT   = t0 - t1;
+        const double T0_4 = t0 * t0 * t0 * t0;
+        const double T1_4 = t1 * t1 * t1 * t1;
+        conductivity[i] = (std::fabs(dT) > DBL_EPSILON) ? coefficient[i] * (T0_4 - T1_4) / dT
+                                                         : defaultValue[i];
+    }
+}
@@ -0,0 +1,129 @@
+#ifndef GunnsThermalRadiationBatch_EXISTS
+#define GunnsThermalRadiationBatch_EXISTS
+
+/********************** TRICK HEADER **************************************************************
+@defgroup  TSM_GUNNS_THERMAL_RADIATION_BATCH    GUNNS Thermal Radiation Batch
+@ingroup   TSM_GUNNS_THERMAL
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+  (Computes the linearized effective conductivities of an array of GunnsThermalRadiation links in
+   one pass over contiguous arrays, instead of each link computing its own from its own members.)
+
+REFERENCE:
+  ()
+
+ASSUMPTIONS AND LIMITATIONS:
+  (The batch must be updated after each network solution and before the links are stepped, as
+   ThermalNetwork does in its pre-solver spotter step.  Links attached to the batch use the
+   conductivity from its last update, so they must not be stepped without it.)
+
+LIBRARY DEPENDENCY:
+  (
+   (GunnsThermalRadiationBatch.o)
+  )
+
+PROGRAMMERS:
+  (
+   ((agent) (agent@local) (2026-10) (Initial))
+  )
+
+@{
+**************************************************************************************************/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <string>
+
+class GunnsThermalRadiation;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GunnsThermalRadiation Batch Class
+///
+/// @details  Holds the radiation coefficients, port temperatures and effective conductivities of an
+///           array of radiation links as structure-of-arrays.  Each update gathers the links' view
+///           scalar & default conductivity products and port temperatures into the arrays, then
+///           linearizes all of the links in a single loop with no branches on link state and no
+///           indirection, that the compiler can vectorize.  The linearization is the same
+///           arithmetic in the same order as GunnsThermalRadiation::updateState, so the attached
+///           links step to the same admittances they would compute themselves.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsThermalRadiationBatch
+{
+        TS_MAKE_SIM_COMPATIBLE(GunnsThermalRadiationBatch);
+
+    public:
+        /// @brief   Default constructs this Thermal Radiation Batch.
+        GunnsThermalRadiationBatch();
+        /// @brief   Default destructs this Thermal Radiation Batch.
+        virtual ~GunnsThermalRadiationBatch();
+        /// @brief   Initializes this batch and attaches the given array of links to it.
+        void initialize(const std::string& name, GunnsThermalRadiation* links, const int numLinks);
+        /// @brief   Detaches the links and deletes the arrays.
+        void release();
+        /// @brief   Computes the effective conductivities of all the links.
+        void update();
+        /// @brief   Returns whether links are attached to this batch.
+        bool isActive() const;
+        /// @brief   Returns the number of links attached to this batch.
+        int  getNumLinks() const;
+        /// @brief   Returns the effective conductivity computed for the given link index.
+        double getConductivity(const int index) const;
+
+    protected:
+        std::string            mName;          /**< ** (--)   trick_chkpnt_io(**) Instance name for messages. */
+        GunnsThermalRadiation* mLinks;         /**< ** (--)   trick_chkpnt_io(**) Attached array of radiation links, not owned. */
+        int                    mNumLinks;      /**<    (--)   trick_chkpnt_io(**) Number of attached links. */
+        double*                mCoefficient;   /**< ** (--)   trick_chkpnt_io(**) View scalar times default conductivity of each link. */
+        double*                mDefault;       /**< ** (W/K)  trick_chkpnt_io(**) Default conductivity of each link, used at equal temperatures. */
+        double*                mTemperature0;  /**< ** (K)    trick_chkpnt_io(**) Port 0 temperature of each link. */
+        double*                mTemperature1;  /**< ** (K)    trick_chkpnt_io(**) Port 1 temperature of each link. */
+        double*                mConductivity;  /**< ** (W/K)  trick_chkpnt_io(**) Computed effective conductivity of each link. */
+
+    private:
+        /// @brief   Copy constructor unavailable since declared private and not implemented.
+        GunnsThermalRadiationBatch(const GunnsThermalRadiationBatch& that);
+        /// @brief   Assignment operator unavailable since declared private and not implemented.
+        GunnsThermalRadiationBatch& operator = (const GunnsThermalRadiationBatch& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   bool  (--)  True if links are attached to this batch.
+///
+/// @details  Returns whether this batch has been initialized with links and not released.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsThermalRadiationBatch::isActive() const
+{
+    return mNumLinks > 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   int  (--)  Number of links attached to this batch.
+///
+/// @details  Returns mNumLinks.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsThermalRadiationBatch::getNumLinks() const
+{
+    return mNumLinks;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  index  (--)  Index of the link in the attached array.
+///
+/// @return   double  (W/K)  Effective conductivity computed for the link in the last update.
+///
+/// @details  Returns the element of mConductivity, or zero for an index out of range.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsThermalRadiationBatch::getConductivity(const int index) const
+{
+    if (index < 0 or index >= mNumLinks) {
+        return 0.0;
+    }
+    return mConductivity[index];
+}
+
+#endif
@@ -4,6 +4,7 @@
 
 LIBRARY DEPENDENCY:
    (
+    (core/GunnsThreadPool.o)
     (parsing/ParseTool.o)
     (parsing/tinyxml/tinyxml.o)
     (software/exceptions/TsInitializationException.o)
@@ -14,16 +15,271 @@ PROGRAMMERS:
    ((Joe Valerioti) (L3) (Dec 2012)))
 ***************************************************************************************************/
 #include "ThermFileParser.hh"
+#include "core/GunnsThreadPool.hh"
 #include "parsing/ParseTool.hh" //needed to check file accessibility in openFile
 #include "software/exceptions/TsParseException.hh"
 #include "aspects/thermal/PtcsMacros.hh"
 #include "math/MsMath.hh" //needed for fabs() and FLT_EPSILON in confirmNodeBuild()
 #include <algorithm> //needed for find() function in getCapEditGroupId()
+#include <cstdio>    //needed for rename() & remove() in writeCache()
+#include <cstring>   //needed for memcpy() & memcmp() in the cache methods
+#include <ctime>     //needed for clock_gettime() in wallTime()
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Integer used to designate a node name that is not yet registered in the Node map.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 const int ThermFileParser::NOT_FOUND  = -99;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Characters identifying a ThermFileParser cache-file, at the start of the file.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const char ThermFileParser::CACHE_MAGIC[8] = {'G', 'T', 'H', 'R', 'M', 'C', 'H', 'E'};
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Cache-file format version.  This must be incremented whenever the layout of the
+///           cache-file or the set of cached data changes, so that old cache-files are rejected.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const uint32_t ThermFileParser::CACHE_VERSION = 1;
+/**************************************************************************************************/
+/* Cache-file serialization helpers */
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Fixed-size header at the start of a cache-file.  The endian marker and type sizes
+///           reject a cache-file made on a different platform, and the hash rejects one made from
+///           different XML files.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+struct ThermFileParserCacheHeader
+{
+    char     magic[8];    /**< (--) CACHE_MAGIC */
+    uint32_t version;     /**< (--) CACHE_VERSION */
+    uint32_t endian;      /**< (--) 0x01020304 in native byte order */
+    uint32_t intSize;     /**< (--) sizeof(int) */
+    uint32_t doubleSize;  /**< (--) sizeof(double) */
+    uint64_t hash;        /**< (--) Hash of the XML file names and contents */
+    uint64_t payloadSize; /**< (--) Number of bytes following the header */
+};
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out]  buffer  (--)  Cache-file payload being built.
+/// @param[in]      count   (--)  Element count to append.
+///
+/// @details  Appends an element count to the payload.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void appendCount(std::string& buffer, const std::size_t count)
+{
+    const uint32_t value = static_cast<uint32_t>(count);
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out]  buffer  (--)  Cache-file payload being built.
+/// @param[in]      values  (--)  Vector of plain values to append.
+///
+/// @details  Appends the vector size and then the vector storage as a single block.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+static void appendVector(std::string& buffer, const std::vector<T>& values)
+{
+    appendCount(buffer, values.size());
+    if (not values.empty()) {
+        buffer.append(reinterpret_cast<const char*>(&values[0]), values.size() * sizeof(T));
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out]  buffer  (--)  Cache-file payload being built.
+/// @param[in]      values  (--)  Vector of vectors of plain values to append.
+///
+/// @details  Appends the number of inner vectors and then each inner vector.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+static void appendVector(std::string& buffer, const std::vector< std::vector<T> >& values)
+{
+    appendCount(buffer, values.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        appendVector(buffer, values[i]);
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out]  buffer  (--)  Cache-file payload being built.
+/// @param[in]      values  (--)  Vector of strings to append.
+///
+/// @details  Appends the number of strings and then each string's length and characters.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void appendVector(std::string& buffer, const std::vector<std::string>& values)
+{
+    appendCount(buffer, values.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        appendCount(buffer, values[i].size());
+        buffer.append(values[i]);
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out]  pos    (--)  Read position in the mapped cache-file, advanced past the count.
+/// @param[in]      end    (--)  End of the mapped cache-file.
+/// @param[out]     count  (--)  Element count read.
+///
+/// @return   bool (--)  False if the count runs past the end of the file.
+///
+/// @details  Reads an element count from the payload.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static bool extractCount(const char*& pos, const char* end, std::size_t& count)
+{
+    uint32_t value = 0;
+    if (static_cast<std::size_t>(end - pos) < sizeof(value)) {
+        return false;
+    }
+    std::memcpy(&value, pos, sizeof(value));
+    pos  += sizeof(value);
+    count = value;
+    return true;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out]  pos     (--)  Read position in the mapped cache-file, advanced past the vector.
+/// @param[in]      end     (--)  End of the mapped cache-file.
+/// @param[out]     values  (--)  Vector of plain values read.
+///
+/// @return   bool (--)  False if the vector runs past the end of the file.
+///
+/// @details  Sizes the vector and copies its storage from the file as a single block.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+static bool extractVector(const char*& pos, const char* end, std::vector<T>& values)
+{
+    std::size_t count = 0;
+    if (not extractCount(pos, end, count)
+            or static_cast<std::size_t>(end - pos) / sizeof(T) < count) {
+        return false;
+    }
+    values.resize(count);
+    if (count > 0) {
+        std::memcpy(&values[0], pos, count * sizeof(T));
+        pos += count * sizeof(T);
+    }
+    return true;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out]  pos     (--)  Read position in the mapped cache-file, advanced past the vectors.
+/// @param[in]      end     (--)  End of the mapped cache-file.
+/// @param[out]     values  (--)  Vector of vectors of plain values read.
+///
+/// @return   bool (--)  False if the vectors run past the end of the file.
+///
+/// @details  Reads the number of inner vectors and then each inner vector.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+static bool extractVector(const char*& pos, const char* end, std::vector< std::vector<T> >& values)
+{
+    std::size_t count = 0;
+    if (not extractCount(pos, end, count)
+            or static_cast<std::size_t>(end - pos) / sizeof(uint32_t) < count) {
+        return false;
+    }
+    values.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (not extractVector(pos, end, values[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out]  pos     (--)  Read position in the mapped cache-file, advanced past the strings.
+/// @param[in]      end     (--)  End of the mapped cache-file.
+/// @param[out]     values  (--)  Vector of strings read.
+///
+/// @return   bool (--)  False if the strings run past the end of the file.
+///
+/// @details  Reads the number of strings and then each string's length and characters.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static bool extractVector(const char*& pos, const char* end, std::vector<std::string>& values)
+{
+    std::size_t count = 0;
+    if (not extractCount(pos, end, count)
+            or static_cast<std::size_t>(end - pos) / sizeof(uint32_t) < count) {
+        return false;
+    }
+    values.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::size_t length = 0;
+        if (not extractCount(pos, end, length) or static_cast<std::size_t>(end - pos) < length) {
+            return false;
+        }
+        values[i].assign(pos, length);
+        pos += length;
+    }
+    return true;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out]  hash    (--)  Running 64-bit FNV-1a hash.
+/// @param[in]      data    (--)  Bytes to add to the hash.
+/// @param[in]      length  (--)  Number of bytes.
+///
+/// @details  Adds bytes to a 64-bit FNV-1a hash.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void hashBytes(uint64_t& hash, const char* data, const std::size_t length)
+{
+    for (std::size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   double (s)  Monotonic wall clock time.
+///
+/// @details  Returns the monotonic wall clock time, for the file load & register times.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static double wallTime()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<double>(now.tv_sec) + 1.0e-9 * static_cast<double>(now.tv_nsec);
+}
+/**************************************************************************************************/
+/* ThermFileParserLoadJob class */
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    ThermFileParser concurrent XML file load job.
+///
+/// @details  Each task loads one XML file's document, and only writes that file's entry, so the
+///           tasks share no data.  A file that fails to load is left without a document, so that
+///           registration loads it again on the calling thread and reports the error as usual.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class ThermFileParserLoadJob : public GunnsThreadPoolJob
+{
+    public:
+        /// @brief  Constructs this job to load the given files.
+        ThermFileParserLoadJob(std::vector<ThermFileParserFile>& files) : mFiles(files) {;}
+        /// @brief  Default destructs this job.
+        virtual ~ThermFileParserLoadJob() {;}
+        /// @brief  Loads the given file's document.
+        virtual void runTask(const int task, const int worker);
+
+    private:
+        std::vector<ThermFileParserFile>& mFiles; /**< (--) Files to load. */
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        ThermFileParserLoadJob(const ThermFileParserLoadJob&);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        ThermFileParserLoadJob& operator=(const ThermFileParserLoadJob&);
+};
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  task    (--)  Index of the file to load.
+/// @param[in]  worker  (--)  Not used.
+///
+/// @details  Loads the file's document and times the load.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermFileParserLoadJob::runTask(const int task, const int worker __attribute__((unused)))
+{
+    ThermFileParserFile& file = mFiles[task];
+    const double start = wallTime();
+    TiXmlDocument* doc = new TiXmlDocument();
+    if (doc->LoadFile(file.mFile)) {
+        file.mDoc = doc;
+    } else {
+        delete doc;
+    }
+    file.mLoadTime = wallTime() - start;
+}
 /**************************************************************************************************/
 /* ThermFileParser class */
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,6 +297,10 @@ ThermFileParser::ThermFileParser(const std::string name)
     mEtcFile(),
     mThermInputFile(),
     mThermInputFileRad(),
+    mCacheFile(),
+    mCacheLoaded(false),
+    mNumParseThreads(1),
+    vFiles(),
     numNodes(0),
     vNodeNames(0),
     mNodeMap(),
@@ -93,7 +353,7 @@ ThermFileParser::ThermFileParser(const std::string name)
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 ThermFileParser::~ThermFileParser()
 {
-    // nothing to do
+    releaseFiles();
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @throw    TsParseException
@@ -137,6 +397,26 @@ void ThermFileParser::initialize(const std::string& name)
             TS_PTCS_ERREX(TsInitializationException, "initialization error", "a ThermFileParser has empty object name.")
         }
 
+        /// - Reset the file load & timing data.
+        releaseFiles();
+        vFiles.clear();
+
+        /// - Load the cache-file instead of parsing if it was made from the same XML files.
+        mCacheLoaded = false;
+        uint64_t hash = 0;
+        if (not mCacheFile.empty()) {
+            hash = hashSourceFiles();
+            if (loadCache(hash)) {
+                mCacheLoaded = true;
+                return;
+            }
+        }
+
+        /// - Load the XML documents concurrently, for the reads below to register from.
+        if (mNumParseThreads > 1) {
+            loadFiles();
+        }
+
         /// - Read each file and build data vectors.
         readNodeFile();
         readCondFile();
@@ -148,10 +428,17 @@ void ThermFileParser::initialize(const std::string& name)
         /// - Read ThermInput files for any overrides.
         readThermInputFile();
         readThermInputFileRad();
+        releaseFiles();
+
+        /// - Save the parsed data for the next initialization.
+        if (not mCacheFile.empty()) {
+            writeCache(hash);
+        }
 
     } catch(TsParseException& e)
     {
         /// - Catch validateFile() exception and re-throw.
+        releaseFiles();
         TS_PTCS_ERREX(TsParseException, "parsing error", "Error reading thermal config-files.")
     }
 }
@@ -517,6 +804,315 @@ void ThermFileParser::readThermInputFileRad()
     }
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   uint64_t (--)  64-bit FNV-1a hash of the XML file names and contents.
+///
+/// @details  Hashes the name and contents of each config-file and ThermInput file, in a fixed
+///           order, so that a change to any of them, or to which files are used, changes the hash.
+///           A file that can't be read is hashed by its name and a marker, so that it being
+///           created later also changes the hash.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t ThermFileParser::hashSourceFiles() const
+{
+    const std::string* files[] = {&mNodeFile, &mCondFile, &mRadFile, &mHtrFile, &mPanFile,
+                                  &mEtcFile, &mThermInputFile, &mThermInputFileRad};
+    uint64_t hash = 14695981039346656037ULL;
+    char chunk[65536];
+
+    for (unsigned int i = 0; i < sizeof(files) / sizeof(files[0]); ++i) {
+        /// - The terminating null separates the name from the contents.
+        hashBytes(hash, files[i]->c_str(), files[i]->size() + 1);
+        if (files[i]->empty()) {
+            continue;
+        }
+        std::ifstream file(files[i]->c_str(), std::ios::in | std::ios::binary);
+        if (not file) {
+            hashBytes(hash, "(missing)", 9);
+            continue;
+        }
+        uint64_t length = 0;
+        while (file) {
+            file.read(chunk, sizeof(chunk));
+            const std::size_t count = static_cast<std::size_t>(file.gcount());
+            hashBytes(hash, chunk, count);
+            length += count;
+        }
+        /// - The length separates this file's contents from the next file's name.
+        hashBytes(hash, reinterpret_cast<const char*>(&length), sizeof(length));
+    }
+    return hash;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  hash  (--)  Hash of the current XML file names and contents.
+///
+/// @return   bool (--)  True if the data vectors were loaded from the cache-file.
+///
+/// @details  Memory-maps the cache-file and, if its header matches this format version, platform
+///           and the given hash, copies each data vector from it as a single block and rebuilds
+///           the node map from the node names.  The port numbers of the links are cached, so no
+///           node names are looked up.  A missing, stale or damaged cache-file is not an error;
+///           this returns false with the data vectors cleared, and the XML files are parsed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool ThermFileParser::loadCache(const uint64_t hash)
+{
+    const int fd = open(mCacheFile.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat status;
+    if (0 != fstat(fd, &status)
+            or static_cast<std::size_t>(status.st_size) < sizeof(ThermFileParserCacheHeader)) {
+        close(fd);
+        return false;
+    }
+    const std::size_t size = static_cast<std::size_t>(status.st_size);
+    void* map = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (MAP_FAILED == map) {
+        return false;
+    }
+
+    /// - Check the header before using any of the payload.
+    const char* pos = static_cast<const char*>(map);
+    const char* end = pos + size;
+    ThermFileParserCacheHeader header;
+    std::memcpy(&header, pos, sizeof(header));
+    pos += sizeof(header);
+    bool valid = 0 == std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC))
+             and CACHE_VERSION                    == header.version
+             and 0x01020304                       == header.endian
+             and sizeof(int)                      == header.intSize
+             and sizeof(double)                   == header.doubleSize
+             and hash                             == header.hash
+             and static_cast<uint64_t>(end - pos) == header.payloadSize;
+
+    /// - Copy the payload in the order written by writeCache.
+    std::vector<int> counts;
+    valid = valid
+        and extractVector(pos, end, counts)          and 9 == counts.size()
+        and extractVector(pos, end, vNodeNames)      and extractVector(pos, end, vCapEditGroupList)
+        and extractVector(pos, end, vCapNames)       and extractVector(pos, end, vCapPorts)
+        and extractVector(pos, end, vCapTemperatures)
+        and extractVector(pos, end, vCapCapacitances)
+        and extractVector(pos, end, vCapEditGroupIdentifiers)
+        and extractVector(pos, end, vCondNames)      and extractVector(pos, end, vCondPorts0)
+        and extractVector(pos, end, vCondPorts1)
+        and extractVector(pos, end, vCondConductivities)
+        and extractVector(pos, end, vRadNames)       and extractVector(pos, end, vRadPorts0)
+        and extractVector(pos, end, vRadPorts1)      and extractVector(pos, end, vRadCoefficients)
+        and extractVector(pos, end, vRadViewScalars)
+        and extractVector(pos, end, vHtrNames)       and extractVector(pos, end, vHtrScalars)
+        and extractVector(pos, end, vHtrPorts)       and extractVector(pos, end, vHtrFracs)
+        and extractVector(pos, end, vPanNames)       and extractVector(pos, end, vPanAreas)
+        and extractVector(pos, end, vPanAbsorptivities)
+        and extractVector(pos, end, vPanPorts)       and extractVector(pos, end, vPanFracs)
+        and extractVector(pos, end, vPotNames)       and extractVector(pos, end, vPotPorts)
+        and extractVector(pos, end, vPotTemperatures)
+        and extractVector(pos, end, vPotConductivities)
+        and extractVector(pos, end, vSrcNames)       and extractVector(pos, end, vSrcInits)
+        and extractVector(pos, end, vSrcScalars)     and extractVector(pos, end, vSrcPorts)
+        and extractVector(pos, end, vSrcFracs)
+        and end == pos;
+    munmap(map, size);
+
+    if (not valid) {
+        clearAll();
+        return false;
+    }
+
+    numNodes           = counts[0];
+    numLinksCap        = counts[1];
+    numLinksCond       = counts[2];
+    numLinksRad        = counts[3];
+    numInputEntriesRad = counts[4];
+    numLinksHtr        = counts[5];
+    numLinksPan        = counts[6];
+    numLinksPot        = counts[7];
+    numLinksSrc        = counts[8];
+
+    /// - Rebuild the node map, which the links use to find their ports by name.
+    mNodeMap.clear();
+    for (unsigned int i = 0; i < vNodeNames.size(); ++i) {
+        mNodeMap[vNodeNames[i]] = static_cast<int>(i);
+    }
+    areNodesRegistered = true;
+    return true;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  hash  (--)  Hash of the XML file names and contents that were parsed.
+///
+/// @details  Writes the header and every data vector to a temporary file, and renames it to the
+///           cache-file so that another simulation never maps a partly written cache-file.  Failure
+///           to write the cache-file only issues a warning, since the parsed data is still good.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermFileParser::writeCache(const uint64_t hash)
+{
+    std::vector<int> counts;
+    counts.push_back(numNodes);
+    counts.push_back(numLinksCap);
+    counts.push_back(numLinksCond);
+    counts.push_back(numLinksRad);
+    counts.push_back(numInputEntriesRad);
+    counts.push_back(numLinksHtr);
+    counts.push_back(numLinksPan);
+    counts.push_back(numLinksPot);
+    counts.push_back(numLinksSrc);
+
+    std::string payload;
+    appendVector(payload, counts);
+    appendVector(payload, vNodeNames);
+    appendVector(payload, vCapEditGroupList);
+    appendVector(payload, vCapNames);
+    appendVector(payload, vCapPorts);
+    appendVector(payload, vCapTemperatures);
+    appendVector(payload, vCapCapacitances);
+    appendVector(payload, vCapEditGroupIdentifiers);
+    appendVector(payload, vCondNames);
+    appendVector(payload, vCondPorts0);
+    appendVector(payload, vCondPorts1);
+    appendVector(payload, vCondConductivities);
+    appendVector(payload, vRadNames);
+    appendVector(payload, vRadPorts0);
+    appendVector(payload, vRadPorts1);
+    appendVector(payload, vRadCoefficients);
+    appendVector(payload, vRadViewScalars);
+    appendVector(payload, vHtrNames);
+    appendVector(payload, vHtrScalars);
+    appendVector(payload, vHtrPorts);
+    appendVector(payload, vHtrFracs);
+    appendVector(payload, vPanNames);
+    appendVector(payload, vPanAreas);
+    appendVector(payload, vPanAbsorptivities);
+    appendVector(payload, vPanPorts);
+    appendVector(payload, vPanFracs);
+    appendVector(payload, vPotNames);
+    appendVector(payload, vPotPorts);
+    appendVector(payload, vPotTemperatures);
+    appendVector(payload, vPotConductivities);
+    appendVector(payload, vSrcNames);
+    appendVector(payload, vSrcInits);
+    appendVector(payload, vSrcScalars);
+    appendVector(payload, vSrcPorts);
+    appendVector(payload, vSrcFracs);
+
+    ThermFileParserCacheHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.version     = CACHE_VERSION;
+    header.endian      = 0x01020304;
+    header.intSize     = sizeof(int);
+    header.doubleSize  = sizeof(double);
+    header.hash        = hash;
+    header.payloadSize = payload.size();
+
+    const std::string tempFile = mCacheFile + ".tmp";
+    std::ofstream file(tempFile.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(payload.data(), payload.size());
+    file.close();
+    if (not file or 0 != std::rename(tempFile.c_str(), mCacheFile.c_str())) {
+        std::remove(tempFile.c_str());
+        TS_PTCS_WARNING("Could not write cache-file: " << mCacheFile);
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Clears all data vectors and counts, for a parse after a failed cache load.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermFileParser::clearAll()
+{
+    clearNode();
+    clearCap();
+    clearCond();
+    clearRad();
+    clearHtr();
+    clearPan();
+    clearPot();
+    clearSrc();
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Adds each XML file to be read to the file list, in the order the read methods read
+///           them, and loads their documents on a pool of up to mNumParseThreads threads.  Failure
+///           to start the threads only issues a warning, since the pool then runs the loads on the
+///           threads that did start, or on this thread.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermFileParser::loadFiles()
+{
+    const std::string* files[] = {&mNodeFile, &mCondFile, &mRadFile, &mHtrFile, &mPanFile,
+                                  &mEtcFile, &mThermInputFile, &mThermInputFileRad};
+    for (unsigned int i = 0; i < sizeof(files) / sizeof(files[0]); ++i) {
+        if (not files[i]->empty()) {
+            getFile(*files[i]);
+        }
+    }
+
+    const int numFiles = static_cast<int>(vFiles.size());
+    GunnsThreadPool pool;
+    try {
+        pool.initialize(mName + ".loadPool", std::min(mNumParseThreads, numFiles));
+    } catch (TsInitializationException& e) {
+        TS_PTCS_WARNING("Could not start all XML file load threads.");
+    }
+    ThermFileParserLoadJob job(vFiles);
+    pool.run(&job, numFiles);
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes the XML documents loaded ahead of registration, keeping the timing data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermFileParser::releaseFiles()
+{
+    for (unsigned int i = 0; i < vFiles.size(); ++i) {
+        delete vFiles[i].mDoc;
+        vFiles[i].mDoc = 0;
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  xmlFile  (--)  XML file path and name
+///
+/// @return   ThermFileParserFile& (--)  The load & timing data of the file.
+///
+/// @details  Returns the load & timing data of the given XML file, adding a new entry at the end
+///           of the file list the first time a file is read.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+ThermFileParserFile& ThermFileParser::getFile(const std::string& xmlFile)
+{
+    for (unsigned int i = 0; i < vFiles.size(); ++i) {
+        if (xmlFile == vFiles[i].mFile) {
+            return vFiles[i];
+        }
+    }
+    ThermFileParserFile file;
+    file.mFile         = xmlFile;
+    file.mDoc          = 0;
+    file.mLoadTime     = 0.0;
+    file.mRegisterTime = 0.0;
+    vFiles.push_back(file);
+    return vFiles.back();
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   std::string (--)  Report of the load & register times of each XML file.
+///
+/// @details  Formats the load & register times of each XML file read in the last initialization,
+///           one file per line, and notes when the data was loaded from the cache-file instead.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string ThermFileParser::getTimingReport() const
+{
+    std::ostringstream report;
+    report << mName << " XML file times (s): load, register, file";
+    double loadTotal     = 0.0;
+    double registerTotal = 0.0;
+    report << std::fixed << std::setprecision(6);
+    for (unsigned int i = 0; i < vFiles.size(); ++i) {
+        report << "\n  " << vFiles[i].mLoadTime << ", " << vFiles[i].mRegisterTime << ", "
+               << vFiles[i].mFile;
+        loadTotal     += vFiles[i].mLoadTime;
+        registerTotal += vFiles[i].mRegisterTime;
+    }
+    report << "\n  " << loadTotal << ", " << registerTotal << ", total";
+    if (mCacheLoaded) {
+        report << "\n  (loaded from cache-file " << mCacheFile << ")";
+    }
+    return report.str();
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  xmlFile       (--)  XML file path and name
 /// @param[in]  linkTag       (--)  XML tag which contains the thermal link data
 /// @param[in]  registerLink  (--)  A pointer to a void function that takes a TiXmlElement pointer;
@@ -533,14 +1129,24 @@ void ThermFileParser::readFile(std::string& xmlFile, const char* linkTag,
 {
     try
     {
-        /// - Instantiate a TiXmlDocument for loading data from the file.
-        TiXmlDocument doc;
+        /// - Use the document loaded ahead of registration, if any.
+        ThermFileParserFile& file = getFile(xmlFile);
+        TiXmlDocument* doc = file.mDoc;
 
-        /// - Validate file accessibility and load XML data.
-        openFile(doc, xmlFile);
+        /// - Instantiate a TiXmlDocument for loading data from the file.
+        TiXmlDocument localDoc;
+
+        /// - Otherwise, validate file accessibility and load XML data.
+        double start = wallTime();
+        if (0 == doc) {
+            openFile(localDoc, xmlFile);
+            doc = &localDoc;
+            file.mLoadTime += wallTime() - start;
+            start = wallTime();
+        }
 
         /// - Get the element data from the <list> tag. Raise an error if not found.
-        TiXmlElement* list = getElement(&doc, "list", true);
+        TiXmlElement* list = getElement(doc, "list", true);
         /// - Get the element data from the <linkTag> tag. Don't raise an error if not found.
         TiXmlElement* elem = getElement(list, linkTag, false);
 
@@ -553,6 +1159,7 @@ void ThermFileParser::readFile(std::string& xmlFile, const char* linkTag,
             /// - Advance to the next element.
             elem = elem->NextSiblingElement(linkTag);
         }
+        file.mRegisterTime += wallTime() - start;
 
     } catch(TsParseException& e)
     {
@@ -591,13 +1198,15 @@ void ThermFileParser::openFile(TiXmlDocument& doc, std::string& xmlFile)
     }
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details  Clears Node name vector and map object. Resets the number of Nodes count.
+/// @details  Clears Node name vector, map object and cap-edit group names. Resets the number of
+///           Nodes count.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void ThermFileParser::clearNode()
 {
     /// - Clear any Node data.
     vNodeNames.clear();
     mNodeMap.clear();
+    vCapEditGroupList.clear();
     /// - Clear the number of nodes.
     numNodes = 0;
 }
@@ -612,6 +1221,7 @@ void ThermFileParser::clearCap()
     vCapPorts.clear();
     vCapTemperatures.clear();
     vCapCapacitances.clear();
+    vCapEditGroupIdentifiers.clear();
     /// - Clear the number of capacitance links.
     numLinksCap = 0;
 }
@@ -670,6 +1280,7 @@ void ThermFileParser::clearPan()
     vPanNames.clear();
     vPanAreas.clear();
     vPanAbsorptivities.clear();
+    vPanFracs.clear();
     /// - Clear the number of panels.
     numLinksPan = 0;
 }
@@ -697,6 +1308,8 @@ void ThermFileParser::clearSrc()
     vSrcNames.clear();
     vSrcPorts.clear();
     vSrcInits.clear();
+    vSrcScalars.clear();
+    vSrcFracs.clear();
     /// - Clear the number of sources.
     numLinksSrc = 0;
 }
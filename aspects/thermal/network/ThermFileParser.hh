@@ -20,13 +20,25 @@ PURPOSE:
           - etc-file:  et.cetera; Other link types, namely <potential> and <source>
     ThermalNetwork calls the ThermFileParser's initialize() method, which parses each file's
     specific XML tag structure, and stores the relevant data into its link-specific vectors.
-    ThermalNetwork accesses these vectors and uses their data to construct a GUNNS network.)
+    ThermalNetwork accesses these vectors and uses their data to construct a GUNNS network.
+    Optionally, the parsed vectors are saved to a binary cache-file after the first parse, and
+    later initializations memory-map and bulk-copy the cache instead of parsing the XML, as long
+    as the cache was made from the same contents of all the XML files.
+    Optionally, the XML files are loaded concurrently by a pool of threads before the links are
+    registered from them in the usual order, and the time spent loading and registering each file
+    is kept for a startup profiling report.)
 
 REFERENCE:
    ()
 
 ASSUMPTIONS AND LIMITATIONS:
-   (This class utilizes tinyxml, hence is limited to take in only XML files.)
+   ((This class utilizes tinyxml, hence is limited to take in only XML files.)
+    (The cache-file is in native byte order and type sizes, and is rejected, and re-written after
+     parsing the XML, on a platform that differs, a different cache format version, or a change in
+     any of the XML file names or contents.)
+    (Warnings for skipped links are only issued when the XML is parsed, not on cache loads.)
+    (Only the loading of the XML documents is concurrent; node names are resolved and links are
+     registered on the calling thread, so the data vectors are the same as with serial loading.))
 
 LIBRARY DEPENDENCY:
    (ThermFileParser.o)
@@ -37,10 +49,24 @@ PROGRAMMERS:
 ***************************************************************************************************/
 #include "parsing/tinyxml/tinyxml.hh"
 #include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <stdint.h>
 #include <string>
 #include <vector>
 #include <map>
 ////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    ThermFileParser XML file load and timing data.
+///
+/// @details  Holds an XML file's document while it is loaded ahead of registration, and the time
+///           spent loading and registering the file during the last initialization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+struct ThermFileParserFile
+{
+    std::string    mFile;         /**<    (--) trick_chkpnt_io(**) XML file path and name */
+    TiXmlDocument* mDoc;          /**< ** (--) trick_chkpnt_io(**) document loaded ahead of registration, or null */
+    double         mLoadTime;     /**<    (s)  trick_chkpnt_io(**) wall time spent loading the document */
+    double         mRegisterTime; /**<    (s)  trick_chkpnt_io(**) wall time spent registering data from the document */
+};
+////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    Parses the ThermalNetwork config-files and stores the data into vectors.
 ///
 /// @details  The ThermFileParser class is only used as a member of the ThermalNetwork
@@ -60,9 +86,15 @@ class ThermFileParser
         ThermFileParser(const std::string name = "");
         /// @brief  Default destructor for the ThermFileParser xml reader.
         virtual ~ThermFileParser();
+        /// @brief  Returns the load & register times of each XML file in the last initialization.
+        const std::vector<ThermFileParserFile>& getFileTimes() const;
+        /// @brief  Returns a report of the load & register times of each XML file.
+        std::string getTimingReport() const;
 
     protected:
         static const int                   NOT_FOUND;                /**<    (--)  trick_chkpnt_io(**) result for a node not registered in the Node map */
+        static const char                  CACHE_MAGIC[8];           /**< ** (--)  trick_chkpnt_io(**) identifies a cache-file, at the start of the file */
+        static const uint32_t              CACHE_VERSION;            /**<    (--)  trick_chkpnt_io(**) cache-file format version, changed with the format */
         bool                               areNodesRegistered;       /**<    (--)                      True if Nodes file successfully parsed. */
         std::string                        mName;                    /**<    (--)  trick_chkpnt_io(**) Parser name. */
 
@@ -76,6 +108,10 @@ class ThermFileParser
 
         std::string                        mThermInputFile;          /**<    (--)  trick_chkpnt_io(**) name of thermal input-file to parse */
         std::string                        mThermInputFileRad;       /**<    (--)  trick_chkpnt_io(**) name of radiation thermal input-file to parse */
+        std::string                        mCacheFile;               /**<    (--)  trick_chkpnt_io(**) binary cache-file of the parsed data, empty for no cache */
+        bool                               mCacheLoaded;             /**<    (--)  trick_chkpnt_io(**) True if the last initialize loaded the cache-file instead of parsing */
+        int                                mNumParseThreads;         /**<    (--)  trick_chkpnt_io(**) number of threads loading the XML files, 1 for serial loading */
+        std::vector<ThermFileParserFile>   vFiles;                   /**< ** (--)  trick_chkpnt_io(**) XML files read in the last initialization, in order of first read */
 
         // Node attributes ////////////////////////////////////////////////////////////////////////////
         int                                numNodes;                 /**<    (--)                      number of nodes in the network */
@@ -161,6 +197,21 @@ class ThermFileParser
         /// @brief  Edits existing link data by reading overrides described in the ThermInput file.
         void readThermInputFileRad();
 
+        /// @brief  Returns a hash of the names and contents of all the thermal XML files.
+        uint64_t hashSourceFiles() const;
+        /// @brief  Loads the data vectors from the cache-file if it matches the source files.
+        bool loadCache(const uint64_t hash);
+        /// @brief  Writes the data vectors to the cache-file.
+        void writeCache(const uint64_t hash);
+        /// @brief  Clears all data vectors.
+        void clearAll();
+        /// @brief  Loads all the XML documents concurrently ahead of registration.
+        void loadFiles();
+        /// @brief  Deletes the XML documents loaded ahead of registration.
+        void releaseFiles();
+        /// @brief  Returns the load & timing data of the given XML file, adding it if not present.
+        ThermFileParserFile& getFile(const std::string& xmlFile);
+
         /// @brief  Private method used to generically ready any of the thermal XML files.
         void readFile(std::string& xmlFile, const char* linkTag, void (ThermFileParser::*registerLink)(TiXmlElement*));
         /// @brief  Private method used to validate file accessibility and set doc member.
@@ -245,4 +296,15 @@ class ThermFileParser
 };
 /// @}
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   std::vector<ThermFileParserFile> (--) The XML files read in the last initialization.
+///
+/// @details  Returns the XML files read in the last initialization, in the order they were first
+///           read, with the wall time spent loading and registering each.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const std::vector<ThermFileParserFile>& ThermFileParser::getFileTimes() const
+{
+    return vFiles;
+}
+
 #endif
@@ -10,6 +10,7 @@ LIBRARY DEPENDENCY:
     (aspects/thermal/GunnsThermalCapacitor.o)
     (core/GunnsBasicConductor.o)
     (aspects/thermal/GunnsThermalRadiation.o)
+    (aspects/thermal/GunnsThermalRadiationBatch.o)
     (aspects/thermal/GunnsThermalHeater.o)
     (aspects/thermal/GunnsThermalPanel.o)
     (aspects/thermal/GunnsThermalPotential.o)
@@ -33,6 +34,8 @@ LIBRARY DEPENDENCY:
 /// @param[in]  htrFile   (--)  xml file with heater link data
 /// @param[in]  panFile   (--)  xml file with thermal-panel data
 /// @param[in]  etcFile   (--)  xml file with other thermal link data (potentials, sources, etc)
+/// @param[in]  cacheFile (--)  binary cache-file of the parsed xml data, empty for no cache
+/// @param[in]  numParseThreads (--)  number of threads loading the xml files, 1 for serial loading
 ///
 /// @details    Constructs this ThermalNetwork configuration data.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -42,14 +45,18 @@ ThermalNetworkConfigData::ThermalNetworkConfigData(
         std::string radFile,
         std::string htrFile,
         std::string panFile,
-        std::string etcFile)
+        std::string etcFile,
+        std::string cacheFile,
+        int         numParseThreads)
     :
     cNodeFile(nodeFile),
     cCondFile(condFile),
     cRadFile(radFile),
     cHtrFile(htrFile),
     cPanFile(panFile),
-    cEtcFile(etcFile)
+    cEtcFile(etcFile),
+    cCacheFile(cacheFile),
+    cNumParseThreads(numParseThreads)
 {
     // nothing to do
 }
@@ -65,7 +72,9 @@ ThermalNetworkConfigData::ThermalNetworkConfigData(const ThermalNetworkConfigDat
     cRadFile(that.cRadFile),
     cHtrFile(that.cHtrFile),
     cPanFile(that.cPanFile),
-    cEtcFile(that.cEtcFile)
+    cEtcFile(that.cEtcFile),
+    cCacheFile(that.cCacheFile),
+    cNumParseThreads(that.cNumParseThreads)
 {
     // nothing to do
 }
@@ -138,6 +147,8 @@ ThermalNetwork::ThermalNetwork(const std::string& name)
     mHtrPowerElectrical(0),
     parser(name + ".parser"),
     netIslandAnalyzer(netNodeList),
+    mRadiationBatchFlag(false),
+    mRadiationBatch(),
     numCapEditGroups(0),
     mCapEditScaleFactor(0),
     mCapEditScalePrev(0),
@@ -203,6 +214,8 @@ void ThermalNetwork::initNodes(const std::string& name)
     parser.mEtcFile           = mConfig.cEtcFile;
     parser.mThermInputFile    = mInput.iThermInputFile;
     parser.mThermInputFileRad = mInput.iInputRadFile;
+    parser.mCacheFile         = mConfig.cCacheFile;
+    parser.mNumParseThreads   = mConfig.cNumParseThreads;
 
     /// - Populate the parser's C++ vectors with data from the config-files.
     parser.initialize(mName + ".parser");
@@ -232,6 +245,11 @@ void ThermalNetwork::initNetwork()
     /// - Initialize the link objects at their ports with correct config/input data.
     buildLinks();
 
+    /// - Attach the radiation links to the batch if it has been selected.
+    if (mRadiationBatchFlag) {
+        mRadiationBatch.initialize(mName + ".mRadiationBatch", mRadiationLinks, numLinksRad);
+    }
+
     /// - Initialize the island analyzer spotter.
     GunnsBasicIslandAnalyzerConfigData config(mName + ".netIslandAnalyzer");
     GunnsBasicIslandAnalyzerInputData input;
@@ -309,6 +327,11 @@ void ThermalNetwork::stepSpottersPre(const double timeStep)
     /// - Perform capacitor group edits.
     editCapacitanceGroups();
 
+    /// - Linearize the radiation links from the last solution, before the solver steps them.
+    if (mRadiationBatch.isActive()) {
+        mRadiationBatch.update();
+    }
+
     /// - Call the island analyzer pre-solultion update.
     netIslandAnalyzer.stepPreSolver(timeStep);
 }
@@ -1173,7 +1196,8 @@ void ThermalNetwork::cleanUp()
     mPotentialConfigData = 0;
     TS_DELETE_ARRAY(mPotentialLinks);
 
-    /// - Delete Radiation links.
+    /// - Detach and delete Radiation links.
+    mRadiationBatch.release();
     for(int i = numLinksRad-1; i >= 0; --i)
     {
         delete mRadiationInputData[i];
@@ -1247,6 +1271,28 @@ void ThermalNetwork::setMalfHtrMiswire(const bool flag, const int* index)
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] flag  (--) True linearizes the radiation links together in a batch.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Selects whether the radiation links are linearized together in one pass over
+///           contiguous arrays each step, rather than each link computing its own effective
+///           conductivity as it is stepped.  Both give the same admittances.  This can be called
+///           before initialization, in which case it takes effect in initNetwork, or at run-time.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermalNetwork::setRadiationBatch(const bool flag)
+{
+    mRadiationBatchFlag = flag;
+
+    if (not flag) {
+        mRadiationBatch.release();
+    } else if (numLinksRad > 0 and mRadiationLinks and mRadiationLinks[0].isInitialized()
+               and not mRadiationBatch.isActive()) {
+        mRadiationBatch.initialize(mName + ".mRadiationBatch", mRadiationLinks, numLinksRad);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @throws   TsParseException
 ///
@@ -1260,3 +1306,13 @@ int ThermalNetwork::getNumLocalNodes()
     netNumLocalNodes = parser.numNodes;
     return netNumLocalNodes;
 }
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   std::string (--)  Report of the time spent loading & registering each xml file.
+///
+/// @details  Returns the file parser's timing report from the last initialization, for startup
+///           profiling.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string ThermalNetwork::getParseTimingReport() const
+{
+    return parser.getTimingReport();
+}
@@ -57,6 +57,7 @@ PROGRAMMERS:
 #include "aspects/thermal/GunnsThermalCapacitor.hh"
 #include "core/GunnsBasicConductor.hh"
 #include "aspects/thermal/GunnsThermalRadiation.hh"
+#include "aspects/thermal/GunnsThermalRadiationBatch.hh"
 #include "aspects/thermal/GunnsThermalHeater.hh"
 #include "aspects/thermal/GunnsThermalPanel.hh"
 #include "aspects/thermal/GunnsThermalPotential.hh"
@@ -81,6 +82,8 @@ class ThermalNetworkConfigData
         std::string  cHtrFile;  /**< (--) trick_chkpnt_io(**) name of xml file with heater/source link data */
         std::string  cPanFile;  /**< (--) trick_chkpnt_io(**) name of xml file with thermal-panel data */
         std::string  cEtcFile;  /**< (--) trick_chkpnt_io(**) name of xml file with other thermal link data */
+        std::string  cCacheFile; /**< (--) trick_chkpnt_io(**) name of binary cache-file of the parsed xml data, empty for no cache */
+        int          cNumParseThreads; /**< (--) trick_chkpnt_io(**) number of threads loading the xml files, 1 for serial loading */
 
         /// @brief   Default constructs this ThermalNetwork configuration data.
         ThermalNetworkConfigData(std::string nodeFile = "",
@@ -88,7 +91,9 @@ class ThermalNetworkConfigData
                                  std::string radFile = "",
                                  std::string htrFile = "",
                                  std::string panFile = "",
-                                 std::string etcFile = "");
+                                 std::string etcFile = "",
+                                 std::string cacheFile = "",
+                                 int         numParseThreads = 1);
         /// @brief   Default destructs this ThermalNetwork configuration data.
         ~ThermalNetworkConfigData();
         /// @brief   Copy constructs this ThermalNetwork configuration data.
@@ -175,6 +180,8 @@ class ThermalNetwork : public GunnsNetworkBase
 
         /// @brief  Returns the number of nodes defined in this network.
         virtual int  getNumLocalNodes();
+        /// @brief  Returns a report of the time spent loading & registering each xml file.
+        std::string  getParseTimingReport() const;
         /// @brief  Parses config files, initializes the nodes and allocates memory for links.
         virtual void initNodes(const std::string& name);
         /// @brief  Initializes the links, spotter and solver.
@@ -197,6 +204,8 @@ class ThermalNetwork : public GunnsNetworkBase
         void setIslandMode(const Gunns::IslandMode mode);
         /// @brief Sets and resets the heater miswire malfunction.
         void setMalfHtrMiswire(const bool flag = false, const int* index = 0);
+        /// @brief Sets whether the radiation links are linearized together in a batch.
+        void setRadiationBatch(const bool flag);
 
    protected:
         /// @details  The mHtrPowerElectrical array will be set by the simbus with values from EPS.
@@ -208,6 +217,11 @@ class ThermalNetwork : public GunnsNetworkBase
 
         GunnsBasicIslandAnalyzer netIslandAnalyzer; /**< (--)                 Island analyzer for debugging */
 
+        /// - Batched radiation link linearization
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        bool mRadiationBatchFlag;            /**<    (--) trick_chkpnt_io(**) Radiation links are linearized in mRadiationBatch */
+        GunnsThermalRadiationBatch mRadiationBatch; /**< ** (--) trick_chkpnt_io(**) Batch linearizing the radiation links */
+
         /// - Capacitance Edit Groups
         ////////////////////////////////////////////////////////////////////////////////////////////
         int     numCapEditGroups;            /**< *o (--) trick_chkpnt_io(**) Number of capacitor link capacitance edit groups    */
@@ -8,6 +8,8 @@
 #include "UtThermFileParser.hh"
 #include "software/exceptions/TsParseException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <string>
 
@@ -623,3 +625,260 @@ void UtThermFileParser::testThermInput()
 
     std::cout << " Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  expected  (--)  Parser holding the expected data.
+/// @param[in]  actual    (--)  Parser to verify.
+///
+/// @details  Verifies that two parsers hold the same counts, data vectors and node map.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermFileParser::verifySameData(FriendlyThermFileParser& expected,
+                                       FriendlyThermFileParser& actual)
+{
+    CPPUNIT_ASSERT(expected.areNodesRegistered       == actual.areNodesRegistered);
+    CPPUNIT_ASSERT(expected.numNodes                 == actual.numNodes);
+    CPPUNIT_ASSERT(expected.vNodeNames               == actual.vNodeNames);
+    CPPUNIT_ASSERT(expected.mNodeMap                 == actual.mNodeMap);
+    CPPUNIT_ASSERT(expected.vCapEditGroupList        == actual.vCapEditGroupList);
+    CPPUNIT_ASSERT(expected.numLinksCap              == actual.numLinksCap);
+    CPPUNIT_ASSERT(expected.vCapNames                == actual.vCapNames);
+    CPPUNIT_ASSERT(expected.vCapPorts                == actual.vCapPorts);
+    CPPUNIT_ASSERT(expected.vCapTemperatures         == actual.vCapTemperatures);
+    CPPUNIT_ASSERT(expected.vCapCapacitances         == actual.vCapCapacitances);
+    CPPUNIT_ASSERT(expected.vCapEditGroupIdentifiers == actual.vCapEditGroupIdentifiers);
+    CPPUNIT_ASSERT(expected.numLinksCond             == actual.numLinksCond);
+    CPPUNIT_ASSERT(expected.vCondNames               == actual.vCondNames);
+    CPPUNIT_ASSERT(expected.vCondPorts0              == actual.vCondPorts0);
+    CPPUNIT_ASSERT(expected.vCondPorts1              == actual.vCondPorts1);
+    CPPUNIT_ASSERT(expected.vCondConductivities      == actual.vCondConductivities);
+    CPPUNIT_ASSERT(expected.numLinksRad              == actual.numLinksRad);
+    CPPUNIT_ASSERT(expected.numInputEntriesRad       == actual.numInputEntriesRad);
+    CPPUNIT_ASSERT(expected.vRadNames                == actual.vRadNames);
+    CPPUNIT_ASSERT(expected.vRadPorts0               == actual.vRadPorts0);
+    CPPUNIT_ASSERT(expected.vRadPorts1               == actual.vRadPorts1);
+    CPPUNIT_ASSERT(expected.vRadCoefficients         == actual.vRadCoefficients);
+    CPPUNIT_ASSERT(expected.vRadViewScalars          == actual.vRadViewScalars);
+    CPPUNIT_ASSERT(expected.numLinksHtr              == actual.numLinksHtr);
+    CPPUNIT_ASSERT(expected.vHtrNames                == actual.vHtrNames);
+    CPPUNIT_ASSERT(expected.vHtrScalars              == actual.vHtrScalars);
+    CPPUNIT_ASSERT(expected.vHtrPorts                == actual.vHtrPorts);
+    CPPUNIT_ASSERT(expected.vHtrFracs                == actual.vHtrFracs);
+    CPPUNIT_ASSERT(expected.numLinksPan              == actual.numLinksPan);
+    CPPUNIT_ASSERT(expected.vPanNames                == actual.vPanNames);
+    CPPUNIT_ASSERT(expected.vPanAreas                == actual.vPanAreas);
+    CPPUNIT_ASSERT(expected.vPanAbsorptivities       == actual.vPanAbsorptivities);
+    CPPUNIT_ASSERT(expected.vPanPorts                == actual.vPanPorts);
+    CPPUNIT_ASSERT(expected.vPanFracs                == actual.vPanFracs);
+    CPPUNIT_ASSERT(expected.numLinksPot              == actual.numLinksPot);
+    CPPUNIT_ASSERT(expected.vPotNames                == actual.vPotNames);
+    CPPUNIT_ASSERT(expected.vPotPorts                == actual.vPotPorts);
+    CPPUNIT_ASSERT(expected.vPotTemperatures         == actual.vPotTemperatures);
+    CPPUNIT_ASSERT(expected.vPotConductivities       == actual.vPotConductivities);
+    CPPUNIT_ASSERT(expected.numLinksSrc              == actual.numLinksSrc);
+    CPPUNIT_ASSERT(expected.vSrcNames                == actual.vSrcNames);
+    CPPUNIT_ASSERT(expected.vSrcInits                == actual.vSrcInits);
+    CPPUNIT_ASSERT(expected.vSrcScalars              == actual.vSrcScalars);
+    CPPUNIT_ASSERT(expected.vSrcPorts                == actual.vSrcPorts);
+    CPPUNIT_ASSERT(expected.vSrcFracs                == actual.vSrcFracs);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for save, load and invalidation of the cache-file.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermFileParser::testCache()
+{
+    std::cout << "\n ThermFileParser 13: Testing cache-file.........................";
+
+    const std::string cacheFile = "ThermParser_test.cache";
+    const std::string inputFile = "ThermInput_cache.xml";
+    std::remove(cacheFile.c_str());
+
+    /// - Make a copy of the ThermInput file that can be edited.
+    {
+        std::ifstream source(tThermInputFile.c_str(), std::ios::binary);
+        std::ofstream copy(inputFile.c_str(), std::ios::binary | std::ios::trunc);
+        copy << source.rdbuf();
+    }
+
+    /// - Parse without a cache-file for the expected data.
+    FriendlyThermFileParser expected;
+    expected.mNodeFile       = tNodeFile;
+    expected.mCondFile       = tCondFile;
+    expected.mRadFile        = tRadFile;
+    expected.mHtrFile        = tHtrFile;
+    expected.mPanFile        = tPanFile;
+    expected.mEtcFile        = tEtcFile;
+    expected.mThermInputFile = inputFile;
+    expected.initialize("article_expected");
+
+    /// @test  No cache-file is used or written when none is named.
+    CPPUNIT_ASSERT(not expected.mCacheLoaded);
+    CPPUNIT_ASSERT(not std::ifstream(cacheFile.c_str()));
+
+    /// @test  The first initialize parses the XML and writes the cache-file.
+    FriendlyThermFileParser first;
+    first.mNodeFile       = tNodeFile;
+    first.mCondFile       = tCondFile;
+    first.mRadFile        = tRadFile;
+    first.mHtrFile        = tHtrFile;
+    first.mPanFile        = tPanFile;
+    first.mEtcFile        = tEtcFile;
+    first.mThermInputFile = inputFile;
+    first.mCacheFile      = cacheFile;
+    first.initialize("article_first");
+    CPPUNIT_ASSERT(not first.mCacheLoaded);
+    CPPUNIT_ASSERT(std::ifstream(cacheFile.c_str()));
+    verifySameData(expected, first);
+
+    /// @test  The next initialize loads the same data from the cache-file.
+    FriendlyThermFileParser second;
+    second.mNodeFile       = tNodeFile;
+    second.mCondFile       = tCondFile;
+    second.mRadFile        = tRadFile;
+    second.mHtrFile        = tHtrFile;
+    second.mPanFile        = tPanFile;
+    second.mEtcFile        = tEtcFile;
+    second.mThermInputFile = inputFile;
+    second.mCacheFile      = cacheFile;
+    second.initialize("article_second");
+    CPPUNIT_ASSERT(second.mCacheLoaded);
+    verifySameData(expected, second);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(12.34, second.vCapTemperatures.at(0), tTol);
+
+    /// @test  Re-initializing from the cache-file doesn't duplicate any data.
+    second.initialize("article_second");
+    CPPUNIT_ASSERT(second.mCacheLoaded);
+    verifySameData(expected, second);
+
+    /// @test  A change to the contents of any XML file causes a re-parse and a new cache-file.
+    {
+        std::ofstream edit(inputFile.c_str(), std::ios::app);
+        edit << "<!-- edited -->\n";
+    }
+    second.initialize("article_second");
+    CPPUNIT_ASSERT(not second.mCacheLoaded);
+    verifySameData(expected, second);
+    second.initialize("article_second");
+    CPPUNIT_ASSERT(second.mCacheLoaded);
+    verifySameData(expected, second);
+
+    /// @test  A change to which XML files are used causes a re-parse.
+    second.mThermInputFile = "";
+    second.initialize("article_second");
+    CPPUNIT_ASSERT(not second.mCacheLoaded);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tCapTemperature, second.vCapTemperatures.at(tCap), tTol);
+    CPPUNIT_ASSERT(expected.vCapTemperatures != second.vCapTemperatures);
+    second.mThermInputFile = inputFile;
+    second.initialize("article_second");
+    CPPUNIT_ASSERT(not second.mCacheLoaded);
+    verifySameData(expected, second);
+
+    /// @test  A cache-file with a different format version is rejected and re-written.
+    {
+        std::fstream cache(cacheFile.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+        const uint32_t version = ThermFileParser::CACHE_VERSION + 1;
+        cache.seekp(sizeof(ThermFileParser::CACHE_MAGIC));
+        cache.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    }
+    second.initialize("article_second");
+    CPPUNIT_ASSERT(not second.mCacheLoaded);
+    verifySameData(expected, second);
+    second.initialize("article_second");
+    CPPUNIT_ASSERT(second.mCacheLoaded);
+
+    /// @test  A cache-file with a damaged payload is rejected without leaving any loaded data.  The
+    ///        node names count, after the 40-byte header and the 9 link counts, is made too large.
+    {
+        std::fstream cache(cacheFile.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+        const uint32_t bad = 0x7FFFFFFF;
+        cache.seekp(40 + 10 * sizeof(uint32_t));
+        cache.write(reinterpret_cast<const char*>(&bad), sizeof(bad));
+    }
+    second.initialize("article_second");
+    CPPUNIT_ASSERT(not second.mCacheLoaded);
+    verifySameData(expected, second);
+
+    std::remove(cacheFile.c_str());
+    std::remove(inputFile.c_str());
+
+    std::cout << " Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for concurrent file loading and the file timing report.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermFileParser::testParallel()
+{
+    std::cout << "\n ThermFileParser 14: Testing concurrent file loading.............";
+
+    /// - Parse serially for the expected data.
+    FriendlyThermFileParser expected;
+    expected.mNodeFile       = tNodeFile;
+    expected.mCondFile       = tCondFile;
+    expected.mRadFile        = tRadFile;
+    expected.mHtrFile        = tHtrFile;
+    expected.mPanFile        = tPanFile;
+    expected.mEtcFile        = tEtcFile;
+    expected.mThermInputFile = tThermInputFile;
+    expected.initialize("article_expected");
+
+    /// @test  Serial loading reports each file once, in order of first read, without documents.
+    const std::string files[] = {tNodeFile, tCondFile, tRadFile, tHtrFile, tPanFile, tEtcFile,
+                                 tThermInputFile};
+    const unsigned int numFiles = sizeof(files) / sizeof(files[0]);
+    CPPUNIT_ASSERT_EQUAL(numFiles, static_cast<unsigned int>(expected.getFileTimes().size()));
+    for (unsigned int i = 0; i < numFiles; ++i) {
+        CPPUNIT_ASSERT(files[i] == expected.getFileTimes()[i].mFile);
+        CPPUNIT_ASSERT(0 == expected.getFileTimes()[i].mDoc);
+        CPPUNIT_ASSERT(expected.getFileTimes()[i].mLoadTime     > 0.0);
+        CPPUNIT_ASSERT(expected.getFileTimes()[i].mRegisterTime > 0.0);
+    }
+
+    /// @test  Concurrent loading, with fewer and more threads than files, gives the same data and
+    ///        file order, and releases the documents.
+    const int threads[] = {2, 16};
+    for (unsigned int t = 0; t < sizeof(threads) / sizeof(threads[0]); ++t) {
+        FriendlyThermFileParser article;
+        article.mNodeFile        = tNodeFile;
+        article.mCondFile        = tCondFile;
+        article.mRadFile         = tRadFile;
+        article.mHtrFile         = tHtrFile;
+        article.mPanFile         = tPanFile;
+        article.mEtcFile         = tEtcFile;
+        article.mThermInputFile  = tThermInputFile;
+        article.mNumParseThreads = threads[t];
+        article.initialize("article_parallel");
+        verifySameData(expected, article);
+        CPPUNIT_ASSERT_EQUAL(numFiles, static_cast<unsigned int>(article.getFileTimes().size()));
+        for (unsigned int i = 0; i < numFiles; ++i) {
+            CPPUNIT_ASSERT(files[i] == article.getFileTimes()[i].mFile);
+            CPPUNIT_ASSERT(0 == article.getFileTimes()[i].mDoc);
+            CPPUNIT_ASSERT(article.getFileTimes()[i].mLoadTime     > 0.0);
+            CPPUNIT_ASSERT(article.getFileTimes()[i].mRegisterTime > 0.0);
+        }
+
+        /// @test  Re-initializing resets the file list.
+        article.initialize("article_parallel");
+        verifySameData(expected, article);
+        CPPUNIT_ASSERT_EQUAL(numFiles, static_cast<unsigned int>(article.getFileTimes().size()));
+    }
+
+    /// @test  The timing report lists each file and the totals.
+    const std::string report = expected.getTimingReport();
+    for (unsigned int i = 0; i < numFiles; ++i) {
+        CPPUNIT_ASSERT(std::string::npos != report.find(files[i]));
+    }
+    CPPUNIT_ASSERT(std::string::npos != report.find("total"));
+
+    /// @test  A file that fails to load concurrently is reported the same as when serial.
+    FriendlyThermFileParser article;
+    article.mNodeFile        = tNodeFile;
+    article.mCondFile        = "ThermNodes_illformed.xml";
+    article.mNumParseThreads = 4;
+    CPPUNIT_ASSERT_THROW(article.initialize("article_illformed"), TsParseException);
+    CPPUNIT_ASSERT(0 == article.getFileTimes()[0].mDoc);
+    article.mCondFile        = "calabria.xml";
+    CPPUNIT_ASSERT_THROW(article.initialize("article_missing"), TsParseException);
+
+    std::cout << " Pass";
+}
@@ -75,6 +75,10 @@ class UtThermFileParser: public CppUnit::TestFixture
         void testSrc();
         /// @brief  Tests for correct edit of data by reading of ThermInput file.
         void testThermInput();
+        /// @brief  Tests for save, load and invalidation of the cache-file.
+        void testCache();
+        /// @brief  Tests for concurrent file loading and the file timing report.
+        void testParallel();
 
     private:
         CPPUNIT_TEST_SUITE(UtThermFileParser);
@@ -89,6 +93,8 @@ class UtThermFileParser: public CppUnit::TestFixture
         CPPUNIT_TEST(testPot);
         CPPUNIT_TEST(testSrc);
         CPPUNIT_TEST(testThermInput);
+        CPPUNIT_TEST(testCache);
+        CPPUNIT_TEST(testParallel);
         CPPUNIT_TEST_SUITE_END();
 
         /// @brief  (s)  Nominal time step
@@ -275,6 +281,9 @@ class UtThermFileParser: public CppUnit::TestFixture
         /// @brief  (W)  Initial source flux (heat rate) of the test source link.
         double tSrcFlux;
 
+        /// @brief  Verifies that two parsers hold the same data.
+        void verifySameData(FriendlyThermFileParser& expected, FriendlyThermFileParser& actual);
+
         /// @brief Copy constructor unavailable since declared private and not implemented.
         UtThermFileParser(const UtThermFileParser& that);
         /// @brief Assignment operator unavailable since declared private and not implemented.
@@ -142,6 +142,8 @@ void UtThermalNetwork::testConfig()
     CPPUNIT_ASSERT_MESSAGE( "cHtrFile", tHtrFile == config.cHtrFile);
     CPPUNIT_ASSERT_MESSAGE( "cPanFile", tPanFile == config.cPanFile);
     CPPUNIT_ASSERT_MESSAGE( "cEtcFile", "" == config.cEtcFile);
+    CPPUNIT_ASSERT_MESSAGE("cCacheFile", "" == config.cCacheFile);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("cNumParseThreads", 1, config.cNumParseThreads);
 
     /// - Default construct config.
     ThermalNetworkConfigData configDefault;
@@ -152,9 +154,15 @@ void UtThermalNetwork::testConfig()
     CPPUNIT_ASSERT_MESSAGE( "cHtrFile", "" == configDefault.cHtrFile );
     CPPUNIT_ASSERT_MESSAGE( "cPanFile", "" == configDefault.cPanFile );
     CPPUNIT_ASSERT_MESSAGE( "cEtcFile", "" == configDefault.cEtcFile );
+    CPPUNIT_ASSERT_MESSAGE("cCacheFile", "" == configDefault.cCacheFile );
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("cNumParseThreads", 1, configDefault.cNumParseThreads );
 
-    /// - Copy construct config.
+    /// - Copy construct config with a cache-file.
+    config.cCacheFile       = "thermal.cache";
+    config.cNumParseThreads = 4;
     ThermalNetworkConfigData configCopy(config);
+    CPPUNIT_ASSERT_MESSAGE("cCacheFile", "thermal.cache" == configCopy.cCacheFile);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("cNumParseThreads", 4, configCopy.cNumParseThreads);
     /// @test   Copied config data.
     CPPUNIT_ASSERT_MESSAGE("cNodeFile", tNodeFile == config.cNodeFile);
     CPPUNIT_ASSERT_MESSAGE("cCondFile", tCondFile == config.cCondFile);
@@ -287,6 +295,14 @@ void UtThermalNetwork::testInitialize()
     /// @test  Repeat initialization doesn't cause an explosion.
     CPPUNIT_ASSERT_NO_THROW_MESSAGE("repeat initialize", tArticle->initialize() );
 
+    /// @test  Initialization with concurrent xml file loading, and its timing report.
+    tArticle->mConfig.cNumParseThreads = 3;
+    CPPUNIT_ASSERT_NO_THROW_MESSAGE("parallel initialize", tArticle->initialize() );
+    CPPUNIT_ASSERT_EQUAL(parserFriendly.numLinksCap,  tArticle->numLinksCap);
+    CPPUNIT_ASSERT_EQUAL(parserFriendly.numLinksRad,  tArticle->numLinksRad);
+    CPPUNIT_ASSERT(std::string::npos
+                   != tArticle->getParseTimingReport().find(tArticle->mConfig.cNodeFile));
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// - Default construct a test article
     FriendlyThermalNetwork article0("article0");
@@ -1241,3 +1257,63 @@ void UtThermalNetwork::testSuperNetwork()
 
     std::cout << "... Pass";
 }
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the batched radiation link linearization gives exactly the same solution as the
+///           radiation links linearizing themselves, when selected before initialization and when
+///           toggled at run-time.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermalNetwork::testRadiationBatch()
+{
+    const char* test = "ThermalNetwork 14: Test radiation batch...........................";
+    std::cout << "\n " << test;
+    TEST_HS(test);
+
+    /// - Configure a second instance of the test network with the radiation batch selected.
+    FriendlyThermalNetwork article(tName);
+    article.mConfig.cNodeFile = tNodeFile;
+    article.mConfig.cCondFile = tCondFile;
+    article.mConfig.cRadFile  = tRadFile;
+    article.mConfig.cHtrFile  = tHtrFile;
+    article.mConfig.cPanFile  = tPanFile;
+    article.mConfig.cEtcFile  = tEtcFile;
+    article.setRadiationBatch(true);
+    CPPUNIT_ASSERT(not article.mRadiationBatch.isActive());
+
+    /// @test  The batch is attached to the radiation links at initialization.
+    article.initialize();
+    CPPUNIT_ASSERT(0 < article.numLinksRad);
+    CPPUNIT_ASSERT(article.mRadiationBatch.isActive());
+    CPPUNIT_ASSERT(article.numLinksRad == article.mRadiationBatch.getNumLinks());
+
+    /// @test  Both networks step to exactly the same temperatures & radiation conductivities, with
+    ///        the batch attached to one of them, then to the other, then to neither.
+    for (int step = 0; step < 9; ++step) {
+        if (3 == step) {
+            article.setRadiationBatch(false);
+            tArticle->setRadiationBatch(true);
+            CPPUNIT_ASSERT(not article.mRadiationBatch.isActive());
+            CPPUNIT_ASSERT(tArticle->mRadiationBatch.isActive());
+        } else if (6 == step) {
+            tArticle->setRadiationBatch(false);
+            CPPUNIT_ASSERT(not tArticle->mRadiationBatch.isActive());
+        }
+        tArticle->update(tTimeStep);
+        article.update(tTimeStep);
+        for (int i = 0; i < tArticle->numLinksCap; ++i) {
+            CPPUNIT_ASSERT(tArticle->mCapacitanceLinks[i].getTemperature()
+                        == article.mCapacitanceLinks[i].getTemperature());
+        }
+        for (int i = 0; i < tArticle->numLinksRad; ++i) {
+            CPPUNIT_ASSERT(tArticle->mRadiationLinks[i].getEffectiveConductivity()
+                        == article.mRadiationLinks[i].getEffectiveConductivity());
+        }
+    }
+
+    /// @test  Re-initialization re-attaches the batch to the new radiation links.
+    article.setRadiationBatch(true);
+    article.initialize();
+    CPPUNIT_ASSERT(article.mRadiationBatch.isActive());
+    CPPUNIT_ASSERT(article.numLinksRad == article.mRadiationBatch.getNumLinks());
+
+    std::cout << "... Pass";
+}
@@ -0,0 +1,244 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    (
+        (aspects/thermal/GunnsThermalRadiationBatch.o)
+    )
+***************************************************************************************************/
+#include "UtGunnsThermalRadiationBatch.hh"
+#include "software/exceptions/TsInitializationException.hh"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsThermalRadiationBatch class.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsThermalRadiationBatch::UtGunnsThermalRadiationBatch()
+    :
+    tArticle(),
+    tConfigData(),
+    tInputData(),
+    tLinks(),
+    tReference(),
+    tNodes(),
+    tNodeList(),
+    tNetworkLinks(),
+    tTimeStep()
+{
+    // Nothing to do
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsThermalRadiationBatch class.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsThermalRadiationBatch::~UtGunnsThermalRadiationBatch()
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBatch::tearDown()
+{
+    /// - Deletes for news in setUp
+    tArticle.release();
+    delete tInputData;
+    delete tConfigData;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.  Initializes two identical sets of links between the
+///           same nodes, one set to attach to the batch and one to compute their own conductivity.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBatch::setUp()
+{
+    tNodeList.mNumNodes = N_NODES;
+    tNodeList.mNodes    = tNodes;
+    tTimeStep           = 0.1;
+    tNetworkLinks.clear();
+
+    tConfigData = new GunnsThermalRadiationConfigData("tLinks", &tNodeList, 1.0e-8);
+    tInputData  = new GunnsThermalRadiationInputData(false, 0.0, 0.6);
+
+    for (int i = 0; i < N_LINKS; ++i) {
+        tConfigData->mDefaultConductivity = 1.0e-8 * (i + 1);
+        tLinks[i].initialize    (*tConfigData, *tInputData, tNetworkLinks, i, (i + 1) % N_NODES);
+        tReference[i].initialize(*tConfigData, *tInputData, tNetworkLinks, i, (i + 1) % N_NODES);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  link  (--)  Index of the link in both sets.
+/// @param[in]  t0    (K)   Port 0 temperature.
+/// @param[in]  t1    (K)   Port 1 temperature.
+///
+/// @details  Sets the port temperatures of the link in both sets, as the solver would.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBatch::setTemperatures(const int link, const double t0,
+                                                   const double t1)
+{
+    tLinks[link].getPotentialVector()[0]     = t0;
+    tLinks[link].getPotentialVector()[1]     = t1;
+    tReference[link].getPotentialVector()[0] = t0;
+    tReference[link].getPotentialVector()[1] = t1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for default construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBatch::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsThermalRadiationBatch 01: testDefaultConstruction ..........";
+
+    FriendlyGunnsThermalRadiationBatch article;
+    CPPUNIT_ASSERT(""  == article.mName);
+    CPPUNIT_ASSERT(0   == article.mLinks);
+    CPPUNIT_ASSERT(0   == article.mNumLinks);
+    CPPUNIT_ASSERT(0   == article.mCoefficient);
+    CPPUNIT_ASSERT(0   == article.mDefault);
+    CPPUNIT_ASSERT(0   == article.mTemperature0);
+    CPPUNIT_ASSERT(0   == article.mTemperature1);
+    CPPUNIT_ASSERT(0   == article.mConductivity);
+    CPPUNIT_ASSERT(not article.isActive());
+    CPPUNIT_ASSERT(0.0 == article.getConductivity(0));
+
+    /// @test  New/delete for code coverage.
+    GunnsThermalRadiationBatch* article2 = new GunnsThermalRadiationBatch();
+    delete article2;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for nominal initialization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBatch::testInitialization()
+{
+    std::cout << "\n UtGunnsThermalRadiationBatch 02: testInitialization ...............";
+
+    setTemperatures(0, 300.0, 250.0);
+    tArticle.initialize("tArticle", tLinks, N_LINKS);
+
+    /// @test  Arrays are allocated and the links are attached.
+    CPPUNIT_ASSERT("tArticle" == tArticle.mName);
+    CPPUNIT_ASSERT(tLinks     == tArticle.mLinks);
+    CPPUNIT_ASSERT(N_LINKS    == tArticle.getNumLinks());
+    CPPUNIT_ASSERT(tArticle.isActive());
+    CPPUNIT_ASSERT(tArticle.mCoefficient and tArticle.mDefault and tArticle.mTemperature0
+                   and tArticle.mTemperature1 and tArticle.mConductivity);
+
+    /// @test  Initial conductivities are computed from the current link state.
+    CPPUNIT_ASSERT(0.6 * 1.0e-8 == tArticle.mCoefficient[0]);
+    CPPUNIT_ASSERT(1.0e-8       == tArticle.mDefault[0]);
+    CPPUNIT_ASSERT(300.0        == tArticle.mTemperature0[0]);
+    CPPUNIT_ASSERT(250.0        == tArticle.mTemperature1[0]);
+    const double expected = 0.6 * 1.0e-8 * (300.0*300.0*300.0*300.0 - 250.0*250.0*250.0*250.0)
+                          / 50.0;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, tArticle.getConductivity(0), expected * 1.0e-12);
+    CPPUNIT_ASSERT(0.0 == tArticle.getConductivity(-1));
+    CPPUNIT_ASSERT(0.0 == tArticle.getConductivity(N_LINKS));
+
+    /// @test  Initializing with no links leaves the batch inactive.
+    FriendlyGunnsThermalRadiationBatch article;
+    article.initialize("article", 0, 0);
+    CPPUNIT_ASSERT(not article.isActive());
+    CPPUNIT_ASSERT(0 == article.mConductivity);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for initialization exceptions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBatch::testInitializationExceptions()
+{
+    std::cout << "\n UtGunnsThermalRadiationBatch 03: testInitializationExceptions .....";
+
+    /// @test  Exception thrown on missing links array.
+    CPPUNIT_ASSERT_THROW(tArticle.initialize("tArticle", 0, N_LINKS), TsInitializationException);
+    CPPUNIT_ASSERT(not tArticle.isActive());
+
+    /// @test  Exception thrown on negative number of links.
+    CPPUNIT_ASSERT_THROW(tArticle.initialize("tArticle", tLinks, -1), TsInitializationException);
+    CPPUNIT_ASSERT(not tArticle.isActive());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the links attached to the batch step to exactly the same effective
+///           conductivities and admittances as the links computing their own, including a link
+///           with equal port temperatures and run-time changes to the view scalar and default
+///           conductivity.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBatch::testUpdate()
+{
+    std::cout << "\n UtGunnsThermalRadiationBatch 04: testUpdate .......................";
+
+    tArticle.initialize("tArticle", tLinks, N_LINKS);
+
+    for (int pass = 0; pass < 3; ++pass) {
+        setTemperatures(0, 300.0 + pass, 250.0);
+        setTemperatures(1, 4.0, 290.0 - 7.0 * pass);
+        setTemperatures(2, 275.0, 275.0);
+        setTemperatures(3, 1000.0, 1000.0 + 1.0e-10);
+        if (1 == pass) {
+            tLinks[1].setViewScalar(0.25);
+            tReference[1].setViewScalar(0.25);
+            tLinks[3].setDefaultConductivity(3.0e-7);
+            tReference[3].setDefaultConductivity(3.0e-7);
+        }
+
+        tArticle.update();
+        for (int i = 0; i < N_LINKS; ++i) {
+            tLinks[i].step(tTimeStep);
+            tReference[i].step(tTimeStep);
+
+            /// @test  Exactly the same conductivity and admittance as the link computes itself.
+            CPPUNIT_ASSERT(tReference[i].getEffectiveConductivity()
+                        == tLinks[i].getEffectiveConductivity());
+            CPPUNIT_ASSERT(tArticle.getConductivity(i) == tLinks[i].getEffectiveConductivity());
+            for (int j = 0; j < 4; ++j) {
+                CPPUNIT_ASSERT(tReference[i].getAdmittanceMatrix()[j]
+                            == tLinks[i].getAdmittanceMatrix()[j]);
+            }
+        }
+
+        /// @test  Equal temperatures use the default conductivity.
+        CPPUNIT_ASSERT(1.0e-8 * 3 == tArticle.getConductivity(2));
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the release method detaches the links so they compute their own conductivity.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBatch::testRelease()
+{
+    std::cout << "\n UtGunnsThermalRadiationBatch 05: testRelease ......................";
+
+    setTemperatures(0, 300.0, 250.0);
+    tArticle.initialize("tArticle", tLinks, N_LINKS);
+    tArticle.release();
+
+    /// @test  Arrays are deleted and the batch is inactive.
+    CPPUNIT_ASSERT(not tArticle.isActive());
+    CPPUNIT_ASSERT(0 == tArticle.mLinks);
+    CPPUNIT_ASSERT(0 == tArticle.mConductivity);
+
+    /// @test  The detached link follows its own temperatures, not the last batch update.
+    setTemperatures(0, 350.0, 250.0);
+    tLinks[0].step(tTimeStep);
+    tReference[0].step(tTimeStep);
+    CPPUNIT_ASSERT(tReference[0].getEffectiveConductivity()
+                == tLinks[0].getEffectiveConductivity());
+
+    /// @test  Release again is harmless.
+    tArticle.release();
+    CPPUNIT_ASSERT(not tArticle.isActive());
+
+    std::cout << "... Pass";
+}
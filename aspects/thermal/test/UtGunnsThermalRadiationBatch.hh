@@ -0,0 +1,108 @@
+#ifndef UtGunnsThermalRadiationBatch_EXISTS
+#define UtGunnsThermalRadiationBatch_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup    UT_GUNNS_THERMAL_RADIATION_BATCH  Gunns Thermal Radiation Batch Unit test
+/// @ingroup     UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details     Unit Tests for Gunns Thermal Radiation Batch
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "aspects/thermal/GunnsThermalRadiation.hh"
+#include "aspects/thermal/GunnsThermalRadiationBatch.hh"
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsThermalRadiationBatch and befriend UtGunnsThermalRadiationBatch.
+///
+/// @details  Class derived from the unit under test. It just has a default constructor and
+///           destructor, but it befriends the unit test case driver class to allow it access to
+///           protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsThermalRadiationBatch : public GunnsThermalRadiationBatch
+{
+    public:
+        FriendlyGunnsThermalRadiationBatch();
+        virtual ~FriendlyGunnsThermalRadiationBatch();
+        friend class UtGunnsThermalRadiationBatch;
+};
+inline FriendlyGunnsThermalRadiationBatch::FriendlyGunnsThermalRadiationBatch()
+    : GunnsThermalRadiationBatch() {};
+inline FriendlyGunnsThermalRadiationBatch::~FriendlyGunnsThermalRadiationBatch() {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Thermal Radiation Batch unit tests.
+///
+/// @details  This class provides unit tests for the Thermal Radiation Batch within the CPPUnit
+///           framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsThermalRadiationBatch: public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default Constructor.
+        UtGunnsThermalRadiationBatch();
+
+        /// @brief    Default Destructor.
+        virtual ~UtGunnsThermalRadiationBatch();
+
+        /// @brief    Executes before each test.
+        void setUp();
+
+        /// @brief    Executes after each test.
+        void tearDown();
+
+        /// @brief    Tests Default Construction.
+        void testDefaultConstruction();
+
+        /// @brief    Tests initialize method.
+        void testInitialization();
+
+        /// @brief    Tests initialize method exceptions.
+        void testInitializationExceptions();
+
+        /// @brief    Tests the batch linearization matches the links' own.
+        void testUpdate();
+
+        /// @brief    Tests release method.
+        void testRelease();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsThermalRadiationBatch);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitialization);
+        CPPUNIT_TEST(testInitializationExceptions);
+        CPPUNIT_TEST(testUpdate);
+        CPPUNIT_TEST(testRelease);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief  Enumeration for the number of links and nodes.
+        enum {N_LINKS = 4, N_NODES = 4};
+
+        FriendlyGunnsThermalRadiationBatch tArticle;            /**< (--) Test Article */
+        GunnsThermalRadiationConfigData*   tConfigData;         /**< (--) Nominal config data */
+        GunnsThermalRadiationInputData*    tInputData;          /**< (--) Nominal input data */
+        GunnsThermalRadiation              tLinks[N_LINKS];     /**< (--) Links in the batch */
+        GunnsThermalRadiation              tReference[N_LINKS]; /**< (--) Links not in the batch */
+        GunnsBasicNode                     tNodes[N_NODES];     /**< (--) Network Nodes */
+        GunnsNodeList                      tNodeList;           /**< (--) Node List */
+        std::vector<GunnsBasicLink*>       tNetworkLinks;       /**< (--) Network Links */
+        double                             tTimeStep;           /**< (s)  Nominal time step */
+
+        /// @brief  Sets the port temperatures of both sets of links.
+        void setTemperatures(const int link, const double t0, const double t1);
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsThermalRadiationBatch(const UtGunnsThermalRadiationBatch& that);
+
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsThermalRadiationBatch& operator =(const UtGunnsThermalRadiationBatch& that);
+};
+
+///@}
+
+#endif
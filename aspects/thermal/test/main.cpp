@@ -12,6 +12,7 @@ LIBRARY DEPENDENCY:
 #include "UtGunnsThermalCapacitor.hh"
 #include "UtGunnsThermalCapacitorHeatQueues.hh"
 #include "UtGunnsThermalRadiation.hh"
+#include "UtGunnsThermalRadiationBatch.hh"
 #include "UtGunnsThermalHeater.hh"
 #include "UtGunnsThermalPanel.hh"
 #include "UtGunnsThermalMultiPanel.hh"
@@ -35,6 +36,7 @@ int main(int argc, char** argv)
     runner.addTest( UtGunnsThermalCapacitor::suite() );
     runner.addTest( UtGunnsThermalCapacitorHeatQueues::suite() );
     runner.addTest( UtGunnsThermalRadiation::suite() );
+    runner.addTest( UtGunnsThermalRadiationBatch::suite() );
     runner.addTest( UtGunnsThermalHeater::suite() );
     runner.addTest( UtGunnsThermalPotential::suite() );
     runner.addTest( UtGunnsThermalPanel::suite() );
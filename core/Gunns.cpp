@@ -24,8 +24,13 @@ LIBRARY DEPENDENCY:
     (core/GunnsInfraFunctions.o)
     (core/GunnsFluidFlowOrchestrator.o)
     (core/GunnsMinorStepLog.o)
+    (core/GunnsThreadPool.o)
     (math/linear_algebra/Sor.o)
     (math/linear_algebra/CholeskyLdu.o)
+    (math/linear_algebra/CholeskyLduSimd.o)
+    (math/linear_algebra/CholeskyLduSparse.o)
+    (math/linear_algebra/ConjugateGradient.o)
+    (math/linear_algebra/SparseCsrMatrix.o)
 #ifdef GUNNS_CUDA_ENABLE
     (math/linear_algebra/cuda/CudaDenseDecomp.o)
     (math/linear_algebra/cuda/CudaSparseSolve.o)
@@ -43,6 +48,7 @@ LIBRARY DEPENDENCY:
    )
 */
 
+#include <algorithm>
 #include <cmath>
 #include <cfloat>
 #include <cstdio>
@@ -54,6 +60,10 @@ LIBRARY DEPENDENCY:
 #include "core/GunnsFluidFlowOrchestrator.hh"
 #include "math/linear_algebra/Sor.hh"
 #include "math/linear_algebra/CholeskyLdu.hh"
+#include "math/linear_algebra/CholeskyLduSimd.hh"
+#include "math/linear_algebra/CholeskyLduSparse.hh"
+#include "math/linear_algebra/ConjugateGradient.hh"
+#include "math/linear_algebra/SparseCsrMatrix.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
 #include "software/exceptions/TsNumericalException.hh"
@@ -139,12 +149,81 @@ Gunns::Gunns()
     mIslandCount           (0),
     mIslandMaxSize         (0),
     mIslandMode            (OFF),
+    mIslandParent          (0),
+    mIslandConnections     (0),
+    mIslandPatternCount    (-1),
+    mIslandFullBuilds      (0),
+    mIslandIncrementalBuilds(0),
+    mIslandPool            (),
+    mIslandTasks           (),
+    mIslandTaskErrors      (),
+    mIslandWorkerVectors   (),
+    mLinkPool              (),
+    mLinkTasks             (),
+    mLinkTaskErrors        (),
+    mLinkResults           (),
+    mLinkParallelTasks     (0),
+    mIslandCaching         (false),
+    mChangedLinks          (),
+    mIslandFactors         (),
+    mIslandFactorNodes     (),
+    mIslandFactorStale     (),
+    mIslandFactorPattern   (-1),
+    mIslandFactorDecompositions(0),
+    mIslandFactorReuses    (0),
+    mFactorRankLimit       (0),
+    mFactorRefreshLimit    (0),
+    mFactorValid           (false),
+    mFactorUpdatesSinceFull(0),
+    mFactorMatrix          (),
+    mFactorLdu             (),
+    mFactorVector          (),
+    mFactorUpdateNodes     (),
+    mFactorUpdateWeights   (),
+    mFactorFullCount       (0),
+    mFactorUpdateCount     (0),
+    mFactorUpdateRanks     (0),
+    mFactorFallbackCount   (0),
+    mIncrementalRefreshLimit(0),
+    mIncrementalSinceFull  (0),
+    mIncrementalPattern    (-1),
+    mAdmittanceChangedLinks(),
+    mAdmittanceSlotSums    (),
+    mSlotContributorStart  (),
+    mSlotContributorLinks  (),
+    mSlotContributorEntries(),
+    mIncrementalBuildCount (0),
+    mIncrementalFullCount  (0),
+    mIncrementalSource     (false),
+    mSourceVerify          (false),
+    mSourceContributorsValid(false),
+    mSourceChangedLinks    (),
+    mSourceNodeSums        (),
+    mSourceVerifySums      (),
+    mSourcePortOffsets     (),
+    mSourcePortNodes       (),
+    mNodeContributorStart  (),
+    mNodeContributorLinks  (),
+    mNodeContributorPorts  (),
+    mSourceIncrementalCount(0),
+    mSourceFullCount       (0),
+    mSourceVerifyFailures  (0),
     mSolverCpu             (0),
     mSolverGpuDense        (0),
     mSolverGpuSparse       (0),
+    mSolverSparse          (0),
     mGpuEnabled            (false),
     mGpuMode               (NO_GPU),
     mGpuSizeThreshold      (9999999),
+    mSolverSimd            (0),
+    mSimdMode              (NO_SIMD),
+    mSimdSizeThreshold     (9999999),
+    mMatrixStorage         (DENSE),
+    mAdmittanceSparse      (0),
+    mSparseLinkOffsets     (0),
+    mSparseSlots           (0),
+    mSparseMaps            (0),
+    mSparsePatternCount    (0),
     mConvergenceTolerance  (1.0),
     mNetworkSize           (0),
     mMinorStepLimit        (1),
@@ -176,6 +255,8 @@ Gunns::Gunns()
     mSolveTimeWorking      (0.0),
     mSolveTime             (0.0),
     mStepTime              (0.0),
+    mPhaseTimeWorking      (),
+    mPhaseTime             (),
     mWorstCaseTiming       (false),
     mLinksConvergence      (0),
     mNodesConvergence      (0),
@@ -191,6 +272,15 @@ Gunns::Gunns()
     mSorTolerance          (1.0E-12),
     mSorLastIteration      (-1),
     mSorFailCount          (0),
+    mSolverPcg             (0),
+    mIterativeMethod       (DIRECT),
+    mPcgMaxIter            (100),
+    mPcgTolerance          (1.0E-10),
+    mPcgLastIteration      (-1),
+    mPcgIterationCount     (0),
+    mPcgFailCount          (0),
+    mPcgMatrixValid        (false),
+    mPcgFallback           (false),
     mLastSolverMode        (NORMAL),
     mLastIslandMode        (OFF),
     mLastRunMode           (RUN)
@@ -216,6 +306,13 @@ Gunns::~Gunns()
         delete [] mNodes;
         mNodes = 0;
     }
+    {
+        delete mAdmittanceSparse;
+        mAdmittanceSparse = 0;
+    } {
+        delete mSolverSparse;
+        mSolverSparse = 0;
+    }
     if (mSolverGpuSparse) {
         delete mSolverGpuSparse;
         mSolverGpuSparse = 0;
@@ -223,6 +320,14 @@ Gunns::~Gunns()
     if (mSolverGpuDense) {
         delete mSolverGpuDense;
         mSolverGpuDense = 0;
+    }
+    if (mSolverPcg) {
+        delete mSolverPcg;
+        mSolverPcg = 0;
+    }
+    if (mSolverSimd) {
+        delete mSolverSimd;
+        mSolverSimd = 0;
     } {
         delete mSolverCpu;
         mSolverCpu = 0;
@@ -235,6 +340,18 @@ Gunns::~Gunns()
 void Gunns::cleanup()
 {
     {
+        delete [] mIslandConnections;
+        mIslandConnections = 0;
+    } {
+        delete [] mSparseMaps;
+        mSparseMaps = 0;
+    } {
+        delete [] mSparseSlots;
+        mSparseSlots = 0;
+    } {
+        delete [] mSparseLinkOffsets;
+        mSparseLinkOffsets = 0;
+    } {
         delete [] mLinkNumPorts;
         mLinkNumPorts = 0;
     } {
@@ -264,6 +381,7 @@ void Gunns::cleanup()
     }
     TS_DELETE_ARRAY(mDebugSavedNode);
     TS_DELETE_ARRAY(mDebugSavedSlice);
+    TS_DELETE_ARRAY(mIslandParent);
     TS_DELETE_ARRAY(mNodeIslandNumbers);
     TS_DELETE_ARRAY(mNetCapDeltaPotential);
     TS_DELETE_ARRAY(mSlavePotentialVector);
@@ -291,10 +409,12 @@ void Gunns::cleanup()
 /// @param[in]  threshold  (--)  Network/island size threshold value to take.
 ///
 /// @details  Rejects any GPU modes and outputs an H&S warning if the compilation is not GPU
-///           enabled.
+///           enabled.  A change of mode forces the matrix to be rebuilt and decomposed for the new
+///           mode on the next step, since the modes keep island decompositions differently.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void Gunns::setGpuOptions(const GpuMode mode, const int threshold)
 {
+    const GpuMode lastMode = mGpuMode;
     mGpuSizeThreshold = threshold;
     if (NO_GPU != mode and not mGpuEnabled) {
         mGpuMode = NO_GPU;
@@ -302,6 +422,171 @@ void Gunns::setGpuOptions(const GpuMode mode, const int threshold)
     } else {
         mGpuMode = mode;
     }
+    if (lastMode != mGpuMode) {
+        mRebuild = true;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  mode       (--)  SimdMode enumeration value to take.
+/// @param[in]  threshold  (--)  Network/island size threshold value to take.
+///
+/// @details  In SIMD_DENSE mode, dense matrices and islands at least the threshold size are
+///           decomposed & solved by the vectorized CPU solver, using the best instruction set the
+///           CPU supports, and smaller ones by the scalar CPU solver.  The GPU modes take
+///           precedence over this for matrices at least the GPU threshold size.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::setSimdOptions(const SimdMode mode, const int threshold)
+{
+    mSimdMode          = mode;
+    mSimdSizeThreshold = threshold;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  method         (--)  IterativeMethod enumeration value to take.
+/// @param[in]  maxIterations  (--)  PCG iteration limit per solution, minimum of 1.
+/// @param[in]  tolerance      (--)  PCG convergence tolerance on the relative residual norm.
+///
+/// @details  Sets the iterative solution method.  The PCG methods solve the system iteratively in
+///           NORMAL solver mode when SOR is not active, starting from the last minor step
+///           potentials.  This forces a rebuild of the admittance matrix, since the PCG and direct
+///           methods leave it in different states.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::setIterativeOptions(const IterativeMethod method, const int maxIterations,
+                                const double tolerance)
+{
+    mIterativeMethod = method;
+    mPcgMaxIter      = std::max(1, maxIterations);
+    mPcgTolerance    = tolerance;
+    mRebuild         = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  threads  (--)  Number of threads, including the calling thread, for islands.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Sets the number of threads that decompose & solve islands concurrently in SOLVE island
+///           mode.  Values less than 2 return to serial island solution.  Each worker gets its own
+///           scratch arrays, which are sized to the largest island when needed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::setIslandThreads(const int threads)
+{
+    mIslandPool.initialize(mName + ".mIslandPool", threads);
+    mIslandWorkerVectors.resize(mIslandPool.getNumWorkers());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  threads  (--)  Number of threads, including the solver's thread, to step links on.
+///
+/// @details  Starts the worker threads for stepping links in parallel.  Values less than 2 return
+///           to serial link stepping.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::setLinkThreads(const int threads)
+{
+    mLinkPool.initialize(mName + ".mLinkPool", threads);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  threads  (--)  Number of threads, including the solver's thread, to integrate nodes
+///                            on.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Passes the number of threads to the flow orchestrator, which may integrate the nodes
+///           that are ready at the same time in parallel.  Values less than 2 return to serial
+///           integration.  This must be called after the network is initialized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::setFlowThreads(const int threads)
+{
+    if (not mFlowOrchestrator or not mFlowOrchestrator->isInitialized()) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "flow threads set before the flow orchestrator is initialized.");
+    }
+    mFlowOrchestrator->setThreads(threads);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  enable  (--)  Keeps and re-uses island decompositions when true.
+///
+/// @details  Sets whether each island's decomposition is re-used until the island changes, in
+///           SOLVE island mode.  The kept decompositions themselves are still used to solve the
+///           islands when disabled, and are decomposed again for every island each decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::setIslandFactorCaching(const bool enable)
+{
+    mIslandCaching = enable;
+    mIslandFactorNodes.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  rankLimit     (--)  Maximum number of rank-1 updates in place of a decomposition.
+/// @param[in]  refreshLimit  (--)  Maximum consecutive updated decompositions.
+///
+/// @details  Enables updating of the saved dense decomposition in place of a full decomposition
+///           when no more than rankLimit rank-1 updates are needed, with a full decomposition at
+///           least every refreshLimit + 1 decompositions.  Each changed off-diagonal admittance
+///           is one update, and each node whose diagonal changes by more than the sum of its
+///           changed off-diagonals is one more.  A rankLimit or refreshLimit less than 1 disables
+///           the updates and releases the saved decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::setFactorUpdateOptions(const int rankLimit, const int refreshLimit)
+{
+    if (rankLimit > 0 and refreshLimit > 0) {
+        mFactorRankLimit    = rankLimit;
+        mFactorRefreshLimit = refreshLimit;
+    } else {
+        mFactorRankLimit    = 0;
+        mFactorRefreshLimit = 0;
+        std::vector<double>().swap(mFactorMatrix);
+        std::vector<double>().swap(mFactorLdu);
+        std::vector<double>().swap(mFactorVector);
+    }
+    mFactorValid = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  refreshLimit  (--)  Maximum consecutive incremental admittance matrix builds.
+///
+/// @details  Enables incremental admittance matrix builds, with a full build at least every
+///           refreshLimit + 1 builds.  A refreshLimit less than 1 disables the incremental builds
+///           and releases the kept slot sums.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::setIncrementalAdmittance(const int refreshLimit)
+{
+    mIncrementalRefreshLimit = std::max(0, refreshLimit);
+    mIncrementalPattern      = -1;
+    mAdmittanceChangedLinks.clear();
+    if (0 == mIncrementalRefreshLimit) {
+        std::vector<double>().swap(mAdmittanceSlotSums);
+        std::vector<int>().swap(mSlotContributorStart);
+        std::vector<int>().swap(mSlotContributorLinks);
+        std::vector<int>().swap(mSlotContributorEntries);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  incremental  (--)  Assemble the source vector incrementally from changed links.
+/// @param[in]  verify       (--)  Verify each incremental assembly against a full assembly.
+///
+/// @details  Enables or disables incremental source vector assembly and its verification.  The
+///           next assembly is a full assembly.  Verification costs more than a full assembly, and
+///           is meant for checking the links' source reporting rather than for normal runs.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::setIncrementalSourceOptions(const bool incremental, const bool verify)
+{
+    mIncrementalSource       = incremental;
+    mSourceVerify            = incremental and verify;
+    mSourceContributorsValid = false;
+    mSourceChangedLinks.clear();
+    if (not mIncrementalSource) {
+        std::vector<double>().swap(mSourceNodeSums);
+        std::vector<double>().swap(mSourceVerifySums);
+        std::vector<int>().swap(mSourcePortNodes);
+        std::vector<int>().swap(mNodeContributorStart);
+        std::vector<int>().swap(mNodeContributorLinks);
+        std::vector<int>().swap(mNodeContributorPorts);
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -340,6 +625,10 @@ void Gunns::initialize(const GunnsConfigData& configData, std::vector<GunnsBasic
 
     /// - Allocate linear algebra solvers.
     mSolverCpu = new CholeskyLdu();
+    mSolverSimd = new CholeskyLduSimd();
+    mSolverPcg = new ConjugateGradient();
+    mSolverSparse = new CholeskyLduSparse();
+    mAdmittanceSparse = new SparseCsrMatrix();
 #ifdef GUNNS_CUDA_ENABLE
     mSolverGpuDense  = new CudaDenseDecomp();
     mSolverGpuSparse = new CudaSparseSolve();
@@ -358,6 +647,7 @@ void Gunns::initialize(const GunnsConfigData& configData, std::vector<GunnsBasic
     TS_NEW_PRIM_ARRAY_EXT(mSlavePotentialVector, mNetworkSize,       double, configData.mName + ".mSlavePotentialVector");
     TS_NEW_PRIM_ARRAY_EXT(mNetCapDeltaPotential, matrixSize,         double, configData.mName + ".mNetCapDeltaPotential");
     TS_NEW_PRIM_ARRAY_EXT(mNodeIslandNumbers,    mNetworkSize,       int,    configData.mName + ".mNodeIslandNumbers");
+    TS_NEW_PRIM_ARRAY_EXT(mIslandParent,         mNetworkSize,       int,    configData.mName + ".mIslandParent");
     TS_NEW_PRIM_ARRAY_EXT(mDebugSavedSlice,      mNetworkSize,       double, configData.mName + ".mDebugSavedSlice");
     TS_NEW_PRIM_ARRAY_EXT(mDebugSavedNode,      (mMinorStepLimit+1), double, configData.mName + ".mDebugSavedNode");
 
@@ -371,6 +661,7 @@ void Gunns::initialize(const GunnsConfigData& configData, std::vector<GunnsBasic
         mMajorPotentialVector[i]  = 0.0;
         mSlavePotentialVector[i]  = 0.0;
         mNodeIslandNumbers[i]     = i;
+        mIslandParent[i]          = i;
         mDebugSavedSlice[i]       = 0.0;
 
         /// - Pre-load the 2D island vectors' 1st dimension with vectors of ints, one for each row
@@ -448,6 +739,10 @@ void Gunns::initialize(const GunnsConfigData& configData, std::vector<GunnsBasic
         mLinkNumPorts[link]           = mLinks[link]->getNumberPorts();
     }
 
+    /// - Build the sparse admittance matrix pattern from the link admittance maps.
+    mSparsePatternCount = 0;
+    buildSparsePattern();
+
     /// - Point the nodes to their network capacitance delta-potentials array.
     for (int node = 0; node < mNetworkSize; ++node) {
         mNodes[node]->setNetCapDeltaPotential(&mNetCapDeltaPotential[node*mNetworkSize]);
@@ -694,9 +989,15 @@ void Gunns::restart()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 inline void Gunns::initializeRestartCommonFunctions()
 {
-    /// - Reset island information.
+    /// - Reset island information, and force a full island build on the first pass.
     mIslandCount            = 0;
     mIslandMaxSize          = 0;
+    mIslandPatternCount     = -1;
+
+    /// - Force a full decomposition before the saved decomposition is updated again, and discard
+    ///   kept island decompositions.
+    mFactorValid            = false;
+    mIslandFactorNodes.clear();
 
     /// - Reset performance metrics.
     mConvergenceFailCount   = 0;
@@ -715,8 +1016,10 @@ inline void Gunns::initializeRestartCommonFunctions()
     mLastRunMode            = mRunMode;
 
     /// - Force a rebuild of the admittance matrix on first pass in Run so that we don't solve on a
-    ///   bad or stale matrix.
+    ///   bad or stale matrix.  This is a full build in incremental mode.
     mRebuild                = true;
+    mIncrementalPattern     = -1;
+    mSourceContributorsValid = false;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -742,6 +1045,9 @@ void Gunns::step(const double timeStep)
     if (PAUSE == mRunMode) return;
     ++mMajorStepCount;
     mStepLog.beginMajorStep();
+    for (int phase = 0; phase < NUM_STEP_PHASES; ++phase) {
+        mPhaseTimeWorking[phase] = 0.0;
+    }
 
     /// - Call the links to process special read data from the sim bus.
     for (int link = 0; link < mNumLinks; ++link) {
@@ -773,12 +1079,14 @@ void Gunns::step(const double timeStep)
 
     if (isConverged) {
         /// - Compute & transport flows.
+        const double orchestrateTime = GunnsInfraFunctions::clockTime();
         mFlowOrchestrator->update(timeStep);
 
         /// - Once the nodes have been updated, call the links to process final outputs.
         for (int link = mNumLinks-1; link >= 0; --link) {
             mLinks[link]->processOutputs();
         }
+        mPhaseTimeWorking[PHASE_ORCHESTRATE] += GunnsInfraFunctions::clockTime() - orchestrateTime;
 
     /// - If the network did not converge, instead of processing final link & node outputs, reset
     ///   the potential solution to the last major frame, including overrides, and issue a warning.
@@ -800,6 +1108,9 @@ void Gunns::step(const double timeStep)
     mStepLog.endMajorStep();
 
     mSolveTime = mSolveTimeWorking;
+    for (int phase = 0; phase < NUM_STEP_PHASES; ++phase) {
+        mPhaseTime[phase] = mPhaseTimeWorking[phase];
+    }
     mStepTime  = GunnsInfraFunctions::clockTime() - startTime;
 }
 
@@ -854,22 +1165,48 @@ bool Gunns::iterateMinorSteps(const double timeStep)
 
             /// - Step each link in the network.  On the first minor step, we call the link's main
             ///   step method.  On subsequent minor steps (in a non-linear network), we call non-
-            ///   linear link's minorStep method.
+            ///   linear link's minorStep method.  In parallel, the links are all stepped first.
+            const double linkStepTime = GunnsInfraFunctions::clockTime();
+            const bool   linkParallel = isLinkParallel();
+            if (linkParallel) {
+                runLinksParallel((1 == mLastMinorStep) ? LINK_STEP : LINK_MINOR_STEP, timeStep,
+                                 0, mLastMinorStep);
+            }
             for (int link = 0; link < mNumLinks; ++link) {
 
-                if (1 == mLastMinorStep) {
-                    mLinks[link]->step(timeStep);
-                }
+                if (not linkParallel) {
+                    if (1 == mLastMinorStep) {
+                        mLinks[link]->step(timeStep);
+                    }
 
-                else if(mLinks[link]->isNonLinear()) {
-                    mLinks[link]->minorStep(timeStep, mLastMinorStep);
+                    else if(mLinks[link]->isNonLinear()) {
+                        mLinks[link]->minorStep(timeStep, mLastMinorStep);
+                    }
                 }
 
+                /// - Re-sum the source vector terms of links changing them, or moving ports.
+                const bool sourceUpdate = mIncrementalSource and mLinks[link]->needSourceUpdate();
+
                 /// - Rebuild the system if any link declares it is changing the admittance matrix.
                 if(mLinks[link]->needAdmittanceUpdate()) {
                     mRebuild = true;
+                    if (static_cast<int>(mChangedLinks.size()) < mNumLinks) {
+                        mChangedLinks.push_back(link);
+                    }
+                    if (mIncrementalRefreshLimit > 0
+                            and static_cast<int>(mAdmittanceChangedLinks.size()) < mNumLinks) {
+                        mAdmittanceChangedLinks.push_back(link);
+                    }
+                    if (mIncrementalSource and not sourceUpdate
+                            and static_cast<int>(mSourceChangedLinks.size()) < mNumLinks) {
+                        mSourceChangedLinks.push_back(link);
+                    }
+                }
+                if (sourceUpdate and static_cast<int>(mSourceChangedLinks.size()) < mNumLinks) {
+                    mSourceChangedLinks.push_back(link);
                 }
             }
+            mPhaseTimeWorking[PHASE_LINK_STEP] += GunnsInfraFunctions::clockTime() - linkStepTime;
 
             /// - Force rebuild of the system every minor step for worst-case timing mode.
             if (mWorstCaseTiming) {
@@ -960,15 +1297,22 @@ bool Gunns::iterateMinorSteps(const double timeStep)
 int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
 {
     //TODO prototype SOR/Cholesky mix
+    const double buildTime = GunnsInfraFunctions::clockTime();
     buildSourceVector();
     bool needDecomposition = false;
-    if (mRebuild or mSorActive or mDebugDesiredStep != 0) {
+    /// - The matrix is also rebuilt when switching between PCG and the direct method, since PCG
+    ///   leaves the matrix un-decomposed.
+    if (mRebuild or mSorActive or mDebugDesiredStep != 0 or (isPcgActive() != mPcgMatrixValid)) {
         buildAdmittanceMatrix();
         conditionAdmittanceMatrix();
         needDecomposition = true;
         mRebuild = false;
+        mPcgMatrixValid = false;
     }
     mStepLog.recordLinkContributions();
+    const double solveTime = GunnsInfraFunctions::clockTime();
+    double decomposeTime   = 0.0;
+    mPhaseTimeWorking[PHASE_BUILD] += solveTime - buildTime;
 
     //if sorResult = -1, then sor didnt' converge, so throw a warning, reset mPotentialVector back
     //to the previous minor step, and go to Cholesky.
@@ -983,10 +1327,34 @@ int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
             GUNNS_WARNING("SOR failed to converge, reverting to Cholesky this step.");
         }
     }
-    //do cholesky if SOR either failed to converge or isn't being attempted.
+    /// - Solve by PCG when active, loading the matrix when it has been rebuilt.  If PCG fails to
+    ///   converge, revert to Cholesky until the next rebuild, decomposing the current matrix.
+    mPcgLastIteration = -1;
+    if (isPcgActive()) {
+        if (needDecomposition) {
+            loadPcgMatrix();
+        }
+        if (not mPcgFallback) {
+            perturbNetworkCapacitances(true);
+            if (not mPcgFallback) {
+                solvePcg();
+            }
+            if (mPcgFallback) {
+                mPcgLastIteration = -1;
+                needDecomposition = true;
+                GUNNS_WARNING("PCG failed to converge, reverting to Cholesky until the next rebuild.");
+            } else {
+                cleanPotentialVector();
+                computeNetworkCapacitances(timeStep);
+            }
+        }
+    }
+
+    //do cholesky if SOR or PCG either failed to converge or isn't being attempted.
     int result = 0;
-    if (mSorLastIteration < 0) {
+    if (mSorLastIteration < 0 and mPcgLastIteration < 0) {
         if (needDecomposition) {
+            decomposeTime = GunnsInfraFunctions::clockTime();
             /// - Save pre-decomposition admittance matrix elements for debugging on the desired step.
             if (mDebugDesiredStep == minorStep or mDebugDesiredStep < 0) {
                 saveDebugAdmittance();
@@ -1001,10 +1369,31 @@ int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
                     mLastDecomposition++;
                     mDecompositionCount++;
 
-                    /// - Decompose admittance matrix by islands.  This builds a new sub-matrix for
-                    ///   each island, then copies the decomposed values back into the main
-                    ///   admittance matrix.
-                    if (SOLVE == mIslandMode) {
+                    /// - Any other decomposition path leaves the saved decompositions stale.
+                    if (not isFactorUpdateActive()) {
+                        mFactorValid = false;
+                    }
+                    if (not isIslandCompact()) {
+                        mIslandFactorNodes.clear();
+                    }
+
+                    /// - In SPARSE storage, the sparse solver decomposes the whole sparse matrix.
+                    ///   Its ordering keeps the islands de-coupled, so island sub-matrices aren't
+                    ///   needed.
+                    if (SPARSE == mMatrixStorage) {
+                        decomposeSparse();
+
+                    /// - Decompose admittance matrix by islands, in parallel or serially, into the
+                    ///   kept island size decompositions.  When caching, only the changed islands
+                    ///   are decomposed.
+                    } else if (isIslandParallel()) {
+                        runIslandsParallel(true);
+
+                    } else if (isIslandCompact()) {
+                        decomposeIslandFactors();
+
+                    /// - With a GPU, decompose by islands into the main admittance matrix.
+                    } else if (SOLVE == mIslandMode) {
                         /// - Loop over all islands, form a sub-matrix for each island and condition
                         ///   it.  Only decompose islands that contain >1 nodes.
                         for (int island = 0; island < mNetworkSize; ++island) {
@@ -1032,15 +1421,22 @@ int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
                             }
                         }
 
-                    /// - Decompose the full matrix without islands.
+                    /// - Decompose the full matrix without islands, updating the saved decomposition
+                    ///   instead when enabled.
+                    } else if (isFactorUpdateActive()) {
+                        decomposeWithUpdates();
+
                     } else {
                         decompose(mAdmittanceMatrix, mNetworkSize);
                     }
+                    mChangedLinks.clear();
                 } else {
                     throw TsOutOfBoundsException("Iteration Limit Exceeded", "Gunns",
                                                  "decomposition limit exceeded.");
                 }
             }
+            decomposeTime = GunnsInfraFunctions::clockTime() - decomposeTime;
+            mPhaseTimeWorking[PHASE_DECOMPOSE] += decomposeTime;
         }
         /// - Solve the system of equations.  The result of this is a new potential vector.  This is
         ///   only needed in NORMAL mode.  In DUMMY mode, the links are responsible for their own
@@ -1053,6 +1449,7 @@ int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
             computeNetworkCapacitances(timeStep);
         }
     }
+    mPhaseTimeWorking[PHASE_SOLVE] += GunnsInfraFunctions::clockTime() - solveTime - decomposeTime;
 
     return(result);
 }
@@ -1083,166 +1480,1172 @@ void Gunns::decompose(double *A, const int size, const int island)
             }
         }
     } else if ( (GPU_SPARSE != mGpuMode) or (size < mGpuSizeThreshold) ) {
-        handleDecompose(mSolverCpu, A, size, island);
+        handleDecompose(getCpuSolver(size), A, size, island);
     }
     mSolveTimeWorking += GunnsInfraFunctions::clockTime() - startTime;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @throws   TsInitializationException
+/// @param[in] size (--) The number of rows in the matrix.
 ///
-/// @details  This method checks the network's mode settings for validity and makes sure the
-///           network has completed initialization prior to stepping.
+/// @returns  CholeskyLdu* (--) Pointer to the CPU dense solver to use.
 ///
-/// @note     The TsInitializationException should be fatal to the load.
+/// @details  Returns the vectorized CPU solver in SIMD_DENSE mode for matrices at least the SIMD
+///           threshold size, otherwise the scalar CPU solver.  Both store the decomposition in the
+///           same format, so either can solve a matrix decomposed by the other.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void Gunns::checkStepInputs()
+CholeskyLdu* Gunns::getCpuSolver(const int size) const
 {
-    if (mLastSolverMode != mSolverMode) {
-        mLastSolverMode  = mSolverMode;
-        GUNNS_INFO("solver mode changed to " << getSolverModeString() << ".");
+    if ( (SIMD_DENSE == mSimdMode) and (size >= mSimdSizeThreshold) ) {
+        return mSolverSimd;
     }
+    return mSolverCpu;
+}
 
-    if (mLastIslandMode != mIslandMode) {
-        mLastIslandMode  = mIslandMode;
-        GUNNS_INFO("island mode changed to " << getIslandModeString() << ".");
-    }
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the system is solved by the PCG iterative method.
+///
+/// @details  PCG is used in NORMAL solver mode with a PCG iterative method, when SOR is not active.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::isPcgActive() const
+{
+    return (DIRECT != mIterativeMethod) and (NORMAL == mSolverMode) and not mSorActive;
+}
 
-    if (mLastRunMode != mRunMode) {
-        mLastRunMode  = mRunMode;
-        GUNNS_INFO("run mode changed to " << getRunModeString() << ".");
-    }
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Loads the rebuilt admittance matrix into the PCG solver, which builds its
+///           preconditioner.  The matrix is loaded from the sparse matrix, which in DENSE storage
+///           is first loaded from the dense matrix at the pattern positions, costing O(# links)
+///           rather than O(n^2).  Since the matrix isn't decomposed, the saved & kept
+///           decompositions are stale.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::loadPcgMatrix()
+{
+    double startTime = GunnsInfraFunctions::clockTime();
+    if (DENSE == mMatrixStorage) {
+        mAdmittanceSparse->fromDense(mAdmittanceMatrix);
+    }
+    const ConjugateGradient::Preconditioner preconditioner = (PCG_IC == mIterativeMethod)
+            ? ConjugateGradient::INCOMPLETE_CHOLESKY : ConjugateGradient::JACOBI;
+    if (preconditioner != mSolverPcg->getPreconditioner()) {
+        mSolverPcg->setPreconditioner(preconditioner);
+    }
+    mSolverPcg->setMatrix(*mAdmittanceSparse);
+    mPcgMatrixValid = true;
+    mPcgFallback    = false;
+    mFactorValid    = false;
+    mIslandFactorNodes.clear();
+    mChangedLinks.clear();
+    mSolveTimeWorking += GunnsInfraFunctions::clockTime() - startTime;
+}
 
-    /// - Prevent invalid GPU modes.
-    if (NO_GPU != mGpuMode) {
-        if (not mGpuEnabled) {
-            mGpuMode = NO_GPU;
-            GUNNS_WARNING("mGpuMode downmoded to NO_GPU because this solver isn't GPU enabled.");
-        } else if (mGpuSizeThreshold > mNetworkSize) {
-            mGpuMode = NO_GPU;
-            GUNNS_WARNING("mGpuMode downmoded to NO_GPU because the entire network size is smaller than the GPU threshold.");
-        }
-        if (mGpuSizeThreshold < 2) {
-            mGpuSizeThreshold = 2;
-            GUNNS_WARNING("mGpuSizeThreshold reset to the minimum operating value of 2.");
-        }
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Solves the system by PCG, starting from the last minor step potentials in non-linear
+///           networks, or from the last major step potentials in linear networks, which don't save
+///           their minor step potentials.  If it fails to converge, the failure is counted and the
+///           Cholesky method is flagged to be used until the next rebuild.  In a Trick environment,
+///           also records the elapsed wall time of the solution for timing analysis.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::solvePcg()
+{
+    double startTime = GunnsInfraFunctions::clockTime();
+    const double* start = mLinearNetwork ? mMajorPotentialVector : mMinorPotentialVector;
+    for (int node = 0; node < mNetworkSize; ++node) {
+        mPotentialVector[node] = start[node];
     }
-
-    /// - Issue an error if the network has not been initialized.  We use the TS_HS_EXCEPTION macro
-    ///   rather than GUNNS_ERROR so we can indicate the unknown name.
-    if (!mInitFlag) {
-        TS_HS_EXCEPTION(TS_HS_ERROR, "GUNNS", "Network has not been initialized.",
-                        TsInitializationException, "Invalid Initialization Data", "Unknown");
+    mPcgLastIteration = mSolverPcg->solve(mPotentialVector, mSourceVector, mPcgMaxIter,
+                                          mPcgTolerance);
+    if (mPcgLastIteration < 0) {
+        mPcgFailCount++;
+        mPcgFallback = true;
+    } else {
+        mPcgIterationCount += mPcgLastIteration;
     }
+    mSolveTimeWorking += GunnsInfraFunctions::clockTime() - startTime;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in] minorStep (--) The absolute minor step # that the network is on
+/// @throws   TsNumericalException
 ///
-/// @return   bool (--) Returns true if the solution has converged, false otherwise
+/// @details  Calls the sparse solver decomposition of the sparse admittance matrix, directly from
+///           its CSR arrays.  The sparse solver only repeats its ordering & symbolic factorization
+///           when the sparse pattern has changed.  In a Trick environment, also records the elapsed
+///           wall time of the decomposition for timing analysis.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::decomposeSparse()
+{
+    double startTime = GunnsInfraFunctions::clockTime();
+    try {
+        mSolverSparse->Decompose(mNetworkSize, mAdmittanceSparse->getRowStart(),
+                                 mAdmittanceSparse->getColumnIndex(),
+                                 mAdmittanceSparse->getValues());
+    } catch (TsNumericalException& e) {
+        std::ostringstream msg;
+        msg << e.getMessage() << " " << e.getThrowingEntityName() << " " << e.getCause() << ".";
+        GUNNS_ERROR(TsNumericalException, "Error Return Value", msg.str());
+    }
+    mSolveTimeWorking += GunnsInfraFunctions::clockTime() - startTime;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Parallel Island Job
 ///
-/// @details  This method checks for convergence of the system's potential vector solution.  The
-///           delta between the previous minor step's solution and the current solution must be
-///           below a defined tolerance, for each node individually.
+/// @details  Runs each task of a parallel island decomposition or solution on the solver.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-bool Gunns::checkSystemConvergence(const int minorStep)
+class Gunns::IslandJob : public GunnsThreadPoolJob
 {
-    /// - Record the last node found that fails to converge, otherwise -1 indicates all nodes have
-    ///   converged.
-    int lastNonConvergingNode = -1;
-    for (int node = 0; node < mNetworkSize; ++node) {
+    public:
+        /// @brief Constructs this job for the given solver and phase.
+        IslandJob(Gunns& solver, const bool decompose) : mSolver(solver), mDecompose(decompose) {;}
+        /// @brief Default destructs this job.
+        virtual ~IslandJob() {;}
+        /// @brief Decomposes or solves the task's island on the given worker.
+        virtual void runTask(const int task, const int worker)
+        {
+            mSolver.runIslandTask(mDecompose, task, worker);
+        }
 
-        mNodesConvergence[node] = fabs(mMinorPotentialVector[node] - mPotentialVector[node]);
-        if (mNodesConvergence[node] > mConvergenceTolerance) {
-            lastNonConvergingNode = node;
+    private:
+        Gunns&     mSolver;    /**< ** (--) trick_chkpnt_io(**) The solver whose islands are run. */
+        const bool mDecompose; /**< ** (--) trick_chkpnt_io(**) Decomposes when true, solves when false. */
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        IslandJob(const IslandJob& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        IslandJob& operator =(const IslandJob& that);
+};
 
-            /// - Pause recording minor step potentials when the recorded node fails to converge.
-            if (minorStep == mMinorStepLimit and node == mDebugDesiredNode) {
-                mDebugDesiredNode = -1;
-            }
-        }
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Island Size Comparison
+///
+/// @details  Orders island numbers by descending island size, then ascending island number.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+struct GunnsIslandSizeGreater
+{
+    const std::vector< std::vector<int> >& mIslands; /**< ** (--) trick_chkpnt_io(**) The island vectors. */
+    /// @brief Constructs this comparison for the given island vectors.
+    explicit GunnsIslandSizeGreater(const std::vector< std::vector<int> >& islands)
+        : mIslands(islands) {;}
+    /// @brief Returns true if island a is ordered before island b.
+    bool operator()(const int a, const int b) const
+    {
+        const std::size_t sizeA = mIslands[a].size();
+        const std::size_t sizeB = mIslands[b].size();
+        return (sizeA > sizeB) or (sizeA == sizeB and a < b);
     }
-    return (lastNonConvergingNode < 0);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if islands are decomposed & solved by the worker threads.
+///
+/// @details  Parallel islands require more than one worker, and the island size decompositions of
+///           SOLVE island mode, DENSE storage and no GPU.  Otherwise the serial paths are used.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::isIslandParallel() const
+{
+    return (mIslandPool.getNumWorkers() > 1) and isIslandCompact();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in] convergedStep (--) The # of minor steps since the network last converged
-/// @param[in] absoluteStep  (--) The absolute minor step number that the network is on
+/// @param[in] decompose (--) Decomposes the islands when true, or solves them when false.
 ///
-/// @return   GunnsBasicLink::SolutionResult (--) The combined assessment of the solution from all
-///                                               of the non-linear links in the network
+/// @throws   TsNumericalException
 ///
-/// @details  This method checks all non-linear links for acceptance of the solution.  An example
-///           would be an open check valve seeing reverse pressure gradient indicating reverse flow,
-///           in which case the link would need to change its state to closed and re-solve the
-///           system.
+/// @details  Lists the islands to be run, largest first, sizes the worker scratch arrays for the
+///           largest island, and runs the islands on the thread pool.  Errors are reported after
+///           all tasks are done, for the lowest numbered failing island, as the serial loop would.
+///           The wall time of the whole parallel section is added to the solve time.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-GunnsBasicLink::SolutionResult Gunns::confirmSolutionAcceptance(const int convergedStep,
-                                                                const int absoluteStep)
+void Gunns::runIslandsParallel(const bool decompose)
 {
-    GunnsBasicLink::SolutionResult result = GunnsBasicLink::CONFIRM;
-
-    /// - Loop over all the non-linear links so they can assess the solution.  If one rejects the
-    ///   solution, we still give the remaining links a chance to assess, because multiple links
-    ///   might be rejecting the solution simultaneously (say for 2 diodes in parallel), and we want
-    ///   all of them to adjust for the next minor-step at the same time.
-    for (int link = 0; link < mNumLinks; ++link) {
-
-        if (mLinks[link]->isNonLinear()) {
+    double startTime = GunnsInfraFunctions::clockTime();
 
-            /// - Get the link's result.  We don't allow links to delay prior to system convergence,
-            ///   so change such a result to confirmed until after we've converged.
-            GunnsBasicLink::SolutionResult linkResult =
-                    mLinks[link]->confirmSolutionAcceptable(convergedStep, absoluteStep);
-            mStepLog.recordLinkResult(link, linkResult);
-            if ((0 == convergedStep) and (GunnsBasicLink::DELAY == linkResult)) {
-                linkResult = GunnsBasicLink::CONFIRM;
+    /// - List the islands as tasks, sorted by descending size.  Only the stale islands are
+    ///   decomposed, including single-node islands so that all have kept factors.
+    if (decompose) {
+        markStaleIslandFactors();
+    }
+    mIslandTasks.clear();
+    for (int island = 0; island < mNetworkSize; ++island) {
+        const int n = static_cast<int>(mIslandVectors[island].size());
+        if (decompose and n > 0 and not mIslandFactorStale[island]) {
+            mIslandFactorReuses++;
+        } else if (n > 0) {
+            mIslandTasks.push_back(island);
+            if (decompose) {
+                mIslandFactorNodes[island].clear();
+                mIslandFactors[island].resize(n * n);
             }
+        }
+    }
+    std::sort(mIslandTasks.begin(), mIslandTasks.end(), GunnsIslandSizeGreater(mIslandVectors));
+    const int numTasks = static_cast<int>(mIslandTasks.size());
+    mIslandTaskErrors.assign(numTasks, std::string());
 
-            /// - If any link rejects the solution, then the solution is rejected for the entire
-            ///   network.  We use if/else structure instead of switch/case to avoid ambiguity with
-            //    break statements.
-            if (GunnsBasicLink::REJECT == linkResult) {
-                result = GunnsBasicLink::REJECT;
+    /// - Size the worker scratch arrays for the largest island.
+    if (numTasks > 0) {
+        const unsigned int n = mIslandVectors[mIslandTasks[0]].size();
+        for (unsigned int worker = 0; worker < mIslandWorkerVectors.size(); ++worker) {
+            if (mIslandWorkerVectors[worker].size() < 2 * n) {
+                mIslandWorkerVectors[worker].resize(2 * n);
             }
+        }
+    }
 
-            /// - If any link delays the solution, then the entire network solution is delayed, but
-            ///   only if no link is rejecting.  Rejecting overrides delaying.
-            else if (GunnsBasicLink::DELAY == linkResult && GunnsBasicLink::REJECT != result) {
-                result = GunnsBasicLink::DELAY;
+    IslandJob job(*this, decompose);
+    const int failed = mIslandPool.run(&job, numTasks);
+    mSolveTimeWorking += GunnsInfraFunctions::clockTime() - startTime;
+
+    /// - Record the nodes of the islands that were successfully decomposed into kept factors.
+    if (decompose) {
+        for (int task = 0; task < numTasks; ++task) {
+            if (mIslandTaskErrors[task].empty()) {
+                const int island = mIslandTasks[task];
+                mIslandFactorNodes[island] = mIslandVectors[island];
+                mIslandFactorStale[island] = 0;
+                mIslandFactorDecompositions++;
             }
-            mLinksConvergence[link] = linkResult;
         }
     }
-    return result;
+
+    /// - Report the error from the lowest numbered failing island.
+    int         errorIsland = mNetworkSize;
+    std::string errorMsg;
+    for (int task = 0; task < numTasks; ++task) {
+        if (not mIslandTaskErrors[task].empty() and mIslandTasks[task] < errorIsland) {
+            errorIsland = mIslandTasks[task];
+            errorMsg    = mIslandTaskErrors[task];
+        }
+    }
+    if (failed > 0 and errorMsg.empty()) {
+        errorMsg = "unexpected exception in an island thread.";
+    }
+    if (not errorMsg.empty()) {
+        GUNNS_ERROR(TsNumericalException, "Error Return Value", errorMsg);
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details  This method assembles the system admittance matrix from the individual link's
-///           contributions.  Looping through the links, we use the link's admittance map to know
-///           where to add its contribution terms into the main matrix.  Any out-of-bounds number in
-///           the link's map denote that location doesn't map to anywhere in the network system of
-///           equations, and we omit including the link's contribution at that location.  This will
-///           usually be the Ground node, but might occur for spare terms in a link's compressed
-///           matrix, or for bad link code that we must protect against, etc.
+/// @param[in] decompose (--) Decomposes the island when true, or solves it when false.
+/// @param[in] task      (--) Task number, the index into mIslandTasks.
+/// @param[in] worker    (--) Worker number, the index into the worker scratch arrays.
+///
+/// @details  To decompose, forms the island's sub-matrix in its kept factors array from the main
+///           matrix, and decomposes it.  To solve, forms the island source vector in the worker's
+///           scratch array, solves the island with its kept factors, and copies the island
+///           potentials into the main potential vector.  Each island only writes its own factors
+///           and rows of the main potential vector, so tasks don't interfere.  Solver exceptions are
+///           caught and their message saved for the calling thread to report.
+///
+/// @note     Like the serial island decomposition, this calls the CPU solver, which keeps no state
+///           between calls and so can be shared by the workers.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::runIslandTask(const bool decompose, const int task, const int worker)
+{
+    const int               island  = mIslandTasks[task];
+    const std::vector<int>& nodes   = mIslandVectors[island];
+    const int               n       = static_cast<int>(nodes.size());
+    double*                 A       = &mIslandFactors[island][0];
+    double*                 w       = &mIslandWorkerVectors[worker][0];
+    double*                 p       = w + n;
+
+    try {
+        if (decompose) {
+            for (int i=0, ij=0; i<n; ++i) {
+                const int in = nodes[i]*mNetworkSize;
+                for (int j=0; j<n; ++j, ++ij) {
+                    A[ij] = mAdmittanceMatrix[in + nodes[j]];
+                }
+            }
+            if (n > 1) {
+                getCpuSolver(n)->Decompose(A, n);
+            }
+        } else {
+            for (int i=0; i<n; ++i) {
+                w[i] = mSourceVector[nodes[i]];
+            }
+            getCpuSolver(n)->Solve(A, w, p, n);
+            for (int i=0; i<n; ++i) {
+                mPotentialVector[nodes[i]] = p[i];
+            }
+        }
+    } catch (TsNumericalException& e) {
+        std::ostringstream msg;
+        msg << e.getMessage() << " " << e.getThrowingEntityName() << " " << e.getCause()
+            << " in island " << island << ".";
+        mIslandTaskErrors[task] = msg.str();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Parallel Link Job
+///
+/// @details  Runs each task of a parallel link method on the solver.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class Gunns::LinkJob : public GunnsThreadPoolJob
+{
+    public:
+        /// @brief Constructs this job for the given solver, link method and its arguments.
+        LinkJob(Gunns& solver, const LinkPhase phase, const double timeStep,
+                const int convergedStep, const int absoluteStep)
+            : mSolver(solver), mPhase(phase), mTimeStep(timeStep), mConvergedStep(convergedStep),
+              mAbsoluteStep(absoluteStep) {;}
+        /// @brief Default destructs this job.
+        virtual ~LinkJob() {;}
+        /// @brief Runs the link method on the task's chunk of links.
+        virtual void runTask(const int task, const int worker __attribute__((unused)))
+        {
+            mSolver.runLinkTask(mPhase, mTimeStep, mConvergedStep, mAbsoluteStep, task);
+        }
+
+    private:
+        Gunns&          mSolver;        /**< ** (--) trick_chkpnt_io(**) The solver whose links are run. */
+        const LinkPhase mPhase;         /**< ** (--) trick_chkpnt_io(**) The link method to run. */
+        const double    mTimeStep;      /**< ** (s)  trick_chkpnt_io(**) Time step argument of the link method. */
+        const int       mConvergedStep; /**< ** (--) trick_chkpnt_io(**) Converged step argument of the link method. */
+        const int       mAbsoluteStep;  /**< ** (--) trick_chkpnt_io(**) Minor step argument of the link method. */
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        LinkJob(const LinkJob& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        LinkJob& operator =(const LinkJob& that);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if links are run by the worker threads.
+///
+/// @details  Parallel links require more than one worker.  Otherwise the serial loops are used.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::isLinkParallel() const
+{
+    return mLinkPool.getNumWorkers() > 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] phase         (--) The link method to run.
+/// @param[in] timeStep      (s)  Time step argument of the step & minorStep methods.
+/// @param[in] convergedStep (--) Converged step argument of the confirmSolutionAcceptable method.
+/// @param[in] absoluteStep  (--) Minor step argument of the minorStep & confirmSolutionAcceptable
+///                               methods.
+///
+/// @throws   TsNumericalException
+///
+/// @details  Runs the link method on each run of links between serial-only links on the thread
+///           pool, split into up to 4 contiguous chunks per worker so that faster workers can take
+///           more of them.  Each serial-only link is run alone on the calling thread after the
+///           links before it are done.  An exception from a link in a parallel chunk stops that
+///           chunk, and is reported after the other chunks are done, for the lowest numbered
+///           failing link.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::runLinksParallel(const LinkPhase phase, const double timeStep,
+                             const int convergedStep, const int absoluteStep)
+{
+    if (LINK_CONFIRM == phase) {
+        mLinkResults.assign(mNumLinks, GunnsBasicLink::CONFIRM);
+    }
+
+    const int workers = mLinkPool.getNumWorkers();
+    int       first   = 0;
+    for (int link = 0; link <= mNumLinks; ++link) {
+        const bool serial = (link < mNumLinks) and mLinks[link]->isSerialOnly();
+        if ((link < mNumLinks) and not serial) {
+            continue;
+        }
+
+        /// - Run the links since the last serial-only link, in parallel if more than one.
+        const int count = link - first;
+        if (count > 1) {
+            const int numTasks = std::min(count, 4 * workers);
+            mLinkTasks.resize(numTasks + 1);
+            for (int task = 0; task <= numTasks; ++task) {
+                mLinkTasks[task] = first + (count * task) / numTasks;
+            }
+            mLinkTaskErrors.assign(numTasks, std::string());
+
+            LinkJob job(*this, phase, timeStep, convergedStep, absoluteStep);
+            const int failed = mLinkPool.run(&job, numTasks);
+            mLinkParallelTasks += numTasks;
+
+            /// - Report the error from the lowest numbered failing link.
+            for (int task = 0; task < numTasks; ++task) {
+                if (not mLinkTaskErrors[task].empty()) {
+                    GUNNS_ERROR(TsNumericalException, "Error Return Value", mLinkTaskErrors[task]);
+                }
+            }
+            if (failed > 0) {
+                GUNNS_ERROR(TsNumericalException, "Error Return Value",
+                            "unexpected exception in a link thread.");
+            }
+        } else if (1 == count) {
+            runLink(phase, timeStep, convergedStep, absoluteStep, first);
+        }
+
+        /// - Run the serial-only link on this thread.
+        if (serial) {
+            runLink(phase, timeStep, convergedStep, absoluteStep, link);
+        }
+        first = link + 1;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] phase         (--) The link method to run.
+/// @param[in] timeStep      (s)  Time step argument of the step & minorStep methods.
+/// @param[in] convergedStep (--) Converged step argument of the confirmSolutionAcceptable method.
+/// @param[in] absoluteStep  (--) Minor step argument of the minorStep & confirmSolutionAcceptable
+///                               methods.
+/// @param[in] task          (--) Task number, the index into mLinkTasks.
+///
+/// @details  Runs the link method on the task's chunk of links, in order.  Link exceptions are
+///           caught and their message saved for the calling thread to report, and the rest of the
+///           chunk is skipped.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::runLinkTask(const LinkPhase phase, const double timeStep,
+                        const int convergedStep, const int absoluteStep, const int task)
+{
+    for (int link = mLinkTasks[task]; link < mLinkTasks[task+1]; ++link) {
+        try {
+            runLink(phase, timeStep, convergedStep, absoluteStep, link);
+        } catch (TsBaseException& e) {
+            std::ostringstream msg;
+            msg << e.getMessage() << " " << e.getThrowingEntityName() << " " << e.getCause()
+                << " in link " << mLinks[link]->getName() << ".";
+            mLinkTaskErrors[task] = msg.str();
+            return;
+        } catch (std::exception& e) {
+            std::ostringstream msg;
+            msg << e.what() << " in link " << mLinks[link]->getName() << ".";
+            mLinkTaskErrors[task] = msg.str();
+            return;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] phase         (--) The link method to run.
+/// @param[in] timeStep      (s)  Time step argument of the step & minorStep methods.
+/// @param[in] convergedStep (--) Converged step argument of the confirmSolutionAcceptable method.
+/// @param[in] absoluteStep  (--) Minor step argument of the minorStep & confirmSolutionAcceptable
+///                               methods.
+/// @param[in] link          (--) Link number, the index into mLinks.
+///
+/// @details  Runs the link method on the link, the same as the serial loops: minorStep and
+///           confirmSolutionAcceptable are only run on non-linear links, and the latter's result is
+///           saved in mLinkResults.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::runLink(const LinkPhase phase, const double timeStep,
+                    const int convergedStep, const int absoluteStep, const int link)
+{
+    if (LINK_STEP == phase) {
+        mLinks[link]->step(timeStep);
+    } else if (mLinks[link]->isNonLinear()) {
+        if (LINK_MINOR_STEP == phase) {
+            mLinks[link]->minorStep(timeStep, absoluteStep);
+        } else {
+            mLinkResults[link] = mLinks[link]->confirmSolutionAcceptable(convergedStep,
+                                                                          absoluteStep);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if island decompositions are kept and solved at island size.
+///
+/// @details  Island size decompositions are used in SOLVE island mode with DENSE storage and no
+///           GPU.  The GPU modes decompose islands into the main matrix instead.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::isIslandCompact() const
+{
+    return (SOLVE == mIslandMode) and (DENSE == mMatrixStorage) and (NO_GPU == mGpuMode);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if island decompositions are kept and re-used.
+///
+/// @details  Island factor caching requires the island size decompositions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::isIslandCaching() const
+{
+    return mIslandCaching and isIslandCompact();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Flags each island as stale if it has no kept decomposition for its current nodes, or
+///           if a link attached to one of its nodes has changed since the last decomposition.  All
+///           islands are stale when not caching, after a change to the matrix pattern, in
+///           worst-case timing mode, or when every link has changed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::markStaleIslandFactors()
+{
+    const bool allStale = not mIslandCaching
+                       or (mIslandFactorPattern != mSparsePatternCount) or mWorstCaseTiming
+                       or (static_cast<int>(mChangedLinks.size()) >= mNumLinks)
+                       or (static_cast<int>(mIslandFactorNodes.size()) != mNetworkSize);
+    if (static_cast<int>(mIslandFactorNodes.size()) != mNetworkSize) {
+        mIslandFactorNodes.assign(mNetworkSize, std::vector<int>());
+    }
+    mIslandFactors.resize(mNetworkSize);
+    mIslandFactorStale.resize(mNetworkSize);
+    mIslandFactorPattern = mSparsePatternCount;
+
+    for (int island = 0; island < mNetworkSize; ++island) {
+        mIslandFactorStale[island] = allStale or (mIslandFactorNodes[island] != mIslandVectors[island]);
+    }
+    for (unsigned int i = 0; i < mChangedLinks.size(); ++i) {
+        const int link = mChangedLinks[i];
+        for (int port = 0; port < mLinkNumPorts[link]; ++port) {
+            const int node = mLinkNodeMaps[link][port];
+            if (node < mNetworkSize) {
+                mIslandFactorStale[mNodeIslandNumbers[node]] = 1;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsNumericalException
+///
+/// @details  Forms the sub-matrix of each stale island in its kept factors array, and decomposes
+///           it.  The island's nodes are recorded once its decomposition succeeds.  Islands that
+///           aren't stale are skipped, and the main admittance matrix is left un-decomposed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::decomposeIslandFactors()
+{
+    markStaleIslandFactors();
+    for (int island = 0; island < mNetworkSize; ++island) {
+        const std::vector<int>& nodes = mIslandVectors[island];
+        const int               n     = static_cast<int>(nodes.size());
+        if (0 == n) {
+            continue;
+        }
+        if (not mIslandFactorStale[island]) {
+            mIslandFactorReuses++;
+            continue;
+        }
+        mIslandFactorNodes[island].clear();
+        std::vector<double>& factors = mIslandFactors[island];
+        factors.resize(n * n);
+        for (int i=0, ij=0; i<n; ++i) {
+            const int in = nodes[i]*mNetworkSize;
+            for (int j=0; j<n; ++j, ++ij) {
+                factors[ij] = mAdmittanceMatrix[in + nodes[j]];
+            }
+        }
+        if (1 < n) {
+            decompose(&factors[0], n, island);
+        }
+        mIslandFactorNodes[island] = nodes;
+        mIslandFactorStale[island] = 0;
+        mIslandFactorDecompositions++;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsNumericalException
+///
+/// @details  Solves each island with its kept decomposition on island size vectors, and copies the
+///           island potentials into the main potential vector.  In a Trick environment, also records
+///           the elapsed wall time of the solutions for timing analysis.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::solveIslandFactors()
+{
+    double startTime = GunnsInfraFunctions::clockTime();
+    for (int island = 0; island < mNetworkSize; ++island) {
+        const std::vector<int>& nodes = mIslandVectors[island];
+        const int               n     = static_cast<int>(nodes.size());
+        if (0 < n) {
+            for (int i=0; i<n; ++i) {
+                mSourceVectorIsland[i] = mSourceVector[nodes[i]];
+            }
+            handleSolve(getCpuSolver(n), &mIslandFactors[island][0], mSourceVectorIsland,
+                        mPotentialVectorIsland, n, island);
+            for (int i=0; i<n; ++i) {
+                mPotentialVector[nodes[i]] = mPotentialVectorIsland[i];
+            }
+        }
+    }
+    mSolveTimeWorking += GunnsInfraFunctions::clockTime() - startTime;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the full dense decomposition is kept for updating.
+///
+/// @details  Updates require a rank limit, DENSE storage, no GPU, and an island mode other than
+///           SOLVE, since only the full matrix decomposition is saved.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::isFactorUpdateActive() const
+{
+    return (mFactorRankLimit > 0) and (SOLVE != mIslandMode)
+       and (DENSE == mMatrixStorage) and (NO_GPU == mGpuMode);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsNumericalException
+///
+/// @details  Replaces the admittance matrix with its decomposition, like decompose, but when the
+///           saved decomposition is valid and below the refresh limit, and the changes to the
+///           matrix since then are within the rank limit, the saved decomposition is updated for
+///           the changes instead.  Updates that increase the matrix are applied before those that
+///           decrease it, so that the diagonal stays as large as possible along the way.  If an
+///           update fails for loss of precision, the full decomposition is done instead.  Either
+///           way, the new matrix and its decomposition are saved for the next update.  In a Trick
+///           environment, also records the elapsed wall time for timing analysis.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::decomposeWithUpdates()
+{
+    const int n  = mNetworkSize;
+    const int n2 = n * n;
+    if (static_cast<int>(mFactorLdu.size()) != n2) {
+        mFactorMatrix.assign(n2, 0.0);
+        mFactorLdu.assign(n2, 0.0);
+        mFactorVector.assign(n, 0.0);
+        mFactorValid = false;
+    }
+
+    bool updated = false;
+    if (mFactorValid and mFactorUpdatesSinceFull < mFactorRefreshLimit) {
+        double startTime = GunnsInfraFunctions::clockTime();
+        if (findFactorUpdates()) {
+            const int numUpdates = static_cast<int>(mFactorUpdateWeights.size());
+            try {
+                for (int pass = 0; pass < 2; ++pass) {
+                    for (int update = 0; update < numUpdates; ++update) {
+                        const double sigma = mFactorUpdateWeights[update];
+                        if ((0 == pass) != (sigma > 0.0)) {
+                            continue;
+                        }
+                        const int i     = mFactorUpdateNodes[2*update];
+                        const int j     = mFactorUpdateNodes[2*update + 1];
+                        const int start = (j < 0) ? i : std::min(i, j);
+                        mFactorVector[i] = 1.0;
+                        if (j >= 0) {
+                            mFactorVector[j] = -1.0;
+                        }
+                        mSolverCpu->Update(&mFactorLdu[0], &mFactorVector[0], sigma, n, start);
+                        std::fill(mFactorVector.begin() + start, mFactorVector.end(), 0.0);
+                    }
+                }
+                updated = true;
+                mFactorUpdateRanks += numUpdates;
+            } catch (TsNumericalException&) {
+                std::fill(mFactorVector.begin(), mFactorVector.end(), 0.0);
+            }
+        }
+        mSolveTimeWorking += GunnsInfraFunctions::clockTime() - startTime;
+        if (not updated) {
+            mFactorFallbackCount++;
+        }
+    }
+
+    if (updated) {
+        mFactorUpdateCount++;
+        mFactorUpdatesSinceFull++;
+        std::copy(mAdmittanceMatrix, mAdmittanceMatrix + n2, mFactorMatrix.begin());
+        std::copy(mFactorLdu.begin(), mFactorLdu.end(), mAdmittanceMatrix);
+    } else {
+        /// - The saved decomposition is invalid until this decomposition succeeds.
+        mFactorValid = false;
+        std::copy(mAdmittanceMatrix, mAdmittanceMatrix + n2, mFactorMatrix.begin());
+        decompose(mAdmittanceMatrix, n);
+        std::copy(mAdmittanceMatrix, mAdmittanceMatrix + n2, mFactorLdu.begin());
+        mFactorValid            = true;
+        mFactorUpdatesSinceFull = 0;
+        mFactorFullCount++;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the changes are within the rank limit.
+///
+/// @details  Compares the admittance matrix to the saved matrix, and lists a rank-1 update for
+///           each change.  A change d to the symmetric off-diagonal pair (i, j) is the update
+///           -d{e_i - e_j}{e_i - e_j}', which also changes both diagonals by -d.  What remains of
+///           each diagonal change after that is a diagonal update, unless it is only round-off
+///           relative to the diagonal.  A conductance change between two nodes therefore takes
+///           one update, and a change to ground takes one.  Stops and returns false as soon as the
+///           rank limit is exceeded.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::findFactorUpdates()
+{
+    const int n = mNetworkSize;
+    mFactorUpdateNodes.clear();
+    mFactorUpdateWeights.clear();
+
+    /// - Use the update vector to accumulate the diagonal residuals; it is zeroed again below.
+    double* residual = &mFactorVector[0];
+    for (int i = 0; i < n; ++i) {
+        const int ii = i*n + i;
+        residual[i] += mAdmittanceMatrix[ii] - mFactorMatrix[ii];
+        for (int j = i + 1, ij = ii + 1; j < n; ++j, ++ij) {
+            const double d = mAdmittanceMatrix[ij] - mFactorMatrix[ij];
+            if (0.0 != d) {
+                if (static_cast<int>(mFactorUpdateWeights.size()) >= mFactorRankLimit) {
+                    std::fill(mFactorVector.begin(), mFactorVector.end(), 0.0);
+                    return false;
+                }
+                mFactorUpdateNodes.push_back(i);
+                mFactorUpdateNodes.push_back(j);
+                mFactorUpdateWeights.push_back(-d);
+                residual[i] += d;
+                residual[j] += d;
+            }
+        }
+    }
+
+    /// - Diagonal residuals within a few round-offs of the summed link contributions are ignored.
+    const double roundOff = 16.0 * DBL_EPSILON;
+    bool withinLimit = true;
+    for (int i = 0; i < n; ++i) {
+        const int    ii = i*n + i;
+        const double r  = residual[i];
+        residual[i] = 0.0;
+        if (withinLimit and std::fabs(r) > roundOff * (std::fabs(mAdmittanceMatrix[ii])
+                                                     + std::fabs(mFactorMatrix[ii]))) {
+            if (static_cast<int>(mFactorUpdateWeights.size()) >= mFactorRankLimit) {
+                withinLimit = false;
+            } else {
+                mFactorUpdateNodes.push_back(i);
+                mFactorUpdateNodes.push_back(-1);
+                mFactorUpdateWeights.push_back(r);
+            }
+        }
+    }
+    return withinLimit;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsInitializationException
+///
+/// @details  This method checks the network's mode settings for validity and makes sure the
+///           network has completed initialization prior to stepping.
+///
+/// @note     The TsInitializationException should be fatal to the load.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::checkStepInputs()
+{
+    if (mLastSolverMode != mSolverMode) {
+        mLastSolverMode  = mSolverMode;
+        GUNNS_INFO("solver mode changed to " << getSolverModeString() << ".");
+    }
+
+    if (mLastIslandMode != mIslandMode) {
+        mLastIslandMode  = mIslandMode;
+        GUNNS_INFO("island mode changed to " << getIslandModeString() << ".");
+    }
+
+    if (mLastRunMode != mRunMode) {
+        mLastRunMode  = mRunMode;
+        GUNNS_INFO("run mode changed to " << getRunModeString() << ".");
+    }
+
+    /// - Prevent invalid GPU modes.  Down-moding forces a rebuild like setGpuOptions.
+    if (NO_GPU != mGpuMode) {
+        if (not mGpuEnabled) {
+            mGpuMode = NO_GPU;
+            mRebuild = true;
+            GUNNS_WARNING("mGpuMode downmoded to NO_GPU because this solver isn't GPU enabled.");
+        } else if (mGpuSizeThreshold > mNetworkSize) {
+            mGpuMode = NO_GPU;
+            mRebuild = true;
+            GUNNS_WARNING("mGpuMode downmoded to NO_GPU because the entire network size is smaller than the GPU threshold.");
+        }
+        if (mGpuSizeThreshold < 2) {
+            mGpuSizeThreshold = 2;
+            GUNNS_WARNING("mGpuSizeThreshold reset to the minimum operating value of 2.");
+        }
+    }
+
+    /// - Issue an error if the network has not been initialized.  We use the TS_HS_EXCEPTION macro
+    ///   rather than GUNNS_ERROR so we can indicate the unknown name.
+    if (!mInitFlag) {
+        TS_HS_EXCEPTION(TS_HS_ERROR, "GUNNS", "Network has not been initialized.",
+                        TsInitializationException, "Invalid Initialization Data", "Unknown");
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] minorStep (--) The absolute minor step # that the network is on
+///
+/// @return   bool (--) Returns true if the solution has converged, false otherwise
+///
+/// @details  This method checks for convergence of the system's potential vector solution.  The
+///           delta between the previous minor step's solution and the current solution must be
+///           below a defined tolerance, for each node individually.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::checkSystemConvergence(const int minorStep)
+{
+    /// - Record the last node found that fails to converge, otherwise -1 indicates all nodes have
+    ///   converged.
+    int lastNonConvergingNode = -1;
+    for (int node = 0; node < mNetworkSize; ++node) {
+
+        mNodesConvergence[node] = fabs(mMinorPotentialVector[node] - mPotentialVector[node]);
+        if (mNodesConvergence[node] > mConvergenceTolerance) {
+            lastNonConvergingNode = node;
+
+            /// - Pause recording minor step potentials when the recorded node fails to converge.
+            if (minorStep == mMinorStepLimit and node == mDebugDesiredNode) {
+                mDebugDesiredNode = -1;
+            }
+        }
+    }
+    return (lastNonConvergingNode < 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] convergedStep (--) The # of minor steps since the network last converged
+/// @param[in] absoluteStep  (--) The absolute minor step number that the network is on
+///
+/// @return   GunnsBasicLink::SolutionResult (--) The combined assessment of the solution from all
+///                                               of the non-linear links in the network
+///
+/// @details  This method checks all non-linear links for acceptance of the solution.  An example
+///           would be an open check valve seeing reverse pressure gradient indicating reverse flow,
+///           in which case the link would need to change its state to closed and re-solve the
+///           system.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBasicLink::SolutionResult Gunns::confirmSolutionAcceptance(const int convergedStep,
+                                                                const int absoluteStep)
+{
+    GunnsBasicLink::SolutionResult result = GunnsBasicLink::CONFIRM;
+
+    /// - In parallel, all the non-linear links assess the solution first, and their results are
+    ///   combined below in link order.
+    const bool linkParallel = isLinkParallel();
+    if (linkParallel) {
+        runLinksParallel(LINK_CONFIRM, 0.0, convergedStep, absoluteStep);
+    }
+
+    /// - Loop over all the non-linear links so they can assess the solution.  If one rejects the
+    ///   solution, we still give the remaining links a chance to assess, because multiple links
+    ///   might be rejecting the solution simultaneously (say for 2 diodes in parallel), and we want
+    ///   all of them to adjust for the next minor-step at the same time.
+    for (int link = 0; link < mNumLinks; ++link) {
+
+        if (mLinks[link]->isNonLinear()) {
+
+            /// - Get the link's result.  We don't allow links to delay prior to system convergence,
+            ///   so change such a result to confirmed until after we've converged.
+            GunnsBasicLink::SolutionResult linkResult = linkParallel ? mLinkResults[link] :
+                    mLinks[link]->confirmSolutionAcceptable(convergedStep, absoluteStep);
+            mStepLog.recordLinkResult(link, linkResult);
+            if ((0 == convergedStep) and (GunnsBasicLink::DELAY == linkResult)) {
+                linkResult = GunnsBasicLink::CONFIRM;
+            }
+
+            /// - If any link rejects the solution, then the solution is rejected for the entire
+            ///   network.  We use if/else structure instead of switch/case to avoid ambiguity with
+            //    break statements.
+            if (GunnsBasicLink::REJECT == linkResult) {
+                result = GunnsBasicLink::REJECT;
+            }
+
+            /// - If any link delays the solution, then the entire network solution is delayed, but
+            ///   only if no link is rejecting.  Rejecting overrides delaying.
+            else if (GunnsBasicLink::DELAY == linkResult && GunnsBasicLink::REJECT != result) {
+                result = GunnsBasicLink::DELAY;
+            }
+            mLinksConvergence[link] = linkResult;
+        }
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method assembles the system admittance matrix from the individual link's
+///           contributions.  Looping through the links, we use the link's admittance map to know
+///           where to add its contribution terms into the main matrix.  Any out-of-bounds number in
+///           the link's map denote that location doesn't map to anywhere in the network system of
+///           equations, and we omit including the link's contribution at that location.  This will
+///           usually be the Ground node, but might occur for spare terms in a link's compressed
+///           matrix, or for bad link code that we must protect against, etc.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void Gunns::buildAdmittanceMatrix()
 {
-    const int admittanceMatrixSize = mNetworkSize * mNetworkSize;
-    for (int i = 0; i < admittanceMatrixSize; ++i) {
-        mAdmittanceMatrix[i] = 0.0;
+    /// - Rebuild the sparse pattern if any link has changed its admittance map since it was last
+    ///   built.  The pattern is used for island detection in both storage modes.
+    if (isSparsePatternStale()) {
+        buildSparsePattern();
+    }
+
+    if (mIncrementalRefreshLimit > 0) {
+        buildIncrementalAdmittanceMatrix();
+    } else if (SPARSE == mMatrixStorage) {
+        buildSparseAdmittanceMatrix();
+    } else {
+        const int admittanceMatrixSize = mNetworkSize * mNetworkSize;
+        for (int i = 0; i < admittanceMatrixSize; ++i) {
+            mAdmittanceMatrix[i] = 0.0;
+        }
+
+        for (int link = 0; link < mNumLinks; ++link) {
+            for (unsigned int linkMap = 0; linkMap < mLinkAdmittanceMaps[link]->mSize; ++linkMap) {
+                const int networkMap = mLinkAdmittanceMaps[link]->mMap[linkMap];
+                if (networkMap > -1 and networkMap < admittanceMatrixSize) {
+                    mAdmittanceMatrix[networkMap] += mLinkAdmittanceMatrices[link][linkMap];
+                }
+            }
+        }
+    }
+
+    /// - Force a full island build when islands are next turned on, since connections may have
+    ///   changed in the meantime.
+    if (OFF != mIslandMode) {
+        buildIslands();
+    } else {
+        mIslandPatternCount = -1;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method is the SPARSE storage mode version of buildAdmittanceMatrix.  The link
+///           contributions are added into the sparse matrix through the storage slots found when
+///           the pattern was built, so only the stored non-zero positions are zeroed and summed.
+///           The sparse matrix is only expanded into the dense admittance matrix when SOR, the
+///           debug or the GPU functions use it, so the build cost doesn't scale with n^2.
+///
+///           Contributions are summed in the same order as in DENSE storage, so both modes result
+///           in an identical admittance matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::buildSparseAdmittanceMatrix()
+{
+    mAdmittanceSparse->zero();
+    double* values = mAdmittanceSparse->getValues();
+    for (int link = 0; link < mNumLinks; ++link) {
+        const int*    slots    = mSparseSlots + mSparseLinkOffsets[link];
+        const double* linkA    = mLinkAdmittanceMatrices[link];
+        const int     linkSize = mSparseLinkOffsets[link+1] - mSparseLinkOffsets[link];
+        for (int linkMap = 0; linkMap < linkSize; ++linkMap) {
+            if (slots[linkMap] > -1) {
+                values[slots[linkMap]] += linkA[linkMap];
+            }
+        }
+    }
+
+    if (isDenseAdmittanceNeeded()) {
+        mAdmittanceSparse->toDense(mAdmittanceMatrix);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the dense admittance matrix is to be kept loaded during the step.
+///
+/// @details  The dense matrix is always used in DENSE storage.  In SPARSE storage it is only used
+///           by SOR, the debug admittance slice, and the GPU solvers, and otherwise is only loaded
+///           from the sparse matrix on demand by getAdmittanceMatrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::isDenseAdmittanceNeeded() const
+{
+    return (DENSE == mMatrixStorage) or mSorActive or (0 != mDebugDesiredStep)
+        or (NO_GPU != mGpuMode);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return double* -- Returns the admittance matrix.
+///
+/// @details  This method gets the admittance matrix.  In SPARSE storage when the dense matrix isn't
+///           being kept loaded, it is first expanded from the sparse matrix, so the caller always
+///           sees the current un-decomposed matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double* Gunns::getAdmittanceMatrix() const
+{
+    if (mAdmittanceSparse and not isDenseAdmittanceNeeded()) {
+        mAdmittanceSparse->toDense(mAdmittanceMatrix);
+    }
+    return mAdmittanceMatrix;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method is the incremental version of buildAdmittanceMatrix, in either storage
+///           mode.  The kept sum at each sparse pattern slot of the links that changed since the
+///           last build is summed again from all of the slot's contributors, in the same order as
+///           a full build, and the sums are loaded into the sparse matrix.  They are only expanded
+///           into the dense matrix when it is needed, so in SPARSE storage the build cost scales
+///           with the changed links rather than n^2.  A full
+///           build of all the slot sums is done instead after a pattern change, when more than a
+///           quarter of the links changed, or at the refresh limit.
+///
+///           Either way, the matrices are identical to the non-incremental build.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::buildIncrementalAdmittanceMatrix()
+{
+    if (mIncrementalPattern != mSparsePatternCount) {
+        buildSlotContributors();
+    }
+
+    const int numChanged = static_cast<int>(mAdmittanceChangedLinks.size());
+    if (mIncrementalSinceFull >= mIncrementalRefreshLimit or numChanged * 4 > mNumLinks) {
+        std::fill(mAdmittanceSlotSums.begin(), mAdmittanceSlotSums.end(), 0.0);
+        for (int link = 0; link < mNumLinks; ++link) {
+            const int*    slots    = mSparseSlots + mSparseLinkOffsets[link];
+            const double* linkA    = mLinkAdmittanceMatrices[link];
+            const int     linkSize = mSparseLinkOffsets[link+1] - mSparseLinkOffsets[link];
+            for (int linkMap = 0; linkMap < linkSize; ++linkMap) {
+                if (slots[linkMap] > -1) {
+                    mAdmittanceSlotSums[slots[linkMap]] += linkA[linkMap];
+                }
+            }
+        }
+        mIncrementalSinceFull = 0;
+        mIncrementalFullCount++;
+    } else {
+        for (int i = 0; i < numChanged; ++i) {
+            const int  link     = mAdmittanceChangedLinks[i];
+            const int* slots    = mSparseSlots + mSparseLinkOffsets[link];
+            const int  linkSize = mSparseLinkOffsets[link+1] - mSparseLinkOffsets[link];
+            for (int linkMap = 0; linkMap < linkSize; ++linkMap) {
+                const int slot = slots[linkMap];
+                if (slot > -1) {
+                    const int end = mSlotContributorStart[slot+1];
+                    double    sum = 0.0;
+                    for (int c = mSlotContributorStart[slot]; c < end; ++c) {
+                        sum += mLinkAdmittanceMatrices[mSlotContributorLinks[c]]
+                                                      [mSlotContributorEntries[c]];
+                    }
+                    mAdmittanceSlotSums[slot] = sum;
+                }
+            }
+        }
+        mIncrementalSinceFull++;
+        mIncrementalBuildCount++;
+    }
+    mAdmittanceChangedLinks.clear();
+
+    /// - Load the slot sums into the matrices.  Conditioning and decomposition modify these, so the
+    ///   sums are kept separately.
+    double* values = mAdmittanceSparse->getValues();
+    std::copy(mAdmittanceSlotSums.begin(), mAdmittanceSlotSums.end(), values);
+    if (isDenseAdmittanceNeeded()) {
+        mAdmittanceSparse->toDense(mAdmittanceMatrix);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Lists the link admittance map entries contributing to each sparse pattern slot, in
+///           link and map entry order, and sizes the kept slot sums for the pattern.  The next
+///           incremental build is a full build.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::buildSlotContributors()
+{
+    const int nnz        = mAdmittanceSparse->getNnz();
+    const int numEntries = mSparseLinkOffsets[mNumLinks];
+    mSlotContributorStart.assign(nnz + 1, 0);
+    for (int entry = 0; entry < numEntries; ++entry) {
+        if (mSparseSlots[entry] > -1) {
+            mSlotContributorStart[mSparseSlots[entry] + 1]++;
+        }
+    }
+    for (int slot = 0; slot < nnz; ++slot) {
+        mSlotContributorStart[slot + 1] += mSlotContributorStart[slot];
+    }
+
+    mSlotContributorLinks.resize(mSlotContributorStart[nnz]);
+    mSlotContributorEntries.resize(mSlotContributorStart[nnz]);
+    std::vector<int> next(mSlotContributorStart.begin(), mSlotContributorStart.end() - 1);
+    for (int link = 0; link < mNumLinks; ++link) {
+        for (int entry = mSparseLinkOffsets[link]; entry < mSparseLinkOffsets[link+1]; ++entry) {
+            const int slot = mSparseSlots[entry];
+            if (slot > -1) {
+                mSlotContributorLinks[next[slot]]   = link;
+                mSlotContributorEntries[next[slot]] = entry - mSparseLinkOffsets[link];
+                next[slot]++;
+            }
+        }
     }
 
+    mAdmittanceSlotSums.assign(nnz, 0.0);
+    mIncrementalPattern   = mSparsePatternCount;
+    mIncrementalSinceFull = mIncrementalRefreshLimit;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Builds the symbolic pattern of the sparse admittance matrix from the current link
+///           admittance maps, and finds the sparse storage slot of each link admittance map entry.
+///           Map entries that are omitted from the dense matrix (such as the Ground node) are given
+///           a slot of -1 and are likewise omitted from the sparse matrix.  A copy of the maps is
+///           saved so that later changes to them can be detected.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::buildSparsePattern()
+{
+    /// - Size the slot and map copy arrays for the current link map sizes.
+    {
+        delete [] mSparseMaps;
+        mSparseMaps = 0;
+    } {
+        delete [] mSparseSlots;
+        mSparseSlots = 0;
+    } {
+        delete [] mSparseLinkOffsets;
+        mSparseLinkOffsets = 0;
+    }
+    mSparseLinkOffsets = new int[mNumLinks+1];
+    mSparseLinkOffsets[0] = 0;
     for (int link = 0; link < mNumLinks; ++link) {
-        for (unsigned int linkMap = 0; linkMap < mLinkAdmittanceMaps[link]->mSize; ++linkMap) {
+        mSparseLinkOffsets[link+1] = mSparseLinkOffsets[link]
+                                   + static_cast<int>(mLinkAdmittanceMaps[link]->mSize);
+    }
+    const int numEntries = mSparseLinkOffsets[mNumLinks];
+    mSparseSlots = new int[numEntries];
+    mSparseMaps  = new int[numEntries];
+
+    /// - Save the link maps and collect the valid positions for the pattern.
+    const int admittanceMatrixSize = mNetworkSize * mNetworkSize;
+    std::vector<int> positions;
+    positions.reserve(numEntries);
+    for (int link = 0, entry = 0; link < mNumLinks; ++link) {
+        for (unsigned int linkMap = 0; linkMap < mLinkAdmittanceMaps[link]->mSize; ++linkMap, ++entry) {
             const int networkMap = mLinkAdmittanceMaps[link]->mMap[linkMap];
+            mSparseMaps[entry] = networkMap;
             if (networkMap > -1 and networkMap < admittanceMatrixSize) {
-                mAdmittanceMatrix[networkMap] += mLinkAdmittanceMatrices[link][linkMap];
+                positions.push_back(networkMap);
             }
         }
     }
+    mAdmittanceSparse->buildPattern(mNetworkSize, positions);
+
+    /// - Size the island connection states for the new pattern.  These are loaded by the next full
+    ///   island build, which the new pattern count will trigger.
+    {
+        delete [] mIslandConnections;
+        mIslandConnections = 0;
+    }
+    mIslandConnections = new bool[mAdmittanceSparse->getNnz()];
+    for (int slot = 0; slot < mAdmittanceSparse->getNnz(); ++slot) {
+        mIslandConnections[slot] = false;
+    }
+
+    /// - Find the storage slot of each link map entry.
+    for (int entry = 0; entry < numEntries; ++entry) {
+        const int networkMap = mSparseMaps[entry];
+        if (networkMap > -1 and networkMap < admittanceMatrixSize) {
+            mSparseSlots[entry] = mAdmittanceSparse->findSlot(networkMap / mNetworkSize,
+                                                              networkMap % mNetworkSize);
+        } else {
+            mSparseSlots[entry] = -1;
+        }
+    }
+    ++mSparsePatternCount;
+}
 
-    if (OFF != mIslandMode) buildIslands();
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if any link admittance map has changed since the pattern was built.
+///
+/// @details  Compares the current link admittance maps to the copy saved when the sparse pattern
+///           was built.  Links change their maps when they move a port to a different node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::isSparsePatternStale() const
+{
+    for (int link = 0; link < mNumLinks; ++link) {
+        const GunnsBasicLinkAdmittanceMap* map = mLinkAdmittanceMaps[link];
+        const int offset = mSparseLinkOffsets[link];
+        if (static_cast<int>(map->mSize) != mSparseLinkOffsets[link+1] - offset) {
+            return true;
+        }
+        for (unsigned int linkMap = 0; linkMap < map->mSize; ++linkMap) {
+            if (map->mMap[linkMap] != mSparseMaps[offset + linkMap]) {
+                return true;
+            }
+        }
+    }
+    return false;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1260,77 +2663,127 @@ void Gunns::buildAdmittanceMatrix()
 ///           incident links for their information about what else is in the island they are on.
 ///           This can be useful for implementing stability filters, etc.
 ///
-///           Finding the islands incurs about 5% more CPU time than not doing it, more or less
-///           depending on how large or sparse the matrix is.  This method only sweeps thru the
-///           matrix once, and only does column searches when it hits off-diagonals, which takes
-///           advantage of sparsity.  This should speed proportional to # nodes * # off-diagonals.
+///           Nodes are connected when the upper off-diagonal of the admittance matrix at any
+///           position in the link admittance maps is non-zero.  These positions are visited via the
+///           sparse matrix pattern, so this costs O(# links) rather than O(n^2).  The nodes are
+///           grouped with a disjoint-set forest whose roots are always the lowest node number in
+///           their island, so the island numbers are the same as the old column-sweep method.
+///
+///           When the pattern is unchanged and positions have only gone from zero to non-zero since
+///           the last pass, the new connections are merged into the existing forest.  If nothing
+///           changed, the island vectors are left alone.  A connection going to zero might split an
+///           island, which a disjoint-set can't do, so that rebuilds the forest from scratch.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void Gunns::buildIslands()
 {
-    /// - Start with all nodes on their own islands
-    for (int node = 0; node < mNetworkSize; ++node) {
-        mNodeIslandNumbers[node] = node;
-    }
-
-    /// - Find all off-diagonals.  They connect 2 nodes in an island.
-    for (int row=0; row<mNetworkSize-1; ++row) {
-        for (int col=row+1, a=row*mNetworkSize+col; col<mNetworkSize; col++, a++) {
-            if (mAdmittanceMatrix[a] != 0.0) {
-
-                /// - Find the lowest island # of all populated rows in this column, including the
-                ///   diagonal.
-                int minNum = mNodeIslandNumbers[col];
-                if (mNodeIslandNumbers[row] < minNum) minNum = mNodeIslandNumbers[row];  // checks the current row
-                for (int row2=row+1, a2=row2*mNetworkSize+col; row2<col; row2++, a2+=mNetworkSize) {
-                    if (mAdmittanceMatrix[a2] != 0.0 and mNodeIslandNumbers[row2] < minNum) {
-                        minNum = mNodeIslandNumbers[row2];                               // checks the off-diagonals
-                    }
+    const int*    rowStart  = mAdmittanceSparse->getRowStart();
+    const int*    columns   = mAdmittanceSparse->getColumnIndex();
+    const int*    diagonals = mAdmittanceSparse->getDiagonalSlots();
+    const double* values    = mAdmittanceSparse->getValues();
+    const bool    sparse    = (SPARSE == mMatrixStorage);
+
+    /// - Merge new connections into the existing islands.  The upper off-diagonals of each row
+    ///   follow its diagonal in the sorted sparse row.
+    bool fullBuild = (mIslandPatternCount != mSparsePatternCount);
+    bool changed   = false;
+    for (int row = 0; row < mNetworkSize and not fullBuild; ++row) {
+        for (int slot = diagonals[row] + 1; slot < rowStart[row+1]; ++slot) {
+            const int  col       = columns[slot];
+            const bool connected = 0.0 != (sparse ? values[slot]
+                                                  : mAdmittanceMatrix[row*mNetworkSize+col]);
+            if (connected != mIslandConnections[slot]) {
+                if (not connected) {
+                    fullBuild = true;
+                    break;
                 }
+                mIslandConnections[slot] = true;
+                unionIslands(row, col);
+                changed = true;
+            }
+        }
+    }
 
-                /// - For any island # found in this column not equal to the new lowest island #,
-                ///   all nodes with that island # must be merged to the new lowest #.
-                for (int row2=row+1, a2=row2*mNetworkSize+col; row2<col; row2++, a2+=mNetworkSize) {
-                    if (mAdmittanceMatrix[a2] != 0.0) {
-                        mergeIslands(mNodeIslandNumbers[row2], minNum); // sets all off-diags down the column
-                    }
+    /// - Rebuild the islands from scratch, starting with all nodes on their own islands.
+    if (fullBuild) {
+        for (int node = 0; node < mNetworkSize; ++node) {
+            mIslandParent[node] = node;
+        }
+        for (int row = 0; row < mNetworkSize; ++row) {
+            for (int slot = diagonals[row] + 1; slot < rowStart[row+1]; ++slot) {
+                const int  col       = columns[slot];
+                const bool connected = 0.0 != (sparse ? values[slot]
+                                                      : mAdmittanceMatrix[row*mNetworkSize+col]);
+                mIslandConnections[slot] = connected;
+                if (connected) {
+                    unionIslands(row, col);
                 }
-                mergeIslands(mNodeIslandNumbers[row], minNum);          // sets the current row
-                mergeIslands(mNodeIslandNumbers[col], minNum);          // sets the diagonal
             }
         }
+        mIslandPatternCount = mSparsePatternCount;
+        mIslandFullBuilds++;
+        changed = true;
+    } else if (changed) {
+        mIslandIncrementalBuilds++;
     }
 
-    /// - Populate island vectors with the node numbers, and give each node a pointer to its vector.
-    for (int island = 0; island < mNetworkSize; ++island) {
-        mIslandVectors[island].clear();
-    }
-    for (int node = 0; node < mNetworkSize; ++node) {
-        mNodes[node]->setIslandVector(&mIslandVectors[mNodeIslandNumbers[node]]);
-        mIslandVectors[mNodeIslandNumbers[node]].push_back(node);
+    if (changed) {
+        for (int node = 0; node < mNetworkSize; ++node) {
+            mNodeIslandNumbers[node] = findIslandRoot(node);
+        }
+
+        /// - Populate island vectors with the node numbers, and give each node a pointer to its
+        ///   vector.
+        for (int island = 0; island < mNetworkSize; ++island) {
+            mIslandVectors[island].clear();
+        }
+        for (int node = 0; node < mNetworkSize; ++node) {
+            mNodes[node]->setIslandVector(&mIslandVectors[mNodeIslandNumbers[node]]);
+            mIslandVectors[mNodeIslandNumbers[node]].push_back(node);
+        }
+
+        /// - Record island metrics.
+        mIslandMaxSize = 0;
+        mIslandCount   = 0;
+        for (int island = 0; island < mNetworkSize; ++island) {
+            int size = static_cast<int>(mIslandVectors[island].size());
+            if (size > 0)              mIslandCount++;
+            if (size > mIslandMaxSize) mIslandMaxSize = size;
+        }
     }
+}
 
-    /// - Record island metrics.
-    mIslandMaxSize = 0;
-    mIslandCount   = 0;
-    for (int island = 0; island < mNetworkSize; ++island) {
-        int size = static_cast<int>(mIslandVectors[island].size());
-        if (size > 0)              mIslandCount++;
-        if (size > mIslandMaxSize) mIslandMaxSize = size;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  node  (--)  Node number to find the island of.
+///
+/// @returns  int (--) The root node of the island, which is the lowest node number in the island.
+///
+/// @details  Follows the disjoint-set parents up to the root, halving the path length as it goes
+///           so later searches are faster.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int Gunns::findIslandRoot(int node)
+{
+    while (mIslandParent[node] != node) {
+        mIslandParent[node] = mIslandParent[mIslandParent[node]];
+        node = mIslandParent[node];
     }
+    return node;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in]  from  (--)  Island number to be moved from.
-/// @param[in]  to    (--)  Island number to be moved to.
+/// @param[in]  node1  (--)  A node in the first island.
+/// @param[in]  node2  (--)  A node in the second island.
 ///
-/// @details  This method re-assigns all nodes belonging to one island to another island.
+/// @details  Merges the islands of the given nodes by making the higher root a child of the lower,
+///           so that the root remains the lowest node number in the island.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-inline void Gunns::mergeIslands(const int from, const int to)
+inline void Gunns::unionIslands(const int node1, const int node2)
 {
-    if (from != to) {
-        for (int node = 0; node < mNetworkSize; ++node) {
-            if (from == mNodeIslandNumbers[node]) mNodeIslandNumbers[node] = to;
-        }
+    const int root1 = findIslandRoot(node1);
+    const int root2 = findIslandRoot(node2);
+    if (root1 < root2) {
+        mIslandParent[root2] = root1;
+    } else if (root2 < root1) {
+        mIslandParent[root1] = root2;
     }
 }
 
@@ -1340,9 +2793,23 @@ inline void Gunns::mergeIslands(const int from, const int to)
 ///           know where to add its contribution terms into the main vector.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void Gunns::buildSourceVector()
+{
+    if (mIncrementalSource) {
+        buildIncrementalSourceVector();
+    } else {
+        sumSourceVector(mSourceVector);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] sums (--) Node sums of the link contributions, of the network size.
+///
+/// @details  Zeroes the given sums and adds every link port's source vector term to its node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::sumSourceVector(double* sums) const
 {
     for (int i = 0; i < mNetworkSize; ++i) {
-        mSourceVector[i] = 0.0;
+        sums[i] = 0.0;
     }
 
     for (int link = 0; link < mNumLinks; ++link) {
@@ -1352,10 +2819,121 @@ void Gunns::buildSourceVector()
 
             // The vacuum/ground node is not actually in the system, so we leave it off.
             if (node < mNetworkSize) {
-                mSourceVector[node] += mLinkSourceVectors[link][port];
+                sums[node] += mLinkSourceVectors[link][port];
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method is the incremental version of buildSourceVector.  The kept sum at each
+///           node of the links that changed their source vector since the last assembly is summed
+///           again from all of the node's contributors, in the same order as a full assembly, and
+///           loaded into the source vector.  All of the sums are assembled instead when a changed
+///           link has moved a port, and when more than a quarter of the links changed.
+///
+///           In verify mode the full assembly is also done and compared to the kept sums, and any
+///           difference is counted and warned about, and the full sums are used.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::buildIncrementalSourceVector()
+{
+    /// - A changed link that moved a port invalidates the node contributors.
+    const int numChanged = static_cast<int>(mSourceChangedLinks.size());
+    for (int i = 0; i < numChanged and mSourceContributorsValid; ++i) {
+        const int  link  = mSourceChangedLinks[i];
+        const int* nodes = &mSourcePortNodes[mSourcePortOffsets[link]];
+        for (int port = 0; port < mLinkNumPorts[link]; ++port) {
+            if (mLinkNodeMaps[link][port] != nodes[port]) {
+                mSourceContributorsValid = false;
+                break;
+            }
+        }
+    }
+    if (not mSourceContributorsValid) {
+        buildNodeContributors();
+    }
+
+    if (not mSourceContributorsValid or numChanged * 4 > mNumLinks) {
+        sumSourceVector(&mSourceNodeSums[0]);
+        mSourceContributorsValid = true;
+        mSourceFullCount++;
+    } else {
+        for (int i = 0; i < numChanged; ++i) {
+            const int link = mSourceChangedLinks[i];
+            for (int port = 0; port < mLinkNumPorts[link]; ++port) {
+                const int node = mLinkNodeMaps[link][port];
+                if (node < mNetworkSize) {
+                    const int end = mNodeContributorStart[node+1];
+                    double    sum = 0.0;
+                    for (int c = mNodeContributorStart[node]; c < end; ++c) {
+                        sum += mLinkSourceVectors[mNodeContributorLinks[c]]
+                                                 [mNodeContributorPorts[c]];
+                    }
+                    mSourceNodeSums[node] = sum;
+                }
+            }
+        }
+        mSourceIncrementalCount++;
+
+        if (mSourceVerify) {
+            sumSourceVector(&mSourceVerifySums[0]);
+            if (not std::equal(mSourceVerifySums.begin(), mSourceVerifySums.end(),
+                               mSourceNodeSums.begin())) {
+                mSourceVerifyFailures++;
+                GUNNS_WARNING("incremental source vector differs from the full assembly.");
+                mSourceNodeSums.swap(mSourceVerifySums);
+            }
+        }
+    }
+    mSourceChangedLinks.clear();
+
+    for (int i = 0; i < mNetworkSize; ++i) {
+        mSourceVector[i] = mSourceNodeSums[i];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Lists the link ports contributing to each node's source vector term, in link and port
+///           order, keeps the link port nodes they were listed for, and sizes the kept node sums.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::buildNodeContributors()
+{
+    mSourcePortOffsets.assign(mNumLinks + 1, 0);
+    for (int link = 0; link < mNumLinks; ++link) {
+        mSourcePortOffsets[link + 1] = mSourcePortOffsets[link] + mLinkNumPorts[link];
+    }
+    mSourcePortNodes.resize(mSourcePortOffsets[mNumLinks]);
+
+    mNodeContributorStart.assign(mNetworkSize + 1, 0);
+    for (int link = 0; link < mNumLinks; ++link) {
+        for (int port = 0; port < mLinkNumPorts[link]; ++port) {
+            const int node = mLinkNodeMaps[link][port];
+            mSourcePortNodes[mSourcePortOffsets[link] + port] = node;
+            if (node < mNetworkSize) {
+                mNodeContributorStart[node + 1]++;
+            }
+        }
+    }
+    for (int node = 0; node < mNetworkSize; ++node) {
+        mNodeContributorStart[node + 1] += mNodeContributorStart[node];
+    }
+
+    mNodeContributorLinks.resize(mNodeContributorStart[mNetworkSize]);
+    mNodeContributorPorts.resize(mNodeContributorStart[mNetworkSize]);
+    std::vector<int> next(mNodeContributorStart.begin(), mNodeContributorStart.end() - 1);
+    for (int link = 0; link < mNumLinks; ++link) {
+        for (int port = 0; port < mLinkNumPorts[link]; ++port) {
+            const int node = mLinkNodeMaps[link][port];
+            if (node < mNetworkSize) {
+                mNodeContributorLinks[next[node]] = link;
+                mNodeContributorPorts[next[node]] = port;
+                next[node]++;
             }
         }
     }
+
+    mSourceNodeSums.assign(mNetworkSize, 0.0);
+    mSourceVerifySums.assign(mNetworkSize, 0.0);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1374,7 +2952,13 @@ void Gunns::solveCholesky()
     ///     The "decompose" method is called immediately before "solve", here in this method.
     ///     We can't re-use decomposed [A] for the next solution to save time.  We have to decompose
     ///       the same [A] every solution, even if [A] hasn't changed.
-    if (GPU_SPARSE == mGpuMode) {
+    /// - In SPARSE storage, the sparse solver uses its own stored factors and ignores the dense
+    ///   matrix argument.
+    if (SPARSE == mMatrixStorage) {
+        double startTime = GunnsInfraFunctions::clockTime();
+        handleSolve(mSolverSparse, mAdmittanceMatrix, mSourceVector, mPotentialVector, mNetworkSize);
+        mSolveTimeWorking += GunnsInfraFunctions::clockTime() - startTime;
+    } else if (GPU_SPARSE == mGpuMode) {
 
         if (SOLVE == mIslandMode) {
             /// - We have to solve each island differently for < or >= the GPU size threshold:
@@ -1419,9 +3003,14 @@ void Gunns::solveCholesky()
                         mPotentialVector, mNetworkSize);
             mSolveTimeWorking += GunnsInfraFunctions::clockTime() - startTime;
         }
+    } else if (isIslandParallel()) {
+        runIslandsParallel(false);
+    } else if (isIslandCompact()) {
+        solveIslandFactors();
     } else {
         double startTime = GunnsInfraFunctions::clockTime();
-        handleSolve(mSolverCpu, mAdmittanceMatrix, mSourceVector, mPotentialVector, mNetworkSize);
+        handleSolve(getCpuSolver(mNetworkSize), mAdmittanceMatrix, mSourceVector, mPotentialVector,
+                    mNetworkSize);
         mSolveTimeWorking += GunnsInfraFunctions::clockTime() - startTime;
     }
 }
@@ -1494,15 +3083,17 @@ inline void Gunns::cleanPotentialVector()
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  iterative  (--)  Solves by PCG instead of the last matrix decomposition when true.
+///
 /// @throws   TsNumericalException
 ///
 /// @details  This method is the first half of the network capacitance computations.  For each node
 ///           that requests its network capacitance, requested flux is added to the node's source
-///           vector and the system of equations solved using the last matrix decomposition.  The
-///           computeNetworkCapacitances() method is called later to finish the computations.  Nodes
-///           that do not request their value have it reset here.
+///           vector and the system of equations solved using the last matrix decomposition, or by
+///           PCG.  The computeNetworkCapacitances() method is called later to finish the
+///           computations.  Nodes that do not request their value have it reset here.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void Gunns::perturbNetworkCapacitances()
+void Gunns::perturbNetworkCapacitances(const bool iterative)
 {
     for (int node = 0; node < mNetworkSize; ++node) {
         const double fluxPerturbartion = mNodes[node]->getNetworkCapacitanceRequest();
@@ -1511,7 +3102,11 @@ void Gunns::perturbNetworkCapacitances()
             ///   potential in the node's capacitance term, and reset the source vector.
             const double savedSourceVector = mSourceVector[node];
             mSourceVector[node] += fluxPerturbartion;
-            solveCholesky();
+            if (iterative) {
+                solvePcg();
+            } else {
+                solveCholesky();
+            }
             mNodes[node]->setNetworkCapacitance(mPotentialVector[node]);
             mSourceVector[node] = savedSourceVector;
 
@@ -1611,16 +3206,40 @@ void Gunns::conditionAdmittanceMatrix()
     ///   unsolvable.  This phantom "leak" prevents the singular matrix at the cost of a
     ///   negligible error in the solution.  This causes the isolated nodes to solve to zero
     ///   potential.
-    for (int row = 0; row < mNetworkSize; ++row) {
+    /// - In SPARSE storage, the row sums only visit the stored positions, and the conditioning is
+    ///   also applied to the dense matrix when it is being kept loaded.
+    if (SPARSE == mMatrixStorage) {
+        const bool dense     = isDenseAdmittanceNeeded();
+        const int* rowStart  = mAdmittanceSparse->getRowStart();
+        const int* diagonals = mAdmittanceSparse->getDiagonalSlots();
+        double*    values    = mAdmittanceSparse->getValues();
+        for (int row = 0; row < mNetworkSize; ++row) {
+
+            double rowSum = 0.0;
+            for (int slot = rowStart[row]; slot < rowStart[row+1]; ++slot) {
+                rowSum += values[slot];
+            }
 
-        double rowSum = 0.0;
-        for (int index = row*mNetworkSize; index < (row+1)*mNetworkSize; ++index) {
-            rowSum += mAdmittanceMatrix[index];
+            if (fabs(rowSum) < DBL_EPSILON) {
+                const int diagonal = diagonals[row];
+                values[diagonal] += std::max(values[diagonal], DBL_EPSILON) * 1.0E-15;
+                if (dense) {
+                    mAdmittanceMatrix[row*mNetworkSize+row] = values[diagonal];
+                }
+            }
         }
+    } else {
+        for (int row = 0; row < mNetworkSize; ++row) {
+
+            double rowSum = 0.0;
+            for (int index = row*mNetworkSize; index < (row+1)*mNetworkSize; ++index) {
+                rowSum += mAdmittanceMatrix[index];
+            }
 
-        if (fabs(rowSum) < DBL_EPSILON) {
-            const int diagonal = row*mNetworkSize+row;
-            mAdmittanceMatrix[diagonal] += std::max(mAdmittanceMatrix[diagonal], DBL_EPSILON) * 1.0E-15;
+            if (fabs(rowSum) < DBL_EPSILON) {
+                const int diagonal = row*mNetworkSize+row;
+                mAdmittanceMatrix[diagonal] += std::max(mAdmittanceMatrix[diagonal], DBL_EPSILON) * 1.0E-15;
+            }
         }
     }
 }
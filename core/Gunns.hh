@@ -59,6 +59,7 @@ PROGRAMMERS:
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "core/GunnsBasicLink.hh"
 #include "core/GunnsMinorStepLog.hh"
+#include "core/GunnsThreadPool.hh"
 
 /// - Forward declare classes used for pointer attributes and method arguments.
 class  GunnsBasicNode;
@@ -66,6 +67,10 @@ class  GunnsBasicFlowOrchestrator;
 struct GunnsNodeList;
 class  PolyFluidConfigData;
 class  CholeskyLdu;
+class  CholeskyLduSparse;
+class  CholeskyLduSimd;
+class  ConjugateGradient;
+class  SparseCsrMatrix;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    Gunns Configuration Data
@@ -136,6 +141,35 @@ class Gunns
             GPU_SPARSE = 2    ///< Uses GPU sparse matrix math for decomposition & solution.
         };
 
+        /// @brief Enumeration of the CPU vector instruction modes.
+        enum SimdMode {
+            NO_SIMD    = 0,   ///< Uses the scalar CPU dense decomposition & solution.
+            SIMD_DENSE = 1    ///< Uses the vectorized CPU dense decomposition & solution.
+        };
+
+        /// @brief Enumeration of the iterative solution methods.
+        enum IterativeMethod {
+            DIRECT     = 0,   ///< Solves by Cholesky decomposition only.
+            PCG_JACOBI = 1,   ///< Preconditioned conjugate gradient with Jacobi preconditioning.
+            PCG_IC     = 2    ///< Preconditioned conjugate gradient with incomplete Cholesky preconditioning.
+        };
+
+        /// @brief Enumeration of the admittance matrix storage modes.
+        enum MatrixStorage {
+            DENSE  = 0,  ///< Link contributions are assembled directly into the dense matrix.
+            SPARSE = 1   ///< Link contributions are assembled into a compressed sparse row matrix, which is decomposed by the sparse solver.
+        };
+
+        /// @brief Enumeration of the major step phases timed for profiling.
+        enum StepPhase {
+            PHASE_LINK_STEP   = 0,  ///< Stepping the links in all minor steps.
+            PHASE_BUILD       = 1,  ///< Building the source vector and admittance matrix.
+            PHASE_DECOMPOSE   = 2,  ///< Decomposing the admittance matrix.
+            PHASE_SOLVE       = 3,  ///< Solving for the potential vector and capacitances.
+            PHASE_ORCHESTRATE = 4,  ///< Computing & transporting flows and link outputs.
+            NUM_STEP_PHASES   = 5   ///< Number of phases.
+        };
+
         /// @name     Step data logger.
         /// @{
         /// @details  This is public to allow Trick jobs to directly call functions in it.
@@ -179,6 +213,37 @@ class Gunns
         /// @brief Sets the solver GPU mode and size threshold.
         void setGpuOptions(const Gunns::GpuMode mode, const int threshold);
 
+        /// @brief Sets the solver CPU vector instruction mode and size threshold.
+        void setSimdOptions(const Gunns::SimdMode mode, const int threshold);
+
+        /// @brief Sets the iterative solution method, iteration limit and tolerance.
+        void setIterativeOptions(const Gunns::IterativeMethod method, const int maxIterations,
+                                 const double tolerance);
+
+        /// @brief Sets the admittance matrix storage mode.
+        void setMatrixStorage(const Gunns::MatrixStorage storage);
+
+        /// @brief Sets the number of threads for parallel island decomposition & solution.
+        void setIslandThreads(const int threads);
+
+        /// @brief Sets whether island decompositions are kept and re-used while unchanged.
+        void setIslandFactorCaching(const bool enable);
+
+        /// @brief Sets the limits for updating the dense decomposition in place of decomposing.
+        void setFactorUpdateOptions(const int rankLimit, const int refreshLimit);
+
+        /// @brief Sets the limit of incremental admittance matrix builds between full builds.
+        void setIncrementalAdmittance(const int refreshLimit);
+
+        /// @brief Sets incremental source vector assembly and its verification against full sums.
+        void setIncrementalSourceOptions(const bool incremental, const bool verify);
+
+        /// @brief Sets the number of threads for parallel link stepping.
+        void setLinkThreads(const int threads);
+
+        /// @brief Sets the number of threads for parallel node flow integration.
+        void setFlowThreads(const int threads);
+
         /// @brief Sets the solver run mode to RUN.
         void setRunMode();
 
@@ -230,6 +295,9 @@ class Gunns
         /// @brief Gets the most recent step time value.
         double getStepTime() const;
 
+        /// @brief Gets the most recent time spent in the given step phase.
+        double getPhaseTime(const StepPhase phase) const;
+
         /// @brief Returns whether GPU solving is enabled.
         bool isGpuEnabled() const;
 
@@ -295,13 +363,189 @@ class Gunns
         int  mIslandMaxSize;              /**<    (--) trick_chkpnt_io(**) Size of the largest island */
         IslandMode mIslandMode;           /**<    (--)                     Operating mode of island functions */
 
+        /// @name     Island detection.
+        /// @{
+        /// @details  Islands are found with a disjoint-set (union-find) forest over the nodes, whose
+        ///           connections are the upper off-diagonal positions of the sparse admittance
+        ///           matrix pattern.  The connected state of each position is saved, so that when
+        ///           only new connections are made, they are merged into the existing forest rather
+        ///           than rebuilding it.  Any broken connection or pattern change causes a full
+        ///           rebuild.
+        int*  mIslandParent;              /**< ** (--) trick_chkpnt_io(**) Disjoint-set parent node of each node, the root being the lowest node in its island */
+        bool* mIslandConnections;         /**< ** (--) trick_chkpnt_io(**) Last connected state of each sparse pattern slot */
+        int   mIslandPatternCount;        /**<    (--) trick_chkpnt_io(**) Sparse pattern count of the last full island build, -1 forces a full build */
+        int   mIslandFullBuilds;          /**<    (--) trick_chkpnt_io(**) Number of full island builds since init */
+        int   mIslandIncrementalBuilds;   /**<    (--) trick_chkpnt_io(**) Number of incremental island updates since init */
+        /// @}
+
+        /// @name     Parallel islands.
+        /// @{
+        /// @details  In SOLVE island mode with DENSE storage and no GPU, the islands can be
+        ///           decomposed & solved concurrently by a pool of worker threads, enabled by
+        ///           setIslandThreads.  Each island is decomposed in its own kept factors, and each
+        ///           worker gathers its island's vectors into its own scratch arrays, so the islands
+        ///           don't share any working storage, and the results are identical to the serial
+        ///           island solution.  Islands are handed out
+        ///           largest first to balance the load.  mSolveTime includes the wall time of each
+        ///           parallel section, not the sum of the workers' times.
+        GunnsThreadPool mIslandPool;      /**< ** (--) trick_chkpnt_io(**) Worker threads for parallel islands. */
+        std::vector<int> mIslandTasks;    /**< ** (--) trick_chkpnt_io(**) Island numbers of the parallel tasks, largest island first. */
+        std::vector<std::string> mIslandTaskErrors;                /**< ** (--) trick_chkpnt_io(**) Error message of each parallel task, empty if none. */
+        std::vector< std::vector<double> > mIslandWorkerVectors;   /**< ** (--) trick_chkpnt_io(**) Island source & potential vector scratch for each worker. */
+        /// @}
+
+        /// @name     Parallel links.
+        /// @{
+        /// @details  The links' step, minorStep and confirmSolutionAcceptable methods can be run
+        ///           concurrently by a pool of worker threads, enabled by setLinkThreads.  Links only
+        ///           write their own contributions to the system in these methods, except for links
+        ///           that declare themselves serial-only, which are run alone on the solver's thread
+        ///           in their place in the link order, so that links are only ever run concurrently
+        ///           with links between the same serial-only links.  The links between serial-only
+        ///           links are split into contiguous chunks as tasks.  Admittance update flags and
+        ///           solution results are gathered in link order after each parallel section, so the
+        ///           results are identical to the serial steps.  Link flows are still computed
+        ///           serially, since links transport their flows into shared nodes.
+        GunnsThreadPool mLinkPool;        /**< ** (--) trick_chkpnt_io(**) Worker threads for parallel links. */
+        std::vector<int> mLinkTasks;      /**< ** (--) trick_chkpnt_io(**) First link of each parallel task, plus the end of the last task. */
+        std::vector<std::string> mLinkTaskErrors;                   /**< ** (--) trick_chkpnt_io(**) Error message of each parallel task, empty if none. */
+        std::vector<GunnsBasicLink::SolutionResult> mLinkResults;  /**< ** (--) trick_chkpnt_io(**) Solution result of each link from the parallel confirmation. */
+        int  mLinkParallelTasks;          /**<    (--) trick_chkpnt_io(**) Number of parallel link tasks run since init */
+        /// @}
+
+        /// @name     Island factor caching.
+        /// @{
+        /// @details  In SOLVE island mode with DENSE storage and no GPU, each island's decomposition
+        ///           is kept at island size, and each island is solved with it on island size
+        ///           vectors, so the solution costs the sum of the island sizes squared rather than
+        ///           the network size squared.  The main admittance matrix holds the un-decomposed
+        ///           matrix in this mode.  Between decompositions, the kept decompositions can also
+        ///           be re-used, enabled by setIslandFactorCaching.  An island is then only
+        ///           decomposed again when one of its own links has reported needAdmittanceUpdate
+        ///           since its last decomposition, or its node membership has changed.  Any change to
+        ///           the admittance matrix pattern, such as a port move, or a decomposition by another
+        ///           path, re-decomposes all islands.
+        bool mIslandCaching;              /**<    (--) trick_chkpnt_io(**) Keeps and re-uses island decompositions */
+        std::vector<int> mChangedLinks;   /**< ** (--) trick_chkpnt_io(**) Links that reported an admittance update since the last decomposition */
+        std::vector< std::vector<double> > mIslandFactors;    /**< ** (--) trick_chkpnt_io(**) Kept decomposition of each island, by island number */
+        std::vector< std::vector<int> >    mIslandFactorNodes;/**< ** (--) trick_chkpnt_io(**) Island nodes each kept decomposition is for, empty if none */
+        std::vector<char> mIslandFactorStale;                 /**< ** (--) trick_chkpnt_io(**) Islands to be decomposed again, by island number */
+        int  mIslandFactorPattern;        /**< ** (--) trick_chkpnt_io(**) Sparse pattern count of the kept decompositions */
+        int  mIslandFactorDecompositions; /**<    (--) trick_chkpnt_io(**) Number of island decompositions into kept factors since init */
+        int  mIslandFactorReuses;         /**<    (--) trick_chkpnt_io(**) Number of island decompositions re-used while caching since init */
+        /// @}
+
+        /// @name     Factorization updates.
+        /// @{
+        /// @details  When the full dense matrix is decomposed (DENSE storage, no GPU, and not in
+        ///           SOLVE island mode), a copy of the last decomposition and the matrix it came
+        ///           from can be kept, enabled by setFactorUpdateOptions.  When only a few link
+        ///           admittances have changed since then, the changes are applied to the copy as
+        ///           rank-1 updates, which cost O(N^2) each instead of the O(N^3) decomposition.
+        ///           A full decomposition is done instead when the changes need more updates than
+        ///           the rank limit, when an update loses too much precision, or after the refresh
+        ///           limit of consecutive updates, which bounds the build-up of round-off error.
+        int    mFactorRankLimit;          /**<    (--) trick_chkpnt_io(**) Maximum rank-1 updates in place of a decomposition, 0 disables updates */
+        int    mFactorRefreshLimit;       /**<    (--) trick_chkpnt_io(**) Maximum consecutive updated decompositions before a full decomposition */
+        bool   mFactorValid;              /**< ** (--) trick_chkpnt_io(**) The saved decomposition is valid for updating */
+        int    mFactorUpdatesSinceFull;   /**< ** (--) trick_chkpnt_io(**) Consecutive updated decompositions since the last full decomposition */
+        std::vector<double> mFactorMatrix;       /**< ** (--) trick_chkpnt_io(**) Admittance matrix represented by the saved decomposition */
+        std::vector<double> mFactorLdu;          /**< ** (--) trick_chkpnt_io(**) Saved decomposition of mFactorMatrix */
+        std::vector<double> mFactorVector;       /**< ** (--) trick_chkpnt_io(**) Rank-1 update vector scratch */
+        std::vector<int>    mFactorUpdateNodes;  /**< ** (--) trick_chkpnt_io(**) Node pairs of the pending rank-1 updates, -1 second node for a diagonal update */
+        std::vector<double> mFactorUpdateWeights;/**< ** (--) trick_chkpnt_io(**) Weights of the pending rank-1 updates */
+        int    mFactorFullCount;          /**<    (--) trick_chkpnt_io(**) Number of full decompositions in update mode since init */
+        int    mFactorUpdateCount;        /**<    (--) trick_chkpnt_io(**) Number of decompositions replaced by updates since init */
+        int    mFactorUpdateRanks;        /**<    (--) trick_chkpnt_io(**) Total number of rank-1 updates applied since init */
+        int    mFactorFallbackCount;      /**<    (--) trick_chkpnt_io(**) Number of updates abandoned for a full decomposition since init */
+        /// @}
+
+        /// @name     Incremental admittance matrix builds.
+        /// @{
+        /// @details  The sum of the link contributions at each sparse pattern slot can be kept
+        ///           between admittance matrix builds, enabled by setIncrementalAdmittance.  A
+        ///           build then only re-sums the slots of the links that reported
+        ///           needAdmittanceUpdate since the last build, from all of the links contributing
+        ///           to each slot, in link order.  This gives exactly the same sums as a full
+        ///           build, so there is no round-off drift between builds.  A full build is still done
+        ///           when the pattern changes, when more than a quarter of the links have changed,
+        ///           and after the refresh limit of consecutive incremental builds, which picks up
+        ///           any link that changes its contributions without reporting it.
+        int    mIncrementalRefreshLimit;  /**<    (--) trick_chkpnt_io(**) Maximum consecutive incremental builds before a full build, 0 disables */
+        int    mIncrementalSinceFull;     /**< ** (--) trick_chkpnt_io(**) Consecutive incremental builds since the last full build */
+        int    mIncrementalPattern;       /**< ** (--) trick_chkpnt_io(**) Sparse pattern count of the kept slot sums, -1 if none */
+        std::vector<int>    mAdmittanceChangedLinks; /**< ** (--) trick_chkpnt_io(**) Links that reported an admittance update since the last build */
+        std::vector<double> mAdmittanceSlotSums;     /**< ** (--) trick_chkpnt_io(**) Kept sum of the link contributions at each sparse pattern slot */
+        std::vector<int>    mSlotContributorStart;   /**< ** (--) trick_chkpnt_io(**) Index of each slot's first contributor, plus the end of the last */
+        std::vector<int>    mSlotContributorLinks;   /**< ** (--) trick_chkpnt_io(**) Link of each slot contributor, in link order */
+        std::vector<int>    mSlotContributorEntries; /**< ** (--) trick_chkpnt_io(**) Link admittance map entry of each slot contributor */
+        int    mIncrementalBuildCount;    /**<    (--) trick_chkpnt_io(**) Number of incremental admittance builds since init */
+        int    mIncrementalFullCount;     /**<    (--) trick_chkpnt_io(**) Number of full admittance builds in incremental mode since init */
+        /// @}
+
+        /// @name     Incremental source vector assembly.
+        /// @{
+        /// @details  The sum of the link contributions to each node's source vector term can be
+        ///           kept between minor steps, enabled by setIncrementalSourceOptions.  Each step
+        ///           then only re-sums the nodes of the links whose needSourceUpdate is true, from
+        ///           all of the node's contributors in link order, so the sums are exactly those of
+        ///           a full assembly.  Links that don't report their source changes are always
+        ///           re-summed.  The verify option also does the full assembly every step, counts
+        ///           the steps where the kept sums differ from it, and uses the full sums, for
+        ///           finding reporting links that change their source without setting the flag.
+        bool   mIncrementalSource;        /**<    (--) trick_chkpnt_io(**) Source vector is assembled incrementally */
+        bool   mSourceVerify;             /**<    (--) trick_chkpnt_io(**) Incremental source vector is verified against the full sums */
+        bool   mSourceContributorsValid;  /**< ** (--) trick_chkpnt_io(**) Node contributors and kept sums are valid for the link node maps */
+        std::vector<int>    mSourceChangedLinks;     /**< ** (--) trick_chkpnt_io(**) Links that changed their source vector since the last assembly */
+        std::vector<double> mSourceNodeSums;         /**< ** (--) trick_chkpnt_io(**) Kept sum of the link contributions at each node */
+        std::vector<double> mSourceVerifySums;       /**< ** (--) trick_chkpnt_io(**) Full sums for verifying the kept sums */
+        std::vector<int>    mSourcePortOffsets;      /**< ** (--) trick_chkpnt_io(**) Index of each link's first port in the kept port nodes */
+        std::vector<int>    mSourcePortNodes;        /**< ** (--) trick_chkpnt_io(**) Node of each link port when the contributors were listed */
+        std::vector<int>    mNodeContributorStart;   /**< ** (--) trick_chkpnt_io(**) Index of each node's first contributor, plus the end of the last */
+        std::vector<int>    mNodeContributorLinks;   /**< ** (--) trick_chkpnt_io(**) Link of each node contributor, in link order */
+        std::vector<int>    mNodeContributorPorts;   /**< ** (--) trick_chkpnt_io(**) Link port of each node contributor */
+        int    mSourceIncrementalCount;   /**<    (--) trick_chkpnt_io(**) Number of incremental source vector assemblies since init */
+        int    mSourceFullCount;          /**<    (--) trick_chkpnt_io(**) Number of full source vector assemblies in incremental mode since init */
+        int    mSourceVerifyFailures;     /**<    (--) trick_chkpnt_io(**) Number of verified assemblies whose kept sums differed from the full sums */
+        /// @}
+
         /// @details  Linear algebra solver classes.
         CholeskyLdu* mSolverCpu;          /**< ** (--) trick_chkpnt_io(**) CPU-based matrix decomposition and system solution. */
         CholeskyLdu* mSolverGpuDense;     /**< ** (--) trick_chkpnt_io(**) GPU-based dense matrix decomposition. */
         CholeskyLdu* mSolverGpuSparse;    /**< ** (--) trick_chkpnt_io(**) GPU-based sparse matrix decomposition and system solution. */
+        CholeskyLduSparse* mSolverSparse; /**< ** (--) trick_chkpnt_io(**) CPU-based sparse matrix decomposition and system solution. */
         bool         mGpuEnabled;         /**< *o (--) trick_chkpnt_io(**) True if GPU solvers are enabled. */
         GpuMode      mGpuMode;            /**<    (--) trick_chkpnt_io(**) GPU or CPU solution method being used. */
         int          mGpuSizeThreshold;   /**<    (--) trick_chkpnt_io(**) Only network islands at least this size are decomposed/solved on the GPU. */
+        CholeskyLduSimd* mSolverSimd;     /**< ** (--) trick_chkpnt_io(**) Vectorized CPU-based dense matrix decomposition and system solution. */
+        SimdMode     mSimdMode;           /**<    (--) trick_chkpnt_io(**) Vectorized or scalar CPU dense solution method being used. */
+        int          mSimdSizeThreshold;  /**<    (--) trick_chkpnt_io(**) Only network islands at least this size are decomposed/solved by the vectorized CPU solver. */
+
+        /// @name     Sparse admittance matrix storage.
+        /// @{
+        /// @details  In SPARSE storage mode, the link contributions are accumulated into a
+        ///           compressed sparse row (CSR) copy of the admittance matrix, through storage
+        ///           slots that are looked up once when the pattern is built, rather than into the
+        ///           dense matrix.  The pattern is built in initialize from all of the link
+        ///           admittance maps, and is only rebuilt if a link changes its map, such as when
+        ///           moving a port.  This makes the rebuild cost scale with the number of link
+        ///           contributions rather than with the square of the network size.  The pattern is
+        ///           also built & used for island detection in DENSE storage.
+        ///
+        ///           The sparse matrix is decomposed & solved by mSolverSparse in place of the dense
+        ///           CPU & GPU solvers.  Its fill-reducing ordering keeps de-coupled islands
+        ///           separate, so the whole matrix is decomposed at once instead of building island
+        ///           sub-matrices, and the dense mAdmittanceMatrix is left un-decomposed.  The
+        ///           sparse matrix is factored directly from its CSR arrays, and only expanded into
+        ///           the dense mAdmittanceMatrix when SOR, debug or GPU functions need it, or on
+        ///           demand by getAdmittanceMatrix.
+        MatrixStorage    mMatrixStorage;      /**<    (--) trick_chkpnt_io(**) Admittance matrix storage mode. */
+        SparseCsrMatrix* mAdmittanceSparse;   /**< ** (--) trick_chkpnt_io(**) Sparse admittance matrix. */
+        int*    mSparseLinkOffsets;           /**< ** (--) trick_chkpnt_io(**) Index of each link's first admittance map entry in mSparseSlots and mSparseMaps. */
+        int*    mSparseSlots;                 /**< ** (--) trick_chkpnt_io(**) Sparse matrix slot of each link admittance map entry, -1 if omitted. */
+        int*    mSparseMaps;                  /**< ** (--) trick_chkpnt_io(**) Copy of the link admittance maps the sparse pattern was built from. */
+        int     mSparsePatternCount;          /**<    (--) trick_chkpnt_io(**) Number of times the sparse pattern has been built since init. */
+        /// @}
 
         /// @details  The tolerance for potential error for considering the network to be solved.
         ///           This is used in non-linear networks between minor steps.  The network is
@@ -376,6 +620,8 @@ class Gunns
         double  mSolveTimeWorking;        /**< ** (s)  trick_chkpnt_io(**) Working term for accumulating total value for mSolveTime. */
         double  mSolveTime;               /**<    (s)  trick_chkpnt_io(**) Total duration of all solver decomposition and solve calls the last major step. */
         double  mStepTime;                /**<    (s)  trick_chkpnt_io(**) Total duration of the last step call. */
+        double  mPhaseTimeWorking[NUM_STEP_PHASES]; /**< ** (s) trick_chkpnt_io(**) Working terms for accumulating mPhaseTime. */
+        double  mPhaseTime[NUM_STEP_PHASES];        /**<    (s) trick_chkpnt_io(**) Duration of each step phase the last major step. */
         /// @details  Forces the solver to keep decomposing the matrix up to the decomposition limit
         ///           each major step regardless of convergence, which uses the maximum CPU.  This
         ///           allows users to budget for worst-case timing scenarios.
@@ -417,6 +663,27 @@ class Gunns
         int     mSorFailCount;            /**<    (--)                     SOR number of convergence failures */
         /// @}
 
+        /// @name     Preconditioned conjugate gradient attributes.
+        /// @{
+        /// @details  The preconditioned conjugate gradient (PCG) method is an iterative solution
+        ///           method alternative to the Cholesky direct method, for large networks whose
+        ///           solution changes slowly between steps.  Each solution starts from the last minor
+        ///           step potentials.  Unlike SOR, the admittance matrix is only rebuilt when links
+        ///           change it, and then the matrix and its preconditioner are loaded into the PCG
+        ///           solver from the sparse matrix in place of a decomposition.  If PCG fails to
+        ///           converge, the matrix is decomposed and the Cholesky method is used until the
+        ///           next rebuild.
+        ConjugateGradient* mSolverPcg;    /**< ** (--) trick_chkpnt_io(**) PCG iterative solver. */
+        IterativeMethod mIterativeMethod; /**<    (--) trick_chkpnt_io(**) Iterative solution method being used. */
+        int     mPcgMaxIter;              /**<    (--) trick_chkpnt_io(**) PCG iteration limit per solution. */
+        double  mPcgTolerance;            /**<    (--) trick_chkpnt_io(**) PCG convergence tolerance on the diagonally scaled residual norm relative to the scaled source vector norm. */
+        int     mPcgLastIteration;        /**<    (--) trick_chkpnt_io(**) PCG iteration count in the last solution, -1 if not used or failed. */
+        int     mPcgIterationCount;       /**<    (--) trick_chkpnt_io(**) Total PCG iterations since init. */
+        int     mPcgFailCount;            /**<    (--) trick_chkpnt_io(**) PCG number of convergence failures. */
+        bool    mPcgMatrixValid;          /**< ** (--) trick_chkpnt_io(**) The PCG solver holds the current admittance matrix, which is not decomposed. */
+        bool    mPcgFallback;             /**< ** (--) trick_chkpnt_io(**) PCG failed on the current matrix, which is decomposed for Cholesky. */
+        /// @}
+
         /// @name     Last-pass states.
         /// @{
         /// @details  Some last-pass values are saved for responding to state changes.
@@ -447,6 +714,82 @@ class Gunns
         /// @brief Decomposes an admittance matrix based on size and GPU options.
         void       decompose(double *A, const int size, const int island = -1);
 
+        /// @brief Returns the CPU dense solver for a matrix of the given size.
+        CholeskyLdu* getCpuSolver(const int size) const;
+
+        /// @brief Returns whether the system is solved by the PCG iterative method.
+        bool       isPcgActive() const;
+
+        /// @brief Loads the admittance matrix into the PCG solver.
+        void       loadPcgMatrix();
+
+        /// @brief Solves the system by the PCG iterative method.
+        void       solvePcg();
+
+        /// @brief Decomposes the sparse admittance matrix.
+        void       decomposeSparse();
+
+        /// @brief Returns whether islands are decomposed & solved by the worker threads.
+        bool       isIslandParallel() const;
+
+        /// @brief Decomposes or solves all islands on the worker threads.
+        void       runIslandsParallel(const bool decompose);
+
+        /// @brief Decomposes or solves one island on the given worker.
+        void       runIslandTask(const bool decompose, const int task, const int worker);
+
+        /// @brief Thread pool job for parallel islands.
+        class IslandJob;
+
+        /// @brief Enumeration of the link methods run in parallel.
+        enum LinkPhase {
+            LINK_STEP       = 0,  ///< Runs the link step method.
+            LINK_MINOR_STEP = 1,  ///< Runs the non-linear link minorStep method.
+            LINK_CONFIRM    = 2   ///< Runs the non-linear link confirmSolutionAcceptable method.
+        };
+
+        /// @brief Returns whether links are run on the worker threads.
+        bool       isLinkParallel() const;
+
+        /// @brief Runs the given link method on all links, on the worker threads.
+        void       runLinksParallel(const LinkPhase phase, const double timeStep,
+                                    const int convergedStep, const int absoluteStep);
+
+        /// @brief Runs the given link method on one chunk of links.
+        void       runLinkTask(const LinkPhase phase, const double timeStep,
+                               const int convergedStep, const int absoluteStep, const int task);
+
+        /// @brief Runs the given link method on one link.
+        void       runLink(const LinkPhase phase, const double timeStep,
+                           const int convergedStep, const int absoluteStep, const int link);
+
+        /// @brief Thread pool job for parallel links.
+        class LinkJob;
+
+        /// @brief Returns whether island decompositions are kept and solved at island size.
+        bool       isIslandCompact() const;
+
+        /// @brief Returns whether island decompositions are kept and re-used.
+        bool       isIslandCaching() const;
+
+        /// @brief Flags the islands whose kept decompositions are stale.
+        void       markStaleIslandFactors();
+
+        /// @brief Decomposes the islands whose kept decompositions are stale.
+        void       decomposeIslandFactors();
+
+        /// @brief Solves each island with its kept decomposition.
+        void       solveIslandFactors();
+
+        /// @brief Returns whether the dense decomposition is kept for updating.
+        bool       isFactorUpdateActive() const;
+
+        /// @brief Decomposes the full dense matrix by updating the saved decomposition if possible.
+        void       decomposeWithUpdates();
+
+        /// @brief Lists the rank-1 updates from the saved matrix to the admittance matrix.
+        bool       findFactorUpdates();
+
         /// @brief Verifies network initialization and step method arguments.
         void       checkStepInputs();
 
@@ -459,15 +802,45 @@ class Gunns
         /// @brief Assembles the system admittance matrix from individual link contributions.
         void       buildAdmittanceMatrix();
 
+        /// @brief Assembles the sparse admittance matrix from individual link contributions.
+        void       buildSparseAdmittanceMatrix();
+
+        /// @brief Builds the sparse admittance matrix pattern and link storage slots.
+        void       buildSparsePattern();
+
+        /// @brief Assembles the admittance matrix from the kept link contribution sums.
+        void       buildIncrementalAdmittanceMatrix();
+
+        /// @brief Lists the link contributors to each sparse pattern slot.
+        void       buildSlotContributors();
+
+        /// @brief Returns whether any link admittance map differs from the sparse pattern.
+        bool       isSparsePatternStale() const;
+
+        /// @brief Returns whether the dense admittance matrix is kept loaded during the step.
+        bool       isDenseAdmittanceNeeded() const;
+
         /// @brief Finds and assembles the islands in the admittance matrix.
         void       buildIslands();
 
-        /// @brief Moves all nodes from island to island.
-        void       mergeIslands(const int from, const int to);
+        /// @brief Returns the root node of the island containing the given node.
+        int        findIslandRoot(int node);
+
+        /// @brief Merges the islands containing the two given nodes.
+        void       unionIslands(const int node1, const int node2);
 
         /// @brief Assembles the system source vector from individual link contributions.
         void       buildSourceVector();
 
+        /// @brief Sums all link contributions to the source vector into the given node sums.
+        void       sumSourceVector(double* sums) const;
+
+        /// @brief Assembles the source vector from the kept node sums of the link contributions.
+        void       buildIncrementalSourceVector();
+
+        /// @brief Lists the link port contributors to each node's source vector term.
+        void       buildNodeContributors();
+
         /// @brief Calls the Cholesky solve method.
         void       solveCholesky();
 
@@ -475,7 +848,7 @@ class Gunns
         void       cleanPotentialVector();
 
         /// @brief Finds potential deltas for network capacitances.
-        void       perturbNetworkCapacitances();
+        void       perturbNetworkCapacitances(const bool iterative = false);
 
         /// @brief Updates the node network capacitances.
         void       computeNetworkCapacitances(const double timeStep);
@@ -571,11 +944,30 @@ inline void Gunns::setSlaveMode()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// param[in]  mode  (--)  Desired island mode.
 ///
-/// @details  This method sets the network solver Island mode to the given value.
+/// @details  This method sets the network solver Island mode to the given value.  A change of mode
+///           forces the matrix to be rebuilt and decomposed for the new mode on the next step.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 inline void Gunns::setIslandMode(const Gunns::IslandMode mode)
 {
-    mIslandMode = mode;
+    if (mode != mIslandMode) {
+        mIslandMode = mode;
+        mRebuild    = true;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// param[in]  storage  (--)  Desired admittance matrix storage mode.
+///
+/// @details  This method sets the admittance matrix storage mode to the given value.  The storage
+///           mode can be changed at any time, and forces the matrix to be rebuilt and decomposed
+///           by the solver for the new mode on the next step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void Gunns::setMatrixStorage(const Gunns::MatrixStorage storage)
+{
+    if (storage != mMatrixStorage) {
+        mMatrixStorage = storage;
+        mRebuild       = true;
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -620,16 +1012,6 @@ inline void Gunns::setSlavePotentialVector(const double* potentials)
     }
 }
 
-////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @return double* -- Returns the admittance matrix.
-///
-/// @details  This method gets the admittance matrix.
-////////////////////////////////////////////////////////////////////////////////////////////////////
-inline double* Gunns::getAdmittanceMatrix() const
-{
-    return mAdmittanceMatrix;
-}
-
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @return double* -- Returns the source vector.
 ///
@@ -750,6 +1132,22 @@ inline double Gunns::getStepTime() const
     return mStepTime;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] phase (--) The step phase to return the time of.
+///
+/// @return   double (s) Elapsed time of the given phase the last major step.
+///
+/// @details  Returns the mPhaseTime value for the given phase, or zero for an invalid phase.  The
+///           phases are timed by the same clock as getStepTime, and sum to slightly less than it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double Gunns::getPhaseTime(const StepPhase phase) const
+{
+    if (phase < PHASE_LINK_STEP or phase >= NUM_STEP_PHASES) {
+        return 0.0;
+    }
+    return mPhaseTime[phase];
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @return   bool (--) True if GPU solving is enabled, false otherwise.
 ///
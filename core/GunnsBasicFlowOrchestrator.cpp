@@ -146,3 +146,14 @@ void GunnsBasicFlowOrchestrator::update(const double dt)
         mNodes[node]->integrateFlows(dt);
     }
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  threads  (--)  Number of threads, including the solver's thread.
+///
+/// @details  Dummy placeholder for derived classes.  Basic nodes are integrated serially, since
+///           their integration is too cheap to gain from threads.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicFlowOrchestrator::setThreads(const int threads __attribute__((unused)))
+{
+    // nothing to do
+}
@@ -60,6 +60,8 @@ class GunnsBasicFlowOrchestrator
         virtual void update(const double dt);
         /// @brief  Returns whether this GUNNS Basic Flow Orchestrator has been successfully initialized & validated.
         bool         isInitialized() const;
+        /// @brief  Sets the number of threads for parallel node integration.
+        virtual void setThreads(const int threads);
 
     protected:
         const int&                      mNumLinks;           /**< ** (1) trick_chkpnt_io(**) Number of links in the network. */
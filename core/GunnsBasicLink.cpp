@@ -183,12 +183,15 @@ GunnsBasicLink::GunnsBasicLink(const int numPorts)
     mPortDirections(0),
     mNumPorts(numPorts),
     mAdmittanceUpdate(false),
+    mSourceUpdate(true),
+    mSourceReporting(false),
     mFlux(0.0),
     mPotentialDrop(0.0),
     mPower(0.0),
     mMinLinearizationPotential(1.0),
     mInitFlag(false),
     mNodeMapLocked(false),
+    mSerialOnly(false),
     mUserPortSelect(-1),
     mUserPortSelectNode(-1),
     mUserPortSetControl(READY)
@@ -245,6 +245,9 @@ class GunnsBasicLink
         /// @brief Boolean for telling the solver to update the admittance matrix for this link
         virtual bool   needAdmittanceUpdate();
 
+        /// @brief Boolean for telling the solver to update the source vector for this link
+        bool           needSourceUpdate();
+
         /// @brief Boolean for telling the solver if it is a non-linear link
         virtual bool   isNonLinear();
 
@@ -276,6 +279,18 @@ class GunnsBasicLink
         /// @brief Unlocks the link node map, so that ports are free to move as normal
         void           unlockNodeMap();
 
+        /// @brief Returns whether the link must be stepped serially by the solver
+        bool           isSerialOnly() const;
+
+        /// @brief Sets whether the link must be stepped serially by the solver
+        void           setSerialOnly(const bool serialOnly);
+
+        /// @brief Returns whether the link reports its source vector changes to the solver
+        bool           isSourceReporting() const;
+
+        /// @brief Sets whether the link reports its source vector changes to the solver
+        void           setSourceReporting(const bool reporting);
+
     protected:
         std::string      mName;                      /**< *o (1) trick_chkpnt_io(**) Link object name for error messages */
         GunnsBasicNode** mNodes;                     /**< *o (1) trick_chkpnt_io(**) Array of pointers to the linked nodes */
@@ -290,12 +305,15 @@ class GunnsBasicLink
         PortDirection*   mPortDirections;            /**<    (1) trick_chkpnt_io(**) Flow direction at each port */
         int              mNumPorts;                  /**< *o (1) trick_chkpnt_io(**) Number of ports on the link */
         bool             mAdmittanceUpdate;          /**<    (1) trick_chkpnt_io(**) Link is changing the admittance matrix */
+        bool             mSourceUpdate;              /**<    (1) trick_chkpnt_io(**) Link is changing the source vector */
+        bool             mSourceReporting;           /**<    (1) trick_chkpnt_io(**) Link sets mSourceUpdate when it changes the source vector */
         double           mFlux;                      /**<    (1)                     Generic flux through the link */
         double           mPotentialDrop;             /**<    (1)                     Generic potential drop across the link */
         double           mPower;                     /**<    (W) trick_chkpnt_io(**) Generic power gain/loss across the link */
         double           mMinLinearizationPotential; /**<    (1) trick_chkpnt_io(**) Delta-Potential linearization threshold */
         bool             mInitFlag;                  /**< *o (1) trick_chkpnt_io(**) Link Init Flag */
         bool             mNodeMapLocked;             /**<    (1) trick_chkpnt_io(**) Ports cannot change nodes for any reason */
+        bool             mSerialOnly;                /**<    (1) trick_chkpnt_io(**) Link must be stepped serially by the solver */
         int              mUserPortSelect;            /**<    (1) trick_chkpnt_io(**) The user-selected port to re-map */
         int              mUserPortSelectNode;        /**<    (1) trick_chkpnt_io(**) The node to re-map the selected port to */
         UserPortControl  mUserPortSetControl;        /**<    (1) trick_chkpnt_io(**) Command/feedback for the re-map action */
@@ -489,6 +507,7 @@ inline bool GunnsBasicLink::isInitialized() const
 inline void GunnsBasicLink::initializeRestartCommonFunctions()
 {
     mAdmittanceUpdate          = false;
+    mSourceUpdate              = true;
     mPower                     = 0.0;
     mUserPortSelect            = -1;
     mUserPortSelectNode        = -1;
@@ -511,6 +530,69 @@ inline void GunnsBasicLink::unlockNodeMap()
     mNodeMapLocked = false;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   bool -- True if the link must be stepped serially by the solver.
+///
+/// @details  Returns mSerialOnly.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsBasicLink::isSerialOnly() const
+{
+    return mSerialOnly;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] serialOnly (--) True if the link must be stepped serially by the solver.
+///
+/// @details  Sets mSerialOnly.  When the solver steps links in parallel, a serial-only link is
+///           stepped alone on the solver's thread, after all links before it and before any links
+///           after it.  Links whose step, minorStep or confirmSolutionAcceptable methods write to
+///           their nodes or to other links, or read from other links, must be serial-only.  So
+///           must links that call the compute methods of a fluid node's contents in those methods,
+///           since the contents' property cache is written by every compute call.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsBasicLink::setSerialOnly(const bool serialOnly)
+{
+    mSerialOnly = serialOnly;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   bool -- True if the link is changing the system source vector.
+///
+/// @details  Returns and clears the source vector update flag.  A link that doesn't report its
+///           source vector changes is always changing it, as far as the solver can tell.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsBasicLink::needSourceUpdate()
+{
+    const bool update = mSourceUpdate or not mSourceReporting;
+    mSourceUpdate = false;
+    return update;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   bool -- True if the link reports its source vector changes to the solver.
+///
+/// @details  Returns mSourceReporting.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsBasicLink::isSourceReporting() const
+{
+    return mSourceReporting;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] reporting (--) True if the link reports its source vector changes to the solver.
+///
+/// @details  Sets mSourceReporting.  When the solver assembles the source vector incrementally, it
+///           only re-sums the contributions of links that set mSourceUpdate, and of all links that
+///           don't report.  Only links whose class sets mSourceUpdate every time it changes the
+///           source vector, such as the basic conductor, potential and source, may report.  This
+///           is not inherited by derived classes that build their own source terms, so it is set
+///           per link rather than by the classes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsBasicLink::setSourceReporting(const bool reporting)
+{
+    mSourceReporting = reporting;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @return   double -- The flux through the link.
 ///
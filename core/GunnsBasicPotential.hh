@@ -177,8 +177,12 @@ inline void GunnsBasicPotential::buildPotential()
     /// - The source potential term is defined as the potential rise created by the potential
     ///   source.  So that a positive source potential creates a flow in the positive direction
     ///   (port 0 to port 1), we reverse the sign in the source vector.
-    mSourceVector[0] = -mSourcePotential * mAdmittanceMatrix[0];
-    mSourceVector[1] = -mSourceVector[0];
+    const double source = -mSourcePotential * mAdmittanceMatrix[0];
+    if (source != mSourceVector[0]) {
+        mSourceUpdate = true;
+    }
+    mSourceVector[0] = source;
+    mSourceVector[1] = -source;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -182,6 +182,9 @@ inline double GunnsBasicSource::getFluxDemand() const
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 inline void GunnsBasicSource::buildSource()
 {
+    if (mFlux != mSourceVector[1]) {
+        mSourceUpdate = true;
+    }
     mSourceVector[0] = -mFlux;
     mSourceVector[1] =  mFlux;
 }
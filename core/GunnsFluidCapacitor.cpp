@@ -125,7 +125,8 @@ GunnsFluidCapacitor::GunnsFluidCapacitor():
     mEditVolumeFlag(false),
     mEditVolume(0.0)
 {
-    // nothing to do
+    /// - Stepped serially since it sets its node's volume and expansion scale factor in step.
+    mSerialOnly = true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
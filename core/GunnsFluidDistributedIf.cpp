@@ -190,7 +190,7 @@ GunnsFluidDistributedIf::GunnsFluidDistributedIf()
     mOtherIfs              (),
     mFluidState            ()
 {
-    // nothing to do
+    mSerialOnly = true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
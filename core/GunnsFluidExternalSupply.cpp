@@ -153,7 +153,8 @@ GunnsFluidExternalSupply::GunnsFluidExternalSupply()
     mDemandMassFractions  (0),
     mDemandTcMoleFractions(0)
 {
-    // nothing to do
+    /// - Stepped serially since it sets its node's network capacitance request in step.
+    mSerialOnly = true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
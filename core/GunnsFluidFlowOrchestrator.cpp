@@ -8,15 +8,20 @@
 LIBRARY DEPENDENCY:
   ((core/GunnsFluidLink.o)
    (core/GunnsBasicFlowOrchestrator.o)
+   (core/GunnsThreadPool.o)
    (simulation/hs/TsHsMsg.o)
+   (software/exceptions/TsNumericalException.o)
    (software/exceptions/TsOutOfBoundsException.o))
 */
 
 #include "GunnsFluidFlowOrchestrator.hh"
 #include "simulation/hs/TsHsMsg.hh"
+#include "software/exceptions/TsNumericalException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
 #include "core/GunnsFluidLink.hh"
 #include "core/GunnsMacros.hh"
+#include <algorithm>
+#include <sstream>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  numLinks  (--)  The number of links in the network.
@@ -29,7 +34,18 @@ GunnsFluidFlowOrchestrator::GunnsFluidFlowOrchestrator(const int& numLinks, cons
     GunnsBasicFlowOrchestrator(numLinks, numNodes),
     mLinkStates(0),
     mNodeStates(0),
-    mNumIncompleteLinks(0)
+    mNumIncompleteLinks(0),
+    mNumCompleteLinks(0),
+    mLinkSources(),
+    mNodeInputs(),
+    mNodeOutputStart(),
+    mNodeOutputs(),
+    mReadyLinks(),
+    mReadyNodes(),
+    mPassItems(),
+    mNodeTaskErrors(),
+    mNodePool(),
+    mNumPasses(0)
 {
     // nothing to do
 }
@@ -74,6 +90,17 @@ void GunnsFluidFlowOrchestrator::initialize(const std::string& name, GunnsBasicL
         mNodeStates[i] = INCOMPLETE;
     }
     mNumIncompleteLinks = 0;
+    mNumCompleteLinks   = 0;
+    mNumPasses          = 0;
+
+    /// - Size the flow graph for all links & nodes, so it doesn't allocate during update.  Only the
+    ///   node outflow list grows, the first few times nodes overflow.
+    mLinkSources.assign(mNumLinks, 0);
+    mNodeInputs.assign(mNumNodes, 0);
+    mNodeOutputStart.assign(mNumNodes + 1, 0);
+    mReadyLinks.reserve(mNumLinks);
+    mReadyNodes.reserve(mNumNodes);
+    mPassItems.reserve(std::max(mNumLinks, mNumNodes));
 
     /// - Set the initialization complete flag.
     mInitFlag = true;
@@ -105,6 +132,8 @@ void GunnsFluidFlowOrchestrator::update(const double dt)
         mLinkStates[link] = false;
     }
     mNumIncompleteLinks = mNumLinks;
+    mNumCompleteLinks   = 0;
+    mNumPasses          = 0;
 
     /// - Initially flag all nodes as incomplete, except for the Ground node which is always
     ///   complete.
@@ -117,28 +146,43 @@ void GunnsFluidFlowOrchestrator::update(const double dt)
         }
     }
 
-    /// - Links and nodes flow transport and integration loop.  The loop is repeated until all nodes
-    ///   and links are completed.
+    /// - Build the graph of this pass's flow directions and find the initially ready links & nodes.
+    buildFlowGraph();
+
+    /// - Links and nodes flow transport and integration loop.  Each pass completes the links that
+    ///   have all of their source nodes ready for outflow, then the nodes that have all of their
+    ///   input links complete.  Nodes are ready for outflow when they are either complete or
+    ///   non-overflowing.  Input links are those that are flowing into the node.  The loop is
+    ///   repeated until all nodes and links are completed.
     try {
         do {
-            /// - Complete all incomplete links that have all of their source nodes ready for
-            ///   outflow.  Nodes are ready for outflow when they are either complete or
-            ///   non-overflowing.
-            for (int link = 0; link < mNumLinks; ++link) {
-                if (not mLinkStates[link] and linkSourceNodesReady(link)) {
-                    mLinks[link]->transportFlows(dt);
-                    mLinkStates[link] = true;
-                }
+            mPassItems.swap(mReadyLinks);
+            mReadyLinks.clear();
+            std::sort(mPassItems.begin(), mPassItems.end());
+            for (unsigned int i = 0; i < mPassItems.size(); ++i) {
+                completeLink(mPassItems[i], dt);
             }
 
-            /// - Complete all incomplete nodes that have all of their input links complete.  Input
-            ///   links are those that are flowing into the node.
-            for (int node = 0; node < mNumNodes-1; ++node) {
-                if (COMPLETE != mNodeStates[node] and nodeInputLinksComplete(node)) {
-                    mNodes[node]->integrateFlows(dt);
-                    mNodeStates[node] = COMPLETE;
+            mPassItems.swap(mReadyNodes);
+            mReadyNodes.clear();
+            std::sort(mPassItems.begin(), mPassItems.end());
+            integratePassNodes(dt);
+
+            /// - Mark the nodes complete and release their outflow links, in order.  Non-overflowing
+            ///   nodes never held their outflow links.
+            for (unsigned int i = 0; i < mPassItems.size(); ++i) {
+                const int node = mPassItems[i];
+                if (OVERFLOWING == mNodeStates[node]) {
+                    for (int edge = mNodeOutputStart[node]; edge < mNodeOutputStart[node+1]; ++edge) {
+                        const int link = mNodeOutputs[edge];
+                        if (0 == --mLinkSources[link] and not mLinkStates[link]) {
+                            mReadyLinks.push_back(link);
+                        }
+                    }
                 }
+                mNodeStates[node] = COMPLETE;
             }
+            ++mNumPasses;
         } while (not checkAllComplete(dt));
     } catch (TsOutOfBoundsException& e) {
         GUNNS_ERROR(TsOutOfBoundsException, "Escape Infinite Loop",
@@ -146,6 +190,207 @@ void GunnsFluidFlowOrchestrator::update(const double dt)
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Counts each link's source ports on overflowing nodes, which must complete before the
+///           link transports, and each node's sink ports of links, which must complete before the
+///           node integrates.  The links flowing out of each overflowing node are stored in
+///           compressed rows, so completing a node releases only its own outflow links.  Links &
+///           nodes with nothing to wait for are queued for the first pass.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidFlowOrchestrator::buildFlowGraph()
+{
+    mNodeInputs.assign(mNumNodes, 0);
+    mNodeOutputStart.assign(mNumNodes + 1, 0);
+    mReadyLinks.clear();
+    mReadyNodes.clear();
+
+    /// - Count the ports, and the outflow links of each overflowing node in the next node's row
+    ///   start, so the partial sums below become the row starts.
+    for (int link = 0; link < mNumLinks; ++link) {
+        mLinkSources[link] = 0;
+        for (int port = 0; port < mLinkNumPorts[link]; ++port) {
+            const GunnsBasicLink::PortDirection direction = mLinkPortDirections[link][port];
+            const int node = mLinkNodeMaps[link][port];
+            if ((GunnsBasicLink::SOURCE == direction or GunnsBasicLink::BOTH == direction)
+                    and OVERFLOWING == mNodeStates[node]) {
+                ++mLinkSources[link];
+                ++mNodeOutputStart[node+1];
+            }
+            if (GunnsBasicLink::SINK == direction or GunnsBasicLink::BOTH == direction) {
+                ++mNodeInputs[node];
+            }
+        }
+        if (0 == mLinkSources[link]) {
+            mReadyLinks.push_back(link);
+        }
+    }
+    for (int node = 0; node < mNumNodes; ++node) {
+        mNodeOutputStart[node+1] += mNodeOutputStart[node];
+    }
+
+    /// - Fill the rows in link order, advancing each row start to its end, then shift the ends
+    ///   back into row starts.
+    mNodeOutputs.resize(mNodeOutputStart[mNumNodes]);
+    for (int link = 0; link < mNumLinks; ++link) {
+        if (0 == mLinkSources[link]) {
+            continue;
+        }
+        for (int port = 0; port < mLinkNumPorts[link]; ++port) {
+            const GunnsBasicLink::PortDirection direction = mLinkPortDirections[link][port];
+            const int node = mLinkNodeMaps[link][port];
+            if ((GunnsBasicLink::SOURCE == direction or GunnsBasicLink::BOTH == direction)
+                    and OVERFLOWING == mNodeStates[node]) {
+                mNodeOutputs[mNodeOutputStart[node]++] = link;
+            }
+        }
+    }
+    for (int node = mNumNodes; node > 0; --node) {
+        mNodeOutputStart[node] = mNodeOutputStart[node-1];
+    }
+    mNodeOutputStart[0] = 0;
+
+    for (int node = 0; node < mNumNodes-1; ++node) {
+        if (0 == mNodeInputs[node]) {
+            mReadyNodes.push_back(node);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  link  (--)  Index of the link to complete.
+/// @param[in]  dt    (s)   Integration time step.
+///
+/// @details  Transports the link's flows and flags it complete, then queues the nodes it flows into
+///           that have no more incomplete input links for the next node pass.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidFlowOrchestrator::completeLink(const int link, const double dt)
+{
+    mLinks[link]->transportFlows(dt);
+    mLinkStates[link] = true;
+    ++mNumCompleteLinks;
+
+    for (int port = 0; port < mLinkNumPorts[link]; ++port) {
+        const GunnsBasicLink::PortDirection direction = mLinkPortDirections[link][port];
+        const int node = mLinkNodeMaps[link][port];
+        if ((GunnsBasicLink::SINK == direction or GunnsBasicLink::BOTH == direction)
+                and node < mNumNodes-1 and 0 == --mNodeInputs[node]) {
+            mReadyNodes.push_back(node);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Thread pool job for parallel node integration.
+///
+/// @details  Integrates a chunk of the current pass's nodes for each task.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsFluidFlowOrchestrator::NodeJob : public GunnsThreadPoolJob
+{
+    public:
+        /// @brief Constructs this job for the given orchestrator, number of tasks and time step.
+        NodeJob(GunnsFluidFlowOrchestrator& orchestrator, const int numTasks, const double dt)
+            : mOrchestrator(orchestrator), mNumTasks(numTasks), mDt(dt) {;}
+        /// @brief Default destructs this job.
+        virtual ~NodeJob() {;}
+        /// @brief Integrates the task's chunk of nodes.
+        virtual void runTask(const int task, const int worker __attribute__((unused)))
+        {
+            mOrchestrator.integrateNodeTask(task, mNumTasks, mDt);
+        }
+
+    private:
+        GunnsFluidFlowOrchestrator& mOrchestrator; /**< ** (--) trick_chkpnt_io(**) The orchestrator whose nodes are integrated. */
+        const int                   mNumTasks;     /**< ** (--) trick_chkpnt_io(**) Number of tasks the nodes are split into. */
+        const double                mDt;           /**< ** (s)  trick_chkpnt_io(**) Integration time step. */
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        NodeJob(const NodeJob& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        NodeJob& operator =(const NodeJob& that);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  threads  (--)  Number of threads, including the solver's thread.
+///
+/// @details  Starts the worker threads for parallel node integration.  One or fewer threads
+///           integrates the nodes serially.  The ready nodes of a pass don't flow into each other,
+///           so integrating them in parallel gives the same results as in series.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidFlowOrchestrator::setThreads(const int threads)
+{
+    mNodePool.initialize(mName + ".mNodePool", threads);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dt  (s)  Integration time step.
+///
+/// @throws   TsNumericalException
+///
+/// @details  Integrates the flows of the current pass's nodes in mPassItems, split among the worker
+///           threads when there are more than one of each.  Errors in the worker threads are
+///           reported after all of them finish.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidFlowOrchestrator::integratePassNodes(const double dt)
+{
+    const int count   = static_cast<int>(mPassItems.size());
+    const int workers = mNodePool.getNumWorkers();
+    if (workers < 2 or count < 2) {
+        for (int i = 0; i < count; ++i) {
+            mNodes[mPassItems[i]]->integrateFlows(dt);
+        }
+        return;
+    }
+
+    const int numTasks = std::min(count, 4 * workers);
+    mNodeTaskErrors.assign(numTasks, std::string());
+    NodeJob job(*this, numTasks, dt);
+    const int failed = mNodePool.run(&job, numTasks);
+
+    /// - Report the error from the lowest numbered failing node.
+    for (int task = 0; task < numTasks; ++task) {
+        if (not mNodeTaskErrors[task].empty()) {
+            GUNNS_ERROR(TsNumericalException, "Error Return Value", mNodeTaskErrors[task]);
+        }
+    }
+    if (failed > 0) {
+        GUNNS_ERROR(TsNumericalException, "Error Return Value",
+                    "unexpected exception in a node thread.");
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  task      (--)  Task number.
+/// @param[in]  numTasks  (--)  Number of tasks the pass's nodes are split into.
+/// @param[in]  dt        (s)   Integration time step.
+///
+/// @details  Integrates the flows of the task's chunk of the current pass's nodes, in order.  Node
+///           exceptions are caught and their message saved for the calling thread to report, and
+///           the rest of the chunk is skipped.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidFlowOrchestrator::integrateNodeTask(const int task, const int numTasks,
+                                                   const double dt)
+{
+    const int count = static_cast<int>(mPassItems.size());
+    const int first = (count * task) / numTasks;
+    const int last  = (count * (task + 1)) / numTasks;
+    for (int i = first; i < last; ++i) {
+        const int node = mPassItems[i];
+        try {
+            mNodes[node]->integrateFlows(dt);
+        } catch (TsBaseException& e) {
+            std::ostringstream msg;
+            msg << e.getMessage() << " " << e.getThrowingEntityName() << " " << e.getCause()
+                << " in node " << mNodes[node]->getName() << ".";
+            mNodeTaskErrors[task] = msg.str();
+            return;
+        } catch (std::exception& e) {
+            std::ostringstream msg;
+            msg << e.what() << " in node " << mNodes[node]->getName() << ".";
+            mNodeTaskErrors[task] = msg.str();
+            return;
+        }
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  dt  (s)  Integration time step.
 ///
@@ -160,7 +405,7 @@ void GunnsFluidFlowOrchestrator::update(const double dt)
 bool GunnsFluidFlowOrchestrator::checkAllComplete(const double dt)
 {
     /// - Return true to exit the transport loop when all nodes & links are complete:
-    int incompleteLinks = countIncompleteLinks();
+    const int incompleteLinks = mNumLinks - mNumCompleteLinks;
     if (0 == incompleteLinks and checkAllNodesComplete()) {
         mNumIncompleteLinks = 0;
         return true;
@@ -181,8 +426,7 @@ bool GunnsFluidFlowOrchestrator::checkAllComplete(const double dt)
     ///   whatever reason there are some nodes that are stuck not completing.
     if (incompleteLinks >= mNumIncompleteLinks) {
         const unsigned int link = getFirstIncompleteLink();
-        mLinks[link]->transportFlows(dt);
-        mLinkStates[link] = true;
+        completeLink(link, dt);
         GUNNS_WARNING("early overflow transport in link " << mLinks[link]->getName() <<
                       ", conservation errors may result.");
     }
@@ -230,68 +474,3 @@ unsigned int GunnsFluidFlowOrchestrator::getFirstIncompleteLink() const
     throw TsOutOfBoundsException();
     return 0;
 }
-
-////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in]  link  (--)  Index of the link to check.
-///
-/// @returns  bool  (--)  True if the link is ready to do flow transport.
-///
-/// @details  Determines whether the link is ready to do its flow transport.  The link is ready when
-///           all of its source nodes are either complete, or otherwise not overflowing.
-////////////////////////////////////////////////////////////////////////////////////////////////////
-bool GunnsFluidFlowOrchestrator::linkSourceNodesReady(int link) const
-{
-    /// - Return false (not ready) if any of the link's source nodes are overflowing and incomplete.
-    for (int port = 0; port < mLinkNumPorts[link]; ++port) {
-        if (GunnsBasicLink::SOURCE == mLinkPortDirections[link][port] or
-            GunnsBasicLink::BOTH   == mLinkPortDirections[link][port]) {
-            if (OVERFLOWING == mNodeStates[mLinkNodeMaps[link][port]]) {
-                return false;
-            }
-        }
-    }
-    return true;
-}
-
-////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in]  node  (--)  Index of the node to check.
-///
-/// @returns  bool  (--)  True if the node is ready to do flow integration.
-///
-/// @details  Determines whether a node is ready to do its flow integration.  The node is ready when
-///           all of its input flow links are complete.
-////////////////////////////////////////////////////////////////////////////////////////////////////
-bool GunnsFluidFlowOrchestrator::nodeInputLinksComplete(int node) const
-{
-    /// - Loop over all links.  Find all links connected to this node that are flowing to this node.
-    ///   If any is not complete, then return false (not ready).
-    for (int link = 0; link < mNumLinks; ++link) {
-        for (int port = 0; port < mLinkNumPorts[link]; ++port) {
-            if (node == mLinkNodeMaps[link][port] and not mLinkStates[link]
-                    and (GunnsBasicLink::SINK == mLinkPortDirections[link][port]
-                      or GunnsBasicLink::BOTH == mLinkPortDirections[link][port])) {
-                return false;
-            }
-        }
-    }
-
-    /// - After loop ends, return true because either no links are connected, or all connected links
-    ///   are complete or not an input flow to this node.
-    return true;
-}
-
-////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @returns  int  (--)  Number of incomplete links.
-///
-/// @details  Counts the number of false (incomplete) flags in the links completion states array.
-////////////////////////////////////////////////////////////////////////////////////////////////////
-int GunnsFluidFlowOrchestrator::countIncompleteLinks() const
-{
-    int result = 0;
-    for (int link = 0; link < mNumLinks; ++link) {
-        if (not mLinkStates[link]) {
-            result++;
-        }
-    }
-    return result;
-}
@@ -20,7 +20,9 @@ REFERENCE:
 ASSUMPTIONS AND LIMITATIONS:
 - ((Design limitation: closed loops of all overflowing nodes do not conserve mass & energy.)
    (Design limitation: conservation errors can occur from a link that flows both to & from an
-   overflowing node with multiple flow paths.))
+   overflowing node with multiple flow paths.)
+   (Parallel node integration assumes that nodes only change their own state when integrating,
+   and that fluid property lookups can be shared by concurrent nodes.))
 
 LIBRARY DEPENDENCY:
 - ((GunnsFluidFlowOrchestrator.o))
@@ -31,8 +33,10 @@ PROGRAMMERS:
 @{
 */
 
+#include <vector>
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "core/GunnsBasicFlowOrchestrator.hh"
+#include "core/GunnsThreadPool.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    GUNNS Fluid Flow Orchestrator Class.
@@ -58,6 +62,16 @@ PROGRAMMERS:
 ///           force a link to transport before its source nodes are complete.  These cases are
 ///           described as design limitations in the Assumptions & Limitations, but all could be
 ///           avoided by proper network setup.
+///
+///           The order is found from a graph of the flow directions, built after the links compute
+///           their flows, where each overflowing node must complete before its outflow links, and
+///           each link must complete before the nodes it flows into.  Links and nodes are completed
+///           as their inputs complete (Kahn's topological sort), in passes of ready links then
+///           ready nodes, each pass in index order, which is the same order as sweeping all links
+///           & nodes until complete, but without re-scanning them.  Loops are cut the same way, by
+///           forcing the lowest numbered incomplete link when a pass completes no links.  The nodes
+///           that are ready in the same pass don't depend on each other, and can be integrated
+///           concurrently by a pool of worker threads, enabled by setThreads.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class GunnsFluidFlowOrchestrator : public GunnsBasicFlowOrchestrator
 {
@@ -78,19 +92,36 @@ class GunnsFluidFlowOrchestrator : public GunnsBasicFlowOrchestrator
                                 int** linkNodeMaps, int* linkNumPorts);
         /// @brief  Updates the flow transport through the links and integration in the nodes.
         virtual void update(const double dt);
+        /// @brief  Sets the number of threads for parallel node integration.
+        virtual void setThreads(const int threads);
 
     protected:
         bool*       mLinkStates;                            /**< (1) Completion state of links. */
         NodeStates* mNodeStates;                            /**< (1) Completion state of nodes. */
         int         mNumIncompleteLinks;                    /**< (1) Number of incomplete links. */
-        /// @brief  Returns whether all of the link's source nodes are complete.
-        bool linkSourceNodesReady(int link) const;
-        /// @brief  Returns whether all of the node's inflowing links are complete.
-        bool nodeInputLinksComplete(int node) const;
+        int         mNumCompleteLinks;                      /**< (1) Number of complete links. */
+        std::vector<int> mLinkSources;                      /**< ** (1) trick_chkpnt_io(**) Number of source ports of each link on incomplete overflowing nodes. */
+        std::vector<int> mNodeInputs;                       /**< ** (1) trick_chkpnt_io(**) Number of sink ports of incomplete links on each node. */
+        std::vector<int> mNodeOutputStart;                  /**< ** (1) trick_chkpnt_io(**) Start of each node's outflow links in mNodeOutputs, plus the total at the end. */
+        std::vector<int> mNodeOutputs;                      /**< ** (1) trick_chkpnt_io(**) Outflow links of each overflowing node. */
+        std::vector<int> mReadyLinks;                       /**< ** (1) trick_chkpnt_io(**) Links ready to complete in the next pass. */
+        std::vector<int> mReadyNodes;                       /**< ** (1) trick_chkpnt_io(**) Nodes ready to complete in the next pass. */
+        std::vector<int> mPassItems;                        /**< ** (1) trick_chkpnt_io(**) Links or nodes being completed in the current pass. */
+        std::vector<std::string> mNodeTaskErrors;           /**< ** (1) trick_chkpnt_io(**) Error message of each parallel node task, empty if none. */
+        GunnsThreadPool  mNodePool;                         /**< ** (1) trick_chkpnt_io(**) Worker threads for parallel node integration. */
+        int         mNumPasses;                             /**< (1) Number of passes in the last update. */
+        /// @brief  Builds the flow direction graph of the links and overflowing nodes.
+        void buildFlowGraph();
+        /// @brief  Transports the link's flows and releases the nodes it flows into.
+        void completeLink(const int link, const double dt);
+        /// @brief  Integrates the nodes of the current pass, in parallel if enabled.
+        void integratePassNodes(const double dt);
+        /// @brief  Integrates the given chunk of nodes of the current pass.
+        void integrateNodeTask(const int task, const int numTasks, const double dt);
+        /// @brief  Thread pool job for parallel node integration.
+        class NodeJob;
         /// @brief  Returns whether all of the network nodes and links are complete.
         bool checkAllComplete(const double dt);
-        /// @brief  Returns the number of links that are not complete.
-        int  countIncompleteLinks() const;
         /// @brief  Returns whether all network nodes are complete.
         virtual bool checkAllNodesComplete() const;
         /// @brief  Returns the index of the first incomplete link.
@@ -175,6 +175,12 @@ void GunnsFluidNode::initialize(const std::string&         name,
         mPreviousPressure    = initialFluidState->mPressure;
     }
 
+    /// - The node contents' properties are computed repeatedly at the same conditions by the node
+    ///   and its capacitive links, so cache them.  The cache isn't thread-safe, so links that call
+    ///   the contents' compute methods in step, minorStep or confirmSolutionAcceptable must be
+    ///   serial-only under parallel link stepping (see GunnsBasicLink::setSerialOnly).
+    mContent.setPropertyCacheEnabled(true);
+
     /// - Allocate memory for the direct trace compound flows into the node.
     const GunnsFluidTraceCompounds* traceCompounds = mContent.getTraceCompounds();
     if (traceCompounds) {
@@ -10,6 +10,7 @@ LIBRARY DEPENDENCY:
 */
 
 #include "GunnsInfraFunctions.hh"
+#include <ctime>
 
 #ifndef no_TRICK_ENV
 #if (TRICK_VER >= 17)
@@ -23,6 +24,9 @@ LIBRARY DEPENDENCY:
 /// @details Defines the static variable, useful for non-Trick implementations like testing.
 double GunnsInfraFunctions::mClockTime = 0.0;
 
+/// @details Defines the static variable, useful for non-Trick implementations like benchmarks.
+bool GunnsInfraFunctions::mWallClock = false;
+
 /// @details Defines the static variable, useful for non-Trick implementations like testing.
 bool GunnsInfraFunctions::mMcIsSlave = false;
 
@@ -39,13 +43,20 @@ std::vector<double> GunnsInfraFunctions::mMcWrite = GunnsInfraFunctions::makeEmp
 /// @returns  double  (s)  A clock time value.
 ///
 /// @details  In the Trick environment, returns the Trick's clock_time() value converted to units of
-///           seconds.  In non-Trick environments, returns the value of mClockTime.
+///           seconds.  In non-Trick environments, returns the value of mClockTime, or the
+///           monotonic wall clock time in seconds when mWallClock is set, so that non-Trick
+///           simulations and benchmarks can use the solver's own timing outputs.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 double GunnsInfraFunctions::clockTime()
 {
 #ifndef no_TRICK_ENV
     return clock_time() / 1000000.0;
 #else  // non-Trick
+    if (mWallClock) {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return static_cast<double>(now.tv_sec) + 1.0E-9 * static_cast<double>(now.tv_nsec);
+    }
     return mClockTime;
 #endif
 }
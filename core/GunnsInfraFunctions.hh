@@ -48,6 +48,7 @@ class GunnsInfraFunctions
 {
     public:
         static double              mClockTime; /**< ** (s) A clock time value. */
+        static bool                mWallClock; /**< ** (1) Non-Trick clock time is the monotonic wall clock instead of mClockTime. */
         static bool                mMcIsSlave; /**< ** (1) An indication (true) of the monte carlo slave role. */
         static int                 mMcSlaveId; /**< ** (1) A monte carlo slave run identifier. */
         static std::vector<double> mMcRead;    /**< ** (1) Values to read from the monte carlo slave role to the master role. */
@@ -0,0 +1,208 @@
+/**
+@file
+@brief    GUNNS Solver Thread Pool implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   ((simulation/hs/TsHsMsg.o)
+    (software/exceptions/TsInitializationException.o))
+*/
+
+#include "GunnsThreadPool.hh"
+#include "core/GunnsMacros.hh"
+#include "software/exceptions/TsInitializationException.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this thread pool with a single worker, the calling thread.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThreadPool::GunnsThreadPool()
+    :
+    mName(),
+    mNumWorkers(1),
+    mThreads(0),
+    mWorkers(0),
+    mMutex(),
+    mStartCond(),
+    mDoneCond(),
+    mJob(0),
+    mNumTasks(0),
+    mNextTask(0),
+    mBusyWorkers(0),
+    mFailedTasks(0),
+    mGeneration(0),
+    mShutdown(false)
+{
+    pthread_mutex_init(&mMutex, NULL);
+    pthread_cond_init(&mStartCond, NULL);
+    pthread_cond_init(&mDoneCond, NULL);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this thread pool, stopping the worker threads.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThreadPool::~GunnsThreadPool()
+{
+    shutdown();
+    pthread_cond_destroy(&mDoneCond);
+    pthread_cond_destroy(&mStartCond);
+    pthread_mutex_destroy(&mMutex);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name       (--) Instance name for messages.
+/// @param[in] numWorkers (--) Number of workers, including the calling thread.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Stops any existing workers and starts numWorkers - 1 new worker threads.  A
+///           numWorkers less than 1 is treated as 1.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThreadPool::initialize(const std::string& name, const int numWorkers)
+{
+    shutdown();
+    mName       = name;
+    mGeneration = 0;
+    if (numWorkers > 1) {
+        mThreads = new pthread_t[numWorkers - 1];
+        mWorkers = new GunnsThreadPoolWorker[numWorkers - 1];
+        for (int i = 0; i < numWorkers - 1; ++i) {
+            mWorkers[i].mPool   = this;
+            mWorkers[i].mNumber = i + 1;
+            if (0 != pthread_create(&mThreads[i], NULL, workerEntry, &mWorkers[i])) {
+                /// - Keep the workers that did start, so they are joined on shutdown.
+                mNumWorkers = i + 1;
+                GUNNS_ERROR(TsInitializationException, "Initialization Error",
+                            "failed to create a worker thread.");
+            }
+        }
+        mNumWorkers = numWorkers;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tells the worker threads to exit and joins them, leaving the pool with a single
+///           worker, the calling thread.  This must not be called while a job is running.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThreadPool::shutdown()
+{
+    if (mNumWorkers > 1) {
+        pthread_mutex_lock(&mMutex);
+        mShutdown = true;
+        pthread_cond_broadcast(&mStartCond);
+        pthread_mutex_unlock(&mMutex);
+        for (int i = 0; i < mNumWorkers - 1; ++i) {
+            pthread_join(mThreads[i], NULL);
+        }
+    }
+    delete [] mWorkers;
+    mWorkers = 0;
+    delete [] mThreads;
+    mThreads    = 0;
+    mNumWorkers = 1;
+    mShutdown   = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] job      (--) The job to run.
+/// @param[in] numTasks (--) Number of tasks in the job.
+///
+/// @returns  int (--) Number of tasks that threw an exception.
+///
+/// @details  Wakes the worker threads to run the job's tasks, runs tasks on the calling thread as
+///           worker 0, and returns when all tasks are done.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int GunnsThreadPool::run(GunnsThreadPoolJob* job, const int numTasks)
+{
+    pthread_mutex_lock(&mMutex);
+    mJob         = job;
+    mNumTasks    = numTasks;
+    mNextTask    = 0;
+    mFailedTasks = 0;
+    mBusyWorkers = mNumWorkers - 1;
+    mGeneration++;
+    pthread_cond_broadcast(&mStartCond);
+    pthread_mutex_unlock(&mMutex);
+
+    runTasks(0);
+
+    pthread_mutex_lock(&mMutex);
+    while (mBusyWorkers > 0) {
+        pthread_cond_wait(&mDoneCond, &mMutex);
+    }
+    mJob = 0;
+    const int failed = mFailedTasks;
+    pthread_mutex_unlock(&mMutex);
+    return failed;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] worker (--) Number of the worker running the tasks.
+///
+/// @details  Takes the next task number from the shared counter and runs it, until all tasks of
+///           the current job have been taken.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThreadPool::runTasks(const int worker)
+{
+    for (;;) {
+        pthread_mutex_lock(&mMutex);
+        const int task = mNextTask++;
+        pthread_mutex_unlock(&mMutex);
+        if (task >= mNumTasks) {
+            break;
+        }
+        try {
+            mJob->runTask(task, worker);
+        } catch (...) {
+            pthread_mutex_lock(&mMutex);
+            mFailedTasks++;
+            pthread_mutex_unlock(&mMutex);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] worker (--) Number of this worker.
+///
+/// @details  Waits for a new job, runs its tasks, and reports done, until told to shut down.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThreadPool::workLoop(const int worker)
+{
+    /// - The job counter is reset before the workers are created, so a worker that starts after
+    ///   the first job has already been posted still runs it.
+    pthread_mutex_lock(&mMutex);
+    unsigned int lastGeneration = 0;
+    for (;;) {
+        while (not mShutdown and lastGeneration == mGeneration) {
+            pthread_cond_wait(&mStartCond, &mMutex);
+        }
+        if (mShutdown) {
+            break;
+        }
+        lastGeneration = mGeneration;
+        pthread_mutex_unlock(&mMutex);
+
+        runTasks(worker);
+
+        pthread_mutex_lock(&mMutex);
+        if (0 == --mBusyWorkers) {
+            pthread_cond_signal(&mDoneCond);
+        }
+    }
+    pthread_mutex_unlock(&mMutex);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] arg (--) Pointer to this worker's GunnsThreadPoolWorker argument.
+///
+/// @returns  void* (--) Always NULL.
+///
+/// @details  Worker thread entry function, runs the worker loop of the given pool.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void* GunnsThreadPool::workerEntry(void* arg)
+{
+    GunnsThreadPoolWorker* worker = static_cast<GunnsThreadPoolWorker*>(arg);
+    worker->mPool->workLoop(worker->mNumber);
+    return NULL;
+}
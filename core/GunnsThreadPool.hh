@@ -0,0 +1,150 @@
+#ifndef GunnsThreadPool_EXISTS
+#define GunnsThreadPool_EXISTS
+
+/**
+@file
+@brief    GUNNS Solver Thread Pool declarations
+
+@defgroup  TSM_GUNNS_CORE_THREAD_POOL    GUNNS Solver Thread Pool
+@ingroup   TSM_GUNNS_CORE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (A small fork-join pool of worker threads for running independent solver tasks concurrently,
+   such as the decomposition & solution of separate network islands.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (Jobs are run one at a time, from a single calling thread.  The calling thread takes part in the
+   job as worker 0, and the call returns when all tasks are done.)
+- (Tasks must not throw exceptions.  Any that escape a task are caught and counted by the pool,
+   and the job is expected to record its own errors for the caller to handle.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsThreadPool.o))
+
+PROGRAMMERS:
+- ((agent) (agent@local) (2026-10) (Initial))
+
+@{
+*/
+
+#include <pthread.h>
+#include <string>
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Solver Thread Pool Job
+///
+/// @details  Interface for a job that is split into a number of independent tasks, to be run by
+///           the GunnsThreadPool.  The worker number passed to each task is in the range [0, number
+///           of workers), and can be used to index per-worker scratch storage, since a worker only
+///           runs one task at a time.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsThreadPoolJob
+{
+    public:
+        /// @brief Default constructs this job.
+        GunnsThreadPoolJob() {;}
+        /// @brief Default destructs this job.
+        virtual ~GunnsThreadPoolJob() {;}
+        /// @brief Runs the given task of this job on the given worker.
+        virtual void runTask(const int task, const int worker) = 0;
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsThreadPoolJob(const GunnsThreadPoolJob& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsThreadPoolJob& operator =(const GunnsThreadPoolJob& that);
+};
+
+class GunnsThreadPool;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Solver Thread Pool Worker Argument
+///
+/// @details  Identifies the pool and worker number to a worker thread's entry function.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+struct GunnsThreadPoolWorker
+{
+    GunnsThreadPool* mPool;   /**< ** (--) trick_chkpnt_io(**) The pool this worker belongs to. */
+    int              mNumber; /**< ** (--) trick_chkpnt_io(**) This worker's number. */
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Solver Thread Pool
+///
+/// @details  Holds a number of worker threads, which wait between jobs.  The run method hands a
+///           job to the workers and the calling thread, which pull tasks from a shared counter
+///           until all tasks are taken, then waits for the workers to finish.  Since tasks are
+///           pulled dynamically, which worker runs which task varies from run to run, so tasks
+///           should only share data with other tasks through storage that they don't both write.
+///
+///           With one worker, no threads are created and run calls the tasks in order on the
+///           calling thread.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsThreadPool
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsThreadPool);
+
+    public:
+        /// @brief Default constructs this thread pool.
+        GunnsThreadPool();
+        /// @brief Default destructs this thread pool.
+        virtual ~GunnsThreadPool();
+        /// @brief Starts the given number of workers, replacing any existing workers.
+        void initialize(const std::string& name, const int numWorkers);
+        /// @brief Runs the given number of tasks of the job on the workers, and waits for them.
+        int  run(GunnsThreadPoolJob* job, const int numTasks);
+        /// @brief Returns the number of workers, including the calling thread.
+        int  getNumWorkers() const;
+        /// @brief Stops and joins the worker threads.
+        void shutdown();
+
+    protected:
+        std::string            mName;        /**< *o (--) trick_chkpnt_io(**) Instance name for messages. */
+        int                    mNumWorkers;  /**< *o (--) trick_chkpnt_io(**) Number of workers, including the calling thread. */
+        pthread_t*             mThreads;     /**< ** (--) trick_chkpnt_io(**) Worker threads, numbers 1 and up. */
+        GunnsThreadPoolWorker* mWorkers;     /**< ** (--) trick_chkpnt_io(**) Worker thread arguments. */
+        pthread_mutex_t        mMutex;       /**< ** (--) trick_chkpnt_io(**) Guards the job state below. */
+        pthread_cond_t         mStartCond;   /**< ** (--) trick_chkpnt_io(**) Signals the workers to start a job or shut down. */
+        pthread_cond_t         mDoneCond;    /**< ** (--) trick_chkpnt_io(**) Signals the caller that the workers are done. */
+        GunnsThreadPoolJob*    mJob;         /**< ** (--) trick_chkpnt_io(**) The job being run. */
+        int                    mNumTasks;    /**< ** (--) trick_chkpnt_io(**) Number of tasks in the job being run. */
+        int                    mNextTask;    /**< ** (--) trick_chkpnt_io(**) Next task to be taken by a worker. */
+        int                    mBusyWorkers; /**< ** (--) trick_chkpnt_io(**) Number of worker threads still running the job. */
+        int                    mFailedTasks; /**< ** (--) trick_chkpnt_io(**) Number of tasks in the job that threw exceptions. */
+        unsigned int           mGeneration;  /**< ** (--) trick_chkpnt_io(**) Job counter, used by the workers to detect a new job. */
+        bool                   mShutdown;    /**< ** (--) trick_chkpnt_io(**) Tells the workers to exit. */
+        /// @brief Runs tasks of the current job until all have been taken.
+        void runTasks(const int worker);
+        /// @brief Worker thread loop, waiting for and running jobs until shutdown.
+        void workLoop(const int worker);
+        /// @brief Worker thread entry function.
+        static void* workerEntry(void* arg);
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsThreadPool(const GunnsThreadPool& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsThreadPool& operator =(const GunnsThreadPool& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) The number of workers, including the calling thread.
+///
+/// @details  Returns mNumWorkers.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsThreadPool::getNumWorkers() const
+{
+    return mNumWorkers;
+}
+
+#endif
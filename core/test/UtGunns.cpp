@@ -6,10 +6,20 @@
 #include <iostream>
 #include <cmath>
 #include <cfloat>
+#include <algorithm>
+#include <sstream>
 
 #include "UtGunns.hh"
 #include "UtGunnsMinorStepLog.hh"
+#include "core/GunnsInfraFunctions.hh"
 #include "core/GunnsBasicFlowOrchestrator.hh"
+#include "math/linear_algebra/CholeskyLdu.hh"
+#include "math/linear_algebra/CholeskyLduSparse.hh"
+#include "math/linear_algebra/ConjugateGradient.hh"
+#include "math/linear_algebra/SparseCsrMatrix.hh"
+#include "aspects/electrical/Converter/GunnsElectConverterInput.hh"
+#include "aspects/electrical/Converter/GunnsElectConverterOutput.hh"
+#include "aspects/thermal/GunnsThermalPhaseChangeBattery.hh"
 
 //TODO catch-up for line coverage:
 //     - line 591, try to make a link throw during restart
@@ -375,9 +385,38 @@ void UtGunns::testDefaultConstruction()
     CPPUNIT_ASSERT(0             == tNetwork.mIslandCount);
     CPPUNIT_ASSERT(0             == tNetwork.mIslandMaxSize);
     CPPUNIT_ASSERT(Gunns::OFF    == tNetwork.mIslandMode);
+    CPPUNIT_ASSERT(0             == tNetwork.mIslandParent);
+    CPPUNIT_ASSERT(0             == tNetwork.mIslandConnections);
+    CPPUNIT_ASSERT(-1            == tNetwork.mIslandPatternCount);
+    CPPUNIT_ASSERT(0             == tNetwork.mIslandFullBuilds);
+    CPPUNIT_ASSERT(0             == tNetwork.mIslandIncrementalBuilds);
+    CPPUNIT_ASSERT(1             == tNetwork.mIslandPool.getNumWorkers());
+    CPPUNIT_ASSERT(0             == tNetwork.mIslandWorkerVectors.size());
+    CPPUNIT_ASSERT(false         == tNetwork.mIslandCaching);
+    CPPUNIT_ASSERT(0             == tNetwork.mChangedLinks.size());
+    CPPUNIT_ASSERT(0             == tNetwork.mIslandFactors.size());
+    CPPUNIT_ASSERT(0             == tNetwork.mIslandFactorNodes.size());
+    CPPUNIT_ASSERT(0             == tNetwork.mIslandFactorStale.size());
+    CPPUNIT_ASSERT(-1            == tNetwork.mIslandFactorPattern);
+    CPPUNIT_ASSERT(0             == tNetwork.mIslandFactorDecompositions);
+    CPPUNIT_ASSERT(0             == tNetwork.mIslandFactorReuses);
+    CPPUNIT_ASSERT(0             == tNetwork.mFactorRankLimit);
+    CPPUNIT_ASSERT(0             == tNetwork.mFactorRefreshLimit);
+    CPPUNIT_ASSERT(false         == tNetwork.mFactorValid);
+    CPPUNIT_ASSERT(0             == tNetwork.mFactorUpdatesSinceFull);
+    CPPUNIT_ASSERT(0             == tNetwork.mFactorMatrix.size());
+    CPPUNIT_ASSERT(0             == tNetwork.mFactorLdu.size());
+    CPPUNIT_ASSERT(0             == tNetwork.mFactorVector.size());
+    CPPUNIT_ASSERT(0             == tNetwork.mFactorUpdateNodes.size());
+    CPPUNIT_ASSERT(0             == tNetwork.mFactorUpdateWeights.size());
+    CPPUNIT_ASSERT(0             == tNetwork.mFactorFullCount);
+    CPPUNIT_ASSERT(0             == tNetwork.mFactorUpdateCount);
+    CPPUNIT_ASSERT(0             == tNetwork.mFactorUpdateRanks);
+    CPPUNIT_ASSERT(0             == tNetwork.mFactorFallbackCount);
     CPPUNIT_ASSERT(0             == tNetwork.mSolverCpu);
     CPPUNIT_ASSERT(0             == tNetwork.mSolverGpuDense);
     CPPUNIT_ASSERT(0             == tNetwork.mSolverGpuSparse);
+    CPPUNIT_ASSERT(0             == tNetwork.mSolverSparse);
     if (tNetwork.isGpuEnabled()) {
         CPPUNIT_ASSERT(true      == tNetwork.mGpuEnabled);
     } else {
@@ -385,6 +424,24 @@ void UtGunns::testDefaultConstruction()
     }
     CPPUNIT_ASSERT(Gunns::NO_GPU == tNetwork.mGpuMode);
     CPPUNIT_ASSERT(9999999       == tNetwork.mGpuSizeThreshold);
+    CPPUNIT_ASSERT(0             == tNetwork.mSolverSimd);
+    CPPUNIT_ASSERT(Gunns::NO_SIMD == tNetwork.mSimdMode);
+    CPPUNIT_ASSERT(9999999       == tNetwork.mSimdSizeThreshold);
+    CPPUNIT_ASSERT(0             == tNetwork.mSolverPcg);
+    CPPUNIT_ASSERT(Gunns::DIRECT == tNetwork.mIterativeMethod);
+    CPPUNIT_ASSERT(100           == tNetwork.mPcgMaxIter);
+    CPPUNIT_ASSERT(1.0E-10       == tNetwork.mPcgTolerance);
+    CPPUNIT_ASSERT(-1            == tNetwork.mPcgLastIteration);
+    CPPUNIT_ASSERT(0             == tNetwork.mPcgIterationCount);
+    CPPUNIT_ASSERT(0             == tNetwork.mPcgFailCount);
+    CPPUNIT_ASSERT(false         == tNetwork.mPcgMatrixValid);
+    CPPUNIT_ASSERT(false         == tNetwork.mPcgFallback);
+    CPPUNIT_ASSERT(Gunns::DENSE  == tNetwork.mMatrixStorage);
+    CPPUNIT_ASSERT(0             == tNetwork.mAdmittanceSparse);
+    CPPUNIT_ASSERT(0             == tNetwork.mSparseLinkOffsets);
+    CPPUNIT_ASSERT(0             == tNetwork.mSparseSlots);
+    CPPUNIT_ASSERT(0             == tNetwork.mSparseMaps);
+    CPPUNIT_ASSERT(0             == tNetwork.mSparsePatternCount);
     CPPUNIT_ASSERT(1.0           == tNetwork.mConvergenceTolerance);
     CPPUNIT_ASSERT(0             == tNetwork.mNetworkSize);
     CPPUNIT_ASSERT(1             == tNetwork.mMinorStepLimit);
@@ -563,6 +620,9 @@ void UtGunns::testNominalInitialization()
         CPPUNIT_ASSERT(0         == tNetwork.mSolverGpuDense);
         CPPUNIT_ASSERT(0         == tNetwork.mSolverGpuSparse);
     }
+    CPPUNIT_ASSERT(0             != tNetwork.mSolverSparse);
+    CPPUNIT_ASSERT(0             != tNetwork.mSolverSimd);
+    CPPUNIT_ASSERT(0             != tNetwork.mSolverPcg);
     CPPUNIT_ASSERT(false         == tNetwork.mWorstCaseTiming);
     CPPUNIT_ASSERT(false         == tNetwork.mVerbose);
     CPPUNIT_ASSERT(Gunns::NORMAL == tNetwork.mSolverMode);
@@ -2032,8 +2092,10 @@ void UtGunns::testSolveIslands()
 
     CPPUNIT_ASSERT_EQUAL(2,   tNetwork.mIslandCount);
     CPPUNIT_ASSERT_EQUAL(5,   tNetwork.mIslandMaxSize);
-    CPPUNIT_ASSERT_EQUAL(0.0, tNetwork.mAdmittanceMatrixIsland[5*5]);
-    CPPUNIT_ASSERT(0.0 < tNetwork.mAdmittanceMatrixIsland[0]);
+    CPPUNIT_ASSERT(25 == tNetwork.mIslandFactors[0].size());
+    CPPUNIT_ASSERT(1  == tNetwork.mIslandFactors[4].size());
+    CPPUNIT_ASSERT(0.0 < tNetwork.mIslandFactors[0][0]);
+    verifyUndecomposedSolution();
 
     CPPUNIT_ASSERT_DOUBLES_EQUAL(120.0,                tNetwork.mPotentialVector[0],  1.0E-8);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(120.0,                tNetwork.mPotentialVector[1],  1.0E-8);
@@ -2459,8 +2521,15 @@ void UtGunns::testGpuSparseIslands()
 
     CPPUNIT_ASSERT_EQUAL(2,   tNetwork.mIslandCount);
     CPPUNIT_ASSERT_EQUAL(5,   tNetwork.mIslandMaxSize);
-    CPPUNIT_ASSERT_EQUAL(0.0, tNetwork.mAdmittanceMatrixIsland[5*5]);
-    CPPUNIT_ASSERT(0.0 < tNetwork.mAdmittanceMatrixIsland[0]);
+    if (tNetwork.isGpuEnabled()) {
+        CPPUNIT_ASSERT_EQUAL(0.0, tNetwork.mAdmittanceMatrixIsland[5*5]);
+        CPPUNIT_ASSERT(0.0 < tNetwork.mAdmittanceMatrixIsland[0]);
+    } else {
+        /// - Without a GPU, the mode is down-moded to NO_GPU, which keeps island size factors.
+        CPPUNIT_ASSERT(Gunns::NO_GPU == tNetwork.mGpuMode);
+        CPPUNIT_ASSERT(25 == tNetwork.mIslandFactors[0].size());
+        CPPUNIT_ASSERT(0.0 < tNetwork.mIslandFactors[0][0]);
+    }
 
     CPPUNIT_ASSERT_DOUBLES_EQUAL(120.0, tNetwork.mPotentialVector[0],  1.0E-8);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(120.0, tNetwork.mPotentialVector[1],  1.0E-8);
@@ -2501,8 +2570,15 @@ void UtGunns::testGpuDenseIslands()
 
     CPPUNIT_ASSERT_EQUAL(2,   tNetwork.mIslandCount);
     CPPUNIT_ASSERT_EQUAL(5,   tNetwork.mIslandMaxSize);
-    CPPUNIT_ASSERT_EQUAL(0.0, tNetwork.mAdmittanceMatrixIsland[5*5]);
-    CPPUNIT_ASSERT(0.0 < tNetwork.mAdmittanceMatrixIsland[0]);
+    if (tNetwork.isGpuEnabled()) {
+        CPPUNIT_ASSERT_EQUAL(0.0, tNetwork.mAdmittanceMatrixIsland[5*5]);
+        CPPUNIT_ASSERT(0.0 < tNetwork.mAdmittanceMatrixIsland[0]);
+    } else {
+        /// - Without a GPU, the mode is down-moded to NO_GPU, which keeps island size factors.
+        CPPUNIT_ASSERT(Gunns::NO_GPU == tNetwork.mGpuMode);
+        CPPUNIT_ASSERT(25 == tNetwork.mIslandFactors[0].size());
+        CPPUNIT_ASSERT(0.0 < tNetwork.mIslandFactors[0][0]);
+    }
 
     CPPUNIT_ASSERT_DOUBLES_EQUAL(120.0, tNetwork.mPotentialVector[0],  1.0E-8);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(120.0, tNetwork.mPotentialVector[1],  1.0E-8);
@@ -2514,6 +2590,1063 @@ void UtGunns::testGpuDenseIslands()
     std::cout << "... Pass";
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the SPARSE admittance matrix storage mode.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testSparseStorage()
+{
+    std::cout << "\n UtGunns ................ 36: testSparseStorage .....................";
+
+    setupIslandNetwork();
+    tNetwork.setIslandMode(Gunns::SOLVE);
+    tNetwork.setWorstCaseTiming(true);
+
+    /// - Verify the sparse pattern was built from the link maps during initialization: the 6
+    ///   diagonals and 4 conductors between non-Ground nodes.
+    const SparseCsrMatrix* sparse = tNetwork.mAdmittanceSparse;
+    CPPUNIT_ASSERT(0  != sparse);
+    CPPUNIT_ASSERT(1  == tNetwork.mSparsePatternCount);
+    CPPUNIT_ASSERT(6  == sparse->getSize());
+    CPPUNIT_ASSERT(14 == sparse->getNnz());
+    CPPUNIT_ASSERT(0  == tNetwork.mSparseLinkOffsets[0]);
+    CPPUNIT_ASSERT(20 == tNetwork.mSparseLinkOffsets[tNetwork.mNumLinks]);
+
+    /// - Verify the Ground node entries of the potential source are omitted from the slots.
+    const int potentialOffset = tNetwork.mSparseLinkOffsets[4];
+    CPPUNIT_ASSERT(-1 == tNetwork.mSparseSlots[potentialOffset + 0]);
+    CPPUNIT_ASSERT(-1 == tNetwork.mSparseSlots[potentialOffset + 1]);
+    CPPUNIT_ASSERT(-1 == tNetwork.mSparseSlots[potentialOffset + 2]);
+    CPPUNIT_ASSERT(sparse->getDiagonalSlots()[5] == tNetwork.mSparseSlots[potentialOffset + 3]);
+
+    /// - Step in DUMMY mode, which doesn't decompose, in both storage modes and verify the
+    ///   identical assembled & conditioned matrix.
+    tNetwork.setDummyMode();
+    tNetwork.step(tDeltaTime);
+    double denseA[36];
+    double denseX[6];
+    for (int i = 0; i < 36; ++i) {
+        denseA[i] = tNetwork.mAdmittanceMatrix[i];
+    }
+    tNetwork.setMatrixStorage(Gunns::SPARSE);
+    CPPUNIT_ASSERT(Gunns::SPARSE == tNetwork.mMatrixStorage);
+    CPPUNIT_ASSERT(tNetwork.mRebuild);
+    tNetwork.step(tDeltaTime);
+    const double* sparseA = tNetwork.getAdmittanceMatrix();
+    for (int i = 0; i < 36; ++i) {
+        CPPUNIT_ASSERT_EQUAL(denseA[i], sparseA[i]);
+    }
+    CPPUNIT_ASSERT(0 == tNetwork.mSolverSparse->getAnalysisCount());
+
+    /// - Step in NORMAL mode in DENSE storage and save the solution.
+    tNetwork.setNormalMode();
+    tNetwork.setMatrixStorage(Gunns::DENSE);
+    tNetwork.step(tDeltaTime);
+    for (int i = 0; i < 6; ++i) {
+        denseX[i] = tNetwork.mPotentialVector[i];
+    }
+
+    /// - Step in SPARSE storage and verify the same solution from the sparse solver.  The dense
+    ///   matrix isn't loaded during the step, and is expanded un-decomposed on demand.
+    tNetwork.setMatrixStorage(Gunns::SPARSE);
+    tNetwork.mAdmittanceMatrix[3] = 99.0;
+    tNetwork.step(tDeltaTime);
+    for (int i = 0; i < 6; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(denseX[i], tNetwork.mPotentialVector[i], 1.0E-10);
+    }
+    CPPUNIT_ASSERT(1 == tNetwork.mSparsePatternCount);
+    CPPUNIT_ASSERT(1 == tNetwork.mSolverSparse->getAnalysisCount());
+    CPPUNIT_ASSERT(99.0 == tNetwork.mAdmittanceMatrix[3]);
+    CPPUNIT_ASSERT(-1.0 / 1750.0 == tNetwork.getAdmittanceMatrix()[3]);
+
+    /// - Verify debugging keeps the dense matrix loaded during the step in SPARSE storage.
+    tNetwork.mAdmittanceMatrix[3] = 99.0;
+    tNetwork.mDebugDesiredStep    = -1;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(-1.0 / 1750.0 == tNetwork.mAdmittanceMatrix[3]);
+    tNetwork.mDebugDesiredStep    = 0;
+
+    /// - Verify the sparse matrix holds the conditioned values of the non-capacitive isolated
+    ///   node 4.
+    const int diag4 = sparse->getDiagonalSlots()[4];
+    CPPUNIT_ASSERT(0.0 < sparse->getValues()[diag4]);
+    CPPUNIT_ASSERT(-1.0 / 1750.0 == sparse->getValues()[sparse->findSlot(0, 3)]);
+
+    /// - Verify a new decomposition with the same topology re-uses the sparse solver analysis.
+    tPotential.mMalfBlockageFlag  = true;
+    tPotential.mMalfBlockageValue = 1.0E-14;
+    const int decompositions = tNetwork.mDecompositionCount;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(decompositions < tNetwork.mDecompositionCount);
+    CPPUNIT_ASSERT(1 == tNetwork.mSolverSparse->getAnalysisCount());
+
+    /// - Move a conductor port and verify the pattern is rebuilt with the new connection, the
+    ///   sparse solver repeats its analysis, node 4 joins the island of nodes 1, 2 & 5, and the new
+    ///   solution matches DENSE storage.
+    CPPUNIT_ASSERT(tConductor3.setPort(1, 4));
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(2  == tNetwork.mSparsePatternCount);
+    CPPUNIT_ASSERT(2  == tNetwork.mSolverSparse->getAnalysisCount());
+    CPPUNIT_ASSERT(14 == sparse->getNnz());
+    CPPUNIT_ASSERT(-1 == sparse->findSlot(2, 3));
+    CPPUNIT_ASSERT(-1 != sparse->findSlot(2, 4));
+    CPPUNIT_ASSERT(2  == tNetwork.mIslandCount);
+    CPPUNIT_ASSERT(1  == tNetwork.mNodeIslandNumbers[4]);
+    for (int i = 0; i < 6; ++i) {
+        denseX[i] = tNetwork.mPotentialVector[i];
+    }
+
+    tNetwork.setMatrixStorage(Gunns::DENSE);
+    tNetwork.step(tDeltaTime);
+    for (int i = 0; i < 6; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(denseX[i], tNetwork.mPotentialVector[i], 1.0E-10);
+    }
+    CPPUNIT_ASSERT(2 == tNetwork.mSparsePatternCount);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the full & incremental union-find island builds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testIslandUnionFind()
+{
+    std::cout << "\n UtGunns ................ 37: testIslandUnionFind ...................";
+
+    setupIslandNetwork();
+    tNetwork.setIslandMode(Gunns::FIND);
+    CPPUNIT_ASSERT(0 != tNetwork.mIslandParent);
+    CPPUNIT_ASSERT(0 != tNetwork.mIslandConnections);
+
+    /// - The first pass does a full build.
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(1 == tNetwork.mIslandFullBuilds);
+    CPPUNIT_ASSERT(0 == tNetwork.mIslandIncrementalBuilds);
+    CPPUNIT_ASSERT(1 == tNetwork.mIslandPatternCount);
+    CPPUNIT_ASSERT(2 == tNetwork.mIslandCount);
+    CPPUNIT_ASSERT(5 == tNetwork.mIslandMaxSize);
+
+    /// - A rebuild with no connection changes leaves the islands alone.
+    tPotential.mMalfBlockageFlag  = true;
+    tPotential.mMalfBlockageValue = 1.0E-14;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(1 == tNetwork.mIslandFullBuilds);
+    CPPUNIT_ASSERT(0 == tNetwork.mIslandIncrementalBuilds);
+    CPPUNIT_ASSERT(2 == tNetwork.mIslandCount);
+
+    /// - Breaking the 2-3 conductor splits nodes 0 & 3 off into their own island, which needs a
+    ///   full build.
+    tConductor3.setDefaultConductivity(0.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(2 == tNetwork.mIslandFullBuilds);
+    CPPUNIT_ASSERT(0 == tNetwork.mIslandIncrementalBuilds);
+    CPPUNIT_ASSERT(3 == tNetwork.mIslandCount);
+    CPPUNIT_ASSERT(3 == tNetwork.mIslandMaxSize);
+    CPPUNIT_ASSERT(0 == tNetwork.mNodeIslandNumbers[0]);
+    CPPUNIT_ASSERT(1 == tNetwork.mNodeIslandNumbers[1]);
+    CPPUNIT_ASSERT(1 == tNetwork.mNodeIslandNumbers[2]);
+    CPPUNIT_ASSERT(0 == tNetwork.mNodeIslandNumbers[3]);
+    CPPUNIT_ASSERT(4 == tNetwork.mNodeIslandNumbers[4]);
+    CPPUNIT_ASSERT(1 == tNetwork.mNodeIslandNumbers[5]);
+    CPPUNIT_ASSERT(2 == tNetwork.mIslandVectors[0].size());
+    CPPUNIT_ASSERT(2 == tNetwork.mIslandVectors[1][1]);
+    CPPUNIT_ASSERT(0 == tNetwork.mIslandVectors[3].size());
+    CPPUNIT_ASSERT(&tNetwork.mIslandVectors[1] == tBasicNodes[2].mIslandVector);
+
+    /// - Restoring the conductor merges the islands incrementally, with the lowest island number.
+    tConductor3.setDefaultConductivity(1.0/10000.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(2 == tNetwork.mIslandFullBuilds);
+    CPPUNIT_ASSERT(1 == tNetwork.mIslandIncrementalBuilds);
+    CPPUNIT_ASSERT(2 == tNetwork.mIslandCount);
+    CPPUNIT_ASSERT(5 == tNetwork.mIslandMaxSize);
+    for (int node = 0; node < 6; ++node) {
+        const int island = (4 == node) ? 4 : 0;
+        CPPUNIT_ASSERT(island == tNetwork.mNodeIslandNumbers[node]);
+        CPPUNIT_ASSERT(&tNetwork.mIslandVectors[island] == tBasicNodes[node].mIslandVector);
+    }
+    CPPUNIT_ASSERT(0 == tNetwork.mIslandVectors[1].size());
+
+    /// - Turning islands off and on again forces a full build.
+    tNetwork.setIslandMode(Gunns::OFF);
+    tPotential.mMalfBlockageValue = 2.0E-14;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(-1 == tNetwork.mIslandPatternCount);
+    tNetwork.setIslandMode(Gunns::FIND);
+    tPotential.mMalfBlockageValue = 3.0E-14;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(3 == tNetwork.mIslandFullBuilds);
+    CPPUNIT_ASSERT(2 == tNetwork.mIslandCount);
+
+    /// - Moving a port changes the sparse pattern and forces a full build, even though only a new
+    ///   connection is made, joining node 4 to the other island.
+    CPPUNIT_ASSERT(tConductor3.setPort(1, 4));
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(4 == tNetwork.mIslandFullBuilds);
+    CPPUNIT_ASSERT(2 == tNetwork.mIslandPatternCount);
+    CPPUNIT_ASSERT(2 == tNetwork.mIslandCount);
+    CPPUNIT_ASSERT(1 == tNetwork.mNodeIslandNumbers[4]);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests parallel decomposition & solution of islands on worker threads, against the
+///           serial island solution.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testParallelIslands()
+{
+    std::cout << "\n UtGunns ................ 38: testParallelIslands ...................";
+
+    setupIslandNetwork();
+    tNetwork.setIslandMode(Gunns::SOLVE);
+    const int N = tNetwork.mNetworkSize;
+
+    /// - Sweep the conductances over a wide range, including 0 to split more islands, and verify
+    ///   the island decompositions and solution are identical between serial and parallel.
+    tConductor2.setDefaultConductivity(0.0);
+    for (int exp1=-8; exp1<9; exp1+=4) {
+        tConductor1.setDefaultConductivity(powf(10.0, exp1));
+        for (int exp3=-8; exp3<13; exp3+=4) {
+            tConductor3.setDefaultConductivity(powf(10.0, exp3));
+            if (12 == exp3) tConductor3.setDefaultConductivity(0.0);
+
+            tNetwork.setIslandThreads(1);
+            tNetwork.mRebuild = true;
+            CPPUNIT_ASSERT_NO_THROW(tNetwork.step(tDeltaTime));
+            const std::vector<double> serialA(tNetwork.mAdmittanceMatrix,
+                                              tNetwork.mAdmittanceMatrix + N*N);
+            const std::vector<double> serialP(tNetwork.mPotentialVector,
+                                              tNetwork.mPotentialVector + N);
+            const std::vector< std::vector<double> > serialFactors(tNetwork.mIslandFactors);
+
+            tNetwork.setIslandThreads(3);
+            tNetwork.mRebuild = true;
+            CPPUNIT_ASSERT_NO_THROW(tNetwork.step(tDeltaTime));
+            for (int i = 0; i < N*N; ++i) {
+                CPPUNIT_ASSERT(serialA[i] == tNetwork.mAdmittanceMatrix[i]);
+            }
+            for (int i = 0; i < N; ++i) {
+                CPPUNIT_ASSERT(serialP[i] == tNetwork.mPotentialVector[i]);
+                CPPUNIT_ASSERT(serialFactors[i] == tNetwork.mIslandFactors[i]);
+            }
+        }
+    }
+
+    /// - Verify the tasks are listed largest island first, and the worker scratch is sized for the
+    ///   largest island.
+    CPPUNIT_ASSERT(3 == tNetwork.mIslandPool.getNumWorkers());
+    CPPUNIT_ASSERT(4 == tNetwork.mIslandCount);
+    CPPUNIT_ASSERT(4 == tNetwork.mIslandTasks.size());
+    CPPUNIT_ASSERT(1 == tNetwork.mIslandTasks[0]);
+    CPPUNIT_ASSERT(0 == tNetwork.mIslandTasks[1]);
+    CPPUNIT_ASSERT(3 == tNetwork.mIslandTasks[2]);
+    CPPUNIT_ASSERT(4 == tNetwork.mIslandTasks[3]);
+    CPPUNIT_ASSERT(3 == tNetwork.mIslandWorkerVectors.size());
+    CPPUNIT_ASSERT(6 <= tNetwork.mIslandWorkerVectors[2].size());
+
+    /// - Verify the serial paths are used in SPARSE storage, which doesn't list island tasks.
+    tNetwork.mIslandTasks.clear();
+    tNetwork.setMatrixStorage(Gunns::SPARSE);
+    CPPUNIT_ASSERT_NO_THROW(tNetwork.step(tDeltaTime));
+    CPPUNIT_ASSERT(tNetwork.mIslandTasks.empty());
+    tNetwork.setMatrixStorage(Gunns::DENSE);
+
+    /// - Verify returning to one thread stops the workers.
+    tNetwork.setIslandThreads(0);
+    CPPUNIT_ASSERT(1 == tNetwork.mIslandPool.getNumWorkers());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests updating the saved dense decomposition in place of full decompositions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testFactorUpdates()
+{
+    std::cout << "\n UtGunns ................ 39: testFactorUpdates .....................";
+
+    setupIslandNetwork();
+    tNetwork.setFactorUpdateOptions(2, 3);
+    CPPUNIT_ASSERT(2     == tNetwork.mFactorRankLimit);
+    CPPUNIT_ASSERT(3     == tNetwork.mFactorRefreshLimit);
+    CPPUNIT_ASSERT(false == tNetwork.mFactorValid);
+
+    /// - The first decomposition is full, and saves the matrix and its decomposition.
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(1    == tNetwork.mFactorFullCount);
+    CPPUNIT_ASSERT(0    == tNetwork.mFactorUpdateCount);
+    CPPUNIT_ASSERT(true == tNetwork.mFactorValid);
+    CPPUNIT_ASSERT(36   == tNetwork.mFactorLdu.size());
+    verifyFactorUpdate();
+
+    /// - A conductance change between two nodes is one update, as is a change to ground.
+    tConductor1.setDefaultConductivity(0.5);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(1 == tNetwork.mFactorFullCount);
+    CPPUNIT_ASSERT(1 == tNetwork.mFactorUpdateCount);
+    CPPUNIT_ASSERT(1 == tNetwork.mFactorUpdateRanks);
+    CPPUNIT_ASSERT(1 == tNetwork.mFactorUpdatesSinceFull);
+    CPPUNIT_ASSERT(1 == tNetwork.mFactorUpdateNodes[0]);
+    CPPUNIT_ASSERT(2 == tNetwork.mFactorUpdateNodes[1]);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-0.5, tNetwork.mFactorUpdateWeights[0], DBL_EPSILON);
+    verifyFactorUpdate();
+
+    tPotential.mMalfBlockageFlag  = true;
+    tPotential.mMalfBlockageValue = 0.5;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(2  == tNetwork.mFactorUpdateCount);
+    CPPUNIT_ASSERT(2  == tNetwork.mFactorUpdateRanks);
+    CPPUNIT_ASSERT(5  == tNetwork.mFactorUpdateNodes[0]);
+    CPPUNIT_ASSERT(-1 == tNetwork.mFactorUpdateNodes[1]);
+    verifyFactorUpdate();
+
+    /// - Two changes together are two updates.
+    tConductor2.setDefaultConductivity(1.0/1000.0);
+    tConductor3.setDefaultConductivity(1.0/1000.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(3 == tNetwork.mFactorUpdateCount);
+    CPPUNIT_ASSERT(4 == tNetwork.mFactorUpdateRanks);
+    CPPUNIT_ASSERT(3 == tNetwork.mFactorUpdatesSinceFull);
+    verifyFactorUpdate();
+
+    /// - The refresh limit forces a full decomposition, which isn't counted as a fallback.
+    tConductor1.setDefaultConductivity(1.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(2 == tNetwork.mFactorFullCount);
+    CPPUNIT_ASSERT(3 == tNetwork.mFactorUpdateCount);
+    CPPUNIT_ASSERT(0 == tNetwork.mFactorUpdatesSinceFull);
+    CPPUNIT_ASSERT(0 == tNetwork.mFactorFallbackCount);
+    verifyFactorUpdate();
+
+    /// - Exceeding the rank limit falls back to a full decomposition.
+    tConductor1.setDefaultConductivity(2.0);
+    tConductor2.setDefaultConductivity(1.0/2000.0);
+    tConductor3.setDefaultConductivity(1.0/2000.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(3 == tNetwork.mFactorFullCount);
+    CPPUNIT_ASSERT(3 == tNetwork.mFactorUpdateCount);
+    CPPUNIT_ASSERT(1 == tNetwork.mFactorFallbackCount);
+    verifyFactorUpdate();
+
+    /// - A downdate that reduces a conductance.  Removing the conductor leaves nodes 0 & 3
+    ///   floating, and the downdate that would make them singular falls back to a full
+    ///   decomposition.
+    tConductor3.setDefaultConductivity(1.0/20000.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(4 == tNetwork.mFactorUpdateCount);
+    verifyFactorUpdate();
+    tConductor3.setDefaultConductivity(0.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(4 == tNetwork.mFactorFullCount);
+    CPPUNIT_ASSERT(2 == tNetwork.mFactorFallbackCount);
+    verifyFactorUpdate();
+
+    /// - Other decomposition paths leave the saved decomposition stale, and restart forces a full
+    ///   decomposition.
+    tNetwork.setIslandMode(Gunns::SOLVE);
+    tConductor3.setDefaultConductivity(1.0/10000.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(false == tNetwork.mFactorValid);
+    tNetwork.setIslandMode(Gunns::OFF);
+    tConductor3.setDefaultConductivity(1.0/20000.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(5    == tNetwork.mFactorFullCount);
+    CPPUNIT_ASSERT(true == tNetwork.mFactorValid);
+    tNetwork.restart();
+    CPPUNIT_ASSERT(false == tNetwork.mFactorValid);
+
+    /// - Disabling the updates releases the saved decomposition.
+    tNetwork.setFactorUpdateOptions(0, 3);
+    CPPUNIT_ASSERT(0 == tNetwork.mFactorRankLimit);
+    CPPUNIT_ASSERT(0 == tNetwork.mFactorRefreshLimit);
+    CPPUNIT_ASSERT(0 == tNetwork.mFactorLdu.size());
+    tConductor3.setDefaultConductivity(1.0/10000.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(5 == tNetwork.mFactorFullCount);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Verifies the network's decomposition and solution match a full decomposition of the
+///           saved matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::verifyFactorUpdate()
+{
+    const int N = tNetwork.mNetworkSize;
+    std::vector<double> A(tNetwork.mFactorMatrix);
+    std::vector<double> x(N, 0.0);
+    CholeskyLdu cholesky;
+    cholesky.Decompose(&A[0], N);
+    cholesky.Solve(&A[0], tNetwork.mSourceVector, &x[0], N);
+    for (int i = 0; i < N*N; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(A[i], tNetwork.mFactorLdu[i],
+                                     1.0E-9 * std::max(1.0, std::fabs(A[i])));
+        CPPUNIT_ASSERT(tNetwork.mFactorLdu[i] == tNetwork.mAdmittanceMatrix[i]);
+    }
+    for (int i = 0; i < N; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(x[i], tNetwork.mPotentialVector[i],
+                                     1.0E-9 * std::max(1.0, std::fabs(x[i])));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests keeping and re-using island decompositions in SOLVE island mode.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testIslandFactorCaching()
+{
+    std::cout << "\n UtGunns ................ 40: testIslandFactorCaching ...............";
+
+    setupIslandNetwork();
+    tNetwork.setIslandMode(Gunns::SOLVE);
+    tNetwork.setIslandFactorCaching(true);
+    CPPUNIT_ASSERT(true == tNetwork.mIslandCaching);
+
+    /// - The first decomposition decomposes both islands, and leaves the main matrix
+    ///   un-decomposed.
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(2 == tNetwork.mIslandFactorDecompositions);
+    CPPUNIT_ASSERT(0 == tNetwork.mIslandFactorReuses);
+    CPPUNIT_ASSERT(0 == tNetwork.mChangedLinks.size());
+    CPPUNIT_ASSERT(25 == tNetwork.mIslandFactors[0].size());
+    CPPUNIT_ASSERT(1  == tNetwork.mIslandFactors[4].size());
+    CPPUNIT_ASSERT(tNetwork.mIslandVectors[0] == tNetwork.mIslandFactorNodes[0]);
+    CPPUNIT_ASSERT(-1.0 == tNetwork.mAdmittanceMatrix[1*6 + 2]);
+    verifyUndecomposedSolution();
+
+    /// - Removing the 2-3 conductor splits off nodes 0 & 3, and all islands whose nodes changed are
+    ///   decomposed.  Island 4 is re-used.
+    tConductor3.setDefaultConductivity(0.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(4 == tNetwork.mIslandFactorDecompositions);
+    CPPUNIT_ASSERT(1 == tNetwork.mIslandFactorReuses);
+    CPPUNIT_ASSERT(3 == tNetwork.mIslandCount);
+    verifyUndecomposedSolution();
+
+    /// - Changing the 0-3 conductor only decomposes its own island.
+    tConductor2.setDefaultConductivity(1.0/1000.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(5 == tNetwork.mIslandFactorDecompositions);
+    CPPUNIT_ASSERT(3 == tNetwork.mIslandFactorReuses);
+    CPPUNIT_ASSERT(tNetwork.mIslandFactorStale[1] == 0);
+    verifyUndecomposedSolution();
+
+    /// - A forced rebuild with no changed links re-uses all islands.
+    tNetwork.mRebuild = true;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(5 == tNetwork.mIslandFactorDecompositions);
+    CPPUNIT_ASSERT(6 == tNetwork.mIslandFactorReuses);
+    verifyUndecomposedSolution();
+
+    /// - Same with parallel islands, which only decompose the changed island.
+    tNetwork.setIslandThreads(3);
+    tConductor1.setDefaultConductivity(0.5);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(6 == tNetwork.mIslandFactorDecompositions);
+    CPPUNIT_ASSERT(8 == tNetwork.mIslandFactorReuses);
+    verifyUndecomposedSolution();
+    tNetwork.setIslandThreads(1);
+
+    /// - A port move changes the pattern, and all islands are decomposed.
+    CPPUNIT_ASSERT(tConductor3.setPort(1, 4));
+    tConductor3.setDefaultConductivity(1.0/10000.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(2 == tNetwork.mIslandCount);
+    CPPUNIT_ASSERT(8 == tNetwork.mIslandFactorDecompositions);
+    CPPUNIT_ASSERT(8 == tNetwork.mIslandFactorReuses);
+    verifyUndecomposedSolution();
+
+    /// - Another decomposition path or a restart discards the kept decompositions.
+    tNetwork.setIslandMode(Gunns::OFF);
+    tNetwork.mRebuild = true;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(tNetwork.mIslandFactorNodes.empty());
+    tNetwork.setIslandMode(Gunns::SOLVE);
+    tNetwork.mRebuild = true;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(10 == tNetwork.mIslandFactorDecompositions);
+    verifyUndecomposedSolution();
+    tNetwork.restart();
+    CPPUNIT_ASSERT(tNetwork.mIslandFactorNodes.empty());
+
+    /// - Disabling decomposes all islands again, into the same kept decompositions.
+    tNetwork.setIslandFactorCaching(false);
+    CPPUNIT_ASSERT(false == tNetwork.mIslandCaching);
+    CPPUNIT_ASSERT(tNetwork.mIslandFactorNodes.empty());
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(12 == tNetwork.mIslandFactorDecompositions);
+    tNetwork.mRebuild = true;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(14 == tNetwork.mIslandFactorDecompositions);
+    CPPUNIT_ASSERT(8  == tNetwork.mIslandFactorReuses);
+    verifyUndecomposedSolution();
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Verifies the network solution matches a solution of the whole un-decomposed
+///           admittance matrix, for the solution methods that leave it un-decomposed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::verifyUndecomposedSolution()
+{
+    const int N = tNetwork.mNetworkSize;
+    std::vector<double> A(tNetwork.mAdmittanceMatrix, tNetwork.mAdmittanceMatrix + N*N);
+    std::vector<double> x(N, 0.0);
+    CholeskyLdu cholesky;
+    cholesky.Decompose(&A[0], N);
+    cholesky.Solve(&A[0], tNetwork.mSourceVector, &x[0], N);
+    for (int i = 0; i < N; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(x[i], tNetwork.mPotentialVector[i],
+                                     1.0E-9 * std::max(1.0, std::fabs(x[i])));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the vectorized CPU dense decomposition & solution options.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testSimdSolver()
+{
+    std::cout << "\n UtGunns ................ 41: testSimdSolver ........................";
+
+    /// - Get the nominal solution with the scalar solver.
+    setupIslandNetwork();
+    tNetwork.step(tDeltaTime);
+    const int N = tNetwork.mNetworkSize;
+    std::vector<double> expected(tNetwork.mPotentialVector, tNetwork.mPotentialVector + N);
+
+    /// - The vectorized solver gives the same solution of the whole network.
+    tNetwork.setSimdOptions(Gunns::SIMD_DENSE, 2);
+    CPPUNIT_ASSERT(Gunns::SIMD_DENSE == tNetwork.mSimdMode);
+    CPPUNIT_ASSERT(2                 == tNetwork.mSimdSizeThreshold);
+    tNetwork.mPotentialVector[1] = 0.0;
+    tNetwork.mRebuild = true;
+    tNetwork.step(tDeltaTime);
+    verifyPotentials(expected);
+
+    /// - Same with islands, serial, cached and parallel.  The size 1 island uses the scalar solver.
+    tNetwork.setIslandMode(Gunns::SOLVE);
+    tNetwork.mRebuild = true;
+    tNetwork.step(tDeltaTime);
+    verifyPotentials(expected);
+    tNetwork.setIslandFactorCaching(true);
+    tNetwork.mRebuild = true;
+    tNetwork.step(tDeltaTime);
+    verifyPotentials(expected);
+    tNetwork.setIslandThreads(2);
+    tNetwork.mRebuild = true;
+    tNetwork.step(tDeltaTime);
+    verifyPotentials(expected);
+    tNetwork.setIslandThreads(1);
+    tNetwork.setIslandFactorCaching(false);
+
+    /// - Sizes below the threshold and NO_SIMD mode return to the scalar solver.
+    tNetwork.setSimdOptions(Gunns::SIMD_DENSE, 100);
+    tNetwork.mRebuild = true;
+    tNetwork.step(tDeltaTime);
+    verifyPotentials(expected);
+    tNetwork.setSimdOptions(Gunns::NO_SIMD, 2);
+    CPPUNIT_ASSERT(Gunns::NO_SIMD == tNetwork.mSimdMode);
+    tNetwork.setIslandMode(Gunns::OFF);
+    tNetwork.mRebuild = true;
+    tNetwork.step(tDeltaTime);
+    verifyPotentials(expected);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] expected (--) Expected node potentials.
+///
+/// @details  Verifies the network potentials match the expected values to within round-off.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::verifyPotentials(const std::vector<double>& expected)
+{
+    for (int i = 0; i < tNetwork.mNetworkSize; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[i], tNetwork.mPotentialVector[i],
+                                     1.0E-9 * std::max(1.0, std::fabs(expected[i])));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the preconditioned conjugate gradient iterative solution method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testConjugateGradient()
+{
+    std::cout << "\n UtGunns ................ 42: testConjugateGradient .................";
+
+    setupIslandNetwork();
+    tNetwork.step(tDeltaTime);
+    const int decompositions = tNetwork.mDecompositionCount;
+
+    /// - Switching to PCG rebuilds and loads the matrix in place of a decomposition, and solves it
+    ///   iteratively.
+    tNetwork.setIterativeOptions(Gunns::PCG_JACOBI, 50, 1.0E-12);
+    CPPUNIT_ASSERT(Gunns::PCG_JACOBI == tNetwork.mIterativeMethod);
+    CPPUNIT_ASSERT(50                == tNetwork.mPcgMaxIter);
+    CPPUNIT_ASSERT(1.0E-12           == tNetwork.mPcgTolerance);
+    CPPUNIT_ASSERT(true              == tNetwork.mRebuild);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(decompositions == tNetwork.mDecompositionCount);
+    CPPUNIT_ASSERT(true           == tNetwork.mPcgMatrixValid);
+    CPPUNIT_ASSERT(0              <= tNetwork.mPcgLastIteration);
+    CPPUNIT_ASSERT(ConjugateGradient::JACOBI == tNetwork.mSolverPcg->getAppliedPreconditioner());
+    verifyUndecomposedSolution();
+
+    /// - An unchanged network starts from the converged solution and takes no iterations, without
+    ///   rebuilding the matrix.
+    const int iterations = tNetwork.mPcgIterationCount;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(0          == tNetwork.mPcgLastIteration);
+    CPPUNIT_ASSERT(iterations == tNetwork.mPcgIterationCount);
+    verifyUndecomposedSolution();
+
+    /// - A changed link rebuilds and re-loads the matrix, with incomplete Cholesky.  The source
+    ///   potential also changes, since all nodes float at it.
+    tNetwork.setIterativeOptions(Gunns::PCG_IC, 50, 1.0E-12);
+    tConductor1.setDefaultConductivity(0.5);
+    tPotential.setSourcePotential(100.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(0 < tNetwork.mPcgLastIteration);
+    CPPUNIT_ASSERT(ConjugateGradient::INCOMPLETE_CHOLESKY
+                   == tNetwork.mSolverPcg->getAppliedPreconditioner());
+    CPPUNIT_ASSERT(decompositions == tNetwork.mDecompositionCount);
+    verifyUndecomposedSolution();
+
+    /// - Same in SPARSE storage.
+    tNetwork.setMatrixStorage(Gunns::SPARSE);
+    tConductor1.setDefaultConductivity(0.25);
+    tPotential.setSourcePotential(110.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(0 < tNetwork.mPcgLastIteration);
+    verifyUndecomposedSolution();
+    tNetwork.setMatrixStorage(Gunns::DENSE);
+
+    /// - Network capacitance requests are solved by PCG too, and match the direct method.
+    tBasicNodes[1].setNetworkCapacitanceRequest(1.0);
+    tNetwork.mRebuild = true;
+    tNetwork.step(tDeltaTime);
+    const double pcgCapacitance = tBasicNodes[1].getNetworkCapacitance();
+    CPPUNIT_ASSERT(0.0 < pcgCapacitance);
+    tNetwork.setIterativeOptions(Gunns::DIRECT, 50, 1.0E-12);
+    tBasicNodes[1].setNetworkCapacitanceRequest(1.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(false == tNetwork.mPcgMatrixValid);
+    CPPUNIT_ASSERT(decompositions + 1 == tNetwork.mDecompositionCount);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tBasicNodes[1].getNetworkCapacitance(), pcgCapacitance,
+                                 1.0E-6 * pcgCapacitance);
+    std::vector<double> expected(tNetwork.mPotentialVector,
+                                 tNetwork.mPotentialVector + tNetwork.mNetworkSize);
+
+    /// - A failure to converge reverts to a decomposition until the next rebuild.
+    tNetwork.setIterativeOptions(Gunns::PCG_JACOBI, 0, 1.0E-15);
+    CPPUNIT_ASSERT(1 == tNetwork.mPcgMaxIter);
+    for (int node = 0; node < tNetwork.mNetworkSize; ++node) {
+        tNetwork.mMajorPotentialVector[node] = 0.0;
+    }
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(1    == tNetwork.mPcgFailCount);
+    CPPUNIT_ASSERT(true == tNetwork.mPcgFallback);
+    CPPUNIT_ASSERT(-1   == tNetwork.mPcgLastIteration);
+    CPPUNIT_ASSERT(decompositions + 2 == tNetwork.mDecompositionCount);
+    verifyPotentials(expected);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(1 == tNetwork.mPcgFailCount);
+    CPPUNIT_ASSERT(decompositions + 2 == tNetwork.mDecompositionCount);
+    verifyPotentials(expected);
+
+    /// - The next rebuild returns to PCG.
+    tNetwork.setIterativeOptions(Gunns::PCG_JACOBI, 50, 1.0E-12);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(false == tNetwork.mPcgFallback);
+    CPPUNIT_ASSERT(0     <= tNetwork.mPcgLastIteration);
+    verifyPotentials(expected);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests parallel link stepping.  A non-linear ladder network is run serially and in
+///           parallel, and the node potentials of every step must be identical.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testParallelLinks()
+{
+    std::cout << "\n UtGunns ................ 43: testParallelLinks .....................";
+
+    /// - Links that write to their nodes in step, or read and write other links, declare
+    ///   themselves serial-only.
+    GunnsFluidCapacitor            fluidCapacitor;
+    GunnsThermalPhaseChangeBattery battery;
+    GunnsElectConverterInput       converterInput;
+    GunnsElectConverterOutput      converterOutput;
+    CPPUNIT_ASSERT(true  == fluidCapacitor.isSerialOnly());
+    CPPUNIT_ASSERT(true  == battery.isSerialOnly());
+    CPPUNIT_ASSERT(true  == converterInput.isSerialOnly());
+    CPPUNIT_ASSERT(true  == converterOutput.isSerialOnly());
+    CPPUNIT_ASSERT(false == tConductor1.isSerialOnly());
+
+    /// - Serial reference.
+    std::vector<double> serialPotentials;
+    int                 serialTasks = 0;
+    runLadderNetwork(serialPotentials, serialTasks, 1);
+    CPPUNIT_ASSERT(0 == serialTasks);
+    CPPUNIT_ASSERT(not serialPotentials.empty());
+
+    /// - Parallel runs with different numbers of threads have identical potentials.
+    for (int threads = 2; threads <= 4; threads += 2) {
+        std::vector<double> parallelPotentials;
+        int                 parallelTasks = 0;
+        runLadderNetwork(parallelPotentials, parallelTasks, threads);
+        CPPUNIT_ASSERT(0 < parallelTasks);
+        CPPUNIT_ASSERT(serialPotentials.size() == parallelPotentials.size());
+        for (unsigned int i = 0; i < serialPotentials.size(); ++i) {
+            CPPUNIT_ASSERT(serialPotentials[i] == parallelPotentials[i]);
+        }
+    }
+
+    /// - Setting fewer than 2 threads returns to serial stepping.
+    tNetwork.setLinkThreads(4);
+    CPPUNIT_ASSERT(4 == tNetwork.mLinkPool.getNumWorkers());
+    tNetwork.setLinkThreads(1);
+    CPPUNIT_ASSERT(1 == tNetwork.mLinkPool.getNumWorkers());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] potentials    (--) Node potentials of every step, appended in order.
+/// @param[out] parallelTasks (--) Number of parallel link tasks run by the network.
+/// @param[in]  threads       (--) Number of link threads.
+/// @param[in]  incrementalLimit (--) Incremental admittance build refresh limit, 0 for none, and
+///                                   incremental source vector assembly when not 0.
+///
+/// @details  Builds a ladder network of conductors, with a capacitor at every node and a constant
+///           power load at every third node, some capacitors serial-only, runs it with the given
+///           number of link threads, and records the node potentials of every step.  The ladder
+///           also has a phase change battery, which sets its node's potential in step, and a
+///           converter input & output pair in the same network, which read and write each other in
+///           minorStep.  The converter output supplies a resistive load on its own node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::runLadderNetwork(std::vector<double>& potentials, int& parallelTasks,
+                               const int threads, const int incrementalLimit)
+{
+    const int N      = 24;
+    const int OUTPUT = N;
+    const int GROUND = N + 1;
+    std::ostringstream prefix;
+    prefix << "Ladder" << threads;
+
+    GunnsBasicNode nodes[N + 2];
+    for (int i = 0; i <= GROUND; ++i) {
+        std::ostringstream name;
+        name << prefix.str() << ".Node" << i;
+        nodes[i].initialize(name.str());
+    }
+    GunnsNodeList nodeList;
+    nodeList.mNumNodes = N + 2;
+    nodeList.mNodes    = nodes;
+
+    GunnsUnitTest network;
+    network.initializeNodes(nodeList);
+    std::vector<GunnsBasicLink*> links;
+
+    GunnsBasicPotential           source;
+    GunnsBasicPotentialConfigData sourceConfig(prefix.str() + ".VS", &nodeList, 1.0E14);
+    GunnsBasicPotentialInputData  sourceInput(false, 0.0, -120.0);
+    source.initialize(sourceConfig, sourceInput, links, 0, GROUND);
+
+    GunnsBasicConductor           conductors[N - 1];
+    GunnsBasicCapacitor           capacitors[N];
+    EpsConstantPowerLoad          loads[N / 3];
+    GunnsBasicConductorInputData  conductorInput(false, 0.0);
+    EpsConstantPowerLoadInputData loadInput(false, 0.0);
+    for (int i = 0; i < N; ++i) {
+        std::ostringstream name;
+        name << prefix.str() << ".R" << i;
+        if (i < N - 1) {
+            GunnsBasicConductorConfigData config(name.str(), &nodeList, 1.0 + 0.1 * i);
+            conductors[i].initialize(config, conductorInput, links, i, i + 1);
+        }
+        name << "C";
+        GunnsBasicCapacitorConfigData config(name.str(), &nodeList);
+        GunnsBasicCapacitorInputData  input(false, 0.0, 1.0 + 0.01 * i, 100.0);
+        capacitors[i].initialize(config, input, links, i, GROUND);
+        if (0 == i % 4) {
+            capacitors[i].setSerialOnly(true);
+        }
+        if (0 == i % 3) {
+            name << "P";
+            EpsConstantPowerLoadConfigData loadConfig(name.str(), &nodeList, 0.01, 10.0 + i, 0.01);
+            loads[i / 3].initialize(loadConfig, loadInput, links, i, GROUND);
+        }
+    }
+
+    GunnsThermalPhaseChangeBatteryConfigData batteryConfig(prefix.str() + ".PCM", &nodeList,
+                                                           1000.0, 200.0, 2.0, 1.5, 1.0);
+    GunnsThermalPhaseChangeBatteryInputData  batteryInput(0.1, 100.0, 0.0);
+    GunnsThermalPhaseChangeBattery           battery;
+    battery.initialize(batteryConfig, batteryInput, links, 7);
+
+    GunnsElectConverterInputConfigData  converterInConfig(prefix.str() + ".ConvIn", &nodeList);
+    GunnsElectConverterInputInputData   converterInInput(false, 0.0, true, 100.0, 10.0);
+    GunnsElectConverterInput            converterIn;
+    converterIn.initialize(converterInConfig, converterInInput, links, 10);
+
+    GunnsElectConverterOutputConfigData converterOutConfig(prefix.str() + ".ConvOut", &nodeList,
+                                                           GunnsElectConverterOutput::VOLTAGE,
+                                                           1.0, 0.9, 0, 0, 0, 0.0, 0.0,
+                                                           &converterIn);
+    GunnsElectConverterOutputInputData  converterOutInput(false, 0.0, true, 100.0, 10.0, 50.0);
+    GunnsElectConverterOutput           converterOut;
+    converterOut.initialize(converterOutConfig, converterOutInput, links, OUTPUT);
+
+    GunnsBasicConductorConfigData outputLoadConfig(prefix.str() + ".RL", &nodeList, 0.05);
+    GunnsBasicConductor           outputLoad;
+    outputLoad.initialize(outputLoadConfig, conductorInput, links, OUTPUT, GROUND);
+
+    GunnsConfigData networkConfig(prefix.str() + ".Network", 1.0E-6, 1.0E-6, 10, 10);
+    network.initialize(networkConfig, links);
+    network.setLinkThreads(threads);
+    network.setIncrementalAdmittance(incrementalLimit);
+    if (incrementalLimit > 0) {
+        network.setIncrementalSourceOptions(true, false);
+        for (int i = 0; i < N - 1; ++i) {
+            conductors[i].setSourceReporting(true);
+        }
+        source.setSourceReporting(true);
+    }
+    for (int step = 0; step < 20; ++step) {
+        network.step(0.1);
+        potentials.insert(potentials.end(), network.mPotentialVector,
+                          network.mPotentialVector + network.mNetworkSize);
+    }
+    parallelTasks = network.mLinkParallelTasks;
+
+    /// - The converter pair shares its input voltage and power, and supplies its output load.
+    CPPUNIT_ASSERT(0.0 < converterIn.getInputVoltage());
+    CPPUNIT_ASSERT(0.0 < converterOut.getInputPower());
+    CPPUNIT_ASSERT(0.0 < nodes[OUTPUT].getPotential());
+    if (incrementalLimit > 0) {
+        CPPUNIT_ASSERT(0 < network.mIncrementalBuildCount);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests incremental admittance matrix builds.  The build counts follow the changed
+///           links, the kept slot sums always equal the sums of the link contributions, and a
+///           non-linear network has identical potentials with and without incremental builds and
+///           source vector assembly.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testIncrementalAdmittance()
+{
+    std::cout << "\n UtGunns ................ 44: testIncrementalAdmittance .............";
+
+    setupIslandNetwork();
+    tNetwork.setIncrementalAdmittance(2);
+    CPPUNIT_ASSERT(2  == tNetwork.mIncrementalRefreshLimit);
+    CPPUNIT_ASSERT(-1 == tNetwork.mIncrementalPattern);
+
+    /// - The first build is full, and lists the slot contributors.
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(1 == tNetwork.mIncrementalFullCount);
+    CPPUNIT_ASSERT(0 == tNetwork.mIncrementalBuildCount);
+    CPPUNIT_ASSERT(tNetwork.mSparsePatternCount == tNetwork.mIncrementalPattern);
+    CPPUNIT_ASSERT(tNetwork.mAdmittanceSparse->getNnz()
+                   == static_cast<int>(tNetwork.mAdmittanceSlotSums.size()));
+    verifyAdmittanceSlotSums();
+
+    /// - One changed link of five is an incremental build, up to the refresh limit.
+    tConductor1.setDefaultConductivity(0.5);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(1 == tNetwork.mIncrementalFullCount);
+    CPPUNIT_ASSERT(1 == tNetwork.mIncrementalBuildCount);
+    CPPUNIT_ASSERT(tNetwork.mAdmittanceChangedLinks.empty());
+    verifyAdmittanceSlotSums();
+
+    tPotential.mMalfBlockageFlag  = true;
+    tPotential.mMalfBlockageValue = 0.5;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(2 == tNetwork.mIncrementalBuildCount);
+    verifyAdmittanceSlotSums();
+
+    tConductor1.setDefaultConductivity(0.25);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(2 == tNetwork.mIncrementalFullCount);
+    CPPUNIT_ASSERT(2 == tNetwork.mIncrementalBuildCount);
+    verifyAdmittanceSlotSums();
+
+    /// - More than a quarter of the links changing is a full build.
+    tConductor2.setDefaultConductivity(1.0/1000.0);
+    tConductor3.setDefaultConductivity(1.0/1000.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(3 == tNetwork.mIncrementalFullCount);
+    CPPUNIT_ASSERT(2 == tNetwork.mIncrementalBuildCount);
+    verifyAdmittanceSlotSums();
+
+    /// - A link moving to another node changes the pattern, which lists the contributors again.
+    const int pattern = tNetwork.mSparsePatternCount;
+    CPPUNIT_ASSERT(tConductor3.setPort(1, 4));
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(pattern < tNetwork.mSparsePatternCount);
+    CPPUNIT_ASSERT(tNetwork.mSparsePatternCount == tNetwork.mIncrementalPattern);
+    CPPUNIT_ASSERT(4 == tNetwork.mIncrementalFullCount);
+    verifyAdmittanceSlotSums();
+
+    /// - Sparse storage builds from the same kept sums, without loading the dense matrix until it
+    ///   is asked for.
+    tNetwork.setMatrixStorage(Gunns::SPARSE);
+    tConductor2.setDefaultConductivity(1.0/2000.0);
+    tNetwork.mAdmittanceMatrix[0] = 99.0;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(4 == tNetwork.mIncrementalFullCount);
+    CPPUNIT_ASSERT(3 == tNetwork.mIncrementalBuildCount);
+    verifyAdmittanceSlotSums();
+    CPPUNIT_ASSERT(99.0 == tNetwork.mAdmittanceMatrix[0]);
+    CPPUNIT_ASSERT(tNetwork.mAdmittanceSparse->getValues()[0] == tNetwork.getAdmittanceMatrix()[0]);
+
+    /// - Disabling releases the kept sums.
+    tNetwork.setIncrementalAdmittance(0);
+    CPPUNIT_ASSERT(tNetwork.mAdmittanceSlotSums.empty());
+    CPPUNIT_ASSERT(tNetwork.mSlotContributorLinks.empty());
+    tConductor1.setDefaultConductivity(1.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(4 == tNetwork.mIncrementalFullCount);
+    CPPUNIT_ASSERT(3 == tNetwork.mIncrementalBuildCount);
+
+    /// - A non-linear network has identical potentials with and without incremental builds.
+    std::vector<double> fullPotentials;
+    std::vector<double> incrementalPotentials;
+    int                 tasks = 0;
+    runLadderNetwork(fullPotentials,        tasks, 1);
+    runLadderNetwork(incrementalPotentials, tasks, 1, 5);
+    CPPUNIT_ASSERT(fullPotentials.size() == incrementalPotentials.size());
+    for (unsigned int i = 0; i < fullPotentials.size(); ++i) {
+        CPPUNIT_ASSERT(fullPotentials[i] == incrementalPotentials[i]);
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Verifies the kept admittance slot sums are exactly the sums of the link contributions
+///           to their dense matrix positions, summed in link order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::verifyAdmittanceSlotSums()
+{
+    const int N = tNetwork.mNetworkSize;
+    std::vector<double> A(N*N, 0.0);
+    for (int link = 0; link < tNetwork.mNumLinks; ++link) {
+        const GunnsBasicLinkAdmittanceMap* map = tNetwork.mLinkAdmittanceMaps[link];
+        for (unsigned int i = 0; i < map->mSize; ++i) {
+            if (map->mMap[i] > -1 and map->mMap[i] < N*N) {
+                A[map->mMap[i]] += tNetwork.mLinkAdmittanceMatrices[link][i];
+            }
+        }
+    }
+    const int* rowStart = tNetwork.mAdmittanceSparse->getRowStart();
+    const int* columns  = tNetwork.mAdmittanceSparse->getColumnIndex();
+    for (int row = 0; row < N; ++row) {
+        for (int slot = rowStart[row]; slot < rowStart[row+1]; ++slot) {
+            CPPUNIT_ASSERT(A[row*N + columns[slot]] == tNetwork.mAdmittanceSlotSums[slot]);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests incremental source vector assembly.  Only links that report their source
+///           changes are skipped when unchanged, the source vector always equals the full sums,
+///           and the verify option catches a reporting link changing its source without flagging.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testIncrementalSource()
+{
+    std::cout << "\n UtGunns ................ 45: testIncrementalSource .................";
+
+    setupIslandNetwork();
+    for (int link = 0; link < tNetwork.mNumLinks; ++link) {
+        tNetwork.mLinks[link]->setSourceReporting(true);
+    }
+    tNetwork.setIncrementalSourceOptions(true, true);
+    CPPUNIT_ASSERT(true  == tNetwork.mIncrementalSource);
+    CPPUNIT_ASSERT(true  == tNetwork.mSourceVerify);
+    CPPUNIT_ASSERT(false == tNetwork.mSourceContributorsValid);
+
+    /// - The first assembly is full, and lists the node contributors.
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(1 == tNetwork.mSourceFullCount);
+    CPPUNIT_ASSERT(0 == tNetwork.mSourceIncrementalCount);
+    CPPUNIT_ASSERT(true == tNetwork.mSourceContributorsValid);
+    CPPUNIT_ASSERT(10 == static_cast<int>(tNetwork.mSourcePortNodes.size()));
+    verifySourceVector();
+
+    /// - With no source changes nothing is re-summed.
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(1 == tNetwork.mSourceFullCount);
+    CPPUNIT_ASSERT(1 == tNetwork.mSourceIncrementalCount);
+    CPPUNIT_ASSERT(tNetwork.mSourceChangedLinks.empty());
+    verifySourceVector();
+
+    /// - A changed source is re-summed, as is a link that doesn't report.
+    const double source = tNetwork.mSourceVector[5];
+    tPotential.setSourcePotential(100.0);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(1 == tNetwork.mSourceFullCount);
+    CPPUNIT_ASSERT(2 == tNetwork.mSourceIncrementalCount);
+    CPPUNIT_ASSERT(source != tNetwork.mSourceVector[5]);
+    verifySourceVector();
+
+    tConductor1.setSourceReporting(false);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(1 == tNetwork.mSourceFullCount);
+    CPPUNIT_ASSERT(3 == tNetwork.mSourceIncrementalCount);
+    CPPUNIT_ASSERT(0 == tNetwork.mSourceVerifyFailures);
+    verifySourceVector();
+
+    /// - A reporting link changing its source without flagging it is caught by verification,
+    ///   which corrects the source vector.
+    tConductor2.mSourceVector[1] = 1.0;
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(1 == tNetwork.mSourceVerifyFailures);
+    verifySourceVector();
+
+    /// - A port move re-lists the contributors for a full assembly.
+    CPPUNIT_ASSERT(tConductor3.setPort(1, 4));
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(2 == tNetwork.mSourceFullCount);
+    CPPUNIT_ASSERT(4 == tNetwork.mSourcePortNodes[5]);
+    verifySourceVector();
+
+    /// - Disabling releases the kept sums.
+    tNetwork.setIncrementalSourceOptions(false, true);
+    CPPUNIT_ASSERT(false == tNetwork.mSourceVerify);
+    CPPUNIT_ASSERT(tNetwork.mSourceNodeSums.empty());
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(2 == tNetwork.mSourceFullCount);
+    verifySourceVector();
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Verifies the source vector is exactly the sums of the link contributions to their
+///           nodes, summed in link order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::verifySourceVector()
+{
+    const int N = tNetwork.mNetworkSize;
+    std::vector<double> b(N, 0.0);
+    for (int link = 0; link < tNetwork.mNumLinks; ++link) {
+        for (int port = 0; port < tNetwork.mLinkNumPorts[link]; ++port) {
+            const int node = tNetwork.mLinkNodeMaps[link][port];
+            if (node < N) {
+                b[node] += tNetwork.mLinkSourceVectors[link][port];
+            }
+        }
+    }
+    for (int i = 0; i < N; ++i) {
+        CPPUNIT_ASSERT(b[i] == tNetwork.mSourceVector[i]);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] converging (--) When true, network set up to be converging, otherwise non-converging.
 ///
@@ -2709,3 +3842,46 @@ void UtGunns::setupIslandNetwork2()
 
     tNetwork.initialize(tNetworkConfig, tLinks);
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the step phase times, with the non-Trick clock held constant and following the
+///           wall clock.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testPhaseTiming()
+{
+    std::cout << "\n UtGunns ................ 46: testPhaseTiming .......................";
+
+    setupIslandNetwork();
+
+    /// - With the default constant clock, all phases take no time.
+    tNetwork.step(tDeltaTime);
+    for (int phase = 0; phase < Gunns::NUM_STEP_PHASES; ++phase) {
+        CPPUNIT_ASSERT(0.0 == tNetwork.getPhaseTime(static_cast<Gunns::StepPhase>(phase)));
+    }
+
+    /// - Following the wall clock, the phases are timed and sum to no more than the step.  The
+    ///   matrix is only decomposed when it changes.
+    GunnsInfraFunctions::mWallClock = true;
+    tNetwork.setWorstCaseTiming(true);
+    tNetwork.step(tDeltaTime);
+    double sum = 0.0;
+    for (int phase = 0; phase < Gunns::NUM_STEP_PHASES; ++phase) {
+        const double time = tNetwork.getPhaseTime(static_cast<Gunns::StepPhase>(phase));
+        CPPUNIT_ASSERT(0.0 <= time);
+        sum += time;
+    }
+    CPPUNIT_ASSERT(0.0 < tNetwork.getPhaseTime(Gunns::PHASE_DECOMPOSE));
+    CPPUNIT_ASSERT(0.0 < tNetwork.getStepTime());
+    CPPUNIT_ASSERT(sum <= tNetwork.getStepTime());
+
+    tNetwork.setWorstCaseTiming(false);
+    tNetwork.step(tDeltaTime);
+    CPPUNIT_ASSERT(0.0 == tNetwork.getPhaseTime(Gunns::PHASE_DECOMPOSE));
+    CPPUNIT_ASSERT(0.0 <  tNetwork.getPhaseTime(Gunns::PHASE_SOLVE));
+    GunnsInfraFunctions::mWallClock = false;
+
+    /// - Invalid phases return zero.
+    CPPUNIT_ASSERT(0.0 == tNetwork.getPhaseTime(Gunns::NUM_STEP_PHASES));
+
+    std::cout << "... Pass";
+}
@@ -148,6 +148,17 @@ class UtGunns : public CppUnit::TestFixture
         CPPUNIT_TEST(testGpuDense);
         CPPUNIT_TEST(testGpuSparseIslands);
         CPPUNIT_TEST(testGpuDenseIslands);
+        CPPUNIT_TEST(testSparseStorage);
+        CPPUNIT_TEST(testIslandUnionFind);
+        CPPUNIT_TEST(testParallelIslands);
+        CPPUNIT_TEST(testFactorUpdates);
+        CPPUNIT_TEST(testIslandFactorCaching);
+        CPPUNIT_TEST(testSimdSolver);
+        CPPUNIT_TEST(testConjugateGradient);
+        CPPUNIT_TEST(testParallelLinks);
+        CPPUNIT_TEST(testIncrementalAdmittance);
+        CPPUNIT_TEST(testIncrementalSource);
+        CPPUNIT_TEST(testPhaseTiming);
 
         CPPUNIT_TEST_SUITE_END();
 
@@ -265,6 +276,24 @@ class UtGunns : public CppUnit::TestFixture
         void testGpuDense();
         void testGpuSparseIslands();
         void testGpuDenseIslands();
+        void testSparseStorage();
+        void testIslandUnionFind();
+        void testParallelIslands();
+        void testFactorUpdates();
+        void verifyFactorUpdate();
+        void testIslandFactorCaching();
+        void verifyUndecomposedSolution();
+        void testSimdSolver();
+        void verifyPotentials(const std::vector<double>& expected);
+        void testConjugateGradient();
+        void testParallelLinks();
+        void runLadderNetwork(std::vector<double>& potentials, int& parallelTasks,
+                              const int threads, const int incrementalLimit = 0);
+        void testIncrementalAdmittance();
+        void verifyAdmittanceSlotSums();
+        void testIncrementalSource();
+        void verifySourceVector();
+        void testPhaseTiming();
 };
 
 ///@}
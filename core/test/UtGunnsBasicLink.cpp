@@ -150,6 +150,9 @@ void UtGunnsBasicLink::testDefaultConstruction()
     CPPUNIT_ASSERT(false                 == mArticle->mMalfBlockageFlag);
     CPPUNIT_ASSERT(0.0                   == mArticle->mMalfBlockageValue);
     CPPUNIT_ASSERT(false                 == mArticle->mInitFlag);
+    CPPUNIT_ASSERT(false                 == mArticle->mSerialOnly);
+    CPPUNIT_ASSERT(true                  == mArticle->mSourceUpdate);
+    CPPUNIT_ASSERT(false                 == mArticle->mSourceReporting);
     CPPUNIT_ASSERT(-1                    == mArticle->mUserPortSelect);
     CPPUNIT_ASSERT(-1                    == mArticle->mUserPortSelectNode);
     CPPUNIT_ASSERT(GunnsBasicLink::READY == mArticle->mUserPortSetControl);
@@ -353,6 +356,26 @@ void UtGunnsBasicLink::testAccessors()
     mArticle->unlockNodeMap();
     CPPUNIT_ASSERT_EQUAL(false, mArticle->mNodeMapLocked);
 
+    /// @test the serial-only setter & getter
+    mArticle->setSerialOnly(true);
+    CPPUNIT_ASSERT_EQUAL(true, mArticle->isSerialOnly());
+
+    mArticle->setSerialOnly(false);
+    CPPUNIT_ASSERT_EQUAL(false, mArticle->isSerialOnly());
+
+    /// @test the source reporting setter & getter, and that a link that doesn't report always
+    ///       needs a source update, and a reporting link only when flagged.
+    mArticle->mSourceUpdate = false;
+    CPPUNIT_ASSERT_EQUAL(false, mArticle->isSourceReporting());
+    CPPUNIT_ASSERT_EQUAL(true,  mArticle->needSourceUpdate());
+    mArticle->setSourceReporting(true);
+    CPPUNIT_ASSERT_EQUAL(true,  mArticle->isSourceReporting());
+    CPPUNIT_ASSERT_EQUAL(false, mArticle->needSourceUpdate());
+    mArticle->mSourceUpdate = true;
+    CPPUNIT_ASSERT_EQUAL(true,  mArticle->needSourceUpdate());
+    CPPUNIT_ASSERT_EQUAL(false, mArticle->mSourceUpdate);
+    mArticle->setSourceReporting(false);
+
     /// - call the dummy placeholder methods that don't do or return anything, for code coverage.
     mArticle->updateState(0.0);
     mArticle->updateFlux(0.0, 0.0);
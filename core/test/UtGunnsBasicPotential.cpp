@@ -214,6 +214,15 @@ void UtGunnsBasicPotential::testStep()
         CPPUNIT_ASSERT(false);
     }
 
+    /// - The source update is flagged only when the source vector changes.
+    CPPUNIT_ASSERT(true  == mArticle->needSourceUpdate());
+    mArticle->setSourceReporting(true);
+    mArticle->step(mTimeStep);
+    CPPUNIT_ASSERT(false == mArticle->needSourceUpdate());
+    mArticle->setSourcePotential(2.0 * mArticle->mSourcePotential);
+    mArticle->step(mTimeStep);
+    CPPUNIT_ASSERT(true  == mArticle->needSourceUpdate());
+
     std::cout << "... Pass";
 }
 
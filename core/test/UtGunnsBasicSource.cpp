@@ -193,6 +193,15 @@ void UtGunnsBasicSource::testStep()
     CPPUNIT_ASSERT_DOUBLES_EQUAL(mArticle->mSourceFlux, mArticle->mSourceVector[1], 0.0);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(mArticle->mSourceFlux, mArticle->mFlux,            0.0);
 
+    /// - The source update is flagged only when the source vector changes.
+    mArticle->setSourceReporting(true);
+    CPPUNIT_ASSERT(true  == mArticle->needSourceUpdate());
+    mArticle->step(mTimeStep);
+    CPPUNIT_ASSERT(false == mArticle->needSourceUpdate());
+    mArticle->mMalfBlockageFlag  = true;
+    mArticle->step(mTimeStep);
+    CPPUNIT_ASSERT(true  == mArticle->needSourceUpdate());
+
     std::cout << "... Pass";
 }
 
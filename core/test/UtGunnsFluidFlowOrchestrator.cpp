@@ -348,3 +348,92 @@ void UtGunnsFluidFlowOrchestrator::testUpdateAbort()
 
     std::cout << "... Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  fraction  (--)  Fraction of node 0 mass to flow around the loop in a time step.
+/// @param[in]  dt        (s)   Integration time step.
+///
+/// @details  Sets the source links flow demand around the loop and steps all the links.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidFlowOrchestrator::stepLoopFlow(const double fraction, const double dt)
+{
+    const double mdot = fraction * tNodes[0].getContent()->getMass() / dt;
+
+    tSource1.setFlowDemand(mdot);
+    tSource2.setFlowDemand(mdot);
+    tSource3.setFlowDemand(mdot);
+
+    tSource1.step(dt);
+    tSource2.step(dt);
+    tSource3.step(dt);
+    tCapacitor1.step(dt);
+    tCapacitor2.step(dt);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the update method of the GunnsFluidFlowOrchestrator class with the
+///           nodes integrated by worker threads.  The nominal case is run in series, then the
+///           network is rebuilt and the same case is run with threads by another article, and the
+///           nodes must end up in exactly the same state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidFlowOrchestrator::testUpdateParallel()
+{
+    std::cout << "\n UtGunnsFluidFlowOrchestrator 08: testUpdateParallel ................";
+
+    const double dt = 0.1;
+
+    /// - Run a step with no flow, where all nodes are ready in the first pass, then the nominal
+    ///   case, in series.
+    tArticle.initialize(tName, tLinksArray, tNodesArray, tLinkNodeMaps, tLinkNumPorts);
+    CPPUNIT_ASSERT(tArticle.mNodePool.getNumWorkers() < 2);
+    tArticle.update(dt);
+    CPPUNIT_ASSERT(1 == tArticle.mNumPasses);
+    tCapacitor2.editVolume(true, 0.1);
+    stepLoopFlow(0.5, dt);
+    tArticle.update(dt);
+    CPPUNIT_ASSERT(3 == tArticle.mNumPasses);
+    CPPUNIT_ASSERT(5 == tArticle.mNumCompleteLinks);
+
+    double mass[NUMNODES];
+    double temperature[NUMNODES];
+    for (int i = 0; i < NUMNODES; ++i) {
+        mass[i]        = tNodes[i].getContent()->getMass();
+        temperature[i] = tNodes[i].getContent()->getTemperature();
+    }
+
+    /// - Rebuild the network and run the same case with threads.
+    tearDown();
+    setUp();
+    FriendlyGunnsFluidFlowOrchestrator article(tNumLinks, tNumNodes);
+    article.initialize(tName, tLinksArray, tNodesArray, tLinkNodeMaps, tLinkNumPorts);
+    article.setThreads(4);
+    CPPUNIT_ASSERT(4 == article.mNodePool.getNumWorkers());
+    article.update(dt);
+    CPPUNIT_ASSERT(1 == article.mNumPasses);
+    tCapacitor2.editVolume(true, 0.1);
+    stepLoopFlow(0.5, dt);
+    article.update(dt);
+    CPPUNIT_ASSERT(3 == article.mNumPasses);
+
+    for (int i = 0; i < NUMNODES; ++i) {
+        CPPUNIT_ASSERT(mass[i]        == tNodes[i].getContent()->getMass());
+        CPPUNIT_ASSERT(temperature[i] == tNodes[i].getContent()->getTemperature());
+        CPPUNIT_ASSERT(GunnsFluidFlowOrchestrator::COMPLETE == article.mNodeStates[i]);
+    }
+
+    /// - The overflow loop case with threads, where a link is forced to break the loop.
+    stepLoopFlow(2.0, dt);
+    article.update(dt);
+    CPPUNIT_ASSERT(5 == article.mNumCompleteLinks);
+    CPPUNIT_ASSERT(0 == article.mNumIncompleteLinks);
+    for (int i = 0; i < NUMNODES; ++i) {
+        CPPUNIT_ASSERT(GunnsFluidFlowOrchestrator::COMPLETE == article.mNodeStates[i]);
+    }
+
+    /// - Setting threads back to one integrates in series.
+    article.setThreads(1);
+    CPPUNIT_ASSERT(article.mNodePool.getNumWorkers() < 2);
+
+    std::cout << "... Pass";
+}
+
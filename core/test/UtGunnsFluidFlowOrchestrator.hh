@@ -77,6 +77,8 @@ class UtGunnsFluidFlowOrchestrator : public CppUnit::TestFixture
         void testUpdateOverflowLoop();
         /// @brief    Tests update method with an infinite loop escape case.
         void testUpdateAbort();
+        /// @brief    Tests update method with parallel node integration.
+        void testUpdateParallel();
 
     private:
         CPPUNIT_TEST_SUITE(UtGunnsFluidFlowOrchestrator);
@@ -87,6 +89,7 @@ class UtGunnsFluidFlowOrchestrator : public CppUnit::TestFixture
         CPPUNIT_TEST(testUpdateNominal);
         CPPUNIT_TEST(testUpdateOverflowLoop);
         CPPUNIT_TEST(testUpdateAbort);
+        CPPUNIT_TEST(testUpdateParallel);
         CPPUNIT_TEST_SUITE_END();
 
         enum {NUMLINKS = 5, NUMNODES = 4};                   /**< (--) Enumeration of numbers of objects */
@@ -115,6 +118,9 @@ class UtGunnsFluidFlowOrchestrator : public CppUnit::TestFixture
         int**                              tLinkNodeMaps;    /**< (--) Array of link node maps */
         int*                               tLinkNumPorts;    /**< (--) Array of link number of ports */
 
+        /// @brief Steps the links with a flow rate around the loop of the given node 0 mass fraction.
+        void stepLoopFlow(const double fraction, const double dt);
+
         /// @brief Copy constructor unavailable since declared private and not implemented.
         UtGunnsFluidFlowOrchestrator(const UtGunnsFluidFlowOrchestrator& that);
         /// @brief Assignment operator unavailable since declared private and not implemented.
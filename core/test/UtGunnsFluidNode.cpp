@@ -145,6 +145,9 @@ void UtGunnsFluidNode::testNominalInitialization()
     CPPUNIT_ASSERT_DOUBLES_EQUAL(  0.0,
             tNode.mContent.getPartialPressure(FluidProperties::GUNNS_CO2),   DBL_EPSILON);
 
+    CPPUNIT_ASSERT(tNode.mContent.getPropertyCache().isEnabled());
+    CPPUNIT_ASSERT(not tNode.mInflow.getPropertyCache().isEnabled());
+
     CPPUNIT_ASSERT_DOUBLES_EQUAL(101.32501, tNode.mInflow.getPressure(),     DBL_EPSILON);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(270.0,     tNode.mInflow.getTemperature(),  DBL_EPSILON);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(101.32501,
@@ -0,0 +1,250 @@
+/**
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+*/
+
+#include "UtGunnsThreadPool.hh"
+#include "software/exceptions/TsNumericalException.hh"
+#include <iostream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] numTasks (--) Number of tasks in the job.
+/// @param[in] failTask (--) Task number that throws, -1 for none.
+///
+/// @details  Constructs the test job with no tasks run yet.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsThreadPoolJob::UtGunnsThreadPoolJob(const int numTasks, const int failTask)
+    :
+    mWorkers(numTasks, -1),
+    mRunCounts(numTasks, 0),
+    mResults(numTasks, 0.0),
+    mSequence(numTasks, -1),
+    mStarted(0),
+    mFailTask(failTask)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] task   (--) Task number.
+/// @param[in] worker (--) Worker number.
+///
+/// @details  Records the worker and start order, sums a series long enough for the workers to
+///           overlap, and throws if this is the failing task.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThreadPoolJob::runTask(const int task, const int worker)
+{
+    mSequence[task] = __sync_fetch_and_add(&mStarted, 1);
+    mWorkers[task]  = worker;
+    mRunCounts[task]++;
+    double sum = 0.0;
+    for (int i = 1; i <= 10000 * (task + 1); ++i) {
+        sum += 1.0 / i;
+    }
+    mResults[task] = sum;
+    if (task == mFailTask) {
+        throw TsNumericalException("test", "UtGunnsThreadPoolJob", "failing task");
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsThreadPool class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsThreadPool::UtGunnsThreadPool()
+    :
+    tArticle(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsThreadPool class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsThreadPool::~UtGunnsThreadPool()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThreadPool::setUp()
+{
+    tArticle = new FriendlyGunnsThreadPool();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThreadPool::tearDown()
+{
+    delete tArticle;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests default construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThreadPool::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsThreadPool 01: testDefaultConstruction ......................";
+
+    CPPUNIT_ASSERT(""    == tArticle->mName);
+    CPPUNIT_ASSERT(1     == tArticle->mNumWorkers);
+    CPPUNIT_ASSERT(0     == tArticle->mThreads);
+    CPPUNIT_ASSERT(0     == tArticle->mWorkers);
+    CPPUNIT_ASSERT(0     == tArticle->mJob);
+    CPPUNIT_ASSERT(0     == tArticle->mNumTasks);
+    CPPUNIT_ASSERT(0     == tArticle->mNextTask);
+    CPPUNIT_ASSERT(0     == tArticle->mBusyWorkers);
+    CPPUNIT_ASSERT(0     == tArticle->mFailedTasks);
+    CPPUNIT_ASSERT(0     == tArticle->mGeneration);
+    CPPUNIT_ASSERT(false == tArticle->mShutdown);
+    CPPUNIT_ASSERT(1     == tArticle->getNumWorkers());
+
+    /// - Test new/delete for code coverage.
+    GunnsThreadPool* article = new GunnsThreadPool();
+    delete article;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests running a job on the calling thread only.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThreadPool::testSerialRun()
+{
+    std::cout << "\n UtGunnsThreadPool 02: testSerialRun ................................";
+
+    /// - Without initialize, all tasks run in order on the calling thread.
+    UtGunnsThreadPoolJob job(5);
+    CPPUNIT_ASSERT(0 == tArticle->run(&job, 5));
+    for (int task = 0; task < 5; ++task) {
+        CPPUNIT_ASSERT(0    == job.mWorkers[task]);
+        CPPUNIT_ASSERT(1    == job.mRunCounts[task]);
+        CPPUNIT_ASSERT(task == job.mSequence[task]);
+        CPPUNIT_ASSERT(0.0  <  job.mResults[task]);
+    }
+    CPPUNIT_ASSERT(0 == tArticle->mJob);
+
+    /// - Initializing to less than 2 workers starts no threads.
+    tArticle->initialize("tArticle", 0);
+    CPPUNIT_ASSERT("tArticle" == tArticle->mName);
+    CPPUNIT_ASSERT(1          == tArticle->getNumWorkers());
+    CPPUNIT_ASSERT(0          == tArticle->mThreads);
+
+    /// - A job with no tasks returns right away.
+    UtGunnsThreadPoolJob empty(0);
+    CPPUNIT_ASSERT(0 == tArticle->run(&empty, 0));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests running jobs on several workers.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThreadPool::testParallelRun()
+{
+    std::cout << "\n UtGunnsThreadPool 03: testParallelRun ..............................";
+
+    tArticle->initialize("tArticle", 4);
+    CPPUNIT_ASSERT(4 == tArticle->getNumWorkers());
+    CPPUNIT_ASSERT(0 != tArticle->mThreads);
+    CPPUNIT_ASSERT(0 != tArticle->mWorkers);
+    CPPUNIT_ASSERT(3 == tArticle->mWorkers[2].mNumber);
+
+    /// - Run several jobs back to back, and verify every task runs exactly once on a valid worker,
+    ///   with the same results as the serial job.
+    const int numTasks = 37;
+    UtGunnsThreadPoolJob serial(numTasks);
+    for (int task = 0; task < numTasks; ++task) {
+        serial.runTask(task, 0);
+    }
+    for (int run = 0; run < 20; ++run) {
+        UtGunnsThreadPoolJob job(numTasks);
+        CPPUNIT_ASSERT(0 == tArticle->run(&job, numTasks));
+        CPPUNIT_ASSERT(numTasks == job.mStarted);
+        for (int task = 0; task < numTasks; ++task) {
+            CPPUNIT_ASSERT(1 == job.mRunCounts[task]);
+            CPPUNIT_ASSERT(0 <= job.mWorkers[task] and 4 > job.mWorkers[task]);
+            CPPUNIT_ASSERT(serial.mResults[task] == job.mResults[task]);
+        }
+        CPPUNIT_ASSERT(0 == tArticle->mBusyWorkers);
+        CPPUNIT_ASSERT(0 == tArticle->mJob);
+    }
+    CPPUNIT_ASSERT(20 == tArticle->mGeneration);
+
+    /// - Fewer tasks than workers.
+    UtGunnsThreadPoolJob small(2);
+    CPPUNIT_ASSERT(0 == tArticle->run(&small, 2));
+    CPPUNIT_ASSERT(1 == small.mRunCounts[0]);
+    CPPUNIT_ASSERT(1 == small.mRunCounts[1]);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests counting of exceptions thrown from tasks.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThreadPool::testTaskExceptions()
+{
+    std::cout << "\n UtGunnsThreadPool 04: testTaskExceptions ...........................";
+
+    /// - An exception thrown from a task is counted, and the other tasks still run.
+    tArticle->initialize("tArticle", 3);
+    UtGunnsThreadPoolJob job(10, 4);
+    CPPUNIT_ASSERT(1 == tArticle->run(&job, 10));
+    for (int task = 0; task < 10; ++task) {
+        CPPUNIT_ASSERT(1 == job.mRunCounts[task]);
+    }
+
+    /// - The count is reset for the next job.
+    UtGunnsThreadPoolJob good(10);
+    CPPUNIT_ASSERT(0 == tArticle->run(&good, 10));
+
+    /// - Same on the calling thread alone.
+    tArticle->initialize("tArticle", 1);
+    UtGunnsThreadPoolJob serial(3, 0);
+    CPPUNIT_ASSERT(1 == tArticle->run(&serial, 3));
+    CPPUNIT_ASSERT(1 == serial.mRunCounts[2]);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests re-initialization and shutdown.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThreadPool::testShutdown()
+{
+    std::cout << "\n UtGunnsThreadPool 05: testShutdown .................................";
+
+    /// - Re-initializing replaces the workers and restarts the job counter.
+    tArticle->initialize("tArticle", 2);
+    UtGunnsThreadPoolJob job1(8);
+    CPPUNIT_ASSERT(0 == tArticle->run(&job1, 8));
+    CPPUNIT_ASSERT(1 == tArticle->mGeneration);
+    tArticle->initialize("tArticle", 5);
+    CPPUNIT_ASSERT(5 == tArticle->getNumWorkers());
+    CPPUNIT_ASSERT(0 == tArticle->mGeneration);
+    UtGunnsThreadPoolJob job2(8);
+    CPPUNIT_ASSERT(0 == tArticle->run(&job2, 8));
+    for (int task = 0; task < 8; ++task) {
+        CPPUNIT_ASSERT(1 == job2.mRunCounts[task]);
+    }
+
+    /// - Shutdown joins the workers and returns to the calling thread only.
+    tArticle->shutdown();
+    CPPUNIT_ASSERT(1     == tArticle->getNumWorkers());
+    CPPUNIT_ASSERT(0     == tArticle->mThreads);
+    CPPUNIT_ASSERT(0     == tArticle->mWorkers);
+    CPPUNIT_ASSERT(false == tArticle->mShutdown);
+    UtGunnsThreadPoolJob job3(3);
+    CPPUNIT_ASSERT(0 == tArticle->run(&job3, 3));
+    CPPUNIT_ASSERT(0 == job3.mWorkers[2]);
+
+    /// - Shutdown of a pool with no threads does nothing.
+    tArticle->shutdown();
+    CPPUNIT_ASSERT(1 == tArticle->getNumWorkers());
+
+    std::cout << "... Pass";
+}
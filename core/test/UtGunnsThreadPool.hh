@@ -0,0 +1,103 @@
+#ifndef UtGunnsThreadPool_EXISTS
+#define UtGunnsThreadPool_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_THREAD_POOL GUNNS Solver Thread Pool Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Gunns Solver Thread Pool class
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <vector>
+
+#include "core/GunnsThreadPool.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsThreadPool and befriend UtGunnsThreadPool.
+///
+/// @details  Class derived from the unit under test.  It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsThreadPool : public GunnsThreadPool
+{
+    public:
+        FriendlyGunnsThreadPool() : GunnsThreadPool() {;}
+        virtual ~FriendlyGunnsThreadPool() {;}
+        friend class UtGunnsThreadPool;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Test job for the thread pool.
+///
+/// @details  Records the worker that ran each task and sums a series in each task, and throws from
+///           the failing task.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsThreadPoolJob : public GunnsThreadPoolJob
+{
+    public:
+        std::vector<int>    mWorkers;   /**< (--) Worker number that ran each task, -1 if not run. */
+        std::vector<int>    mRunCounts; /**< (--) Number of times each task was run. */
+        std::vector<double> mResults;   /**< (--) Result of each task. */
+        std::vector<int>    mSequence;  /**< (--) Order in which each task was started. */
+        int                 mStarted;   /**< (--) Number of tasks started. */
+        int                 mFailTask;  /**< (--) Task number that throws, -1 for none. */
+        UtGunnsThreadPoolJob(const int numTasks, const int failTask = -1);
+        virtual ~UtGunnsThreadPoolJob() {;}
+        virtual void runTask(const int task, const int worker);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Solver Thread Pool unit tests.
+///
+/// @details  This class provides the unit tests for the GunnsThreadPool class within the CPPUnit
+///           framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsThreadPool: public CppUnit::TestFixture
+{
+    public:
+        /// @brief Default constructs this unit test.
+        UtGunnsThreadPool();
+        /// @brief Default destructs this unit test.
+        virtual ~UtGunnsThreadPool();
+        /// @brief Executes before each test.
+        void setUp();
+        /// @brief Executes after each test.
+        void tearDown();
+        /// @brief Tests default construction.
+        void testDefaultConstruction();
+        /// @brief Tests running a job on the calling thread only.
+        void testSerialRun();
+        /// @brief Tests running jobs on several workers.
+        void testParallelRun();
+        /// @brief Tests counting of exceptions thrown from tasks.
+        void testTaskExceptions();
+        /// @brief Tests re-initialization and shutdown.
+        void testShutdown();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsThreadPool);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testSerialRun);
+        CPPUNIT_TEST(testParallelRun);
+        CPPUNIT_TEST(testTaskExceptions);
+        CPPUNIT_TEST(testShutdown);
+        CPPUNIT_TEST_SUITE_END();
+
+        FriendlyGunnsThreadPool* tArticle; /**< (--) Test article. */
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsThreadPool(const UtGunnsThreadPool& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsThreadPool& operator =(const UtGunnsThreadPool& that);
+};
+
+///@}
+
+#endif
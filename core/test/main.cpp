@@ -56,6 +56,7 @@ LIBRARY DEPENDENCY:
 #include "UtGunnsFluidFlowIntegrator.hh"
 #include "UtGunnsFluidVolumeMonitor.hh"
 #include "UtGunnsSensorAnalogWrapper.hh"
+#include "UtGunnsThreadPool.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param    argc  int     --  not used
@@ -107,6 +108,7 @@ int main(int argc, char** argv) {
     runner.addTest( UtGunnsFluidFlowIntegrator::suite() );
     runner.addTest( UtGunnsFluidVolumeMonitor::suite() );
     runner.addTest( UtGunnsSensorAnalogWrapper::suite() );
+    runner.addTest( UtGunnsThreadPool::suite() );
 
     runner.run();
 
@@ -3,7 +3,6 @@
 #
 # Omit these files because they use Trick message_publish:
 SOURCES := $(filter-out %/TsHsConsolePlugin.cpp,$(SOURCES))
-SOURCES := $(filter-out %/TsHsMsgStdFilter.cpp,$(SOURCES))
 SOURCES := $(filter-out %/TsHsStdMngr.cpp,$(SOURCES))
 SOURCES := $(filter-out %/TsHsTextPlugin.cpp,$(SOURCES))
 
@@ -52,6 +52,8 @@ class ExponentialFit : public TsApproximation {
         double mC;     /**< (--) trick_chkpnt_io(**) Third coefficient for curve fit model. */
         /// @brief Returns the model fit for the specified variables.
         virtual double evaluate(const double x, const double y = 0.0);
+        /// @brief Returns the model fit at each of an array of points.
+        virtual void evaluateBatch(const double* x, const double* y, double* out, const int n);
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details  Copy constructor unavailable since declared private and not implemented.
@@ -79,4 +81,21 @@ inline double ExponentialFit::evaluate(const double x, const double y __attribut
     return exp(mA + (mB + mC / x) / x);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x    (--)  Array of first independent variables for curve fit.
+/// @param[in]    y    (--)  Array of second independent variables for curve fit.
+/// @param[out]   out  (--)  Array of fitted variables at the specified inputs.
+/// @param[in]    n    (--)  Number of points.
+///
+/// @details  Returns this exponential model fit at each point, with the inline model so the loop
+///           can be vectorized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void ExponentialFit::evaluateBatch(const double* x, const double* y, double* out,
+                                          const int n)
+{
+    for (int i = 0; i < n; ++i) {
+        out[i] = ExponentialFit::evaluate(x[i], y[i]);
+    }
+}
+
 #endif
@@ -50,6 +50,8 @@ class InvQuadraticFit : public TsApproximation {
         double mC;     /**< (--) trick_chkpnt_io(**) Third coefficient for curve fit model. */
         /// @brief Returns the model fit for the specified variables.
         virtual double evaluate(const double x, const double y = 0.0);
+        /// @brief Returns the model fit at each of an array of points.
+        virtual void evaluateBatch(const double* x, const double* y, double* out, const int n);
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details
@@ -78,5 +80,21 @@ inline double InvQuadraticFit::evaluate(const double x, const double y __attribu
     return mA + (mB + mC / x) / x;
 }
 
-#endif
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x    (--)  Array of first independent variables for curve fit.
+/// @param[in]    y    (--)  Array of second independent variables for curve fit.
+/// @param[out]   out  (--)  Array of fitted variables at the specified inputs.
+/// @param[in]    n    (--)  Number of points.
+///
+/// @details  Returns this inverse quadratic model fit at each point, with the inline model so the
+///           loop can be vectorized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void InvQuadraticFit::evaluateBatch(const double* x, const double* y, double* out,
+                                           const int n)
+{
+    for (int i = 0; i < n; ++i) {
+        out[i] = InvQuadraticFit::evaluate(x[i], y[i]);
+    }
+}
 
+#endif
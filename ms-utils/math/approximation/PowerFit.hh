@@ -46,6 +46,8 @@ class PowerFit : public TsApproximation {
         double mB;     /**< (--) trick_chkpnt_io(**) Second coefficient for curve fit model. */
         /// @brief Returns the model fit for the specified variables.
         virtual double evaluate(const double x, const double y = 0.0);
+        /// @brief Returns the model fit at each of an array of points.
+        virtual void evaluateBatch(const double* x, const double* y, double* out, const int n);
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details
@@ -74,4 +76,20 @@ inline double PowerFit::evaluate(const double x, const double y __attribute__((u
     return mA * pow(mB, x);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x    (--)  Array of first independent variables for curve fit.
+/// @param[in]    y    (--)  Array of second independent variables for curve fit.
+/// @param[out]   out  (--)  Array of fitted variables at the specified inputs.
+/// @param[in]    n    (--)  Number of points.
+///
+/// @details  Returns this power model fit at each point, with the inline model so the loop can be
+///           vectorized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void PowerFit::evaluateBatch(const double* x, const double* y, double* out, const int n)
+{
+    for (int i = 0; i < n; ++i) {
+        out[i] = PowerFit::evaluate(x[i], y[i]);
+    }
+}
+
 #endif
@@ -43,10 +43,14 @@ class ProductFit : public TsApproximation {
         void init(const double a,    const double minX, const double maxX,
                   const double minY, const double maxY,
                   const std::string &name = "ProductFit");
+        /// @brief Returns the first coefficient of this curve fit model.
+        double getA() const;
     protected:
         double mA;     /**< (--) trick_chkpnt_io(**) First coefficient for curve fit model. */
         /// @brief Returns the model fit for the specified variables.
         virtual double evaluate(const double x, const double y);
+        /// @brief Returns the model fit at each of an array of points.
+        virtual void evaluateBatch(const double* x, const double* y, double* out, const int n);
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details
@@ -62,6 +66,16 @@ class ProductFit : public TsApproximation {
 
 /// @}
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   First coefficient of this Bivariate Product curve fit model.
+///
+/// @details  Returns the first coefficient of this Bivariate Product curve fit model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double ProductFit::getA() const
+{
+    return mA;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]    x  (--)  First independent variable for curve fit.
 /// @param[in]    y  (--)  Second independent variable for curve fit.
@@ -75,4 +89,20 @@ inline double ProductFit::evaluate(const double x, const double y)
     return mA * x * y;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x    (--)  Array of first independent variables for curve fit.
+/// @param[in]    y    (--)  Array of second independent variables for curve fit.
+/// @param[out]   out  (--)  Array of fitted variables at the specified inputs.
+/// @param[in]    n    (--)  Number of points.
+///
+/// @details  Returns this product model fit at each point, with the inline model so the loop can be
+///           vectorized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void ProductFit::evaluateBatch(const double* x, const double* y, double* out, const int n)
+{
+    for (int i = 0; i < n; ++i) {
+        out[i] = ProductFit::evaluate(x[i], y[i]);
+    }
+}
+
 #endif
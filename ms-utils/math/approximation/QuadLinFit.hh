@@ -46,6 +46,18 @@ class QuadLinFit : public TsApproximation {
                   const double d,    const double e,    const double f,
                   const double minX, const double maxX, const double minY, const double maxY,
                   const std::string &name = "QuadLinFit");
+        /// @brief Returns the first coefficient of this curve fit model.
+        double getA() const;
+        /// @brief Returns the second coefficient of this curve fit model.
+        double getB() const;
+        /// @brief Returns the third coefficient of this curve fit model.
+        double getC() const;
+        /// @brief Returns the fourth coefficient of this curve fit model.
+        double getD() const;
+        /// @brief Returns the fifth coefficient of this curve fit model.
+        double getE() const;
+        /// @brief Returns the sixth coefficient of this curve fit model.
+        double getF() const;
     protected:
         double mA;     /**< (--) trick_chkpnt_io(**) First coefficient for curve fit model. */
         double mB;     /**< (--) trick_chkpnt_io(**) Second coefficient for curve fit model. */
@@ -55,6 +67,8 @@ class QuadLinFit : public TsApproximation {
         double mF;     /**< (--) trick_chkpnt_io(**) Sixth coefficient for curve fit model. */
         /// @brief Returns the model fit for the specified variables.
         virtual double evaluate(const double x, const double y) ;
+        /// @brief Returns the model fit at each of an array of points.
+        virtual void evaluateBatch(const double* x, const double* y, double* out, const int n);
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details
@@ -70,6 +84,66 @@ class QuadLinFit : public TsApproximation {
 
 /// @}
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   First coefficient of this Bivariate Quadratic, Linear curve fit model.
+///
+/// @details  Returns the first coefficient of this Bivariate Quadratic, Linear curve fit model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double QuadLinFit::getA() const
+{
+    return mA;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   Second coefficient of this Bivariate Quadratic, Linear curve fit model.
+///
+/// @details  Returns the second coefficient of this Bivariate Quadratic, Linear curve fit model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double QuadLinFit::getB() const
+{
+    return mB;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   Third coefficient of this Bivariate Quadratic, Linear curve fit model.
+///
+/// @details  Returns the third coefficient of this Bivariate Quadratic, Linear curve fit model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double QuadLinFit::getC() const
+{
+    return mC;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   Fourth coefficient of this Bivariate Quadratic, Linear curve fit model.
+///
+/// @details  Returns the fourth coefficient of this Bivariate Quadratic, Linear curve fit model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double QuadLinFit::getD() const
+{
+    return mD;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   Fifth coefficient of this Bivariate Quadratic, Linear curve fit model.
+///
+/// @details  Returns the fifth coefficient of this Bivariate Quadratic, Linear curve fit model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double QuadLinFit::getE() const
+{
+    return mE;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   Sixth coefficient of this Bivariate Quadratic, Linear curve fit model.
+///
+/// @details  Returns the sixth coefficient of this Bivariate Quadratic, Linear curve fit model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double QuadLinFit::getF() const
+{
+    return mF;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]    x  (--)  First independent variable for curve fit.
 /// @param[in]    y  (--)  Second independent variable for curve fit.
@@ -83,4 +157,20 @@ inline double QuadLinFit::evaluate(const double x, const double y)
     return (mA + mB * y) + ((mC + mD * y) + (mE + mF * y) * x) * x;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x    (--)  Array of first independent variables for curve fit.
+/// @param[in]    y    (--)  Array of second independent variables for curve fit.
+/// @param[out]   out  (--)  Array of fitted variables at the specified inputs.
+/// @param[in]    n    (--)  Number of points.
+///
+/// @details  Returns this quadratic linear model fit at each point, with the inline model so the
+///           loop can be vectorized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void QuadLinFit::evaluateBatch(const double* x, const double* y, double* out, const int n)
+{
+    for (int i = 0; i < n; ++i) {
+        out[i] = QuadLinFit::evaluate(x[i], y[i]);
+    }
+}
+
 #endif
@@ -52,6 +52,18 @@ class QuadLinInvFit : public TsApproximation {
                   const double d,    const double e,    const double f,
                   const double minX, const double maxX, const double minY, const double maxY,
                   const std::string &name = "QuadLinInvFit");
+        /// @brief Returns the first coefficient of this curve fit model.
+        double getA() const;
+        /// @brief Returns the second coefficient of this curve fit model.
+        double getB() const;
+        /// @brief Returns the third coefficient of this curve fit model.
+        double getC() const;
+        /// @brief Returns the fourth coefficient of this curve fit model.
+        double getD() const;
+        /// @brief Returns the fifth coefficient of this curve fit model.
+        double getE() const;
+        /// @brief Returns the sixth coefficient of this curve fit model.
+        double getF() const;
     protected:
         double mA;     /**< (--) trick_chkpnt_io(**) First coefficient for curve fit model. */
         double mB;     /**< (--) trick_chkpnt_io(**) Second coefficient for curve fit model. */
@@ -61,6 +73,8 @@ class QuadLinInvFit : public TsApproximation {
         double mF;     /**< (--) trick_chkpnt_io(**) Sixth coefficient for curve fit model. */
         /// @brief Returns the model fit for the specified variables.
         virtual double evaluate(const double x, const double y) ;
+        /// @brief Returns the model fit at each of an array of points.
+        virtual void evaluateBatch(const double* x, const double* y, double* out, const int n);
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details
@@ -76,6 +90,66 @@ class QuadLinInvFit : public TsApproximation {
 
 /// @}
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   First coefficient of this Bivariate Quadratic, Linear Inverse curve fit model.
+///
+/// @details  Returns the first coefficient of this Bivariate Quadratic, Linear Inverse curve fit model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double QuadLinInvFit::getA() const
+{
+    return mA;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   Second coefficient of this Bivariate Quadratic, Linear Inverse curve fit model.
+///
+/// @details  Returns the second coefficient of this Bivariate Quadratic, Linear Inverse curve fit model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double QuadLinInvFit::getB() const
+{
+    return mB;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   Third coefficient of this Bivariate Quadratic, Linear Inverse curve fit model.
+///
+/// @details  Returns the third coefficient of this Bivariate Quadratic, Linear Inverse curve fit model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double QuadLinInvFit::getC() const
+{
+    return mC;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   Fourth coefficient of this Bivariate Quadratic, Linear Inverse curve fit model.
+///
+/// @details  Returns the fourth coefficient of this Bivariate Quadratic, Linear Inverse curve fit model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double QuadLinInvFit::getD() const
+{
+    return mD;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   Fifth coefficient of this Bivariate Quadratic, Linear Inverse curve fit model.
+///
+/// @details  Returns the fifth coefficient of this Bivariate Quadratic, Linear Inverse curve fit model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double QuadLinInvFit::getE() const
+{
+    return mE;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   Sixth coefficient of this Bivariate Quadratic, Linear Inverse curve fit model.
+///
+/// @details  Returns the sixth coefficient of this Bivariate Quadratic, Linear Inverse curve fit model.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double QuadLinInvFit::getF() const
+{
+    return mF;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]    x  (--)  First independent variable for curve fit.
 /// @param[in]    y  (--)  Second independent variable for curve fit.
@@ -90,5 +164,20 @@ inline double QuadLinInvFit::evaluate(const double x, const double y)
     return (y - mA - (mC + mE * x) * x) / (mB + (mD + mF * x) * x);
 }
 
-#endif
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x    (--)  Array of first independent variables for curve fit.
+/// @param[in]    y    (--)  Array of second independent variables for curve fit.
+/// @param[out]   out  (--)  Array of fitted variables at the specified inputs.
+/// @param[in]    n    (--)  Number of points.
+///
+/// @details  Returns this quadratic linear inverse model fit at each point, with the inline model
+///           so the loop can be vectorized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void QuadLinInvFit::evaluateBatch(const double* x, const double* y, double* out, const int n)
+{
+    for (int i = 0; i < n; ++i) {
+        out[i] = QuadLinInvFit::evaluate(x[i], y[i]);
+    }
+}
 
+#endif
@@ -49,6 +49,8 @@ class QuadraticFit : public TsApproximation {
         double mC;     /**< (--) trick_chkpnt_io(**) Third coefficient for curve fit model. */
         /// @brief Returns the model fit for the specified variables.
         virtual double evaluate(const double x, const double y = 0.0) ;
+        /// @brief Returns the model fit at each of an array of points.
+        virtual void evaluateBatch(const double* x, const double* y, double* out, const int n);
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details  Copy constructor unavailable since declared private and not implemented.
@@ -75,4 +77,20 @@ inline double QuadraticFit::evaluate(const double x, const double y __attribute_
     return mA + (mB + mC * x) * x;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x    (--)  Array of first independent variables for curve fit.
+/// @param[in]    y    (--)  Array of second independent variables for curve fit.
+/// @param[out]   out  (--)  Array of fitted variables at the specified inputs.
+/// @param[in]    n    (--)  Number of points.
+///
+/// @details  Returns this quadratic model fit at each point, with the inline model so the loop can
+///           be vectorized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void QuadraticFit::evaluateBatch(const double* x, const double* y, double* out, const int n)
+{
+    for (int i = 0; i < n; ++i) {
+        out[i] = QuadraticFit::evaluate(x[i], y[i]);
+    }
+}
+
 #endif
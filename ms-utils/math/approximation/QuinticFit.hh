@@ -52,6 +52,8 @@ class QuinticFit : public TsApproximation {
         double mF;     /**< (--) trick_chkpnt_io(**) Sixth coefficient for curve fit model. */
         /// @brief Returns the model fit for the specified variables.
         virtual double evaluate(const double x, const double y = 0.0) ;
+        /// @brief Returns the model fit at each of an array of points.
+        virtual void evaluateBatch(const double* x, const double* y, double* out, const int n);
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details  Copy constructor unavailable since declared private and not implemented.
@@ -78,5 +80,20 @@ inline double QuinticFit::evaluate(const double x, const double y __attribute__(
     return mA + (mB + (mC + (mD + (mE + mF * x) * x) * x) * x) * x;
 }
 
-#endif
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x    (--)  Array of first independent variables for curve fit.
+/// @param[in]    y    (--)  Array of second independent variables for curve fit.
+/// @param[out]   out  (--)  Array of fitted variables at the specified inputs.
+/// @param[in]    n    (--)  Number of points.
+///
+/// @details  Returns this quintic model fit at each point, with the inline model so the loop can be
+///           vectorized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void QuinticFit::evaluateBatch(const double* x, const double* y, double* out, const int n)
+{
+    for (int i = 0; i < n; ++i) {
+        out[i] = QuinticFit::evaluate(x[i], y[i]);
+    }
+}
 
+#endif
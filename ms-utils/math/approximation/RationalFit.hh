@@ -50,6 +50,8 @@ class RationalFit : public TsApproximation {
         double mD;     /**< (--) trick_chkpnt_io(**) Fourth coefficient for curve fit model. */
         /// @brief Returns the model fit for the specified variables.
         virtual double evaluate(const double x, const double y = 0.0) ;
+        /// @brief Returns the model fit at each of an array of points.
+        virtual void evaluateBatch(const double* x, const double* y, double* out, const int n);
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details
@@ -78,4 +80,20 @@ inline double RationalFit::evaluate(const double x, const double y __attribute__
     return (mA + mB * x) / (1.0 + (mC + mD * x) * x);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x    (--)  Array of first independent variables for curve fit.
+/// @param[in]    y    (--)  Array of second independent variables for curve fit.
+/// @param[out]   out  (--)  Array of fitted variables at the specified inputs.
+/// @param[in]    n    (--)  Number of points.
+///
+/// @details  Returns this rational model fit at each point, with the inline model so the loop can
+///           be vectorized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void RationalFit::evaluateBatch(const double* x, const double* y, double* out, const int n)
+{
+    for (int i = 0; i < n; ++i) {
+        out[i] = RationalFit::evaluate(x[i], y[i]);
+    }
+}
+
 #endif
@@ -49,6 +49,8 @@ class ShowmateFit : public TsApproximation {
         double mE;     /**< (--) trick_chkpnt_io(**) Fifth coefficient for curve fit model. */
         /// @brief Returns the model fit for the specified variables.
         virtual double evaluate(const double x, const double y = 0.0) ;
+        /// @brief Returns the model fit at each of an array of points.
+        virtual void evaluateBatch(const double* x, const double* y, double* out, const int n);
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details
@@ -79,4 +81,20 @@ inline double ShowmateFit::evaluate(const double x, const double y __attribute__
     return mA + (mB + (mC + mD * 0.001 * x) * 0.001 * x) * 0.001 * x + 1000000.0 * mE / (x * x);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x    (--)  Array of first independent variables for curve fit.
+/// @param[in]    y    (--)  Array of second independent variables for curve fit.
+/// @param[out]   out  (--)  Array of fitted variables at the specified inputs.
+/// @param[in]    n    (--)  Number of points.
+///
+/// @details  Returns this Showmate model fit at each point, with the inline model so the loop can
+///           be vectorized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void ShowmateFit::evaluateBatch(const double* x, const double* y, double* out, const int n)
+{
+    for (int i = 0; i < n; ++i) {
+        out[i] = ShowmateFit::evaluate(x[i], y[i]);
+    }
+}
+
 #endif
@@ -49,6 +49,8 @@ class SutherlandFit : public TsApproximation {
         double mB;     /**< (--) trick_chkpnt_io(**) Second coefficient for curve fit model. */
         /// @brief Returns the model fit for the specified variables.
         virtual double evaluate(const double x, const double y = 0.0) ;
+        /// @brief Returns the model fit at each of an array of points.
+        virtual void evaluateBatch(const double* x, const double* y, double* out, const int n);
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details
@@ -77,4 +79,20 @@ inline double SutherlandFit::evaluate(const double x, const double y __attribute
     return mA * sqrt(x * x * x) / (mB + x);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x    (--)  Array of first independent variables for curve fit.
+/// @param[in]    y    (--)  Array of second independent variables for curve fit.
+/// @param[out]   out  (--)  Array of fitted variables at the specified inputs.
+/// @param[in]    n    (--)  Number of points.
+///
+/// @details  Returns this Sutherland model fit at each point, with the inline model so the loop can
+///           be vectorized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void SutherlandFit::evaluateBatch(const double* x, const double* y, double* out, const int n)
+{
+    for (int i = 0; i < n; ++i) {
+        out[i] = SutherlandFit::evaluate(x[i], y[i]);
+    }
+}
+
 #endif
@@ -124,6 +124,57 @@ double TsApproximation::getExceptional(const double x, const double y)
     return evaluate(x, y);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x    (--)  Array of first independent variables.
+/// @param[in]    y    (--)  Array of second independent variables, or null for all zero.
+/// @param[out]   out  (--)  Array of approximated dependent variables at the specified inputs.
+/// @param[in]    n    (--)  Number of points.
+///
+/// @details  Returns this approximation at each point with bounding to the valid range, like the
+///           scalar get.  The points are bounded into local arrays BATCH_SIZE at a time and passed
+///           to evaluateBatch, so the derived class is called once per batch instead of once per
+///           point.  The output array may be the same as an input array.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsApproximation::get(const double* x, const double* y, double* out, const size_t n)
+{
+    double boundedX[BATCH_SIZE];
+    double boundedY[BATCH_SIZE];
+    for (size_t start = 0; start < n; start += BATCH_SIZE) {
+        const int size = (n - start < static_cast<size_t>(BATCH_SIZE))
+                       ? static_cast<int>(n - start) : BATCH_SIZE;
+        for (int i = 0; i < size; ++i) {
+            boundedX[i] = MsMath::limitRange(mMinX, x[start + i], mMaxX);
+        }
+        if (y) {
+            for (int i = 0; i < size; ++i) {
+                boundedY[i] = MsMath::limitRange(mMinY, y[start + i], mMaxY);
+            }
+        } else {
+            const double zero = MsMath::limitRange(mMinY, 0.0, mMaxY);
+            for (int i = 0; i < size; ++i) {
+                boundedY[i] = zero;
+            }
+        }
+        evaluateBatch(boundedX, boundedY, out + start, size);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x    (--)  Array of first independent variables, within the valid range.
+/// @param[in]    y    (--)  Array of second independent variables, within the valid range.
+/// @param[out]   out  (--)  Array of approximated dependent variables at the specified inputs.
+/// @param[in]    n    (--)  Number of points.
+///
+/// @details  Calls evaluate for each point.  The curve fits override this with a loop over their
+///           inline model, which the compiler can unroll and vectorize.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsApproximation::evaluateBatch(const double* x, const double* y, double* out, const int n)
+{
+    for (int i = 0; i < n; ++i) {
+        out[i] = evaluate(x[i], y[i]);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @return   Initialization status
 ///
@@ -22,6 +22,7 @@
 
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "math/MsMath.hh"
+#include <cstddef>
 #include <string>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -45,10 +46,20 @@ class TsApproximation {
                   const std::string &name = "TsApproximation");
         /// @brief    Returns the approximation with bounding on out of bounds input.
         double get(const double x, const double y = 0);
+        /// @brief    Returns the approximation at each of an array of points, with bounding.
+        void get(const double* x, const double* y, double* out, const size_t n);
         /// @brief    Returns the approximation with exception on out of bounds input.
         double getExceptional(const double x, const double y = 0);
         /// @brief   Returns initialization flag.
         bool isInitialized() const;
+        /// @brief    Returns the valid range lower limit for the first variable.
+        double getMinX() const;
+        /// @brief    Returns the valid range upper limit for the first variable.
+        double getMaxX() const;
+        /// @brief    Returns the valid range lower limit for the second variable.
+        double getMinY() const;
+        /// @brief    Returns the valid range upper limit for the second variable.
+        double getMaxY() const;
     protected:
         double mMinX;      /**<    (--) trick_chkpnt_io(**) Approximation valid range lower limit for first variable.  */
         double mMaxX;      /**<    (--) trick_chkpnt_io(**) Approximation valid range upper limit for first variable.  */
@@ -70,6 +81,10 @@ class TsApproximation {
         /// @details  Returns this approximation for the specified variables.
         ////////////////////////////////////////////////////////////////////////////////////////////
         virtual double evaluate(const double x, const double y = 0.0) = 0;
+        /// @brief    Returns the approximation at each of an array of points in the valid range.
+        virtual void evaluateBatch(const double* x, const double* y, double* out, const int n);
+        /// @brief    Number of points bounded & evaluated together by the batch get.
+        static const int BATCH_SIZE = 64;
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details  Copy constructor unavailable since declared private and not implemented.
@@ -97,4 +112,48 @@ inline double TsApproximation::get(const double x, const double y) {
     return evaluate(z, w);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   Valid range lower limit for the first variable.
+///
+/// @details  Returns the valid range lower limit for the first independent variable, to which
+///           get bounds its input.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double TsApproximation::getMinX() const
+{
+    return mMinX;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   Valid range upper limit for the first variable.
+///
+/// @details  Returns the valid range upper limit for the first independent variable, to which
+///           get bounds its input.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double TsApproximation::getMaxX() const
+{
+    return mMaxX;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   Valid range lower limit for the second variable.
+///
+/// @details  Returns the valid range lower limit for the second independent variable, to which
+///           get bounds its input.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double TsApproximation::getMinY() const
+{
+    return mMinY;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   Valid range upper limit for the second variable.
+///
+/// @details  Returns the valid range upper limit for the second independent variable, to which
+///           get bounds its input.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double TsApproximation::getMaxY() const
+{
+    return mMaxY;
+}
+
 #endif
@@ -1,6 +1,7 @@
 /************************** TRICK HEADER **********************************************************
  LIBRARY DEPENDENCY:
-    ((TsApproximation.o))
+    ((TsApproximation.o)
+     (TsBreakpointIndex.o))
  **************************************************************************************************/
 
 #include "GenericMacros.hh"
@@ -22,7 +23,9 @@ TsBilinearInterpolator::TsBilinearInterpolator()
     mM(0),
     mN(0),
     mI(0),
-    mJ(0)
+    mJ(0),
+    mIndexX(),
+    mIndexY()
 {
     // nothing to do
 }
@@ -41,8 +44,7 @@ TsBilinearInterpolator::TsBilinearInterpolator()
 ///
 /// @details  Constructs this Bilinear interpolator model taking coefficient and range arguments.
 ///           Determines whether both independent arrays are ordered, and swaps from descending to
-///           ascending order if necessary.  getExceptional should be called to get a first-pass
-///           value to minimize the time required for the initial search.
+///           ascending order if necessary.
 /// @throws TsInitializationException
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TsBilinearInterpolator::TsBilinearInterpolator(const double* x,    const double* y, const double* z,
@@ -58,7 +60,9 @@ TsBilinearInterpolator::TsBilinearInterpolator(const double* x,    const double*
         mM(m),
         mN(n),
         mI(0),
-        mJ(0)
+        mJ(0),
+        mIndexX(),
+        mIndexY()
 {
     init(x, y, z, m, n, minX, maxX, minY, maxY, name);
 }
@@ -111,8 +115,7 @@ void TsBilinearInterpolator::cleanup()
 ///
 /// @details  Initializes this Bilinear interpolator model taking coefficient and range arguments.
 ///           Determines whether both independent arrays are ordered, and swaps from descending to
-///           ascending order if necessary. getExceptional should be called to get a first-pass
-///           value to minimize the time required for the initial search.
+///           ascending order if necessary, and indexes both for cell lookup.
 /// @throws TsInitializationException
 void TsBilinearInterpolator::init(const double* x,    const double* y, const double* z,
                                   const int     m,    const int     n,
@@ -259,6 +262,13 @@ void TsBilinearInterpolator::init(const double* x,    const double* y, const dou
     mN = n;
     mI = 0;
     mJ = 0;
+
+    /// - Index the ascending independent variable arrays for cell lookup.
+    mIndexX.init(mX, mM);
+    mIndexY.init(mY, mN);
+
+    /// - Set the initialization complete flag.
+    mInitFlag = true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -268,54 +278,17 @@ void TsBilinearInterpolator::init(const double* x,    const double* y, const dou
 /// @return   bilinear interpolated dependent variable value at specified input.
 ///
 /// @details  Returns this bilinear interpolated for the specified variable.
-///           Saves previous indices mI and mJ.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 inline double TsBilinearInterpolator::evaluate(const double x, const double y)
 {
-    /// - Find index i such that mX[i] <= x < mX[i+1] starting at mI from previous call.
-    ///   Note that constructor guarantees mX is in strictly ascending order.
-    if (x >= mX[mI+1]) {
-        // If x increased enough, search up.
-        for (int i = mI + 1; i < mM; ++i) {
-            if (mX[i] >= x) {
-                mI = i - 1;
-                break;
-            }
-        }
-    } else if (x < mX[mI]) {
-        // If x decreased enough, search down.
-        for (int i = mI - 1; i >= 0; --i) {
-            if (mX[i] <= x) {
-                mI = i;
-                break;
-            }
-        }
-    }
-
-    /// - Find index i such that mY[i] <= y < mY[i+1] starting at mJ from previous call.
-    ///   Note that constructor guarantees mY is in strictly ascending order.
-    if (y >= mY[mJ+1]) {
-        // If y increased enough, search up.
-        for (int i = mJ + 1; i < mN; ++i) {
-            if (mY[i] >= y) {
-                mJ = i - 1;
-                break;
-            }
-        }
-    } else if (y < mY[mJ]) {
-        // If y decreased enough, search down.
-        for (int i = mJ - 1; i >= 0; --i) {
-            if (mY[i] <= y) {
-                mJ = i;
-                break;
-            }
-        }
-    }
+    /// - Find indices i & j such that mX[i] <= x < mX[i+1] and mY[j] <= y < mY[j+1].
+    const int i = mIndexX.find(x);
+    const int j = mIndexY.find(y);
 
     /// - Return the bilinearly interpolated value
     // No threat of division by zero since constructor guarantees mX[i+1] > mX[i] and mY[j+1] > mY[j]
-    const double XDifInv = 1.0 / (mX[mI+1] - mX[mI]);
-    const double Z1      = ((mX[mI+1] - x) * mZ[mI][mJ]   + (x - mX[mI]) * mZ[mI+1][mJ]);
-    const double Z2      = ((mX[mI+1] - x) * mZ[mI][mJ+1] + (x - mX[mI]) * mZ[mI+1][mJ+1]);
-    return (Z1 * (mY[mJ+1] - y) + Z2 * (y - mY[mJ])) * XDifInv / (mY[mJ+1] - mY[mJ]);
+    const double XDifInv = 1.0 / (mX[i+1] - mX[i]);
+    const double Z1      = ((mX[i+1] - x) * mZ[i][j]   + (x - mX[i]) * mZ[i+1][j]);
+    const double Z2      = ((mX[i+1] - x) * mZ[i][j+1] + (x - mX[i]) * mZ[i+1][j+1]);
+    return (Z1 * (mY[j+1] - y) + Z2 * (y - mY[j])) * XDifInv / (mY[j+1] - mY[j]);
 }
@@ -19,6 +19,7 @@ PURPOSE:
 */
 
 #include "TsApproximation.hh"
+#include "TsBreakpointIndex.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    Bilinear interpolation derived from abstract base class TsApproximation.
@@ -34,7 +35,9 @@ PURPOSE:
 ///              Z  = z      * (x   - x) / (x   - x ) + z        * (x - x ) / (x   - x )
 ///               2    i,j+1     i+1         i+1   i     i+1,j+1         i      i+1   i
 ///           \endverbatim
-///
+///           The cells i and j are found by a TsBreakpointIndex for each variable, so the lookup
+///           cost doesn't depend on how far the inputs moved since the previous call, and forward
+///           evaluation has no side effects.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class TsBilinearInterpolator : public TsApproximation {
     TS_MAKE_SIM_COMPATIBLE(TsBilinearInterpolator);
@@ -61,8 +64,10 @@ class TsBilinearInterpolator : public TsApproximation {
         double** mZ; /**< ** (--) trick_chkpnt_io(**) Array of values for the dependent array. */
         int      mM; /**<    (--) trick_chkpnt_io(**) Length of the first independent variable array. */
         int      mN; /**<    (--) trick_chkpnt_io(**) Length of the second independent variable array. */
-        int      mI; /**<    (--)                     Previous interpolation index (mX[mI] <= x < mX[mI+1]). */
-        int      mJ; /**<    (--)                     Previous interpolation index (mY[mJ] <= y < mY[mJ+1]). */
+        int      mI; /**<    (--)                     Previous reverse interpolation index (mX[mI] <= x < mX[mI+1]). */
+        int      mJ; /**<    (--)                     Previous reverse interpolation index (mY[mJ] <= y < mY[mJ+1]). */
+        TsBreakpointIndex mIndexX; /**< (--) trick_chkpnt_io(**) Cell lookup of the first independent variable array. */
+        TsBreakpointIndex mIndexY; /**< (--) trick_chkpnt_io(**) Cell lookup of the second independent variable array. */
         /// @brief    Returns the bilinear interpolated value for the specified variables.
         virtual double evaluate(const double x, const double y) ;
         /// @brief    Deletes dynamic memory
@@ -105,25 +105,8 @@ void TsBilinearInterpolatorReverse::init()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 double TsBilinearInterpolatorReverse::evaluate(const double x, const double z)
 {
-    /// - Find index i such that mX[i] <= x < mX[i+1] starting at mI from previous call.
-    ///   Note that constructor guarantees mX is in strictly ascending order.
-    if (x >= mX[mI+1]) {
-        // If x increased enough, search up.
-        for (int i = mI + 1; i < mM; ++i) {
-            if (mX[i] >= x) {
-                mI = i - 1;
-                break;
-            }
-        }
-    } else if (x < mX[mI]) {
-        // If x decreased enough, search down.
-        for (int i = mI - 1; i >= 0; --i) {
-            if (mX[i] <= x) {
-                mI = i;
-                break;
-            }
-        }
-    }
+    /// - Find index i such that mX[i] <= x < mX[i+1].
+    mI = mIndexX.find(x);
 
     /// - Store the fractional distance of the x argument across the bounding x scale points.
     //    No threat of division by zero since constructor guarantees mX[i+1] > mX[i].
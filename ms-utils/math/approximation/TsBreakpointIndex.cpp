@@ -0,0 +1,103 @@
+/**
+@file
+@brief    Interpolation Breakpoint Index implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ()
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "TsBreakpointIndex.hh"
+
+/// @details  One part per million of the interval keeps the one step correction of the direct
+///           index valid with ample margin for the rounding of tabulated breakpoints.
+const double TsBreakpointIndex::UNIFORM_TOLERANCE = 1.0e-6;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Interpolation Breakpoint Index.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsBreakpointIndex::TsBreakpointIndex()
+    :
+    mX(0),
+    mNumCells(0),
+    mUniform(false),
+    mOrigin(0.0),
+    mScale(0.0),
+    mNumBuckets(0),
+    mBuckets(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Interpolation Breakpoint Index.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsBreakpointIndex::~TsBreakpointIndex()
+{
+    cleanup();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes dynamic memory.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsBreakpointIndex::cleanup()
+{
+    delete [] mBuckets;
+    mBuckets    = 0;
+    mNumBuckets = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x  (--) Strictly ascending breakpoint array, at least two long.
+/// @param[in]    n  (--) Number of breakpoints.
+///
+/// @details  Checks the breakpoints for uniform spacing, and builds the bucket table when they
+///           aren't.  The caller is responsible for validating the breakpoints, as the
+///           interpolators already do.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsBreakpointIndex::init(const double* x, const int n)
+{
+    cleanup();
+    mX        = x;
+    mNumCells = n - 1;
+    mOrigin   = x[0];
+
+    /// - The breakpoints are uniform if each is within tolerance of its evenly spaced position.
+    const double range    = x[n-1] - x[0];
+    const double interval = range / mNumCells;
+    double       minInterval = range;
+    mUniform = true;
+    for (int i = 1; i < n; ++i) {
+        if (std::fabs(x[i] - (x[0] + i * interval)) > UNIFORM_TOLERANCE * interval) {
+            mUniform = false;
+        }
+        minInterval = std::min(minInterval, x[i] - x[i-1]);
+    }
+
+    if (mUniform) {
+        mScale = mNumCells / range;
+        return;
+    }
+
+    /// - Size the buckets to the smallest interval, limited to BUCKETS_PER_CELL per cell.
+    mNumBuckets = static_cast<int>(std::min(std::ceil(range / minInterval),
+                                            static_cast<double>(BUCKETS_PER_CELL * mNumCells)));
+    mScale      = mNumBuckets / range;
+    mBuckets    = new int[mNumBuckets + 1];
+
+    /// - The first cell of each bucket is the number of interior breakpoints in lower buckets.
+    ///   Mapping the breakpoints through the same bucket function as find makes the ranges
+    ///   consistent with it regardless of rounding.
+    std::fill(mBuckets, mBuckets + mNumBuckets + 1, 0);
+    for (int i = 1; i < mNumCells; ++i) {
+        ++mBuckets[bucket(x[i], mNumBuckets) + 1];
+    }
+    for (int b = 1; b <= mNumBuckets; ++b) {
+        mBuckets[b] += mBuckets[b-1];
+    }
+}
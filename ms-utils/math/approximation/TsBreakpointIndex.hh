@@ -0,0 +1,170 @@
+#ifndef TsBreakpointIndex_EXISTS
+#define TsBreakpointIndex_EXISTS
+
+/**
+@file
+@brief    Interpolation Breakpoint Index declarations
+
+@defgroup  TSM_UTILITIES_MATH_APPROXIMATION_BREAKPOINT_INDEX Interpolation Breakpoint Index
+@ingroup   TSM_UTILITIES_MATH_APPROXIMATION
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Finds the interpolation table cell containing a value in bounded time, independent of the cell
+   found for the previous value, for the linear & bilinear interpolators.)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The breakpoint array is strictly ascending, as the interpolators arrange it, and is not owned
+   by the index, so it must outlive the index and not be changed after init.)
+- (Lookup does not modify the index, so one index can be used from several threads.)
+
+LIBRARY DEPENDENCY:
+- ((TsBreakpointIndex.o))
+
+PROGRAMMERS:
+- ((agent) (agent@local) (2026-10) (Initial))
+
+@{
+*/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Interpolation Breakpoint Index.
+///
+/// @details  Maps a value to the index i of the cell with breakpoints x[i] <= value < x[i+1],
+///           limited to the first and last cells for values outside the breakpoints.
+///
+///           When the breakpoints are uniformly spaced, to within UNIFORM_TOLERANCE of the
+///           interval, the cell is found directly from the value's offset from the first
+///           breakpoint, with at most one step to correct for the deviation from exact spacing.
+///
+///           Otherwise the breakpoint range is split into equal width buckets, and each bucket
+///           stores the range of cells that values falling in it can be in.  The bucket is found
+///           directly, and the cell by bisection within its range.  There are enough buckets for
+///           one per smallest interval, up to BUCKETS_PER_CELL per cell, so each bucket spans one
+///           or two cells unless the breakpoints are strongly clustered, and never more than
+///           log2(number of cells) bisection steps.  The bucket ranges are found at init by
+///           mapping the breakpoints with the same arithmetic as the lookup, so rounding can't put
+///           a value in a bucket whose range excludes its cell.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class TsBreakpointIndex {
+    TS_MAKE_SIM_COMPATIBLE(TsBreakpointIndex);
+    public:
+        /// @brief    Largest deviation from exact spacing, relative to the interval, for uniform.
+        static const double UNIFORM_TOLERANCE;
+        /// @brief    Upper limit on the number of buckets per cell of non-uniform breakpoints.
+        static const int    BUCKETS_PER_CELL = 4;
+        /// @brief    Default constructs this Interpolation Breakpoint Index.
+        TsBreakpointIndex();
+        /// @brief    Default destructs this Interpolation Breakpoint Index.
+        virtual ~TsBreakpointIndex();
+        /// @brief    Initializes this index for the given strictly ascending breakpoints.
+        void init(const double* x, const int n);
+        /// @brief    Returns the index of the cell containing the given value.
+        int  find(const double x) const;
+        /// @brief    Returns whether the breakpoints were found to be uniformly spaced.
+        bool isUniform() const;
+        /// @brief    Returns the number of buckets of the non-uniform breakpoints.
+        int  getNumBuckets() const;
+    protected:
+        const double* mX;          /**< ** (--) trick_chkpnt_io(**) Breakpoint array, not owned. */
+        int           mNumCells;   /**<    (--) trick_chkpnt_io(**) Number of cells, one less than the number of breakpoints. */
+        bool          mUniform;    /**<    (--) trick_chkpnt_io(**) Breakpoints are uniformly spaced. */
+        double        mOrigin;     /**<    (--) trick_chkpnt_io(**) First breakpoint. */
+        double        mScale;      /**<    (--) trick_chkpnt_io(**) Cells, or buckets, per unit of the variable. */
+        int           mNumBuckets; /**<    (--) trick_chkpnt_io(**) Number of buckets of non-uniform breakpoints. */
+        int*          mBuckets;    /**< ** (--) trick_chkpnt_io(**) First cell of each bucket, and of one past the last bucket. */
+        /// @brief    Returns the bucket, or uniform cell, the given value falls in.
+        int  bucket(const double x, const int size) const;
+        /// @brief    Deletes dynamic memory.
+        void cleanup();
+    private:
+        /// @brief    Copy constructor unavailable since declared private and not implemented.
+        TsBreakpointIndex(const TsBreakpointIndex&);
+        /// @brief    Assignment operator unavailable since declared private and not implemented.
+        TsBreakpointIndex& operator =(const TsBreakpointIndex&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   bool (--) True if the breakpoints were found to be uniformly spaced.
+///
+/// @details  Returns mUniform.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool TsBreakpointIndex::isUniform() const
+{
+    return mUniform;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   int (--) Number of buckets of the non-uniform breakpoints, zero when uniform.
+///
+/// @details  Returns mNumBuckets.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int TsBreakpointIndex::getNumBuckets() const
+{
+    return mNumBuckets;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x     (--) Value to map.
+/// @param[in]    size  (--) Number of buckets, or uniform cells.
+///
+/// @return   int (--) Bucket, or uniform cell, the value falls in, limited to 0 to size - 1.
+///
+/// @details  The limits are tested on the scaled offset before the conversion to int, so that
+///           values far out of range, and NaN, map to a valid bucket.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int TsBreakpointIndex::bucket(const double x, const int size) const
+{
+    const double u = (x - mOrigin) * mScale;
+    if (not (u > 0.0)) {
+        return 0;
+    }
+    if (u >= size - 1) {
+        return size - 1;
+    }
+    return static_cast<int>(u);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x  (--) Value to find the cell of.
+///
+/// @return   int (--) Index i of the cell with x[i] <= value < x[i+1], from 0 to cells - 1.
+///
+/// @details  Uniform breakpoints step at most one cell from the direct index.  Non-uniform
+///           breakpoints bisect the cell range of the value's bucket, which is usually one or two
+///           cells.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int TsBreakpointIndex::find(const double x) const
+{
+    if (mUniform) {
+        int i = bucket(x, mNumCells);
+        if (x < mX[i] and i > 0) {
+            --i;
+        } else if (x >= mX[i+1] and i < mNumCells - 1) {
+            ++i;
+        }
+        return i;
+    }
+
+    const int b  = bucket(x, mNumBuckets);
+    int       lo = mBuckets[b];
+    int       hi = mBuckets[b+1];
+    while (lo < hi) {
+        const int mid = (lo + hi + 1) / 2;
+        if (mX[mid] <= x) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return lo;
+}
+
+#endif
@@ -1,6 +1,7 @@
 /************************** TRICK HEADER **********************************************************
  LIBRARY DEPENDENCY:
     ((TsApproximation.o)
+     (TsBreakpointIndex.o)
      (simulation/hs/TsHsMsg.o))
  **************************************************************************************************/
 
@@ -19,7 +20,7 @@ TsLinearInterpolator::TsLinearInterpolator()
     mX(0),
     mZ(0),
     mM(0),
-    mI(0)
+    mIndex()
 {
     // nothing to do
 }
@@ -34,8 +35,7 @@ TsLinearInterpolator::TsLinearInterpolator()
 ///
 /// @details  Constructs this Linear interpolator model taking coefficient and range arguments.
 ///           Determines whether independent array is strictly ordered, and swaps from descending to
-///           ascending order if necessary.  getExceptional should be called to get a first-pass value to minimize
-///           the time required for the initial search.
+///           ascending order if necessary.
 /// @throws TsInitializationException
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TsLinearInterpolator::TsLinearInterpolator(const double* x,   const double* z,   const int n,
@@ -46,7 +46,7 @@ TsLinearInterpolator::TsLinearInterpolator(const double* x,   const double* z,
         mX(0),
         mZ(0),
         mM(n),
-        mI(0)
+        mIndex()
 {
     init(x, z, n, minX, maxX, name);
 }
@@ -114,8 +114,7 @@ void TsLinearInterpolator::validateOrdered(const int n, const double x[])
 /// @param[in]    name  (--) name for the instance.
 ///
 /// @details  Initialization of linear interpolator. Validates parameters and creates copy of
-/// the x and y data.  getExceptional should be called to get a first-pass value to minimize
-/// the time required for the initial search.
+/// the x and y data, and indexes the x data for cell lookup.
 /// @throws TsInitializationException
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void TsLinearInterpolator::init(const double *x, const double *z, const int n,
@@ -174,51 +173,14 @@ void TsLinearInterpolator::init(const double *x, const double *z, const int n,
         TS_GENERIC_ERREX(TsInitializationException, "Invalid Input Argument", "independent variable (x) array does not cover valid range.");
     }
 
+    /// - Index the ascending independent variable array for cell lookup.
+    mIndex.init(mX, mM);
+
     /// - Set the flag to indicate successful initialization.
     mInitFlag = true;
 
 }
 
-////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in]      x      (--) value to find index for cell
-/// @param[in]      mX     (--) array of cell bounds
-/// @param[in]      size   (--) number of elements of mX
-/// @param[in,out]  cIndex (--) previous index found
-/// @details  determines index:
-///      mIndex  criteria
-///         0       x < mX[0]
-///         i    mX[i] <= x <mX[i+1]
-///         N-1  mX[N-1] < x, where N is the table size
-/// Searches linearly staring from cIndex - steps to next cell
-/// Provides a basis for refactoring out the search algorithm. An alternate approach could be to use
-/// bisection (if there is no expectation that the next x value will be close to the current value.
-/// @return index of cell for x
-////////////////////////////////////////////////////////////////////////////////////////////////////
-inline int  TsLinearInterpolator::selectCell(const double x, const double mX[], const int size, int cIndex)
-{
-
-    if (x >= mX[cIndex+1]) {
-        cIndex++;
-        // If x increased enough, search up.
-        for (; cIndex < size-1; ++cIndex) {
-            if (mX[cIndex] > x) {
-                break;
-            }
-        }
-        cIndex--;
-    } else if (x < mX[cIndex] && cIndex > 0) {
-        // If x decreased enough, search down.
-       cIndex--;
-        for (; cIndex > 0; --cIndex) {
-            if (mX[cIndex] <= x) {
-                break;
-            }
-        }
-    }
-    return cIndex;
-
-}
-
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]    x  (--)  First independent variable for interpolator model.
 /// @param[in]    y  (--)  Second independent variable for interpolator model (defaults to zero since not used).
@@ -227,14 +189,27 @@ inline int  TsLinearInterpolator::selectCell(const double x, const double mX[],
 ///
 /// @details  Returns this linear interpolator model for the specified variable.
 ///           The user of this method is responsible for ensuring initialization has occurred.
-///           Saves previous index mI.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 inline double TsLinearInterpolator::evaluate(const double x, const double y __attribute__((unused)))
 {
-
-    mI = selectCell(x, mX, mM, mI);
+    const int i = mIndex.find(x);
     /// - Return the linearly interpolated value.
-    return mZ[mI] + (mZ[mI+1] - mZ[mI]) * (x - mX[mI]) / (mX[mI+1] - mX[mI]);
+    return mZ[i] + (mZ[i+1] - mZ[i]) * (x - mX[i]) / (mX[i+1] - mX[i]);
 }
 
-
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x    (--)  Array of independent variables for interpolator model.
+/// @param[in]    y    (--)  Not used.
+/// @param[out]   out  (--)  Array of interpolated dependent variables at the specified inputs.
+/// @param[in]    n    (--)  Number of points.
+///
+/// @details  Interpolates at each point with the inline evaluate.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsLinearInterpolator::evaluateBatch(const double* x,
+                                         const double* y __attribute__((unused)),
+                                         double* out, const int n)
+{
+    for (int i = 0; i < n; ++i) {
+        out[i] = TsLinearInterpolator::evaluate(x[i]);
+    }
+}
@@ -19,6 +19,7 @@
  */
 
 #include "TsApproximation.hh"
+#include "TsBreakpointIndex.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    Linear interpolator derived from abstract base class TsApproximation.
@@ -28,6 +29,8 @@
 ///           z + ((z    -z ) * (x - x )/(x    -x )
 ///            i     i+1   i          i    i+1   i
 ///           \endverbatim
+///           The cell i is found by a TsBreakpointIndex, so the lookup cost doesn't depend on how
+///           far the input moved since the previous call, and evaluation has no side effects.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class TsLinearInterpolator: public TsApproximation {
     TS_MAKE_SIM_COMPATIBLE(TsLinearInterpolator);
@@ -47,11 +50,11 @@ class TsLinearInterpolator: public TsApproximation {
         double* mX; /**< ** (--) trick_chkpnt_io(**) Array of values for the independent variable. */
         double* mZ; /**< ** (--) trick_chkpnt_io(**) Array of values for the dependent variable. */
         int     mM; /**<    (--) trick_chkpnt_io(**) Length of the independent and dependent variable arrays. */
-        int     mI; /**<    (--)                     Previous interpolation index (mX[mI] <= x < mX[mI+1]). */
+        TsBreakpointIndex mIndex; /**< (--) trick_chkpnt_io(**) Cell lookup of the independent variable array. */
         /// @brief    Returns the linear interpolated value for the specified variables.
         virtual double evaluate(const double x, const double = 0.0);
-        /// @brief    returns index to use in interpolation
-        static int selectCell(const double x, const double mX[], const int size, int cIndex = 0);
+        /// @brief    Returns the linear interpolated value at each of an array of points.
+        virtual void evaluateBatch(const double* x, const double* y, double* out, const int n);
         /// @brief    validates the input array x is sequentially ordered (increasing or decreasing)
         void  validateOrdered(const int n, const double x[]);
         /// @brief    Deletes dynamic memory
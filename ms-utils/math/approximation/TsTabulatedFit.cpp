@@ -0,0 +1,277 @@
+/**
+@file
+@brief    Tabulated Approximation implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((math/approximation/TsApproximation.o))
+*/
+
+#include <algorithm>
+#include <cfloat>
+
+#include "GenericMacros.hh"
+#include "software/exceptions/TsHsException.hh"
+#include "software/exceptions/TsInitializationException.hh"
+
+#include "TsTabulatedFit.hh"
+
+/// @details  Relative errors are measured against at least this fraction of the largest source
+///           magnitude on the grid.
+const double TsTabulatedFit::ERROR_FLOOR = 1.0e-3;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Tabulated Approximation.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsTabulatedFit::TsTabulatedFit()
+    :
+    TsApproximation(),
+    mSpacingX(UNIFORM),
+    mSpacingY(UNIFORM),
+    mSizeX(0),
+    mSizeY(0),
+    mOriginX(0.0),
+    mOriginY(0.0),
+    mScaleX(0.0),
+    mScaleY(0.0),
+    mTable(),
+    mTolerance(0.0),
+    mMaxError(0.0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    source     (--) Approximation to tabulate.
+/// @param[in]    tolerance  (--) Relative error tolerance against the source.
+/// @param[in]    maxPoints  (--) Maximum number of grid points in each tabulated variable.
+/// @param[in]    spacingX   (--) Grid point spacing in the first variable.
+/// @param[in]    spacingY   (--) Grid point spacing in the second variable.
+/// @param[in]    name       (--) Name for the instance.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Constructs this Tabulated Approximation by sampling the given source approximation.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsTabulatedFit::TsTabulatedFit(TsApproximation& source, const double tolerance,
+                               const int maxPoints, const Spacing spacingX,
+                               const Spacing spacingY, const std::string& name)
+    :
+    TsApproximation(),
+    mSpacingX(spacingX),
+    mSpacingY(spacingY),
+    mSizeX(0),
+    mSizeY(0),
+    mOriginX(0.0),
+    mOriginY(0.0),
+    mScaleX(0.0),
+    mScaleY(0.0),
+    mTable(),
+    mTolerance(tolerance),
+    mMaxError(0.0)
+{
+    init(source, tolerance, maxPoints, spacingX, spacingY, name);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Tabulated Approximation.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsTabulatedFit::~TsTabulatedFit()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    source     (--) Approximation to tabulate.
+/// @param[in]    tolerance  (--) Relative error tolerance against the source.
+/// @param[in]    maxPoints  (--) Maximum number of grid points in each tabulated variable.
+/// @param[in]    spacingX   (--) Grid point spacing in the first variable.
+/// @param[in]    spacingY   (--) Grid point spacing in the second variable.
+/// @param[in]    name       (--) Name for the instance.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Takes the valid range of the source approximation, and samples the source on a grid
+///           that is refined in each variable until the tolerance is met or the maximum number of
+///           points is reached.  Not meeting the tolerance is not an error; the caller can check
+///           isWithinTolerance and decide whether to use the table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsTabulatedFit::init(TsApproximation& source, const double tolerance, const int maxPoints,
+                          const Spacing spacingX, const Spacing spacingY,
+                          const std::string& name)
+{
+    /// - Initialize the parent with the source valid range.
+    TsApproximation::init(source.getMinX(), source.getMaxX(), source.getMinY(), source.getMaxY(),
+                          name);
+
+    /// - Reset the initialization complete flag.
+    mInitFlag = false;
+
+    /// - Throw a TsInitializationException exception on an uninitialized source.
+    TS_GENERIC_IF_ERREX(not source.isInitialized(), TsInitializationException,
+                        "Invalid Input Argument", "Source approximation is not initialized.");
+
+    /// - Throw a TsInitializationException exception on a non-positive tolerance.
+    TS_GENERIC_IF_ERREX((tolerance <= 0.0), TsInitializationException,
+                        "Invalid Input Argument", "Tolerance is not positive.");
+
+    /// - Throw a TsInitializationException exception on too few maximum points.
+    TS_GENERIC_IF_ERREX((maxPoints < MIN_POINTS), TsInitializationException,
+                        "Invalid Input Argument", "Maximum points is less than MIN_POINTS.");
+
+    /// - The source is univariate if its second variable range is the curve fits' +/- FLT_EPSILON.
+    const bool univariate = (mMaxY - mMinY) <= 2.0 * static_cast<double>(FLT_EPSILON);
+
+    /// - Throw a TsInitializationException exception on logarithmic spacing of a range that isn't
+    ///   positive.
+    TS_GENERIC_IF_ERREX((LOGARITHMIC == spacingX and mMinX <= 0.0), TsInitializationException,
+                        "Invalid Input Argument", "Logarithmic spacing of a non-positive x range.");
+    TS_GENERIC_IF_ERREX((LOGARITHMIC == spacingY and not univariate and mMinY <= 0.0),
+                        TsInitializationException,
+                        "Invalid Input Argument", "Logarithmic spacing of a non-positive y range.");
+
+    mSpacingX  = spacingX;
+    mSpacingY  = univariate ? UNIFORM : spacingY;
+    mTolerance = tolerance;
+    mSizeX     = MIN_POINTS;
+    mSizeY     = univariate ? 1 : MIN_POINTS;
+
+    /// - Sample the source, and double the intervals in each variable whose midpoint error is out
+    ///   of tolerance until the tolerance is met or no variable can be refined.
+    for (;;) {
+        build(source);
+        double errorX      = 0.0;
+        double errorY      = 0.0;
+        double errorCenter = 0.0;
+        measureError(source, errorX, errorY, errorCenter);
+        mMaxError = std::max(std::max(errorX, errorY), errorCenter);
+        if (mMaxError <= mTolerance) {
+            break;
+        }
+        /// - Only the interval centers being out of tolerance refines both variables.
+        const bool centerOnly = errorX <= mTolerance and errorY <= mTolerance;
+        const bool refineX    = (centerOnly or errorX > mTolerance) and 2 * mSizeX - 1 <= maxPoints;
+        const bool refineY    = (centerOnly or errorY > mTolerance) and mSizeY > 1
+                              and 2 * mSizeY - 1 <= maxPoints;
+        if (not (refineX or refineY)) {
+            break;
+        }
+        if (refineX) {
+            mSizeX = 2 * mSizeX - 1;
+        }
+        if (refineY) {
+            mSizeY = 2 * mSizeY - 1;
+        }
+    }
+
+    /// - Set the initialization complete flag.
+    mInitFlag = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    source  (--) Approximation to tabulate.
+///
+/// @details  Sets the grid origin & scale for the current sizes, and stores the source values at
+///           the grid points.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsTabulatedFit::build(TsApproximation& source)
+{
+    if (LOGARITHMIC == mSpacingX) {
+        mOriginX = std::log(mMinX);
+        mScaleX  = (mSizeX - 1) / (std::log(mMaxX) - mOriginX);
+    } else {
+        mOriginX = mMinX;
+        mScaleX  = (mSizeX - 1) / (mMaxX - mMinX);
+    }
+    if (1 == mSizeY) {
+        mOriginY = 0.0;
+        mScaleY  = 0.0;
+    } else if (LOGARITHMIC == mSpacingY) {
+        mOriginY = std::log(mMinY);
+        mScaleY  = (mSizeY - 1) / (std::log(mMaxY) - mOriginY);
+    } else {
+        mOriginY = mMinY;
+        mScaleY  = (mSizeY - 1) / (mMaxY - mMinY);
+    }
+
+    mTable.resize(mSizeX * mSizeY);
+    for (int i = 0; i < mSizeX; ++i) {
+        const double x = gridPoint(i, mSizeX, mMinX, mMaxX, mSpacingX);
+        for (int j = 0; j < mSizeY; ++j) {
+            const double y = (1 == mSizeY) ? 0.0 : gridPoint(j, mSizeY, mMinY, mMaxY, mSpacingY);
+            mTable[i * mSizeY + j] = source.get(x, y);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    source       (--) Approximation that was tabulated.
+/// @param[out]   errorX       (--) Largest relative error at the first variable interval midpoints.
+/// @param[out]   errorY       (--) Largest relative error at the second variable interval midpoints.
+/// @param[out]   errorCenter  (--) Largest relative error at the interval centers.
+///
+/// @details  Compares the table to the source at the midpoints of the first variable intervals on
+///           the second variable grid points, at the midpoints of the second variable intervals on
+///           the first variable grid points, and at the centers of the intervals.  Errors that
+///           aren't finite, from a source that isn't, are counted as out of any tolerance.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsTabulatedFit::measureError(TsApproximation& source, double& errorX, double& errorY,
+                                  double& errorCenter)
+{
+    double fullScale = 0.0;
+    for (unsigned int k = 0; k < mTable.size(); ++k) {
+        fullScale = std::max(fullScale, std::fabs(mTable[k]));
+    }
+    const double floor = std::max(ERROR_FLOOR * fullScale, DBL_MIN);
+
+    errorX      = 0.0;
+    errorY      = 0.0;
+    errorCenter = 0.0;
+    const int stepsY = (1 == mSizeY) ? 1 : 2 * mSizeY - 1;
+    for (int i = 0; i < 2 * mSizeX - 1; ++i) {
+        const double x = gridPoint(0.5 * i, mSizeX, mMinX, mMaxX, mSpacingX);
+        for (int j = 0; j < stepsY; ++j) {
+            const bool midX = (1 == i % 2);
+            const bool midY = (1 == j % 2);
+            if (not (midX or midY)) {
+                continue;
+            }
+            const double y = (1 == mSizeY) ? 0.0
+                           : gridPoint(0.5 * j, mSizeY, mMinY, mMaxY, mSpacingY);
+            const double expected = source.get(x, y);
+            double error = std::fabs(get(x, y) - expected) / std::max(std::fabs(expected), floor);
+            if (not (error <= DBL_MAX)) {
+                error = DBL_MAX;
+            }
+            double& measured = (midX and midY) ? errorCenter : (midX ? errorX : errorY);
+            measured = std::max(measured, error);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    index    (--) Grid index, which may be fractional.
+/// @param[in]    size     (--) Number of grid points.
+/// @param[in]    min      (--) Variable value at the first grid point.
+/// @param[in]    max      (--) Variable value at the last grid point.
+/// @param[in]    spacing  (--) Grid point spacing.
+///
+/// @returns  double (--) Value of the variable at the grid index.
+///
+/// @details  The last grid point is returned as exactly the maximum, so that rounding in the
+///           logarithm can't move it out of the valid range.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double TsTabulatedFit::gridPoint(const double index, const int size, const double min,
+                                 const double max, const Spacing spacing) const
+{
+    if (index >= size - 1) {
+        return max;
+    }
+    const double fraction = index / (size - 1);
+    if (LOGARITHMIC == spacing) {
+        return std::exp(std::log(min) + fraction * (std::log(max) - std::log(min)));
+    }
+    return min + fraction * (max - min);
+}
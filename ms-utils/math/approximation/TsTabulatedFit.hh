@@ -0,0 +1,211 @@
+#ifndef TsTabulatedFit_EXISTS
+#define TsTabulatedFit_EXISTS
+
+/**
+@file
+@brief    Tabulated Approximation declarations
+
+@defgroup  TSM_UTILITIES_MATH_APPROXIMATION_TABULATED Tabulated Approximation
+@ingroup   TSM_UTILITIES_MATH_APPROXIMATION
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Provides a regular-grid table of another approximation, sampled once at initialization, so that
+   each later evaluation is index arithmetic and a linear or bilinear interpolation instead of the
+   source approximation's own evaluation or table search.)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The table covers the source approximation's valid range, so it bounds its inputs the same way.)
+- (A source whose second variable range is no wider than the +/- FLT_EPSILON range given by the
+   univariate curve fits is treated as univariate, and is tabulated in the first variable only.)
+- (Logarithmic spacing of a variable is only available when its range is positive.)
+- (Evaluation does not modify the table, so one table can be evaluated from several threads.)
+
+LIBRARY DEPENDENCY:
+- ((TsTabulatedFit.o))
+
+PROGRAMMERS:
+- ((agent) (agent@local) (2026-10) (Initial))
+
+@{
+*/
+
+#include "TsApproximation.hh"
+#include <cmath>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Tabulated Approximation.
+///
+/// @details  Samples a source approximation on a grid of points over its valid range, uniformly
+///           or logarithmically spaced in each variable, and interpolates linearly between the
+///           grid points.  The grid starts with MIN_POINTS points in each tabulated variable, and
+///           the number of intervals in a variable is doubled while the largest error between the
+///           table and the source at the interval midpoints in that variable, or at the interval
+///           centers, exceeds the tolerance, up to the given maximum number of points.  The error at
+///           each check point is relative to the larger of the source value and ERROR_FLOOR times
+///           the largest source magnitude on the grid, so that values near zero do not dominate.
+///           The largest error found is kept for reporting, along with whether it met the
+///           tolerance.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class TsTabulatedFit : public TsApproximation {
+    TS_MAKE_SIM_COMPATIBLE(TsTabulatedFit);
+    public:
+        /// @brief Enumeration of the grid point spacings.
+        enum Spacing {
+            UNIFORM     = 0, ///< Points are evenly spaced in the variable.
+            LOGARITHMIC = 1  ///< Points are evenly spaced in the logarithm of the variable.
+        };
+        /// @brief    Initial number of grid points in each tabulated variable.
+        static const int    MIN_POINTS  = 17;
+        /// @brief    Fraction of the largest source magnitude used as the floor for relative error.
+        static const double ERROR_FLOOR;
+        /// @brief Default constructs this Tabulated Approximation.
+        TsTabulatedFit();
+        /// @brief Constructs this Tabulated Approximation from the given source approximation.
+        TsTabulatedFit(TsApproximation& source, const double tolerance, const int maxPoints,
+                       const Spacing spacingX = UNIFORM, const Spacing spacingY = UNIFORM,
+                       const std::string& name = "TsTabulatedFit");
+        /// @brief Default destructs this Tabulated Approximation.
+        virtual ~TsTabulatedFit();
+        /// @brief Initializes this Tabulated Approximation from the given source approximation.
+        void   init(TsApproximation& source, const double tolerance, const int maxPoints,
+                    const Spacing spacingX = UNIFORM, const Spacing spacingY = UNIFORM,
+                    const std::string& name = "TsTabulatedFit");
+        /// @brief Returns the number of grid points in the first variable.
+        int    getSizeX() const;
+        /// @brief Returns the number of grid points in the second variable.
+        int    getSizeY() const;
+        /// @brief Returns the largest relative error against the source found at initialization.
+        double getMaxError() const;
+        /// @brief Returns whether the largest error found at initialization met the tolerance.
+        bool   isWithinTolerance() const;
+    protected:
+        Spacing             mSpacingX;  /**<    (--) trick_chkpnt_io(**) Grid point spacing in the first variable. */
+        Spacing             mSpacingY;  /**<    (--) trick_chkpnt_io(**) Grid point spacing in the second variable. */
+        int                 mSizeX;     /**<    (--) trick_chkpnt_io(**) Number of grid points in the first variable. */
+        int                 mSizeY;     /**<    (--) trick_chkpnt_io(**) Number of grid points in the second variable, 1 when univariate. */
+        double              mOriginX;   /**<    (--) trick_chkpnt_io(**) First variable, or its logarithm, at the first grid point. */
+        double              mOriginY;   /**<    (--) trick_chkpnt_io(**) Second variable, or its logarithm, at the first grid point. */
+        double              mScaleX;    /**<    (--) trick_chkpnt_io(**) Grid intervals per unit of the first variable or its logarithm. */
+        double              mScaleY;    /**<    (--) trick_chkpnt_io(**) Grid intervals per unit of the second variable or its logarithm. */
+        std::vector<double> mTable;     /**< ** (--) trick_chkpnt_io(**) Source values at the grid points, second variable varying fastest. */
+        double              mTolerance; /**<    (--) trick_chkpnt_io(**) Relative error tolerance against the source. */
+        double              mMaxError;  /**<    (--) trick_chkpnt_io(**) Largest relative error against the source found at initialization. */
+        /// @brief Returns the interpolated table value for the specified variables.
+        virtual double evaluate(const double x, const double y);
+        /// @brief Returns the interpolated table value at each of an array of points.
+        virtual void   evaluateBatch(const double* x, const double* y, double* out, const int n);
+        /// @brief Samples the source approximation at the grid points.
+        void   build(TsApproximation& source);
+        /// @brief Measures the largest relative errors against the source at the interval midpoints.
+        void   measureError(TsApproximation& source, double& errorX, double& errorY,
+                            double& errorCenter);
+        /// @brief Returns the value of a variable at the given, possibly fractional, grid index.
+        double gridPoint(const double index, const int size, const double min, const double max,
+                         const Spacing spacing) const;
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        TsTabulatedFit(const TsTabulatedFit&);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        TsTabulatedFit& operator =(const TsTabulatedFit&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   int (--) Number of grid points in the first variable.
+///
+/// @details  Returns mSizeX.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int TsTabulatedFit::getSizeX() const
+{
+    return mSizeX;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   int (--) Number of grid points in the second variable.
+///
+/// @details  Returns mSizeY, which is 1 for a univariate source.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int TsTabulatedFit::getSizeY() const
+{
+    return mSizeY;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   double (--) Largest relative error against the source found at initialization.
+///
+/// @details  Returns mMaxError.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double TsTabulatedFit::getMaxError() const
+{
+    return mMaxError;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   bool (--) True if the largest error found at initialization met the tolerance.
+///
+/// @details  Returns whether mMaxError is no more than mTolerance.  This is false when the maximum
+///           number of grid points was reached before the tolerance was met.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool TsTabulatedFit::isWithinTolerance() const
+{
+    return mMaxError <= mTolerance;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x  (--)  First independent variable, within the valid range.
+/// @param[in]    y  (--)  Second independent variable, within the valid range.
+///
+/// @return   double (--) Interpolated table value at the specified input.
+///
+/// @details  Finds the grid interval containing each variable directly from its offset from the
+///           first grid point, and interpolates linearly (univariate) or bilinearly (bivariate).
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double TsTabulatedFit::evaluate(const double x, const double y)
+{
+    double u = (LOGARITHMIC == mSpacingX) ? std::log(x) : x;
+    u = (u - mOriginX) * mScaleX;
+    int i = static_cast<int>(u);
+    i = (i < 0) ? 0 : ((i > mSizeX - 2) ? mSizeX - 2 : i);
+    const double fx = u - i;
+
+    if (1 == mSizeY) {
+        const double* z = &mTable[i];
+        return z[0] + fx * (z[1] - z[0]);
+    }
+
+    double v = (LOGARITHMIC == mSpacingY) ? std::log(y) : y;
+    v = (v - mOriginY) * mScaleY;
+    int j = static_cast<int>(v);
+    j = (j < 0) ? 0 : ((j > mSizeY - 2) ? mSizeY - 2 : j);
+    const double fy = v - j;
+
+    const double* z0 = &mTable[i * mSizeY + j];
+    const double* z1 = z0 + mSizeY;
+    const double  a  = z0[0] + fy * (z0[1] - z0[0]);
+    const double  b  = z1[0] + fy * (z1[1] - z1[0]);
+    return a + fx * (b - a);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x    (--)  Array of first independent variables, within the valid range.
+/// @param[in]    y    (--)  Array of second independent variables, within the valid range.
+/// @param[out]   out  (--)  Array of interpolated table values at the specified inputs.
+/// @param[in]    n    (--)  Number of points.
+///
+/// @details  Interpolates the table at each point with the inline evaluate.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void TsTabulatedFit::evaluateBatch(const double* x, const double* y, double* out,
+                                          const int n)
+{
+    for (int i = 0; i < n; ++i) {
+        out[i] = TsTabulatedFit::evaluate(x[i], y[i]);
+    }
+}
+
+#endif
@@ -38,6 +38,8 @@
 #include "math/approximation/RationalFit.hh"
 #include "math/approximation/ShowmateFit.hh"
 #include "math/approximation/SutherlandFit.hh"
+#include "properties/FluidHvapFit.hh"
+#include "properties/FluidTsatFit.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
 
@@ -1126,3 +1128,100 @@ void UtTsCurveFit::testEmptyConstructors()
     std::cout << "... Pass." << std::endl;
     std::cout << ".--------------------------------------------------------------------------------";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  fit  (--) Curve fit to verify.
+///
+/// @details  Verifies the batch get of the given curve fit matches the scalar get at points spread
+///           past both ends of the valid range, with and without a second variable array, and in
+///           place over the first variable array.  The number of points isn't a multiple of the
+///           batch size, so a partial batch is covered.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsCurveFit::verifyBatch(TsApproximation& fit)
+{
+    const int    n      = 150;
+    const double rangeX = fit.getMaxX() - fit.getMinX();
+    const double rangeY = fit.getMaxY() - fit.getMinY();
+    double x[n];
+    double y[n];
+    double out[n];
+    for (int i = 0; i < n; ++i) {
+        x[i] = fit.getMinX() + rangeX * (1.5 * i / (n - 1) - 0.25);
+        y[i] = fit.getMaxY() - rangeY * (1.5 * ((7 * i) % n) / (n - 1) - 0.25);
+    }
+
+    fit.get(x, y, out, n);
+    for (int i = 0; i < n; ++i) {
+        const double expected = fit.get(x[i], y[i]);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, out[i], 4.0 * DBL_EPSILON * std::fabs(expected));
+    }
+
+    fit.get(x, 0, out, n);
+    for (int i = 0; i < n; ++i) {
+        const double expected = fit.get(x[i]);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, out[i], 4.0 * DBL_EPSILON * std::fabs(expected));
+    }
+
+    fit.get(x, y, y, n);
+    for (int i = 0; i < n; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(fit.get(x[i], fit.getMaxY() - rangeY
+                                     * (1.5 * ((7 * i) % n) / (n - 1) - 0.25)), y[i],
+                                     4.0 * DBL_EPSILON * std::fabs(y[i]));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the batch get of every curve fit against its scalar get.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsCurveFit::testBatch()
+{
+    std::cout << "\n Curve Fit 33: Batch Evaluation                                         ";
+
+    LinearFit        linear(1.0, 2.0, -10.0, 10.0);
+    QuadraticFit     quadratic(1.0, 2.0, 3.0, -10.0, 10.0);
+    CubicFit         cubic(1.0, 2.0, 3.0, 4.0, -10.0, 10.0);
+    QuarticFit       quartic(1.0, 2.0, 3.0, 4.0, 5.0, -10.0, 10.0);
+    QuinticFit       quintic(1.0, 2.0, 3.0, 4.0, 5.0, 6.0, -10.0, 10.0);
+    PowerFit         power(2.0, 0.9, -10.0, 10.0);
+    ExponentialFit   exponential(-1.0, 2.0, -3.0, 10.0, 1000.0);
+    InvLinearFit     invLinear(101.0, -21.0, 0.3, -201.0, -199.0);
+    InvQuadraticFit  invQuadratic(-1.0, 22.0, -330.0, 10.0, 12.0);
+    RationalFit      rational(1.0, -2.0, 3.0, -4.0, 315.0, 317.0);
+    ShowmateFit      showmate(1.0, -2.0, 3.0, -4.0, 5.0, 31600.0, 31620.0);
+    SutherlandFit    sutherland(2.0, -3.0, 99.0, 101.0);
+    QuadraticRootFit quadraticRoot(8.679227E+002, 1.785E-001, 200.0, 400.0);
+    ProductFit       product(3.0, 1.0, 10.0, -5.0, 5.0);
+    QuotientFit      quotient(3.0, 1.0, 10.0, -5.0, 5.0);
+    QuadLinFit       quadLin(1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 9.0, 10.0, 12.0);
+    QuadLinInvFit    quadLinInv(1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 9.0, 600.0, 800.0);
+    FluidTsatFit     tsat(5.904077, -2.314267, -0.05184318, 15.0, 3000.0);
+    FluidHvapFit     hvap(282.398, -0.191, 0.409709, 0.5, 0.99);
+
+    verifyBatch(linear);
+    verifyBatch(quadratic);
+    verifyBatch(cubic);
+    verifyBatch(quartic);
+    verifyBatch(quintic);
+    verifyBatch(power);
+    verifyBatch(exponential);
+    verifyBatch(invLinear);
+    verifyBatch(invQuadratic);
+    verifyBatch(rational);
+    verifyBatch(showmate);
+    verifyBatch(sutherland);
+    verifyBatch(quadraticRoot);
+    verifyBatch(product);
+    verifyBatch(quotient);
+    verifyBatch(quadLin);
+    verifyBatch(quadLinInv);
+    verifyBatch(tsat);
+    verifyBatch(hvap);
+
+    /// - Verify an empty batch doesn't touch the output.
+    double x   = 1.0;
+    double out = -1.0;
+    linear.get(&x, 0, &out, 0);
+    CPPUNIT_ASSERT(-1.0 == out);
+
+    std::cout << "... Pass";
+}
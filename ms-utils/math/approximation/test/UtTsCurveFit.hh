@@ -58,6 +58,7 @@ class UtTsCurveFit: public CppUnit::TestFixture
         CPPUNIT_TEST(testQuadraticRootException);
         CPPUNIT_TEST(testFunctionPointer);
         CPPUNIT_TEST(testEmptyConstructors);
+        CPPUNIT_TEST(testBatch);
         CPPUNIT_TEST_SUITE_END();
         /// @brief    -- Pointer to unit under test
         TsApproximation*   mArticle;
@@ -102,6 +103,8 @@ class UtTsCurveFit: public CppUnit::TestFixture
         void testQuadraticRootException();
         void testFunctionPointer();
         void testEmptyConstructors();
+        void testBatch();
+        void verifyBatch(TsApproximation& fit);
         typedef  double (TsApproximation::*EvaluateFunction)(const double x, const double y);
         double dummy(EvaluateFunction eval, TsApproximation* c);
     private:
@@ -2,12 +2,18 @@
  LIBRARY DEPENDENCY:
  (
      (math/approximation/TsBilinearInterpolatorReverse.o)
+     (math/approximation/TsBreakpointIndex.o)
      (math/approximation/TsLinearInterpolator.o)
+     (math/approximation/TsTabulatedFit.o)
  )
  ***************************************************************************************************/
 
 #include "math/approximation/TsBilinearInterpolatorReverse.hh"
+#include "math/approximation/TsBreakpointIndex.hh"
 #include "math/approximation/TsLinearInterpolator.hh"
+#include "math/approximation/TsTabulatedFit.hh"
+#include "math/approximation/PowerFit.hh"
+#include "math/approximation/QuotientFit.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
 
@@ -539,3 +545,217 @@ void UtTsInterpolator::testTsBilinearReverse()
 
     std::cout << "... Pass." << std::endl;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Test Tabulated Approximation of univariate & bivariate sources.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsInterpolator::testTsTabulated()
+{
+    std::cout << "\n Interpolator 6.1: Tabulated Univariate Test                            ";
+
+    /// - Tabulate a power fit, and verify the table is univariate, met the tolerance, matches the
+    ///   source at its end points and is within tolerance in between.
+    PowerFit power(2.0, 0.995, 1.0, 1000.0);
+    TsTabulatedFit* article = new TsTabulatedFit(power, 1.0e-4, 1025);
+    mArticle = article;
+    CPPUNIT_ASSERT(article->isInitialized());
+    CPPUNIT_ASSERT(article->isWithinTolerance());
+    CPPUNIT_ASSERT(1 == article->getSizeY());
+    CPPUNIT_ASSERT(TsTabulatedFit::MIN_POINTS < article->getSizeX());
+    CPPUNIT_ASSERT(1025 >= article->getSizeX());
+    CPPUNIT_ASSERT(1.0e-4 >= article->getMaxError());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(power.get(1.0),    mArticle->get(1.0),    DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(power.get(1000.0), mArticle->get(1000.0), DBL_EPSILON);
+    for (double x = 1.0; x < 1000.0; x += 13.7) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(power.get(x), mArticle->get(x), 1.0e-4 * power.get(x));
+    }
+
+    /// - Verify inputs are bounded to the source range.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(power.get(1.0),    mArticle->get(0.1),  DBL_EPSILON);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(power.get(1000.0), mArticle->get(1.e6), DBL_EPSILON);
+    delete mArticle;
+    mArticle = 0;
+    std::cout << "... Pass.";
+
+    std::cout << "\n Interpolator 6.2: Tabulated Bivariate Test                             ";
+
+    /// - Tabulate a quotient fit with logarithmic spacing in x, and verify only x was refined, since
+    ///   the fit is linear in y, and the table is within tolerance at points off the grid.
+    QuotientFit quotient(3.0, 100.0, 1000.0, 0.0, 500.0);
+    article  = new TsTabulatedFit(quotient, 1.0e-5, 1025, TsTabulatedFit::LOGARITHMIC);
+    mArticle = article;
+    CPPUNIT_ASSERT(article->isWithinTolerance());
+    CPPUNIT_ASSERT(TsTabulatedFit::MIN_POINTS < article->getSizeX());
+    CPPUNIT_ASSERT(TsTabulatedFit::MIN_POINTS == article->getSizeY());
+    for (double x = 100.0; x < 1000.0; x += 61.7) {
+        for (double y = 0.0; y < 500.0; y += 23.3) {
+            const double expected = quotient.get(x, y);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, mArticle->get(x, y),
+                                         1.0e-5 * std::max(expected, 1.0e-3 * 15.0));
+        }
+    }
+    delete mArticle;
+    mArticle = 0;
+    std::cout << "... Pass.";
+
+    std::cout << "\n Interpolator 6.3: Tabulated Point Limit Test                           ";
+
+    /// - Verify the grid stops at the maximum points and reports the tolerance wasn't met.
+    article  = new TsTabulatedFit(power, 1.0e-12, TsTabulatedFit::MIN_POINTS);
+    mArticle = article;
+    CPPUNIT_ASSERT(article->isInitialized());
+    CPPUNIT_ASSERT(not article->isWithinTolerance());
+    CPPUNIT_ASSERT(TsTabulatedFit::MIN_POINTS == article->getSizeX());
+    CPPUNIT_ASSERT(1.0e-12 < article->getMaxError());
+    std::cout << "... Pass." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Test Tabulated Approximation initialization exceptions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsInterpolator::testTsTabulatedExceptions()
+{
+    std::cout << "\n Interpolator 6.4: Tabulated Exceptions Test                            ";
+
+    PowerFit       power(2.0, 0.995, 1.0, 1000.0);
+    QuotientFit    quotient(3.0, 100.0, 1000.0, 0.0, 500.0);
+    PowerFit       uninitialized;
+    TsTabulatedFit article;
+    CPPUNIT_ASSERT(not article.isInitialized());
+
+    /// - Verify exceptions on an uninitialized source, a non-positive tolerance, too few points,
+    ///   and logarithmic spacing of a range that includes zero.
+    CPPUNIT_ASSERT_THROW(article.init(uninitialized, 1.0e-4, 65), TsInitializationException);
+    CPPUNIT_ASSERT_THROW(article.init(power, 0.0, 65), TsInitializationException);
+    CPPUNIT_ASSERT_THROW(article.init(power, 1.0e-4, TsTabulatedFit::MIN_POINTS - 1),
+                         TsInitializationException);
+    CPPUNIT_ASSERT_THROW(article.init(quotient, 1.0e-4, 65, TsTabulatedFit::UNIFORM,
+                                      TsTabulatedFit::LOGARITHMIC), TsInitializationException);
+    CPPUNIT_ASSERT(not article.isInitialized());
+
+    /// - Verify logarithmic spacing of the unused second variable of a univariate source is ignored.
+    CPPUNIT_ASSERT_NO_THROW(article.init(power, 1.0e-4, 65, TsTabulatedFit::UNIFORM,
+                                         TsTabulatedFit::LOGARITHMIC));
+    CPPUNIT_ASSERT(article.isInitialized());
+    std::cout << "... Pass." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x  (--) Strictly ascending breakpoint array.
+/// @param[in]    n  (--) Number of breakpoints.
+/// @param[in]    v  (--) Value to find the cell of.
+///
+/// @returns  int (--) Index of the cell containing the value, by linear search.
+///
+/// @details  Reference cell search for the breakpoint index tests.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static int referenceCell(const double* x, const int n, const double v)
+{
+    int i = 0;
+    while (i < n - 2 and x[i+1] <= v) {
+        ++i;
+    }
+    return i;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Test Interpolation Breakpoint Index cell lookup of uniform & non-uniform breakpoints.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsInterpolator::testBreakpointIndex()
+{
+    std::cout << "\n Interpolator 11.1: Breakpoint Index Uniform Test                       ";
+
+    /// - Verify breakpoints that are uniform to within rounding are detected as uniform, and the
+    ///   cell of values on, between and outside the breakpoints matches a linear search.
+    double uniform[41];
+    for (int i = 0; i < 41; ++i) {
+        uniform[i] = -3.0 + 0.1 * i;
+    }
+    TsBreakpointIndex index;
+    index.init(uniform, 41);
+    CPPUNIT_ASSERT(index.isUniform());
+    CPPUNIT_ASSERT(0 == index.getNumBuckets());
+    for (int i = 0; i < 41; ++i) {
+        CPPUNIT_ASSERT(referenceCell(uniform, 41, uniform[i]) == index.find(uniform[i]));
+    }
+    for (double v = -4.0; v < 2.0; v += 0.0137) {
+        CPPUNIT_ASSERT(referenceCell(uniform, 41, v) == index.find(v));
+    }
+    CPPUNIT_ASSERT(0  == index.find(-1.0e300));
+    CPPUNIT_ASSERT(39 == index.find(1.0e300));
+    CPPUNIT_ASSERT(0  == index.find(std::sqrt(-1.0)));
+    std::cout << "... Pass.";
+
+    std::cout << "\n Interpolator 11.2: Breakpoint Index Non-uniform Test                   ";
+
+    /// - Verify clustered breakpoints are not uniform, the buckets are limited per cell, and the
+    ///   cell of values on, between and outside the breakpoints matches a linear search.
+    const double clustered[10] = {0.0, 1.0e-3, 2.0e-3, 5.0e-3, 1.0, 2.0, 50.0, 51.0, 99.0, 100.0};
+    index.init(clustered, 10);
+    CPPUNIT_ASSERT(not index.isUniform());
+    CPPUNIT_ASSERT(9 * TsBreakpointIndex::BUCKETS_PER_CELL == index.getNumBuckets());
+    for (int i = 0; i < 10; ++i) {
+        CPPUNIT_ASSERT(referenceCell(clustered, 10, clustered[i]) == index.find(clustered[i]));
+    }
+    for (double v = -1.0; v < 101.0; v += 0.0731) {
+        CPPUNIT_ASSERT(referenceCell(clustered, 10, v) == index.find(v));
+    }
+    for (double v = 0.0; v < 0.01; v += 1.3e-5) {
+        CPPUNIT_ASSERT(referenceCell(clustered, 10, v) == index.find(v));
+    }
+
+    /// - Verify mildly non-uniform breakpoints get one bucket per smallest interval.
+    const double mild[5] = {0.0, 1.0, 2.5, 3.5, 5.0};
+    index.init(mild, 5);
+    CPPUNIT_ASSERT(not index.isUniform());
+    CPPUNIT_ASSERT(5 == index.getNumBuckets());
+    for (double v = -1.0; v < 6.0; v += 0.01) {
+        CPPUNIT_ASSERT(referenceCell(mild, 5, v) == index.find(v));
+    }
+    std::cout << "... Pass." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Test the interpolators return the same values for inputs in random order as in
+///           ascending order, since the cell lookup doesn't depend on the previous input.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsInterpolator::testRandomAccess()
+{
+    std::cout << "\n Interpolator 11.3: Random Access Test                                  ";
+
+    const double x[7] = {0.0, 0.5, 1.0, 4.0, 9.0, 9.5, 20.0};
+    const double y[4] = {-1.0, 0.0, 1.0, 2.0};
+    double       z[28];
+    for (int i = 0; i < 7; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            z[i * 4 + j] = x[i] * x[i] - 3.0 * y[j] + x[i] * y[j];
+        }
+    }
+    TsLinearInterpolator   linear(x, z, 7, 0.0, 20.0);
+    TsBilinearInterpolator bilinear(x, y, z, 7, 4, 0.0, 20.0, -1.0, 2.0);
+
+    const int n = 200;
+    double    xs[n];
+    double    ys[n];
+    double    expectedLinear[n];
+    double    expectedBilinear[n];
+    for (int k = 0; k < n; ++k) {
+        xs[k] = 20.0 * k / (n - 1);
+        ys[k] = -1.0 + 3.0 * ((k * 37) % n) / (n - 1);
+        expectedLinear[k]   = linear.get(xs[k]);
+        expectedBilinear[k] = bilinear.get(xs[k], ys[k]);
+    }
+
+    /// - Visit the same points in a scattered order and compare to the ascending order results.
+    for (int k = 0; k < n; ++k) {
+        const int m = (k * 73) % n;
+        CPPUNIT_ASSERT(expectedLinear[m]   == linear.get(xs[m]));
+        CPPUNIT_ASSERT(expectedBilinear[m] == bilinear.get(xs[m], ys[m]));
+    }
+
+    /// - Verify the interpolated values at a breakpoint and mid-cell.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(z[3],                  linear.get(4.0),        1.0e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5 * (z[4] + z[5]),   linear.get(9.25),       1.0e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(z[4 * 4 + 2],          bilinear.get(9.0, 1.0), 1.0e-12);
+    std::cout << "... Pass." << std::endl;
+}
@@ -36,6 +36,10 @@ class UtTsInterpolator: public CppUnit::TestFixture
         CPPUNIT_TEST(testTsLinearInit1);
         CPPUNIT_TEST(testTsLinearInit2);
         CPPUNIT_TEST(testTsBilinearReverse);
+        CPPUNIT_TEST(testTsTabulated);
+        CPPUNIT_TEST(testTsTabulatedExceptions);
+        CPPUNIT_TEST(testBreakpointIndex);
+        CPPUNIT_TEST(testRandomAccess);
         CPPUNIT_TEST_SUITE_END();
         /// @brief    -- Pointer to unit under test
         TsApproximation*   mArticle;
@@ -57,6 +61,10 @@ class UtTsInterpolator: public CppUnit::TestFixture
         void testInvalidRangeExceptions();
         void testEmptyConstructors();
         void testTsBilinearReverse();
+        void testTsTabulated();
+        void testTsTabulatedExceptions();
+        void testBreakpointIndex();
+        void testRandomAccess();
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @details  Copy constructor unavailable since declared private and not implemented.
@@ -278,6 +278,74 @@ void CholeskyLdu::Invert(double *LDU, int n)
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] LDU   (--) On input, the pointer to the first element of the LDU decomposition of
+///                           the matrix A[n][n], as output by Decompose.  On output, the LDU
+///                           decomposition of A + sigma * z * z'.
+/// @param[in,out] z     (--) The update vector z[n].  It is destroyed by the update.
+/// @param[in]     sigma (--) The weight of the update, positive for an update and negative for a
+///                           downdate.
+/// @param[in]     n     (--) The number of rows and/or columns of the matrix A.
+/// @param[in]     start (--) The first row of z that may be non-zero.  Rows of z before this are
+///                           assumed to be zero and are skipped.
+///
+/// @throws  TsNumericalException
+///
+/// @details  This routine modifies the LDU decomposition of A in place for a rank-1 change to A,
+///           without repeating the decomposition.  This uses the classic rank-1 LDL' modification
+///           (Gill, Golub, Murray & Saunders method C1), evaluated for j = start, ..., n-1:
+///               p    = w[j]
+///               D'[j] = D[j] + alpha * p^2
+///               beta  = alpha * p / D'[j]
+///               alpha = alpha * D[j] / D'[j]
+///               w[k]    = w[k] - p * L[k][j],     for k = j+1, ..., n-1
+///               L'[k][j] = L[k][j] + beta * w[k],  for k = j+1, ..., n-1
+///           starting with alpha = sigma and w = z.  Columns where w[j] is zero are unchanged and
+///           skipped, so the cost falls with the sparsity of z and of L.  Both the lower L and
+///           upper U = L' triangles are updated.
+///
+///           A downdate (sigma < 0) can make the matrix indefinite, or lose most of the precision
+///           of a diagonal term through cancellation.  When any new D[j] falls below a small
+///           fraction of its old value, this throws, and the LDU is left partly updated, so the
+///           caller must decompose A + sigma * z * z' again from scratch.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLdu::Update(double *LDU, double z[], const double sigma, int n, int start)
+{
+    /// - New diagonal terms below this fraction of the old have lost most of their precision.
+    const double minRatio = 1.0E-10;
+
+    double alpha = sigma;
+    for (int j = start; j < n; ++j) {
+        const double p = z[j];
+        if (0.0 == p) {
+            continue;
+        }
+
+        double*      u_j  = LDU + j * n;       // pointer to U[j][0], the transpose of L column j
+        const double dOld = *(u_j + j);
+        const double dNew = dOld + alpha * p * p;
+        if ( not (dNew > minRatio * dOld) ) {
+            std::ostringstream msg;
+            msg << "failed at row " << j;
+            throw(TsNumericalException("", "CholeskyLdu::Update", msg.str()));
+        }
+        const double beta = alpha * p / dNew;
+        alpha *= dOld / dNew;
+        *(u_j + j) = dNew;
+
+        double* l_kj = u_j + n + j;            // pointer to L[j+1][j]
+        for (int k = j + 1; k < n; ++k, l_kj += n) {
+            const double u = *(u_j + k);
+            if (0.0 != u or 0.0 != z[k]) {
+                z[k] -= p * u;
+                const double uNew = u + beta * z[k];
+                *(u_j + k) = uNew;
+                *l_kj      = uNew;
+            }
+        }
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]      L (--) Pointer to the first element of the unit lower triangular matrix.
 /// @param[in]      B (--) Pointer to the column vector, (n x 1) matrix, B.
@@ -57,6 +57,9 @@ class CholeskyLdu
         /// @brief Uses the decomposed admittance matrix to solve [A]{x} = {b} for {x}.
         virtual void Solve(double *LDU, double B[], double x[], int n);
 
+        /// @brief Updates the decomposition of [A] to that of [A] + sigma{z}{z}'.
+        virtual void Update(double *LDU, double z[], const double sigma, int n, int start = 0);
+
         /// @brief Uses the decomposed admittance matrix to find the inverse of [A].
         virtual void Invert(double *LDU, int n);
 
@@ -0,0 +1,451 @@
+/*
+@file
+@brief    Vectorized Cholesky LDU Decomposition implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+     ((math/linear_algebra/CholeskyLdu.o)
+      (software/exceptions/TsNumericalException.o))
+*/
+
+#include "CholeskyLduSimd.hh"
+#include "software/exceptions/TsNumericalException.hh"
+#include <sstream>
+
+/// - The vector kernels are compiled for their instruction sets with function target attributes,
+///   so the rest of the library doesn't need those instruction sets to run.
+#if defined(__GNUC__) and (defined(__x86_64__) or defined(__i386__))
+#define CHOLESKY_LDU_SIMD_X86
+#include <immintrin.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] a (--) Pointer to the first vector.
+/// @param[in] b (--) Pointer to the second vector.
+/// @param[in] n (--) Length of the vectors.
+///
+/// @returns  double (--) The dot product of a and b.
+///
+/// @details  Portable dot product, with four partial sums to shorten the dependency chain.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static double dotScalar(const double* a, const double* b, const int n)
+{
+    double s0 = 0.0;
+    double s1 = 0.0;
+    double s2 = 0.0;
+    double s3 = 0.0;
+    int k = 0;
+    for (; k + 4 <= n; k += 4) {
+        s0 += a[k]   * b[k];
+        s1 += a[k+1] * b[k+1];
+        s2 += a[k+2] * b[k+2];
+        s3 += a[k+3] * b[k+3];
+    }
+    for (; k < n; ++k) {
+        s0 += a[k] * b[k];
+    }
+    return (s0 + s1) + (s2 + s3);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  a0   (--) Pointer to the first row.
+/// @param[in]  a1   (--) Pointer to the second row.
+/// @param[in]  a2   (--) Pointer to the third row.
+/// @param[in]  a3   (--) Pointer to the fourth row.
+/// @param[in]  b    (--) Pointer to the vector common to all rows.
+/// @param[in]  n    (--) Length of the vectors.
+/// @param[out] dots (--) The four dot products.
+///
+/// @details  Portable dot products of four rows with one vector.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void dot4Scalar(const double* a0, const double* a1, const double* a2, const double* a3,
+                       const double* b, const int n, double* dots)
+{
+    double s0 = 0.0;
+    double s1 = 0.0;
+    double s2 = 0.0;
+    double s3 = 0.0;
+    for (int k = 0; k < n; ++k) {
+        const double bk = b[k];
+        s0 += a0[k] * bk;
+        s1 += a1[k] * bk;
+        s2 += a2[k] * bk;
+        s3 += a3[k] * bk;
+    }
+    dots[0] = s0;
+    dots[1] = s1;
+    dots[2] = s2;
+    dots[3] = s3;
+}
+
+#ifdef CHOLESKY_LDU_SIMD_X86
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] s (--) Vector of four partial sums.
+///
+/// @returns  double (--) The sum of the four terms.
+///
+/// @details  Horizontal sum of an AVX register.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+__attribute__((target("avx2,fma")))
+static inline double sumAvx2(const __m256d s)
+{
+    __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(s), _mm256_extractf128_pd(s, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] a (--) Pointer to the first vector.
+/// @param[in] b (--) Pointer to the second vector.
+/// @param[in] n (--) Length of the vectors.
+///
+/// @returns  double (--) The dot product of a and b.
+///
+/// @details  AVX2 dot product, with two vector accumulators.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+__attribute__((target("avx2,fma")))
+static double dotAvx2(const double* a, const double* b, const int n)
+{
+    __m256d s0 = _mm256_setzero_pd();
+    __m256d s1 = _mm256_setzero_pd();
+    int k = 0;
+    for (; k + 8 <= n; k += 8) {
+        s0 = _mm256_fmadd_pd(_mm256_loadu_pd(a + k),     _mm256_loadu_pd(b + k),     s0);
+        s1 = _mm256_fmadd_pd(_mm256_loadu_pd(a + k + 4), _mm256_loadu_pd(b + k + 4), s1);
+    }
+    if (k + 4 <= n) {
+        s0 = _mm256_fmadd_pd(_mm256_loadu_pd(a + k), _mm256_loadu_pd(b + k), s0);
+        k += 4;
+    }
+    double sum = sumAvx2(_mm256_add_pd(s0, s1));
+    for (; k < n; ++k) {
+        sum += a[k] * b[k];
+    }
+    return sum;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  a0   (--) Pointer to the first row.
+/// @param[in]  a1   (--) Pointer to the second row.
+/// @param[in]  a2   (--) Pointer to the third row.
+/// @param[in]  a3   (--) Pointer to the fourth row.
+/// @param[in]  b    (--) Pointer to the vector common to all rows.
+/// @param[in]  n    (--) Length of the vectors.
+/// @param[out] dots (--) The four dot products.
+///
+/// @details  AVX2 dot products of four rows with one vector, loading the vector once for all rows.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+__attribute__((target("avx2,fma")))
+static void dot4Avx2(const double* a0, const double* a1, const double* a2, const double* a3,
+                     const double* b, const int n, double* dots)
+{
+    __m256d s0 = _mm256_setzero_pd();
+    __m256d s1 = _mm256_setzero_pd();
+    __m256d s2 = _mm256_setzero_pd();
+    __m256d s3 = _mm256_setzero_pd();
+    int k = 0;
+    for (; k + 4 <= n; k += 4) {
+        const __m256d bk = _mm256_loadu_pd(b + k);
+        s0 = _mm256_fmadd_pd(_mm256_loadu_pd(a0 + k), bk, s0);
+        s1 = _mm256_fmadd_pd(_mm256_loadu_pd(a1 + k), bk, s1);
+        s2 = _mm256_fmadd_pd(_mm256_loadu_pd(a2 + k), bk, s2);
+        s3 = _mm256_fmadd_pd(_mm256_loadu_pd(a3 + k), bk, s3);
+    }
+    dots[0] = sumAvx2(s0);
+    dots[1] = sumAvx2(s1);
+    dots[2] = sumAvx2(s2);
+    dots[3] = sumAvx2(s3);
+    for (; k < n; ++k) {
+        dots[0] += a0[k] * b[k];
+        dots[1] += a1[k] * b[k];
+        dots[2] += a2[k] * b[k];
+        dots[3] += a3[k] * b[k];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] s (--) Vector of eight partial sums.
+///
+/// @returns  double (--) The sum of the eight terms.
+///
+/// @details  Horizontal sum of an AVX-512 register, by halves.  The register is summed through
+///           memory since some compilers' 512 to 256-bit extraction intrinsics warn of uninitialized
+///           use; this is outside the inner loops so the cost is negligible.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+__attribute__((target("avx512f")))
+static inline double sumAvx512(const __m512d s)
+{
+    double terms[8];
+    _mm512_storeu_pd(terms, s);
+    return ((terms[0] + terms[4]) + (terms[2] + terms[6]))
+         + ((terms[1] + terms[5]) + (terms[3] + terms[7]));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] a (--) Pointer to the first vector.
+/// @param[in] b (--) Pointer to the second vector.
+/// @param[in] n (--) Length of the vectors.
+///
+/// @returns  double (--) The dot product of a and b.
+///
+/// @details  AVX-512 dot product, with two vector accumulators and a masked remainder.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+__attribute__((target("avx512f")))
+static double dotAvx512(const double* a, const double* b, const int n)
+{
+    __m512d s0 = _mm512_setzero_pd();
+    __m512d s1 = _mm512_setzero_pd();
+    int k = 0;
+    for (; k + 16 <= n; k += 16) {
+        s0 = _mm512_fmadd_pd(_mm512_loadu_pd(a + k),     _mm512_loadu_pd(b + k),     s0);
+        s1 = _mm512_fmadd_pd(_mm512_loadu_pd(a + k + 8), _mm512_loadu_pd(b + k + 8), s1);
+    }
+    for (; k < n; k += 8) {
+        const __mmask8 mask = (n - k >= 8) ? 0xFF : static_cast<__mmask8>((1u << (n - k)) - 1u);
+        s0 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, a + k), _mm512_maskz_loadu_pd(mask, b + k),
+                             s0);
+    }
+    return sumAvx512(_mm512_add_pd(s0, s1));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  a0   (--) Pointer to the first row.
+/// @param[in]  a1   (--) Pointer to the second row.
+/// @param[in]  a2   (--) Pointer to the third row.
+/// @param[in]  a3   (--) Pointer to the fourth row.
+/// @param[in]  b    (--) Pointer to the vector common to all rows.
+/// @param[in]  n    (--) Length of the vectors.
+/// @param[out] dots (--) The four dot products.
+///
+/// @details  AVX-512 dot products of four rows with one vector, loading the vector once for all
+///           rows, with a masked remainder.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+__attribute__((target("avx512f")))
+static void dot4Avx512(const double* a0, const double* a1, const double* a2, const double* a3,
+                       const double* b, const int n, double* dots)
+{
+    __m512d s0 = _mm512_setzero_pd();
+    __m512d s1 = _mm512_setzero_pd();
+    __m512d s2 = _mm512_setzero_pd();
+    __m512d s3 = _mm512_setzero_pd();
+    for (int k = 0; k < n; k += 8) {
+        const __mmask8 mask = (n - k >= 8) ? 0xFF : static_cast<__mmask8>((1u << (n - k)) - 1u);
+        const __m512d  bk   = _mm512_maskz_loadu_pd(mask, b + k);
+        s0 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, a0 + k), bk, s0);
+        s1 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, a1 + k), bk, s1);
+        s2 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, a2 + k), bk, s2);
+        s3 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, a3 + k), bk, s3);
+    }
+    dots[0] = sumAvx512(s0);
+    dots[1] = sumAvx512(s1);
+    dots[2] = sumAvx512(s2);
+    dots[3] = sumAvx512(s3);
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] x (--) Value to protect.
+///
+/// @returns  double (--) The value, or zero if its magnitude is below 1E-100.
+///
+/// @details  Same underflow protection as CholeskyLdu::Decompose.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static inline double flushUnderflow(const double x)
+{
+    return (x > -1.0E-100 and x < 1.0E-100) ? 0.0 : x;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Vectorized Cholesky LDU Decomposition with the best
+///           instruction set supported by the CPU.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+CholeskyLduSimd::CholeskyLduSimd()
+    :
+    CholeskyLdu(),
+    mInstructionSet(SCALAR),
+    mBlockSize(64),
+    mDot(dotScalar),
+    mDot4(dot4Scalar)
+{
+    setInstructionSet(getSupportedInstructionSet());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Vectorized Cholesky LDU Decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+CholeskyLduSimd::~CholeskyLduSimd()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  InstructionSet (--) The best instruction set supported by the CPU.
+///
+/// @details  Queries the CPU at run-time.  Only SCALAR is supported by non-x86 builds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+CholeskyLduSimd::InstructionSet CholeskyLduSimd::getSupportedInstructionSet()
+{
+#ifdef CHOLESKY_LDU_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") and __builtin_cpu_supports("fma")) {
+        return AVX2;
+    }
+#endif
+    return SCALAR;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] set (--) The desired instruction set.
+///
+/// @returns  InstructionSet (--) The instruction set actually used.
+///
+/// @details  Uses the desired instruction set if the CPU supports it, otherwise the best one the CPU
+///           does support.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+CholeskyLduSimd::InstructionSet CholeskyLduSimd::setInstructionSet(const InstructionSet set)
+{
+    const InstructionSet supported = getSupportedInstructionSet();
+    mInstructionSet = (set > supported) ? supported : set;
+    switch (mInstructionSet) {
+#ifdef CHOLESKY_LDU_SIMD_X86
+        case AVX512:
+            mDot  = dotAvx512;
+            mDot4 = dot4Avx512;
+            break;
+        case AVX2:
+            mDot  = dotAvx2;
+            mDot4 = dot4Avx2;
+            break;
+#endif
+        default:
+            mInstructionSet = SCALAR;
+            mDot  = dotScalar;
+            mDot4 = dot4Scalar;
+            break;
+    }
+    return mInstructionSet;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] rows (--) Number of rows per block, limited to at least 4.
+///
+/// @details  Sets the number of rows in each block of the decomposition.  The rows of a block should
+///           fit in the data cache along with a finished row.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLduSimd::setBlockSize(const int rows)
+{
+    mBlockSize = (rows < 4) ? 4 : rows;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] A (--) On input, the pointer to the first element of the matrix A[n][n].  On
+///                       output, the matrix A is replaced by the lower triangular, diagonal, and
+///                       upper triangular matrices of the Cholesky LDL' factorization of A.
+/// @param[in]     n (--) The number of rows and/or columns of the matrix A.
+///
+/// @throws  TsNumericalException
+///
+/// @details  Evaluates the same expressions as CholeskyLdu::Decompose, in the same storage.  While
+///           row i is reduced, it holds the products L[i][k]*D[k] for k < i, so that:
+///               L[i][j]*D[j] = A[i][j] - (row i . row j) over k < j,
+///           where row j is already finished with L[j][k].  Then each L[i][k] is divided out, D[i]
+///           is found, and U[k][i] = L[i][k] is stored.
+///
+///           Rows before the current block are finished, so the block's rows are first reduced by
+///           all of them, four at a time.  Then the block's rows are reduced by the earlier rows in
+///           the block and finished, in order.  As in CholeskyLdu::Decompose, the first row is not
+///           checked for a non-positive diagonal.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLduSimd::Decompose(double *A, int n)
+{
+    for (int block = 0; block < n; block += mBlockSize) {
+        const int blockEnd = (block + mBlockSize < n) ? block + mBlockSize : n;
+
+        /// - Reduce the block's rows by the finished rows above the block, four rows at a time.
+        int i = block;
+        for (; i + 4 <= blockEnd; i += 4) {
+            double* a0 = A + i * n;
+            double* a1 = a0 + n;
+            double* a2 = a1 + n;
+            double* a3 = a2 + n;
+            double  dots[4];
+            for (int j = 0; j < block; ++j) {
+                mDot4(a0, a1, a2, a3, A + j * n, j, dots);
+                a0[j] = flushUnderflow(a0[j] - dots[0]);
+                a1[j] = flushUnderflow(a1[j] - dots[1]);
+                a2[j] = flushUnderflow(a2[j] - dots[2]);
+                a3[j] = flushUnderflow(a3[j] - dots[3]);
+            }
+        }
+        for (; i < blockEnd; ++i) {
+            double* a_i = A + i * n;
+            for (int j = 0; j < block; ++j) {
+                a_i[j] = flushUnderflow(a_i[j] - mDot(a_i, A + j * n, j));
+            }
+        }
+
+        /// - Reduce each row by the earlier rows in the block, then finish it.
+        for (i = block; i < blockEnd; ++i) {
+            double* a_i = A + i * n;
+            for (int j = block; j < i; ++j) {
+                a_i[j] = flushUnderflow(a_i[j] - mDot(a_i, A + j * n, j));
+            }
+
+            /// - Calculate the diagonal element D[i] and L[i][k].  Store the transpose L[k][i].
+            double  d   = a_i[i];
+            double* p_k = A;                                   // pointer to L[k][0]
+            for (int k = 0; k < i; ++k, p_k += n) {
+                const double ld = a_i[k] / p_k[k];
+                d       -= a_i[k] * ld;
+                a_i[k]   = ld;
+                p_k[i]   = ld;
+            }
+            a_i[i] = d;
+
+            /// - Return the failing row number to aid debugging.
+            if (i > 0 and d <= 0.0) {
+                std::ostringstream msg;
+                msg << "failed at row " << i;
+                throw(TsNumericalException("", "CholeskyLduSimd::Decompose", msg.str()));
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  L (--) Pointer to the first element of the unit lower triangular matrix.
+/// @param[in]  B (--) Pointer to the column vector, (n x 1) matrix, B.
+/// @param[out] x (--) Pointer to the column vector, (n x 1) matrix, x.  May be the same as B.
+/// @param[in]  n (--) The number of rows or columns of the matrix L.
+///
+/// @details  Solves Lx = B by forward substitution, like the base class, with each row's sum as a
+///           vectorized dot product of the row with the solution so far:
+///               x[i] = B[i] - (L[i][0] * x[0]  + ... + L[i][i-1] * x[i-1]).
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLduSimd::SolveUnitLowerTriangular(double *L, double B[], double x[], int n)
+{
+    for (int i = 0; i < n; ++i, L += n) {
+        x[i] = B[i] - mDot(L, x, i);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  U (--) Pointer to the first element of the unit upper triangular matrix.
+/// @param[in]  B (--) Pointer to the column vector, (n x 1) matrix, B.
+/// @param[out] x (--) Pointer to the column vector, (n x 1) matrix, x.  May be the same as B.
+/// @param[in]  n (--) The number of rows or columns of the matrix U.
+///
+/// @details  Solves Ux = B by back substitution, like the base class, with each row's sum as a
+///           vectorized dot product of the row with the solution so far:
+///               x[i] = B[i] - (U[i][i+1] * x[i+1]  + ... + U[i][n-1] * x[n-1]).
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLduSimd::SolveUnitUpperTriangular(double *U, double B[], double x[], int n)
+{
+    for (int i = n - 1; i >= 0; --i) {
+        x[i] = B[i] - mDot(U + i * n + i + 1, x + i + 1, n - i - 1);
+    }
+}
@@ -0,0 +1,113 @@
+#ifndef CholeskyLduSimd_EXISTS
+#define CholeskyLduSimd_EXISTS
+
+/**
+@file
+@brief    Vectorized Cholesky LDU Decomposition declarations
+
+@defgroup  TSM_UTILITIES_MATH_LINEAR_ALGEBRA_CHOLESKY_LDU_SIMD Vectorized Cholesky LDU Decomposition
+@ingroup   TSM_UTILITIES_MATH_LINEAR_ALGEBRA
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (A cache-blocked, SIMD-vectorized version of the dense Cholesky LDU decomposition and triangular
+   solutions, for mid-size and larger dense matrices.  The decomposition is stored in the same
+   format as CholeskyLdu, so either class can solve the other's decomposition.)
+
+REFERENCE:
+- (Golub & Van Loan, "Matrix Computations", 4th ed., section 4.2, the LDL' factorization.)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The instruction set is selected at run-time from those the CPU supports: AVX-512, AVX2 with FMA,
+   or a portable scalar version.  The vector versions are only compiled for x86 with GCC-compatible
+   compilers; other targets only have the scalar version.)
+- (Unlike CholeskyLdu, this doesn't skip products of zero or positive off-diagonal terms, so it
+   doesn't gain from sparsity in the matrix, but it is correct for any symmetric positive definite
+   matrix.  For the admittance matrices of conductive networks, whose off-diagonals are all zero or
+   negative, the results are the same as CholeskyLdu to within round-off.)
+- (The object keeps no state between calls other than its instruction set, so it can be shared by
+   several threads.)
+
+LIBRARY_DEPENDENCY:
+- ((CholeskyLduSimd.o))
+
+PROGRAMMERS:
+- ((agent) (agent@local) (2026-10) (Initial))
+
+@{
+*/
+
+#include "CholeskyLdu.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Vectorized Cholesky LDU Matrix Decomposition Utilities
+///
+/// @details  Decomposes by rows like CholeskyLdu, so that every inner loop is a dot product of two
+///           contiguous rows, which vectorizes.  The rows are processed in blocks: each block of
+///           rows is first reduced by all finished rows above the block, four rows at a time so
+///           that each finished row is loaded once for all four, then the block's rows are
+///           finished in order.  The triangular solutions are dot products of the matrix rows with
+///           the solution vector.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class CholeskyLduSimd : public CholeskyLdu
+{
+    public:
+        /// @brief Enumeration of the instruction sets.
+        enum InstructionSet {
+            SCALAR = 0, ///< Portable scalar code.
+            AVX2   = 1, ///< AVX2 with fused multiply-add.
+            AVX512 = 2  ///< AVX-512 foundation.
+        };
+        /// @brief Default constructor.
+        CholeskyLduSimd();
+        /// @brief Default destructor.
+        virtual ~CholeskyLduSimd();
+        /// @brief Decomposes the admittance matrix [A].
+        virtual void Decompose(double *A, int n);
+        /// @brief Solves [L]{x} = {b} where [L] is a n x n unit lower triangular matrix.
+        virtual void SolveUnitLowerTriangular(double *L, double B[], double x[], int n);
+        /// @brief Solves [U]{x} = {b} where [U] is a n x n unit upper triangular matrix.
+        virtual void SolveUnitUpperTriangular(double *U, double B[], double x[], int n);
+        /// @brief Sets the instruction set, limited to the best one supported by the CPU.
+        InstructionSet setInstructionSet(const InstructionSet set);
+        /// @brief Returns the instruction set in use.
+        InstructionSet getInstructionSet() const;
+        /// @brief Returns the best instruction set supported by the CPU.
+        static InstructionSet getSupportedInstructionSet();
+        /// @brief Sets the number of rows per block in the decomposition.
+        void setBlockSize(const int rows);
+
+    protected:
+        /// @brief Dot product function type.
+        typedef double (*DotFunction)(const double* a, const double* b, const int n);
+        /// @brief Four-row dot product function type.
+        typedef void (*Dot4Function)(const double* a0, const double* a1, const double* a2,
+                                     const double* a3, const double* b, const int n, double* dots);
+        InstructionSet mInstructionSet; /**< (--) trick_chkpnt_io(**) Instruction set in use. */
+        int            mBlockSize;      /**< (--) trick_chkpnt_io(**) Number of rows per block in the decomposition. */
+        DotFunction    mDot;            /**< ** (--) trick_chkpnt_io(**) Dot product for the instruction set. */
+        Dot4Function   mDot4;           /**< ** (--) trick_chkpnt_io(**) Four-row dot product for the instruction set. */
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        CholeskyLduSimd(const CholeskyLduSimd& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        CholeskyLduSimd& operator =(const CholeskyLduSimd&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  InstructionSet (--) The instruction set in use.
+///
+/// @details  Returns the mInstructionSet value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline CholeskyLduSimd::InstructionSet CholeskyLduSimd::getInstructionSet() const
+{
+    return mInstructionSet;
+}
+
+#endif
@@ -0,0 +1,444 @@
+/*
+@file
+@brief    Sparse Cholesky LDU Decomposition implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+     ((math/linear_algebra/CholeskyLdu.o)
+      (math/linear_algebra/SparseCsrMatrix.o)
+      (software/exceptions/TsNumericalException.o))
+*/
+
+#include "CholeskyLduSparse.hh"
+#include "software/exceptions/TsNumericalException.hh"
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <sstream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Sparse Cholesky LDU Decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+CholeskyLduSparse::CholeskyLduSparse()
+    :
+    CholeskyLdu(),
+    mSize(0),
+    mAnalysisCount(0),
+    mFactored(false),
+    mPatternRowStart(),
+    mPatternColumns(),
+    mPermutation(),
+    mInverse(),
+    mParent(),
+    mColumnStart(),
+    mRowIndex(),
+    mLower(),
+    mDiagonal(),
+    mColumnCount(),
+    mFlag(),
+    mStack(),
+    mWork(),
+    mDenseInput(),
+    mDensePositions()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Sparse Cholesky LDU Decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+CholeskyLduSparse::~CholeskyLduSparse()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] A (--) Pointer to the first element of the symmetric matrix A[n][n].  Not modified.
+/// @param[in] n (--) The number of rows and/or columns of the matrix A.
+///
+/// @throws  TsNumericalException
+///
+/// @details  Loads the non-zero terms of the dense matrix into the internal sparse matrix and
+///           decomposes that.  The internal sparse pattern is only rebuilt when the set of
+///           non-zero positions differs from the last call.  Unlike the dense CholeskyLdu, the
+///           factors are stored internally and A is not modified.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLduSparse::Decompose(double *A, int n)
+{
+    /// - Collect the non-zero positions of the lower triangle.  The internal pattern symmetrizes
+    ///   them and always includes the diagonal.
+    std::vector<int> positions;
+    positions.reserve(mDensePositions.size());
+    for (int row = 1; row < n; ++row) {
+        const double* rowA = A + row * n;
+        for (int col = 0; col < row; ++col) {
+            if (0.0 != rowA[col]) {
+                positions.push_back(row * n + col);
+            }
+        }
+    }
+
+    if (n != mDenseInput.getSize() or positions != mDensePositions) {
+        mDensePositions.swap(positions);
+        mDenseInput.buildPattern(n, mDensePositions);
+    }
+    mDenseInput.fromDense(A);
+    Decompose(mDenseInput);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] A (--) Not used.
+/// @param[in] n (--) Not used.
+/// @param[in] r (--) Not used.
+///
+/// @throws  TsNumericalException
+///
+/// @details  Decomposition of a subset of rows in place isn't compatible with the internally stored
+///           factors, so this always throws.  Sparse decomposition of the whole matrix already
+///           skips over the de-coupled islands this was intended for.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLduSparse::Decompose(double *A __attribute__((unused)), int n __attribute__((unused)),
+                                  std::vector<int>& r __attribute__((unused)))
+{
+    throw(TsNumericalException("", "CholeskyLduSparse::Decompose",
+                               "row subset decomposition is not supported"));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] LDU   (--) Not used.
+/// @param[in] z     (--) Not used.
+/// @param[in] sigma (--) Not used.
+/// @param[in] n     (--) Not used.
+/// @param[in] start (--) Not used.
+///
+/// @throws  TsNumericalException
+///
+/// @details  A rank-1 update can add fill outside of the stored factor pattern, so this always
+///           throws.  The caller should decompose the changed matrix instead.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLduSparse::Update(double *LDU __attribute__((unused)), double z[] __attribute__((unused)),
+                               const double sigma __attribute__((unused)),
+                               int n __attribute__((unused)), int start __attribute__((unused)))
+{
+    throw(TsNumericalException("", "CholeskyLduSparse::Update",
+                               "rank-1 update is not supported"));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] A (--) The symmetric positive definite sparse matrix to decompose.
+///
+/// @throws  TsNumericalException
+///
+/// @details  Repeats the ordering & symbolic factorization if the pattern of A has changed since the
+///           last call, then does the numeric factorization.  Stored terms of A that are zero are
+///           treated as structural non-zeros, so the analysis only depends on the pattern of A and
+///           not on its values.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLduSparse::Decompose(const SparseCsrMatrix& A)
+{
+    Decompose(A.getSize(), A.getRowStart(), A.getColumnIndex(), A.getValues());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] n        (--) The number of rows & columns of the matrix.
+/// @param[in] rowStart (--) Slot of the first entry of each row, and the total at the end.
+/// @param[in] columns  (--) Column number of each stored entry, ascending within each row.
+/// @param[in] values   (--) Value of each stored entry.
+///
+/// @throws  TsNumericalException
+///
+/// @details  Decomposes the matrix given in the same CSR format as SparseCsrMatrix, with a
+///           symmetric pattern that includes the full diagonal.  The arrays are only read, so the
+///           caller keeps ownership and can pass its own storage without copying it.  As with the
+///           SparseCsrMatrix version, the analysis is only repeated when the pattern has changed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLduSparse::Decompose(const int n, const int* rowStart, const int* columns,
+                                  const double* values)
+{
+    if (isPatternChanged(n, rowStart, columns)) {
+        analyze(n, rowStart, columns);
+    }
+    factor(rowStart, columns, values);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] n        (--) The number of rows & columns of the pattern.
+/// @param[in] rowStart (--) Row start slots of the pattern.
+/// @param[in] columns  (--) Column numbers of the pattern.
+///
+/// @returns  bool (--) True if the pattern differs from the last analyzed pattern.
+///
+/// @details  This is O(nnz) and negligible compared to the numeric factorization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool CholeskyLduSparse::isPatternChanged(const int n, const int* rowStart,
+                                         const int* columns) const
+{
+    if (0 == mAnalysisCount or n != mSize
+            or rowStart[n] != static_cast<int>(mPatternColumns.size())) {
+        return true;
+    }
+    return not (std::equal(mPatternRowStart.begin(), mPatternRowStart.end(), rowStart)
+            and std::equal(mPatternColumns.begin(), mPatternColumns.end(), columns));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] n        (--) The number of rows & columns of the pattern.
+/// @param[in] rowStart (--) Row start slots of the pattern.
+/// @param[in] columns  (--) Column numbers of the pattern.
+///
+/// @details  Finds the fill-reducing ordering, then the elimination tree and the number of terms in
+///           each column of [L] under that ordering, and sizes the factor storage to suit.  The
+///           column counts are found by walking each row's terms up the elimination tree, marking
+///           the visited nodes to count each fill position once (Davis 2006, section 4.1).
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLduSparse::analyze(const int n, const int* rowStart, const int* columns)
+{
+    mFactored = false;
+    mSize     = n;
+    mPatternRowStart.assign(rowStart, rowStart + n + 1);
+    mPatternColumns.assign(columns, columns + rowStart[n]);
+
+    orderMinimumDegree(n, rowStart, columns);
+
+    /// - Build the elimination tree and column counts of the permuted matrix.  Row k of the
+    ///   permuted matrix is row mPermutation[k] of A.
+    mParent.assign(n, -1);
+    mFlag.assign(n, -1);
+    mColumnCount.assign(n, 0);
+    for (int k = 0; k < n; ++k) {
+        mFlag[k] = k;
+        const int row = mPermutation[k];
+        for (int slot = rowStart[row]; slot < rowStart[row+1]; ++slot) {
+            int i = mInverse[columns[slot]];
+            if (i < k) {
+                for ( ; mFlag[i] != k; i = mParent[i]) {
+                    if (-1 == mParent[i]) {
+                        mParent[i] = k;
+                    }
+                    mColumnCount[i]++;
+                    mFlag[i] = k;
+                }
+            }
+        }
+    }
+
+    /// - Size the factor storage.
+    mColumnStart.resize(n + 1);
+    mColumnStart[0] = 0;
+    for (int k = 0; k < n; ++k) {
+        mColumnStart[k+1] = mColumnStart[k] + mColumnCount[k];
+    }
+    mRowIndex.resize(mColumnStart[n]);
+    mLower.resize(mColumnStart[n]);
+    mDiagonal.resize(n);
+    mStack.resize(n);
+    mWork.resize(n);
+    mAnalysisCount++;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] n        (--) The number of rows & columns of the pattern.
+/// @param[in] rowStart (--) Row start slots of the pattern.
+/// @param[in] columns  (--) Column numbers of the pattern.
+///
+/// @details  Finds a minimum degree ordering by simulating the elimination on the explicit graph of
+///           the matrix: the node with the fewest neighbors is eliminated next, and its neighbors
+///           are joined into a clique to represent the fill.  Ties are broken by the lowest node
+///           number so the ordering is repeatable.  This is the exact degree form of the algorithm
+///           that AMD approximates; GUNNS networks are sparse enough that the exact form is fast,
+///           and it only runs when the topology changes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLduSparse::orderMinimumDegree(const int n, const int* rowStart, const int* columns)
+{
+    /// - Load the sorted adjacency lists of the matrix graph, excluding the diagonal.
+    std::vector< std::vector<int> > adjacency(n);
+    std::set< std::pair<int, int> > queue;
+    for (int row = 0; row < n; ++row) {
+        for (int slot = rowStart[row]; slot < rowStart[row+1]; ++slot) {
+            if (columns[slot] != row) {
+                adjacency[row].push_back(columns[slot]);
+            }
+        }
+        queue.insert(std::make_pair(static_cast<int>(adjacency[row].size()), row));
+    }
+
+    mPermutation.resize(n);
+    mInverse.resize(n);
+    std::vector<int> merged;
+    for (int k = 0; k < n; ++k) {
+        const int node = queue.begin()->second;
+        queue.erase(queue.begin());
+        mPermutation[k] = node;
+        mInverse[node]  = k;
+
+        /// - Join the eliminated node's neighbors into a clique and remove the node from the graph.
+        const std::vector<int>& neighbors = adjacency[node];
+        for (unsigned int i = 0; i < neighbors.size(); ++i) {
+            const int neighbor = neighbors[i];
+            std::vector<int>& list = adjacency[neighbor];
+            const int oldDegree = static_cast<int>(list.size());
+            merged.clear();
+            std::set_union(list.begin(), list.end(), neighbors.begin(), neighbors.end(),
+                           std::back_inserter(merged));
+            merged.erase(std::remove(merged.begin(), merged.end(), node), merged.end());
+            merged.erase(std::remove(merged.begin(), merged.end(), neighbor), merged.end());
+            list.swap(merged);
+            const int newDegree = static_cast<int>(list.size());
+            if (newDegree != oldDegree) {
+                queue.erase(std::make_pair(oldDegree, neighbor));
+                queue.insert(std::make_pair(newDegree, neighbor));
+            }
+        }
+        std::vector<int>().swap(adjacency[node]);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] rowStart (--) Row start slots of the matrix, with the same pattern as last analyzed.
+/// @param[in] columns  (--) Column numbers of the matrix.
+/// @param[in] values   (--) Values of the matrix.
+///
+/// @throws  TsNumericalException
+///
+/// @details  Computes row k of [L] and D[k] for k = 0, ..., n-1 of the permuted matrix.  The
+///           pattern of row k is the set of elimination tree nodes reachable from the terms of row
+///           k of A, which is found in topological order and then used to do the sparse triangular
+///           solve [L]{y} = {a_k} against the rows already computed (Davis 2006, section 4.2):
+///               L[k][i] = y[i] / D[i],
+///               D[k]    = A[k][k] - sum(L[k][i] * y[i]).
+///           Since [L] is stored by columns, each new row term is appended to the end of its
+///           column.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLduSparse::factor(const int* rowStart, const int* columns, const double* values)
+{
+    const int n = mSize;
+
+    mFactored = false;
+    mFlag.assign(n, -1);
+    mWork.assign(n, 0.0);
+    for (int k = 0; k < n; ++k) {
+
+        /// - Scatter row k of the permuted A into the work row, and find the pattern of row k of
+        ///   [L] by walking up the elimination tree from each term.
+        int top = n;
+        mFlag[k]        = k;
+        mColumnCount[k] = 0;
+        const int row = mPermutation[k];
+        for (int slot = rowStart[row]; slot < rowStart[row+1]; ++slot) {
+            int i = mInverse[columns[slot]];
+            if (i <= k) {
+                mWork[i] += values[slot];
+                int length = 0;
+                for ( ; mFlag[i] != k; i = mParent[i]) {
+                    mStack[length++] = i;
+                    mFlag[i] = k;
+                }
+                while (length > 0) {
+                    mStack[--top] = mStack[--length];
+                }
+            }
+        }
+
+        /// - Sparse triangular solve for row k of [L] and D[k].
+        double d = mWork[k];
+        mWork[k] = 0.0;
+        for ( ; top < n; ++top) {
+            const int    i   = mStack[top];
+            const double yi  = mWork[i];
+            const int    end = mColumnStart[i] + mColumnCount[i];
+            mWork[i] = 0.0;
+            for (int p = mColumnStart[i]; p < end; ++p) {
+                mWork[mRowIndex[p]] -= mLower[p] * yi;
+            }
+            const double lki = yi / mDiagonal[i];
+            d -= lki * yi;
+            mRowIndex[end] = k;
+            mLower[end]    = lki;
+            mColumnCount[i]++;
+        }
+
+        /// - Return the failing original row number to aid debugging.
+        if (d <= 0.0) {
+            std::ostringstream msg;
+            msg << "failed at row " << row;
+            throw(TsNumericalException("", "CholeskyLduSparse::Decompose", msg.str()));
+        }
+        mDiagonal[k] = d;
+    }
+    mFactored = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  LDU (--) Not used, the internally stored factors are used instead.
+/// @param[in]  B   (--) Pointer to the column vector, (n x 1) matrix, B.
+/// @param[out] x   (--) Solution to the equation Ax = B.  May be the same array as B.
+/// @param[in]  n   (--) The number of rows or columns of the decomposed matrix.
+///
+/// @throws  TsNumericalException
+///
+/// @details  Solves [P][L][D][L]'[P]'{x} = {B} by permuting B, solving [L]{y} = {B}, {z} = {y}/[D]
+///           and [L]'{x} = {z}, and permuting the result back.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLduSparse::Solve(double *LDU __attribute__((unused)), double B[], double x[], int n)
+{
+    if (not mFactored or n != mSize) {
+        std::ostringstream msg;
+        msg << "no decomposition of size " << n;
+        throw(TsNumericalException("", "CholeskyLduSparse::Solve", msg.str()));
+    }
+
+    for (int k = 0; k < n; ++k) {
+        mWork[k] = B[mPermutation[k]];
+    }
+
+    /// - Solve the linear equation Ly = B for y, where L is a unit lower triangular matrix.
+    for (int j = 0; j < n; ++j) {
+        const double yj = mWork[j];
+        for (int p = mColumnStart[j]; p < mColumnStart[j+1]; ++p) {
+            mWork[mRowIndex[p]] -= mLower[p] * yj;
+        }
+    }
+
+    /// - Solve the linear equation Dz = y for z, where D is the diagonal matrix.  The diagonal was
+    ///   already checked to be positive by the decomposition.
+    for (int j = 0; j < n; ++j) {
+        mWork[j] /= mDiagonal[j];
+    }
+
+    /// - Solve the linear equation L'x = z for x.
+    for (int j = n - 1; j >= 0; --j) {
+        double xj = mWork[j];
+        for (int p = mColumnStart[j]; p < mColumnStart[j+1]; ++p) {
+            xj -= mLower[p] * mWork[mRowIndex[p]];
+        }
+        mWork[j] = xj;
+    }
+
+    for (int k = 0; k < n; ++k) {
+        x[mPermutation[k]] = mWork[k];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] LDU (--) Pointer to the first element of the matrix A[n][n] to store the inverse in.
+/// @param[in]  n   (--) The number of rows or columns of the decomposed matrix.
+///
+/// @throws  TsNumericalException
+///
+/// @details  Finds the inverse of the decomposed matrix one column at a time, by solving for each
+///           column of the identity matrix, and stores it in the given dense matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLduSparse::Invert(double *LDU, int n)
+{
+    std::vector<double> column(n, 0.0);
+    for (int j = 0; j < n; ++j) {
+        column.assign(n, 0.0);
+        column[j] = 1.0;
+        Solve(LDU, &column[0], &column[0], n);
+        for (int i = 0; i < n; ++i) {
+            LDU[i * n + j] = column[i];
+        }
+    }
+}
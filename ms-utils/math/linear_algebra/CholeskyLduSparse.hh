@@ -0,0 +1,181 @@
+#ifndef CholeskyLduSparse_EXISTS
+#define CholeskyLduSparse_EXISTS
+
+/**
+@file
+@brief    Sparse Cholesky LDU Decomposition declarations
+
+@defgroup  TSM_UTILITIES_MATH_LINEAR_ALGEBRA_CHOLESKY_LDU_SPARSE Sparse Cholesky LDU Decomposition
+@ingroup   TSM_UTILITIES_MATH_LINEAR_ALGEBRA
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (This is a sparse direct solver for symmetric positive definite systems of linear algebraic
+   equations, with the same interface as the dense Cholesky LDU Decomposition.  The matrix rows &
+   columns are re-ordered with a minimum degree ordering to reduce fill-in, the non-zero pattern
+   of the L factor is found by a symbolic factorization, and then only the non-zero terms are
+   computed by the numeric factorization.  The ordering and symbolic factorization are only
+   repeated when the pattern of the input matrix changes, so repeated decompositions of a matrix
+   with a fixed topology only pay for the numeric factorization.)
+
+REFERENCE:
+- (Davis, T.A., "Direct Methods for Sparse Linear Systems", SIAM, 2006, chapters 4 & 7)
+- (George, A. & Liu, J.W.H., "The Evolution of the Minimum Degree Ordering Algorithm", SIAM Review
+   31(1), 1989)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The matrix is symmetric positive definite.  Only the diagonal & lower triangle are used.)
+- (The factors are stored internally, so Solve must follow the Decompose of the same matrix.  The
+   dense matrix argument to Decompose is not modified, and the LDU argument to Solve is ignored.)
+- (The ordering is an exact minimum degree on the explicit elimination graph, which is fine for
+   the very sparse & low-degree matrices of GUNNS networks but would be slow for dense ones.)
+
+LIBRARY_DEPENDENCY:
+- ((CholeskyLduSparse.o))
+
+PROGRAMMERS:
+- ((agent) (agent@local) (2026-10) (Initial))
+
+@{
+*/
+
+#include "CholeskyLdu.hh"
+#include "SparseCsrMatrix.hh"
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Sparse Cholesky LDU Matrix Decomposition
+///
+/// @details  This factors a symmetric positive definite matrix [A] into [P][L][D][L]'[P]', where
+///           [P] is a fill-reducing permutation, [L] is unit lower triangular and [D] is diagonal.
+///           [L] is stored by columns, holding only the terms that are structurally non-zero.
+///
+///           The factorization has two phases.  The analysis phase finds the ordering [P], the
+///           elimination tree and the number of non-zeros in each column of [L], and allocates
+///           the factor storage.  This is only done when the pattern of [A] differs from the one
+///           last analyzed.  The numeric phase then computes [L] & [D] a row at a time by sparse
+///           triangular solves along the elimination tree (an up-looking factorization).
+///
+///           The primary input is a SparseCsrMatrix, or the row start, column and value arrays of
+///           a matrix in the same CSR format, which are factored directly without ever forming the
+///           dense matrix.  The dense Decompose inherited from CholeskyLdu is also supported, by
+///           first loading the non-zero terms of the dense matrix into an internal SparseCsrMatrix;
+///           this costs O(n^2) to scan the dense matrix but is still much cheaper than a dense
+///           decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class CholeskyLduSparse : public CholeskyLdu
+{
+    public:
+        /// @brief Default constructor.
+        CholeskyLduSparse();
+
+        /// @brief Default destructor.
+        virtual ~CholeskyLduSparse();
+
+        /// @brief Decomposes the dense admittance matrix [A].
+        virtual void Decompose(double *A, int n);
+
+        /// @brief Not supported, throws an exception.
+        virtual void Decompose(double *A, int n, std::vector<int>& r);
+
+        /// @brief Decomposes the sparse admittance matrix [A].
+        void         Decompose(const SparseCsrMatrix& A);
+
+        /// @brief Decomposes the sparse admittance matrix [A] given by its CSR arrays.
+        void         Decompose(const int n, const int* rowStart, const int* columns,
+                               const double* values);
+
+        /// @brief Uses the decomposition to solve [A]{x} = {b} for {x}.
+        virtual void Solve(double *LDU, double B[], double x[], int n);
+
+        /// @brief Uses the decomposition to find the inverse of [A].
+        virtual void Invert(double *LDU, int n);
+
+        /// @brief Not supported, throws an exception.
+        virtual void Update(double *LDU, double z[], const double sigma, int n, int start = 0);
+
+        /// @brief Returns the number of times the ordering & symbolic factorization has been done.
+        int          getAnalysisCount() const;
+
+        /// @brief Returns the number of off-diagonal non-zero terms in the [L] factor.
+        int          getFactorNnz() const;
+
+        /// @brief Returns the fill-reducing permutation, new row number to original row number.
+        const std::vector<int>& getPermutation() const;
+
+    protected:
+        int                 mSize;              /**< *o (--) trick_chkpnt_io(**) Number of rows & columns in the decomposed matrix. */
+        int                 mAnalysisCount;     /**< *o (--) trick_chkpnt_io(**) Number of times the ordering & symbolic factorization has been done. */
+        bool                mFactored;          /**< *o (--) trick_chkpnt_io(**) True when a valid factorization is stored. */
+        std::vector<int>    mPatternRowStart;   /**< ** (--) trick_chkpnt_io(**) Row starts of the last analyzed input pattern. */
+        std::vector<int>    mPatternColumns;    /**< ** (--) trick_chkpnt_io(**) Column numbers of the last analyzed input pattern. */
+        std::vector<int>    mPermutation;       /**< ** (--) trick_chkpnt_io(**) Fill-reducing ordering, new row to original row. */
+        std::vector<int>    mInverse;           /**< ** (--) trick_chkpnt_io(**) Inverse of the ordering, original row to new row. */
+        std::vector<int>    mParent;            /**< ** (--) trick_chkpnt_io(**) Elimination tree parent of each permuted column, -1 for roots. */
+        std::vector<int>    mColumnStart;       /**< ** (--) trick_chkpnt_io(**) Start of each column of [L] in mRowIndex & mLower, plus the total at the end. */
+        std::vector<int>    mRowIndex;          /**< ** (--) trick_chkpnt_io(**) Permuted row number of each non-zero term in [L]. */
+        std::vector<double> mLower;             /**< ** (--) trick_chkpnt_io(**) Values of the non-zero terms in [L]. */
+        std::vector<double> mDiagonal;          /**< ** (--) trick_chkpnt_io(**) Values of [D]. */
+        std::vector<int>    mColumnCount;       /**< ** (--) trick_chkpnt_io(**) Working count of terms in each column of [L]. */
+        std::vector<int>    mFlag;              /**< ** (--) trick_chkpnt_io(**) Working visited flags for elimination tree traversal. */
+        std::vector<int>    mStack;             /**< ** (--) trick_chkpnt_io(**) Working row pattern stack for the numeric factorization. */
+        std::vector<double> mWork;              /**< ** (--) trick_chkpnt_io(**) Working dense row & permuted vector. */
+        SparseCsrMatrix     mDenseInput;        /**< ** (--) trick_chkpnt_io(**) Sparse copy of a dense input matrix. */
+        std::vector<int>    mDensePositions;    /**< ** (--) trick_chkpnt_io(**) Non-zero positions of the last dense input matrix. */
+
+        /// @brief Returns whether the given pattern differs from the last analyzed.
+        bool         isPatternChanged(const int n, const int* rowStart, const int* columns) const;
+
+        /// @brief Finds the ordering, elimination tree & factor storage for the given pattern.
+        void         analyze(const int n, const int* rowStart, const int* columns);
+
+        /// @brief Finds the minimum degree ordering of the given pattern.
+        void         orderMinimumDegree(const int n, const int* rowStart, const int* columns);
+
+        /// @brief Computes the numeric factorization of the given matrix.
+        void         factor(const int* rowStart, const int* columns, const double* values);
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        CholeskyLduSparse(const CholeskyLduSparse& that);
+
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        CholeskyLduSparse& operator =(const CholeskyLduSparse&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) The number of times the ordering & symbolic factorization has been done.
+///
+/// @details  Returns mAnalysisCount.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int CholeskyLduSparse::getAnalysisCount() const
+{
+    return mAnalysisCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) The number of off-diagonal non-zero terms in the [L] factor.
+///
+/// @details  Returns the size of the last analyzed factor, or zero before the first analysis.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int CholeskyLduSparse::getFactorNnz() const
+{
+    return static_cast<int>(mRowIndex.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  std::vector<int>& (--) The fill-reducing permutation.
+///
+/// @details  Returns mPermutation.  Element i is the original row number eliminated i'th.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const std::vector<int>& CholeskyLduSparse::getPermutation() const
+{
+    return mPermutation;
+}
+
+#endif
@@ -0,0 +1,362 @@
+/*
+@file
+@brief    Preconditioned Conjugate Gradient Solver implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+     ((SparseCsrMatrix.o))
+*/
+
+#include "ConjugateGradient.hh"
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Preconditioned Conjugate Gradient Solver with no matrix and the
+///           Jacobi preconditioner.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+ConjugateGradient::ConjugateGradient()
+    :
+    mPreconditioner(JACOBI),
+    mApplied(JACOBI),
+    mSize(0),
+    mRowStart(),
+    mColumns(),
+    mValues(),
+    mInverseDiagonal(),
+    mLowerStart(),
+    mLowerColumns(),
+    mLowerValues(),
+    mResidualVector(),
+    mPreconditioned(),
+    mDirection(),
+    mProduct(),
+    mResidual(0.0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Preconditioned Conjugate Gradient Solver.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+ConjugateGradient::~ConjugateGradient()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] preconditioner (--) The preconditioner to use.
+///
+/// @details  Sets the preconditioner, and rebuilds it for the current matrix if there is one.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ConjugateGradient::setPreconditioner(const Preconditioner preconditioner)
+{
+    mPreconditioner = preconditioner;
+    if (mSize > 0) {
+        buildPreconditioner();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] A (--) The matrix [A] in sparse storage.
+///
+/// @details  Copies the stored terms of the sparse matrix, and builds the preconditioner for it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ConjugateGradient::setMatrix(const SparseCsrMatrix& A)
+{
+    mSize = A.getSize();
+    const int     nnz      = A.getNnz();
+    const int*    rowStart = A.getRowStart();
+    const int*    columns  = A.getColumnIndex();
+    const double* values   = A.getValues();
+    if (mSize > 0) {
+        mRowStart.assign(rowStart, rowStart + mSize + 1);
+        mColumns .assign(columns,  columns  + nnz);
+        mValues  .assign(values,   values   + nnz);
+    } else {
+        mRowStart.assign(1, 0);
+        mColumns .clear();
+        mValues  .clear();
+    }
+    buildPreconditioner();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] A (--) The n x n matrix [A] in dense row-major storage.
+/// @param[in] n (--) The number of rows & columns in the matrix.
+///
+/// @details  Copies the non-zero terms and the full diagonal of the dense matrix into sparse
+///           storage, and builds the preconditioner for it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ConjugateGradient::setMatrix(const double* A, const int n)
+{
+    mSize = (n > 0) ? n : 0;
+    mRowStart.assign(mSize + 1, 0);
+    mColumns.clear();
+    mValues .clear();
+    for (int row = 0; row < mSize; ++row) {
+        const double* rowA = A + row * mSize;
+        for (int col = 0; col < mSize; ++col) {
+            if (0.0 != rowA[col] or row == col) {
+                mColumns.push_back(col);
+                mValues .push_back(rowA[col]);
+            }
+        }
+        mRowStart[row+1] = static_cast<int>(mColumns.size());
+    }
+    buildPreconditioner();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Sizes the working vectors, and builds the Jacobi preconditioner and, if selected, the
+///           incomplete Cholesky factor.  If the incomplete Cholesky factorization breaks down, the
+///           Jacobi preconditioner is applied instead.  A non-positive diagonal is given a Jacobi
+///           factor of 1 so the preconditioner stays finite; the solution will then fail on its own.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ConjugateGradient::buildPreconditioner()
+{
+    mResidualVector.assign(mSize, 0.0);
+    mPreconditioned.assign(mSize, 0.0);
+    mDirection     .assign(mSize, 0.0);
+    mProduct       .assign(mSize, 0.0);
+
+    mInverseDiagonal.assign(mSize, 1.0);
+    for (int row = 0; row < mSize; ++row) {
+        for (int slot = mRowStart[row]; slot < mRowStart[row+1]; ++slot) {
+            if (row == mColumns[slot] and mValues[slot] > 0.0) {
+                mInverseDiagonal[row] = 1.0 / mValues[slot];
+            }
+        }
+    }
+
+    mApplied = JACOBI;
+    if (INCOMPLETE_CHOLESKY == mPreconditioner) {
+        if (factorIncompleteCholesky()) {
+            mApplied = INCOMPLETE_CHOLESKY;
+        } else {
+            mLowerStart  .clear();
+            mLowerColumns.clear();
+            mLowerValues .clear();
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the factorization succeeded, false if it broke down.
+///
+/// @details  Computes the incomplete Cholesky factor [L] with the pattern of the lower triangle of
+///           [A], a row at a time.  Each off-diagonal term is reduced by the products of the terms
+///           to its left in its row with those of the same columns in the row of its column, found
+///           by merging the two sorted rows, and the diagonal is the square root of its reduced
+///           value.  The factorization breaks down if any reduced diagonal is not positive.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool ConjugateGradient::factorIncompleteCholesky()
+{
+    /// - Copy the lower triangle pattern & values of [A], with each row's diagonal last.
+    mLowerStart  .assign(mSize + 1, 0);
+    mLowerColumns.clear();
+    mLowerValues .clear();
+    for (int row = 0; row < mSize; ++row) {
+        double diagonal = 0.0;
+        for (int slot = mRowStart[row]; slot < mRowStart[row+1]; ++slot) {
+            const int col = mColumns[slot];
+            if (col < row) {
+                mLowerColumns.push_back(col);
+                mLowerValues .push_back(mValues[slot]);
+            } else if (col == row) {
+                diagonal = mValues[slot];
+            }
+        }
+        mLowerColumns.push_back(row);
+        mLowerValues .push_back(diagonal);
+        mLowerStart[row+1] = static_cast<int>(mLowerColumns.size());
+    }
+
+    /// - Factor in place.
+    for (int row = 0; row < mSize; ++row) {
+        const int start = mLowerStart[row];
+        const int last  = mLowerStart[row+1] - 1;
+        for (int slot = start; slot < last; ++slot) {
+            const int col      = mLowerColumns[slot];
+            const int colStart = mLowerStart[col];
+            const int colLast  = mLowerStart[col+1] - 1;
+            double sum = mLowerValues[slot];
+            for (int i = start, j = colStart; i < slot and j < colLast; ) {
+                if (mLowerColumns[i] < mLowerColumns[j]) {
+                    ++i;
+                } else if (mLowerColumns[j] < mLowerColumns[i]) {
+                    ++j;
+                } else {
+                    sum -= mLowerValues[i] * mLowerValues[j];
+                    ++i;
+                    ++j;
+                }
+            }
+            mLowerValues[slot] = sum / mLowerValues[colLast];
+        }
+        double diagonal = mLowerValues[last];
+        for (int slot = start; slot < last; ++slot) {
+            diagonal -= mLowerValues[slot] * mLowerValues[slot];
+        }
+        if (not (diagonal > 0.0)) {
+            return false;
+        }
+        mLowerValues[last] = std::sqrt(diagonal);
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] z (--) The preconditioned vector [M]^-1 {r}.
+/// @param[in]  r (--) The vector to precondition.
+///
+/// @details  Applies the Jacobi preconditioner, or the incomplete Cholesky preconditioner by
+///           forward substitution with [L] and backward substitution with [L]', which is done by
+///           rows of [L].
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ConjugateGradient::precondition(double* z, const double* r) const
+{
+    if (INCOMPLETE_CHOLESKY == mApplied) {
+        for (int row = 0; row < mSize; ++row) {
+            const int last = mLowerStart[row+1] - 1;
+            double sum = r[row];
+            for (int slot = mLowerStart[row]; slot < last; ++slot) {
+                sum -= mLowerValues[slot] * z[mLowerColumns[slot]];
+            }
+            z[row] = sum / mLowerValues[last];
+        }
+        for (int row = mSize - 1; row >= 0; --row) {
+            const int last = mLowerStart[row+1] - 1;
+            z[row] /= mLowerValues[last];
+            for (int slot = mLowerStart[row]; slot < last; ++slot) {
+                z[mLowerColumns[slot]] -= mLowerValues[slot] * z[row];
+            }
+        }
+    } else {
+        for (int row = 0; row < mSize; ++row) {
+            z[row] = mInverseDiagonal[row] * r[row];
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] y (--) The product vector.
+/// @param[in]  x (--) The vector to multiply.
+///
+/// @details  Computes {y} = [A]{x} over the stored terms of [A].
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ConjugateGradient::multiply(double* y, const double* x) const
+{
+    for (int row = 0; row < mSize; ++row) {
+        double sum = 0.0;
+        for (int slot = mRowStart[row]; slot < mRowStart[row+1]; ++slot) {
+            sum += mValues[slot] * x[mColumns[slot]];
+        }
+        y[row] = sum;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] x             (--) Both the initial estimate (in) and the solution (out) {x}.
+/// @param[in]     b             (--) The right-hand side vector {b}.
+/// @param[in]     maxIterations (--) The limit on the number of iterations this call may perform.
+/// @param[in]     tolerance     (--) The scaled residual norm relative to the scaled norm of {b}
+///                                   below which the solution is converged.
+///
+/// @returns  int (--) The number of iterations this solution took if it converged, 0 if the initial
+///                    estimate was already converged, or -1 if it did not converge.
+///
+/// @details  Solves [A]{x} = {b} for {x} by the preconditioned conjugate gradient method, starting
+///           from the caller's estimate of {x}.  The residual and {b} are scaled by the inverse of
+///           the diagonal of [A] for the convergence test, so that rows with very large diagonals,
+///           such as nodes held at a potential by a large conductance, don't dominate the norms.
+///           The iterations also stop without converging if the search direction loses positive
+///           curvature, which means [A] or [M] is not positive definite.
+///
+/// @note     If this method fails to converge, {x} is returned with the results of the last,
+///           unconverged iteration.  The caller must restore a previous valid solution or take
+///           other steps as appropriate.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int ConjugateGradient::solve(double* x, const double* b, const int maxIterations,
+                             const double tolerance)
+{
+    if (mSize < 1) {
+        mResidual = 0.0;
+        return 0;
+    }
+    double* r = &mResidualVector[0];
+    double* z = &mPreconditioned[0];
+    double* p = &mDirection[0];
+    double* q = &mProduct[0];
+
+    /// - The solution of a zero {b} is zero.
+    double bNorm = 0.0;
+    for (int i = 0; i < mSize; ++i) {
+        const double scaled = mInverseDiagonal[i] * b[i];
+        bNorm += scaled * scaled;
+    }
+    bNorm = std::sqrt(bNorm);
+    if (0.0 == bNorm) {
+        for (int i = 0; i < mSize; ++i) {
+            x[i] = 0.0;
+        }
+        mResidual = 0.0;
+        return 0;
+    }
+
+    /// - Initial residual from the caller's estimate.
+    multiply(q, x);
+    double rNorm = 0.0;
+    for (int i = 0; i < mSize; ++i) {
+        r[i] = b[i] - q[i];
+        const double scaled = mInverseDiagonal[i] * r[i];
+        rNorm += scaled * scaled;
+    }
+    mResidual = std::sqrt(rNorm) / bNorm;
+    if (mResidual <= tolerance) {
+        return 0;
+    }
+
+    precondition(z, r);
+    double rz = 0.0;
+    for (int i = 0; i < mSize; ++i) {
+        p[i] = z[i];
+        rz  += r[i] * z[i];
+    }
+
+    for (int iteration = 1; iteration <= maxIterations; ++iteration) {
+        multiply(q, p);
+        double pq = 0.0;
+        for (int i = 0; i < mSize; ++i) {
+            pq += p[i] * q[i];
+        }
+        if (not (pq > 0.0 and rz > 0.0)) {
+            return -1;
+        }
+        const double alpha = rz / pq;
+        rNorm = 0.0;
+        for (int i = 0; i < mSize; ++i) {
+            x[i] += alpha * p[i];
+            r[i] -= alpha * q[i];
+            const double scaled = mInverseDiagonal[i] * r[i];
+            rNorm += scaled * scaled;
+        }
+        mResidual = std::sqrt(rNorm) / bNorm;
+        if (mResidual <= tolerance) {
+            return iteration;
+        }
+
+        precondition(z, r);
+        double rzNew = 0.0;
+        for (int i = 0; i < mSize; ++i) {
+            rzNew += r[i] * z[i];
+        }
+        const double beta = rzNew / rz;
+        rz = rzNew;
+        for (int i = 0; i < mSize; ++i) {
+            p[i] = z[i] + beta * p[i];
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,163 @@
+#ifndef ConjugateGradient_EXISTS
+#define ConjugateGradient_EXISTS
+
+/**
+@file
+@brief    Preconditioned Conjugate Gradient Solver declarations
+
+@defgroup  TSM_UTILITIES_MATH_LINEAR_ALGEBRA_CONJUGATE_GRADIENT Preconditioned Conjugate Gradient
+@ingroup   TSM_UTILITIES_MATH_LINEAR_ALGEBRA
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (An iterative solver for symmetric positive definite systems of linear algebraic equations
+   [A]{x} = {b}, using the conjugate gradient method with Jacobi or incomplete Cholesky
+   preconditioning.  The iteration starts from the caller's {x}, so a good initial estimate, such
+   as the last solution of a slowly varying system, converges in few or no iterations.)
+
+REFERENCE:
+- (Saad, Y., "Iterative Methods for Sparse Linear Systems", 2nd Ed., SIAM, 2003, sections 9.2 &
+   10.3)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The matrix is symmetric positive definite, and symmetric in pattern.)
+- (The matrix is copied into internal sparse storage by setMatrix, and the preconditioner is built
+   then, so repeated solutions with the same matrix only pay for the iterations.)
+- (The incomplete Cholesky preconditioner has no fill-in, IC(0).  If it breaks down on a
+   non-positive pivot, the Jacobi preconditioner is used instead for that matrix.)
+
+LIBRARY_DEPENDENCY:
+- ((ConjugateGradient.o))
+
+PROGRAMMERS:
+- ((agent) (agent@local) (2026-10) (Initial))
+
+@{
+*/
+
+#include "SparseCsrMatrix.hh"
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Preconditioned Conjugate Gradient Solver
+///
+/// @details  Holds a copy of the matrix [A] in compressed sparse row storage and its
+///           preconditioner [M], and solves [A]{x} = {b} for {x} by the preconditioned conjugate
+///           gradient method.  The iterations stop when the 2-norm of the residual {b} - [A]{x},
+///           scaled by the inverse of the diagonal of [A], is no more than the tolerance times the
+///           2-norm of {b} scaled the same way.
+///
+///           The Jacobi preconditioner is the inverse of the diagonal of [A].  The incomplete
+///           Cholesky preconditioner is [L][L]', where [L] is lower triangular with the same
+///           pattern as the lower triangle of [A], and is applied by forward & backward
+///           substitution.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class ConjugateGradient
+{
+    public:
+        /// @brief Enumeration of the preconditioners.
+        enum Preconditioner {
+            JACOBI              = 0, ///< Inverse of the matrix diagonal.
+            INCOMPLETE_CHOLESKY = 1  ///< Incomplete Cholesky factorization with no fill-in.
+        };
+        /// @brief Default constructor.
+        ConjugateGradient();
+        /// @brief Default destructor.
+        virtual ~ConjugateGradient();
+        /// @brief Sets the preconditioner, rebuilding it for the current matrix.
+        void           setPreconditioner(const Preconditioner preconditioner);
+        /// @brief Returns the preconditioner selected by the user.
+        Preconditioner getPreconditioner() const;
+        /// @brief Returns the preconditioner in use for the current matrix.
+        Preconditioner getAppliedPreconditioner() const;
+        /// @brief Loads the matrix from sparse storage and builds the preconditioner.
+        void           setMatrix(const SparseCsrMatrix& A);
+        /// @brief Loads the matrix from dense storage and builds the preconditioner.
+        void           setMatrix(const double* A, const int n);
+        /// @brief Solves [A]{x} = {b} for {x} iteratively, starting from the given {x}.
+        int            solve(double* x, const double* b, const int maxIterations,
+                             const double tolerance);
+        /// @brief Returns the number of rows in the current matrix.
+        int            getSize() const;
+        /// @brief Returns the relative scaled residual norm at the end of the last solution.
+        double         getResidual() const;
+
+    protected:
+        Preconditioner      mPreconditioner;    /**<    (--) trick_chkpnt_io(**) Preconditioner selected by the user. */
+        Preconditioner      mApplied;           /**< ** (--) trick_chkpnt_io(**) Preconditioner in use for the current matrix. */
+        int                 mSize;              /**< ** (--) trick_chkpnt_io(**) Number of rows & columns in the matrix. */
+        std::vector<int>    mRowStart;          /**< ** (--) trick_chkpnt_io(**) Start of each row of [A] in mColumns & mValues, plus the total at the end. */
+        std::vector<int>    mColumns;           /**< ** (--) trick_chkpnt_io(**) Column number of each stored term of [A], ascending in each row. */
+        std::vector<double> mValues;            /**< ** (--) trick_chkpnt_io(**) Values of the stored terms of [A]. */
+        std::vector<double> mInverseDiagonal;   /**< ** (--) trick_chkpnt_io(**) Jacobi preconditioner. */
+        std::vector<int>    mLowerStart;        /**< ** (--) trick_chkpnt_io(**) Start of each row of [L] in mLowerColumns & mLowerValues, plus the total at the end. */
+        std::vector<int>    mLowerColumns;      /**< ** (--) trick_chkpnt_io(**) Column number of each term of [L], ascending with the diagonal last in each row. */
+        std::vector<double> mLowerValues;       /**< ** (--) trick_chkpnt_io(**) Values of the terms of the incomplete Cholesky factor [L]. */
+        std::vector<double> mResidualVector;    /**< ** (--) trick_chkpnt_io(**) Working residual vector {r}. */
+        std::vector<double> mPreconditioned;    /**< ** (--) trick_chkpnt_io(**) Working preconditioned residual vector {z}. */
+        std::vector<double> mDirection;         /**< ** (--) trick_chkpnt_io(**) Working search direction vector {p}. */
+        std::vector<double> mProduct;           /**< ** (--) trick_chkpnt_io(**) Working product vector [A]{p}. */
+        double              mResidual;          /**< ** (--) trick_chkpnt_io(**) Relative scaled residual norm at the end of the last solution. */
+
+    private:
+        /// @brief Builds the preconditioner for the current matrix.
+        void buildPreconditioner();
+        /// @brief Builds the incomplete Cholesky factor, returning false on breakdown.
+        bool factorIncompleteCholesky();
+        /// @brief Computes {z} = [M]^-1 {r}.
+        void precondition(double* z, const double* r) const;
+        /// @brief Computes {y} = [A]{x}.
+        void multiply(double* y, const double* x) const;
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        ConjugateGradient(const ConjugateGradient& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        ConjugateGradient& operator =(const ConjugateGradient&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  Preconditioner (--) The preconditioner selected by the user.
+///
+/// @details  Returns mPreconditioner.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline ConjugateGradient::Preconditioner ConjugateGradient::getPreconditioner() const
+{
+    return mPreconditioner;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  Preconditioner (--) The preconditioner in use for the current matrix.
+///
+/// @details  Returns mApplied.  This differs from the selected preconditioner when the incomplete
+///           Cholesky factorization broke down and Jacobi is used instead.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline ConjugateGradient::Preconditioner ConjugateGradient::getAppliedPreconditioner() const
+{
+    return mApplied;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) The number of rows & columns in the current matrix.
+///
+/// @details  Returns mSize.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int ConjugateGradient::getSize() const
+{
+    return mSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (--) The relative scaled residual norm at the end of the last solution.
+///
+/// @details  Returns mResidual.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double ConjugateGradient::getResidual() const
+{
+    return mResidual;
+}
+
+#endif
@@ -0,0 +1,200 @@
+/*
+@file
+@brief    Sparse Compressed Row Storage Matrix implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+     ()
+*/
+
+#include "SparseCsrMatrix.hh"
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Sparse CSR Matrix with an empty pattern.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+SparseCsrMatrix::SparseCsrMatrix()
+    :
+    mSize(0),
+    mNnz(0),
+    mRowStart(0),
+    mColumnIndex(0),
+    mDiagonalSlots(0),
+    mValues(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Sparse CSR Matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+SparseCsrMatrix::~SparseCsrMatrix()
+{
+    cleanup();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes allocated memory and resets to an empty pattern.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SparseCsrMatrix::cleanup()
+{
+    delete [] mValues;
+    mValues = 0;
+    delete [] mDiagonalSlots;
+    mDiagonalSlots = 0;
+    delete [] mColumnIndex;
+    mColumnIndex = 0;
+    delete [] mRowStart;
+    mRowStart = 0;
+    mNnz  = 0;
+    mSize = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] n         (--) The number of rows & columns in the matrix.
+/// @param[in] positions (--) Dense matrix positions (row * n + column) to be stored.
+///
+/// @details  Builds the symbolic pattern of stored positions, replacing any previous pattern, and
+///           zeroes the values.  The full diagonal is always stored, and the pattern is made
+///           symmetric by also storing the transpose of each given position.  Positions outside of
+///           the n x n matrix are ignored, and duplicates are only stored once.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SparseCsrMatrix::buildPattern(const int n, const std::vector<int>& positions)
+{
+    cleanup();
+    if (n < 1) {
+        return;
+    }
+
+    /// - Collect the diagonal, the given positions and their transposes, then sort them into
+    ///   row-major order and remove duplicates.
+    const int denseSize = n * n;
+    std::vector<int> entries;
+    entries.reserve(n + 2 * positions.size());
+    for (int i = 0; i < n; ++i) {
+        entries.push_back(i * n + i);
+    }
+    for (unsigned int i = 0; i < positions.size(); ++i) {
+        const int position = positions[i];
+        if (position > -1 and position < denseSize) {
+            const int row = position / n;
+            const int col = position % n;
+            if (row != col) {
+                entries.push_back(position);
+                entries.push_back(col * n + row);
+            }
+        }
+    }
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+
+    /// - Allocate and load the compressed rows.
+    mSize          = n;
+    mNnz           = static_cast<int>(entries.size());
+    mRowStart      = new int[n + 1];
+    mDiagonalSlots = new int[n];
+    mColumnIndex   = new int[mNnz];
+    mValues        = new double[mNnz];
+    for (int i = 0; i <= n; ++i) {
+        mRowStart[i] = 0;
+    }
+    for (int slot = 0; slot < mNnz; ++slot) {
+        const int row = entries[slot] / n;
+        const int col = entries[slot] % n;
+        mColumnIndex[slot] = col;
+        mValues[slot]      = 0.0;
+        mRowStart[row + 1]++;
+        if (row == col) {
+            mDiagonalSlots[row] = slot;
+        }
+    }
+    for (int i = 0; i < n; ++i) {
+        mRowStart[i + 1] += mRowStart[i];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] row (--) Row number of the desired entry.
+/// @param[in] col (--) Column number of the desired entry.
+///
+/// @returns  int (--) The storage slot of the entry, or -1 if it isn't in the pattern.
+///
+/// @details  Performs a binary search of the row's sorted column numbers.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int SparseCsrMatrix::findSlot(const int row, const int col) const
+{
+    if (row < 0 or row >= mSize or col < 0 or col >= mSize) {
+        return -1;
+    }
+    const int* first = mColumnIndex + mRowStart[row];
+    const int* last  = mColumnIndex + mRowStart[row + 1];
+    const int* found = std::lower_bound(first, last, col);
+    if (found != last and *found == col) {
+        return static_cast<int>(found - mColumnIndex);
+    }
+    return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Zeroes all of the stored values.  The pattern is unchanged.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SparseCsrMatrix::zero()
+{
+    for (int slot = 0; slot < mNnz; ++slot) {
+        mValues[slot] = 0.0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] A (--) Pointer to the first element of the dense matrix A[n][n].
+///
+/// @details  Zeroes the dense matrix and copies the stored values into their positions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SparseCsrMatrix::toDense(double* A) const
+{
+    const int denseSize = mSize * mSize;
+    for (int i = 0; i < denseSize; ++i) {
+        A[i] = 0.0;
+    }
+    for (int row = 0; row < mSize; ++row) {
+        double* rowA = A + row * mSize;
+        for (int slot = mRowStart[row]; slot < mRowStart[row + 1]; ++slot) {
+            rowA[mColumnIndex[slot]] = mValues[slot];
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] A (--) Pointer to the first element of the dense matrix A[n][n].
+///
+/// @details  Loads the stored values from their positions in the dense matrix.  Dense values
+///           outside of the pattern are ignored.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SparseCsrMatrix::fromDense(const double* A)
+{
+    for (int row = 0; row < mSize; ++row) {
+        const double* rowA = A + row * mSize;
+        for (int slot = mRowStart[row]; slot < mRowStart[row + 1]; ++slot) {
+            mValues[slot] = rowA[mColumnIndex[slot]];
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] y (--) The product vector, size n.
+/// @param[in]  x (--) The vector to multiply, size n.
+///
+/// @details  Computes the matrix-vector product {y} = [this]{x}.  y and x must not overlap.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SparseCsrMatrix::multiply(double* y, const double* x) const
+{
+    for (int row = 0; row < mSize; ++row) {
+        double sum = 0.0;
+        for (int slot = mRowStart[row]; slot < mRowStart[row + 1]; ++slot) {
+            sum += mValues[slot] * x[mColumnIndex[slot]];
+        }
+        y[row] = sum;
+    }
+}
@@ -0,0 +1,180 @@
+#ifndef SparseCsrMatrix_EXISTS
+#define SparseCsrMatrix_EXISTS
+
+/**
+@file
+@brief    Sparse Compressed Row Storage Matrix declarations
+
+@defgroup  TSM_UTILITIES_MATH_LINEAR_ALGEBRA_SPARSE_CSR_MATRIX Sparse CSR Matrix
+@ingroup   TSM_UTILITIES_MATH_LINEAR_ALGEBRA
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Stores a square sparse matrix in Compressed Sparse Row (CSR) format with a fixed symbolic
+   pattern of non-zero positions.  The pattern is built once from a list of dense matrix positions,
+   after which callers can look up the storage slot of each position once and then accumulate
+   values directly into the slots.)
+
+REFERENCE:
+- (Saad, Y., "Iterative Methods for Sparse Linear Systems", 2nd Ed., SIAM, 2003, section 3.4)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The pattern is symmetric and always includes the full diagonal, as is the case for the GUNNS
+   admittance matrix.)
+- (Dense positions are given as row * n + column, the same indexing used by dense row-major
+   matrices.)
+
+LIBRARY_DEPENDENCY:
+- ((SparseCsrMatrix.o))
+
+PROGRAMMERS:
+- ((agent) (agent@local) (2026-10) (Initial))
+
+@{
+*/
+
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Sparse Compressed Row Storage Matrix
+///
+/// @details  This holds an n x n matrix in CSR format.  Row i's entries are stored in the values
+///           array at slots mRowStart[i] through mRowStart[i+1]-1, with their column numbers in the
+///           same slots of mColumnIndex, sorted by ascending column.  The slot of each row's
+///           diagonal is also stored for fast access.
+///
+///           The symbolic pattern (which positions are stored) is defined by the buildPattern
+///           method, and stays fixed until buildPattern is called again.  The values can be
+///           re-accumulated as often as needed without re-allocating anything.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class SparseCsrMatrix
+{
+    public:
+        /// @brief Default constructor.
+        SparseCsrMatrix();
+
+        /// @brief Default destructor.
+        virtual ~SparseCsrMatrix();
+
+        /// @brief Builds the symbolic pattern from the given dense matrix positions.
+        void    buildPattern(const int n, const std::vector<int>& positions);
+
+        /// @brief Returns the storage slot of the given row & column, or -1 if not in the pattern.
+        int     findSlot(const int row, const int col) const;
+
+        /// @brief Zeroes all stored values.
+        void    zero();
+
+        /// @brief Expands the stored values into the given dense matrix.
+        void    toDense(double* A) const;
+
+        /// @brief Loads the stored values from the pattern positions of the given dense matrix.
+        void    fromDense(const double* A);
+
+        /// @brief Computes {y} = [this]{x}.
+        void    multiply(double* y, const double* x) const;
+
+        /// @brief Returns the number of rows & columns.
+        int     getSize() const;
+
+        /// @brief Returns the number of stored entries.
+        int     getNnz() const;
+
+        /// @brief Returns the row start slot array, size n+1.
+        const int* getRowStart() const;
+
+        /// @brief Returns the column index array, size nnz.
+        const int* getColumnIndex() const;
+
+        /// @brief Returns the diagonal slot array, size n.
+        const int* getDiagonalSlots() const;
+
+        /// @brief Returns the stored values array, size nnz.
+        double* getValues() const;
+
+    protected:
+        int     mSize;           /**< *o (--) trick_chkpnt_io(**) Number of rows & columns in the matrix. */
+        int     mNnz;            /**< *o (--) trick_chkpnt_io(**) Number of stored entries in the pattern. */
+        int*    mRowStart;       /**< ** (--) trick_chkpnt_io(**) Slot of the first entry of each row, plus the total at the end. */
+        int*    mColumnIndex;    /**< ** (--) trick_chkpnt_io(**) Column number of each stored entry. */
+        int*    mDiagonalSlots;  /**< ** (--) trick_chkpnt_io(**) Slot of the diagonal entry of each row. */
+        double* mValues;         /**< ** (--) trick_chkpnt_io(**) Values of each stored entry. */
+
+    private:
+        /// @brief Deletes allocated memory.
+        void    cleanup();
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        SparseCsrMatrix(const SparseCsrMatrix& that);
+
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        SparseCsrMatrix& operator =(const SparseCsrMatrix&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) The number of rows & columns in the matrix.
+///
+/// @details  Returns mSize.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int SparseCsrMatrix::getSize() const
+{
+    return mSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) The number of stored entries in the matrix.
+///
+/// @details  Returns mNnz.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int SparseCsrMatrix::getNnz() const
+{
+    return mNnz;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int* (--) The row start slot array.
+///
+/// @details  Returns mRowStart.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const int* SparseCsrMatrix::getRowStart() const
+{
+    return mRowStart;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int* (--) The column index array.
+///
+/// @details  Returns mColumnIndex.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const int* SparseCsrMatrix::getColumnIndex() const
+{
+    return mColumnIndex;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int* (--) The diagonal slot array.
+///
+/// @details  Returns mDiagonalSlots.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const int* SparseCsrMatrix::getDiagonalSlots() const
+{
+    return mDiagonalSlots;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double* (--) The stored values array.
+///
+/// @details  Returns mValues.  Callers may accumulate directly into this array using the slots
+///           returned by findSlot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double* SparseCsrMatrix::getValues() const
+{
+    return mValues;
+}
+
+#endif
@@ -480,3 +480,87 @@ void UtCholeskyLdu::testPosOffDiagSolution()
 
     std::cout << "... Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests rank-1 updates & downdates of a decomposition against decompositions of the
+///           changed matrices, for a conductance network like a GUNNS admittance matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLdu::testUpdate()
+{
+    std::cout << "\n UtCholeskyLdu ..... 08: testUpdate .................................";
+
+    /// - A 6-node chain of conductors with leaks to ground on the end nodes.
+    const int n = 6;
+    double A[36];
+    for (int i = 0; i < 36; ++i) {
+        A[i] = 0.0;
+    }
+    for (int i = 0; i < n-1; ++i) {
+        const double g = 1.0 + i;
+        A[i*n+i]       += g;
+        A[(i+1)*n+i+1] += g;
+        A[i*n+i+1]     -= g;
+        A[(i+1)*n+i]   -= g;
+    }
+    A[0]   += 0.5;
+    A[n*n-1] += 0.25;
+
+    /// - Update with a new conductor between nodes 1 & 4, z = e1 - e4.
+    double LDU[36];
+    double expected[36];
+    for (int i = 0; i < 36; ++i) {
+        LDU[i] = A[i];
+    }
+    tArticle.Decompose(LDU, n);
+
+    const double g = 3.0;
+    double z[n] = {0.0, 1.0, 0.0, 0.0, -1.0, 0.0};
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Update(LDU, z, g, n, 1));
+    A[1*n+1] += g;
+    A[4*n+4] += g;
+    A[1*n+4] -= g;
+    A[4*n+1] -= g;
+    for (int i = 0; i < 36; ++i) {
+        expected[i] = A[i];
+    }
+    tArticle.Decompose(expected, n);
+    for (int i = 0; i < 36; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[i], LDU[i], 1.0E-12);
+    }
+
+    /// - Solutions with the updated decomposition satisfy the changed system.
+    double b[n] = {1.0, 0.0, -2.0, 0.5, 0.0, 3.0};
+    double x[n];
+    tArticle.Solve(LDU, b, x, n);
+    for (int i = 0; i < n; ++i) {
+        double result = 0.0;
+        for (int j = 0; j < n; ++j) {
+            result += A[i*n+j] * x[j];
+        }
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(b[i], result, 1.0E-12);
+    }
+
+    /// - Downdate the conductor between nodes 2 & 3 by half, and a diagonal leak at node 5.
+    double z2[n] = {0.0, 0.0, 1.0, -1.0, 0.0, 0.0};
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Update(LDU, z2, -1.5, n, 2));
+    double z3[n] = {0.0, 0.0, 0.0, 0.0, 0.0, 1.0};
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Update(LDU, z3, -0.125, n));
+    A[2*n+2] -= 1.5;
+    A[3*n+3] -= 1.5;
+    A[2*n+3] += 1.5;
+    A[3*n+2] += 1.5;
+    A[n*n-1] -= 0.125;
+    for (int i = 0; i < 36; ++i) {
+        expected[i] = A[i];
+    }
+    tArticle.Decompose(expected, n);
+    for (int i = 0; i < 36; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[i], LDU[i], 1.0E-12);
+    }
+
+    /// - Downdating past positive-definite throws.
+    double z4[n] = {1.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    CPPUNIT_ASSERT_THROW(tArticle.Update(LDU, z4, -100.0, n), TsNumericalException);
+
+    std::cout << "... Pass";
+}
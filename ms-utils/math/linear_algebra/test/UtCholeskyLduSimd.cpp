@@ -0,0 +1,306 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    ((math/linear_algebra/CholeskyLduSimd.o))
+***************************************************************************************************/
+
+#include "UtCholeskyLduSimd.hh"
+#include "software/exceptions/TsNumericalException.hh"
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <iostream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (s) Monotonic clock time.
+///
+/// @details  Returns the wall clock time for the benchmark.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static double benchmarkClock()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + 1.0E-9 * now.tv_nsec;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Vectorized Cholesky LDU Decomposition unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtCholeskyLduSimd::UtCholeskyLduSimd()
+    :
+    tArticle(),
+    tBase()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Vectorized Cholesky LDU Decomposition unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtCholeskyLduSimd::~UtCholeskyLduSimd()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSimd::setUp()
+{
+    tArticle.setInstructionSet(CholeskyLduSimd::getSupportedInstructionSet());
+    tArticle.setBlockSize(64);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSimd::tearDown()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] A (--) The admittance matrix.
+/// @param[in]  n (--) Number of nodes.
+///
+/// @details  Builds the admittance matrix of a network of conductors: a chain through all nodes,
+///           plus pseudo-random conductors between other node pairs, about n/8 per node, and
+///           pseudo-random conductances to ground on every fourth node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSimd::buildNetwork(std::vector<double>& A, const int n) const
+{
+    A.assign(n * n, 0.0);
+    unsigned int seed = 12345u;
+    const int links = (n / 8 > 1) ? n / 8 : 1;
+    for (int i = 0; i < n; ++i) {
+        for (int link = 0; link <= links; ++link) {
+            int j = i + 1;
+            if (link > 0) {
+                seed = seed * 1103515245u + 12345u;
+                j = static_cast<int>((seed >> 8) % static_cast<unsigned int>(n));
+            }
+            if (j < n and j != i) {
+                seed = seed * 1103515245u + 12345u;
+                const double g = 0.1 + 10.0 * ((seed >> 8) % 1000u) / 1000.0;
+                A[i*n + j] -= g;
+                A[j*n + i] -= g;
+                A[i*n + i] += g;
+                A[j*n + j] += g;
+            }
+        }
+        if (0 == i % 4) {
+            A[i*n + i] += 1.0 + i;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] n (--) Number of nodes.
+///
+/// @details  Decomposes and solves a network of the given size with the article and the base class,
+///           and verifies the decompositions and solutions match to within round-off, and that each
+///           can solve the other's decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSimd::verifyAgainstBase(const int n)
+{
+    std::vector<double> A;
+    buildNetwork(A, n);
+    std::vector<double> ldu(A);
+    std::vector<double> ref(A);
+    std::vector<double> b(n);
+    for (int i = 0; i < n; ++i) {
+        b[i] = std::sin(1.0 + i);
+    }
+    std::vector<double> x(n, 0.0);
+    std::vector<double> xRef(n, 0.0);
+    std::vector<double> xMix(n, 0.0);
+
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Decompose(&ldu[0], n));
+    CPPUNIT_ASSERT_NO_THROW(tBase.Decompose(&ref[0], n));
+    for (int i = 0; i < n*n; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(ref[i], ldu[i], 1.0E-12 * std::max(1.0, std::fabs(ref[i])));
+    }
+
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Solve(&ldu[0], &b[0], &x[0], n));
+    CPPUNIT_ASSERT_NO_THROW(tBase.Solve(&ref[0], &b[0], &xRef[0], n));
+    CPPUNIT_ASSERT_NO_THROW(tBase.Solve(&ldu[0], &b[0], &xMix[0], n));
+    for (int i = 0; i < n; ++i) {
+        const double tolerance = 1.0E-10 * std::max(1.0, std::fabs(xRef[i]));
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(xRef[i], x[i],    tolerance);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(xRef[i], xMix[i], tolerance);
+    }
+
+    /// - Verify the solution satisfies the original system.
+    for (int i = 0; i < n; ++i) {
+        double sum = 0.0;
+        for (int j = 0; j < n; ++j) {
+            sum += A[i*n + j] * x[j];
+        }
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(b[i], sum, 1.0E-10);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests default construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSimd::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtCholeskyLduSimd . 01: testDefaultConstruction ....................";
+
+    FriendlyCholeskyLduSimd article;
+    CPPUNIT_ASSERT(CholeskyLduSimd::getSupportedInstructionSet() == article.mInstructionSet);
+    CPPUNIT_ASSERT(64 == article.mBlockSize);
+    CPPUNIT_ASSERT(0  != article.mDot);
+    CPPUNIT_ASSERT(0  != article.mDot4);
+
+    /// - Test new/delete for code coverage.
+    CholeskyLduSimd* article2 = new CholeskyLduSimd();
+    delete article2;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests instruction set selection is limited to what the CPU supports.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSimd::testInstructionSets()
+{
+    std::cout << "\n UtCholeskyLduSimd . 02: testInstructionSets ........................";
+
+    const CholeskyLduSimd::InstructionSet supported = CholeskyLduSimd::getSupportedInstructionSet();
+    CPPUNIT_ASSERT(CholeskyLduSimd::SCALAR == tArticle.setInstructionSet(CholeskyLduSimd::SCALAR));
+    CPPUNIT_ASSERT(CholeskyLduSimd::SCALAR == tArticle.getInstructionSet());
+    CPPUNIT_ASSERT(supported == tArticle.setInstructionSet(CholeskyLduSimd::AVX512));
+    CPPUNIT_ASSERT(supported == tArticle.getInstructionSet());
+    if (supported >= CholeskyLduSimd::AVX2) {
+        CPPUNIT_ASSERT(CholeskyLduSimd::AVX2 == tArticle.setInstructionSet(CholeskyLduSimd::AVX2));
+    }
+
+    /// - Block size is limited to at least 4 rows.
+    tArticle.setBlockSize(1);
+    CPPUNIT_ASSERT(4 == tArticle.mBlockSize);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests decomposition & solution against CholeskyLdu for each supported instruction set,
+///           over sizes and block sizes that exercise the vector remainders and partial blocks.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSimd::testDecomposeSolve()
+{
+    std::cout << "\n UtCholeskyLduSimd . 03: testDecomposeSolve .........................";
+
+    const int sizes[]  = {1, 2, 3, 5, 8, 17, 33, 64, 100};
+    const int blocks[] = {4, 7, 64};
+    for (int set = CholeskyLduSimd::SCALAR;
+             set <= CholeskyLduSimd::getSupportedInstructionSet(); ++set) {
+        tArticle.setInstructionSet(static_cast<CholeskyLduSimd::InstructionSet>(set));
+        for (int block = 0; block < 3; ++block) {
+            tArticle.setBlockSize(blocks[block]);
+            for (int size = 0; size < 9; ++size) {
+                verifyAgainstBase(sizes[size]);
+            }
+        }
+    }
+
+    /// - Solve with the same input & output vector.
+    double A[9] = { 2.0, -1.0,  0.0,
+                   -1.0,  3.0, -1.0,
+                    0.0, -1.0,  2.0};
+    double b[3] = { 1.0,  1.0,  1.0};
+    tArticle.Decompose(A, 3);
+    tArticle.Solve(A, b, b, 3);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, b[0], 1.0E-15);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, b[1], 1.0E-15);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, b[2], 1.0E-15);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the decomposition throws on a matrix that isn't positive definite, like the base
+///           class, and that tiny values are flushed to zero.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSimd::testErrors()
+{
+    std::cout << "\n UtCholeskyLduSimd . 04: testErrors .................................";
+
+    double A[9] = { 1.0, -1.0,  0.0,
+                   -1.0,  1.0,  0.0,
+                    0.0,  0.0,  1.0};
+    CPPUNIT_ASSERT_THROW(tArticle.Decompose(A, 3), TsNumericalException);
+
+    /// - Like the base class, a non-positive first row isn't detected by the decomposition, but is
+    ///   by the solution.
+    double B[4] = { 0.0,  0.0,
+                    0.0,  1.0};
+    double b[2] = { 1.0,  1.0};
+    double x[2] = { 0.0,  0.0};
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Decompose(B, 2));
+    CPPUNIT_ASSERT_THROW(tArticle.Solve(B, b, x, 2), TsNumericalException);
+
+    /// - Underflow protection.
+    double C[9] = { 1.0,      -1.0E-60,  0.0,
+                   -1.0E-60,   1.0,     -1.0E-110,
+                    0.0,      -1.0E-110, 1.0};
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Decompose(C, 3));
+    CPPUNIT_ASSERT(0.0 == C[7]);
+    CPPUNIT_ASSERT(0.0 == C[5]);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Reports the decomposition rate in GFLOP/s, counting n^3/3 multiply-adds as 2 flops
+///           each, and the time per solution, for CholeskyLdu and each supported instruction set
+///           over a range of network sizes.  This doesn't assert on the timing, which depends on
+///           the machine.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSimd::testBenchmark()
+{
+    std::cout << "\n UtCholeskyLduSimd . 05: testBenchmark ..............................";
+
+    const char* names[] = {"SCALAR", "AVX2", "AVX512"};
+    const int   sizes[] = {32, 64, 128, 256, 512};
+    std::printf("\n      size   method       decomp GFLOP/s   solve (us)");
+    for (int size = 0; size < 5; ++size) {
+        const int n = sizes[size];
+        std::vector<double> A;
+        buildNetwork(A, n);
+        std::vector<double> ldu(n * n);
+        std::vector<double> b(n, 1.0);
+        std::vector<double> x(n, 0.0);
+        const double flops = 2.0 * n * n * n / 3.0;
+        const int    reps  = static_cast<int>(std::max(1.0, 2.0E8 / flops));
+
+        for (int method = -1; method <= CholeskyLduSimd::getSupportedInstructionSet(); ++method) {
+            CholeskyLdu* solver = &tBase;
+            if (method >= 0) {
+                tArticle.setInstructionSet(static_cast<CholeskyLduSimd::InstructionSet>(method));
+                solver = &tArticle;
+            }
+            double decompose = 0.0;
+            for (int rep = 0; rep < reps; ++rep) {
+                ldu = A;
+                const double start = benchmarkClock();
+                solver->Decompose(&ldu[0], n);
+                decompose += benchmarkClock() - start;
+            }
+            const double start = benchmarkClock();
+            for (int rep = 0; rep < reps; ++rep) {
+                solver->Solve(&ldu[0], &b[0], &x[0], n);
+            }
+            const double solve = benchmarkClock() - start;
+            std::printf("\n      %4d   %-12s %12.3f %12.2f", n,
+                        (method < 0) ? "CholeskyLdu" : names[method],
+                        flops * reps / decompose * 1.0E-9, solve / reps * 1.0E6);
+        }
+    }
+    std::cout << "\n UtCholeskyLduSimd . 05: testBenchmark ..............................";
+
+    std::cout << "... Pass";
+}
@@ -0,0 +1,87 @@
+#ifndef UtCholeskyLduSimd_EXISTS
+#define UtCholeskyLduSimd_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_UTILITIES_MATH_LINEAR_ALGEBRA_CHOLESKY_LDU_SIMD Vectorized Cholesky LDU Unit Tests
+/// @ingroup  UT_UTILITIES_MATH_LINEAR_ALGEBRA
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the CholeskyLduSimd class.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <vector>
+
+#include "math/linear_algebra/CholeskyLduSimd.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from CholeskyLduSimd and befriend UtCholeskyLduSimd.
+///
+/// @details  Class derived from the unit under test.  It just has a default constructor and
+///           destructor, but it befriends the unit test case driver class to allow it access to
+///           protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyCholeskyLduSimd : public CholeskyLduSimd
+{
+    public:
+        FriendlyCholeskyLduSimd() : CholeskyLduSimd() {;}
+        virtual ~FriendlyCholeskyLduSimd() {;}
+        friend class UtCholeskyLduSimd;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Vectorized Cholesky LDU Decomposition unit tests.
+///
+/// @details  This class provides the unit tests for the CholeskyLduSimd class within the CPPUnit
+///           framework, and a benchmark against the CholeskyLdu class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtCholeskyLduSimd : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this unit test.
+        UtCholeskyLduSimd();
+        /// @brief    Default destructs this unit test.
+        virtual ~UtCholeskyLduSimd();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests default construction.
+        void testDefaultConstruction();
+        /// @brief    Tests instruction set selection.
+        void testInstructionSets();
+        /// @brief    Tests decomposition & solution against CholeskyLdu.
+        void testDecomposeSolve();
+        /// @brief    Tests decomposition errors.
+        void testErrors();
+        /// @brief    Reports decomposition & solution speed against CholeskyLdu.
+        void testBenchmark();
+    private:
+        CPPUNIT_TEST_SUITE(UtCholeskyLduSimd);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInstructionSets);
+        CPPUNIT_TEST(testDecomposeSolve);
+        CPPUNIT_TEST(testErrors);
+        CPPUNIT_TEST(testBenchmark);
+        CPPUNIT_TEST_SUITE_END();
+
+        FriendlyCholeskyLduSimd tArticle; /**< (--) Unit under test. */
+        CholeskyLdu             tBase;    /**< (--) Scalar decomposition for comparison. */
+
+        /// @brief    Builds a conductive network admittance matrix of the given size.
+        void buildNetwork(std::vector<double>& A, const int n) const;
+        /// @brief    Verifies the article matches the base class for the given size.
+        void verifyAgainstBase(const int n);
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtCholeskyLduSimd(const UtCholeskyLduSimd& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtCholeskyLduSimd& operator =(const UtCholeskyLduSimd& that);
+};
+
+///@}
+
+#endif
@@ -0,0 +1,449 @@
+/************************** TRICK HEADER ***********************************************************
+ LIBRARY DEPENDENCY:
+    ((math/linear_algebra/CholeskyLduSparse.o))
+***************************************************************************************************/
+
+#include "UtCholeskyLduSparse.hh"
+#include "software/exceptions/TsNumericalException.hh"
+#include <cfloat>
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Sparse Cholesky LDU Decomposition unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtCholeskyLduSparse::UtCholeskyLduSparse()
+    :
+    tArticle()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Sparse Cholesky LDU Decomposition unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtCholeskyLduSparse::~UtCholeskyLduSparse()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSparse::setUp()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSparse::tearDown()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] matrix (--) The sparse matrix to load.
+/// @param[out] dense  (--) The dense copy of the matrix.
+/// @param[in]  size   (--) Number of nodes along each side of the grid.
+///
+/// @details  Loads the admittance matrix of a square grid of nodes connected to their neighbors by
+///           conductors of varying conductance, with every 3rd node also connected to ground.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSparse::loadGrid(SparseCsrMatrix& matrix, std::vector<double>& dense,
+                                   const int size)
+{
+    const int n = size * size;
+    dense.assign(n * n, 0.0);
+    for (int node = 0; node < n; ++node) {
+        const int right = node + 1;
+        const int down  = node + size;
+        if (0 != right % size) {
+            const double g = 1.0 + 0.1 * (node % 7);
+            dense[node  * n + node]  += g;
+            dense[right * n + right] += g;
+            dense[node  * n + right] -= g;
+            dense[right * n + node]  -= g;
+        }
+        if (down < n) {
+            const double g = 2.0 + 0.3 * (node % 5);
+            dense[node * n + node] += g;
+            dense[down * n + down] += g;
+            dense[node * n + down] -= g;
+            dense[down * n + node] -= g;
+        }
+        if (0 == node % 3) {
+            dense[node * n + node] += 0.5;
+        }
+    }
+
+    std::vector<int> positions;
+    for (int i = 0; i < n * n; ++i) {
+        if (0.0 != dense[i]) {
+            positions.push_back(i);
+        }
+    }
+    matrix.buildPattern(n, positions);
+    matrix.fromDense(&dense[0]);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests default construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSparse::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtCholeskyLduSparse 01: testDefaultConstruction ....................";
+
+    CPPUNIT_ASSERT(0 == tArticle.getAnalysisCount());
+    CPPUNIT_ASSERT(0 == tArticle.getFactorNnz());
+    CPPUNIT_ASSERT(tArticle.getPermutation().empty());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that the solution of [A]{x} = {b} from the dense interface satisfies the original
+///           system of equations, and that the dense input matrix is not modified.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSparse::testDenseSolution()
+{
+    std::cout << "\n UtCholeskyLduSparse 02: testDenseSolution ..........................";
+
+    const double tolerance = 1.0E-14;
+
+    /// - Test the same made-up system as the dense CholeskyLdu test.
+    double A[16] = {10.0,     -0.001,    -0.002,    0.0,
+                    -0.001,    8.0,      -0.003,   -0.001,
+                    -0.002,   -0.003,    12.0,      0.0,
+                     0.0,     -0.001,     0.0,      9.0};
+    double x[4]  = { 0.0,      0.0,       0.0,      0.0};
+    double b[4]  = {27.0,      0.03,      0.0,     -1.5};
+
+    double C[16];
+    for (int i=0; i<16; ++i) {
+        C[i] = A[i];
+    }
+
+    CholeskyLdu* solver = &tArticle;
+    CPPUNIT_ASSERT_NO_THROW(solver->Decompose(A, 4));
+    CPPUNIT_ASSERT_NO_THROW(solver->Solve(A, b, x, 4));
+    for (int i=0; i<16; ++i) {
+        CPPUNIT_ASSERT(C[i] == A[i]);
+    }
+
+    for (int row=0; row<4; ++row) {
+        double result = 0.0;
+        for (int col=0; col<4; ++col) {
+            result += C[row*4 + col] * x[col];
+        }
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(b[row], result, std::max(fabs(b[row]) * tolerance, 2.0 * tolerance));
+    }
+    CPPUNIT_ASSERT(1 == tArticle.getAnalysisCount());
+
+    /// - Test a solution in place.
+    CPPUNIT_ASSERT_NO_THROW(solver->Solve(A, b, b, 4));
+    for (int i=0; i<4; ++i) {
+        CPPUNIT_ASSERT(x[i] == b[i]);
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that the solution of a sparse grid network matches the dense decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSparse::testSparseSolution()
+{
+    std::cout << "\n UtCholeskyLduSparse 03: testSparseSolution .........................";
+
+    const int size = 8;
+    const int n    = size * size;
+    SparseCsrMatrix     matrix;
+    std::vector<double> dense;
+    loadGrid(matrix, dense, size);
+
+    std::vector<double> b(n);
+    for (int i = 0; i < n; ++i) {
+        b[i] = std::sin(0.3 * i) * 10.0;
+    }
+
+    /// - Solve the sparse system.
+    std::vector<double> x(n, 0.0);
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Decompose(matrix));
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Solve(0, &b[0], &x[0], n));
+
+    /// - Solve the dense system with the dense CholeskyLdu.
+    CholeskyLdu         denseSolver;
+    std::vector<double> ldu(dense);
+    std::vector<double> expected(n, 0.0);
+    denseSolver.Decompose(&ldu[0], n);
+    denseSolver.Solve(&ldu[0], &b[0], &expected[0], n);
+
+    /// - Verify the solutions match and satisfy the system.
+    std::vector<double> result(n, 0.0);
+    matrix.multiply(&result[0], &x[0]);
+    for (int i = 0; i < n; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[i], x[i], 1.0E-12 * std::max(1.0, fabs(expected[i])));
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(b[i], result[i], 1.0E-12 * std::max(1.0, fabs(b[i])));
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the fill-reducing ordering of an arrowhead matrix: a hub node connected to all
+///           others.  In natural order, eliminating the hub first fills the entire matrix.  Minimum
+///           degree eliminates the hub at the end so there is no fill.  Also tests the grid network has
+///           much less fill than the dense lower triangle.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSparse::testOrdering()
+{
+    std::cout << "\n UtCholeskyLduSparse 04: testOrdering ...............................";
+
+    const int n = 10;
+    std::vector<int>    positions;
+    std::vector<double> dense(n * n, 0.0);
+    dense[0] = 1.0;
+    for (int i = 1; i < n; ++i) {
+        dense[i]         = -1.0;
+        dense[i * n]     = -1.0;
+        dense[0]        += 1.0;
+        dense[i * n + i] =  2.0;
+        positions.push_back(i);
+    }
+    SparseCsrMatrix arrow;
+    arrow.buildPattern(n, positions);
+    arrow.fromDense(&dense[0]);
+
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Decompose(arrow));
+    CPPUNIT_ASSERT(n - 1 == tArticle.getFactorNnz());
+    /// - The hub isn't eliminated until its degree ties with the last leaf, and then goes first on
+    ///   the lower node number.
+    CPPUNIT_ASSERT(0     == tArticle.getPermutation()[n - 2]);
+
+    /// - Verify the solution.
+    std::vector<double> b(n, 1.0);
+    std::vector<double> x(n, 0.0);
+    std::vector<double> result(n, 0.0);
+    tArticle.Solve(0, &b[0], &x[0], n);
+    arrow.multiply(&result[0], &x[0]);
+    for (int i = 0; i < n; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(b[i], result[i], 1.0E-14);
+    }
+
+    /// - Grid network fill is much less than the dense lower triangle.
+    const int size = 10;
+    SparseCsrMatrix     grid;
+    std::vector<double> gridDense;
+    loadGrid(grid, gridDense, size);
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Decompose(grid));
+    const int denseLower = size * size * (size * size - 1) / 2;
+    CPPUNIT_ASSERT(tArticle.getFactorNnz() < denseLower / 5);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the ordering & symbolic factorization is only repeated when the matrix pattern
+///           changes, and not when only its values change.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSparse::testAnalysisReuse()
+{
+    std::cout << "\n UtCholeskyLduSparse 05: testAnalysisReuse ..........................";
+
+    const int size = 5;
+    const int n    = size * size;
+    SparseCsrMatrix     matrix;
+    std::vector<double> dense;
+    loadGrid(matrix, dense, size);
+
+    /// - First decomposition does the analysis.
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Decompose(matrix));
+    CPPUNIT_ASSERT(1 == tArticle.getAnalysisCount());
+    const int nnz = tArticle.getFactorNnz();
+
+    /// - Changing values re-uses the analysis, and the new solution is correct.
+    for (int i = 0; i < n; ++i) {
+        dense[i * n + i] *= 2.0;
+    }
+    matrix.fromDense(&dense[0]);
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Decompose(matrix));
+    CPPUNIT_ASSERT(1   == tArticle.getAnalysisCount());
+    CPPUNIT_ASSERT(nnz == tArticle.getFactorNnz());
+
+    std::vector<double> b(n, 1.0);
+    std::vector<double> x(n, 0.0);
+    std::vector<double> result(n, 0.0);
+    tArticle.Solve(0, &b[0], &x[0], n);
+    matrix.multiply(&result[0], &x[0]);
+    for (int i = 0; i < n; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(b[i], result[i], 1.0E-13);
+    }
+
+    /// - Changing the pattern repeats the analysis.  Connect the opposite corners of the grid.
+    dense[0 * n + (n-1)] = -1.0;
+    dense[(n-1) * n + 0] = -1.0;
+    dense[0]             +=  1.0;
+    dense[n * n - 1]     +=  1.0;
+    std::vector<int> positions;
+    for (int i = 0; i < n * n; ++i) {
+        if (0.0 != dense[i]) {
+            positions.push_back(i);
+        }
+    }
+    matrix.buildPattern(n, positions);
+    matrix.fromDense(&dense[0]);
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Decompose(matrix));
+    CPPUNIT_ASSERT(2 == tArticle.getAnalysisCount());
+    tArticle.Solve(0, &b[0], &x[0], n);
+    matrix.multiply(&result[0], &x[0]);
+    for (int i = 0; i < n; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(b[i], result[i], 1.0E-13);
+    }
+
+    /// - The dense interface also only repeats the analysis when the non-zero positions change.
+    CholeskyLduSparse article;
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(&dense[0], n));
+    CPPUNIT_ASSERT(1 == article.getAnalysisCount());
+    dense[0] += 1.0;
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(&dense[0], n));
+    CPPUNIT_ASSERT(1 == article.getAnalysisCount());
+    dense[0 * n + (n-1)] = 0.0;
+    dense[(n-1) * n + 0] = 0.0;
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(&dense[0], n));
+    CPPUNIT_ASSERT(2 == article.getAnalysisCount());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that [A] multiplied by the inverse of [A] is the identity matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSparse::testInvert()
+{
+    std::cout << "\n UtCholeskyLduSparse 06: testInvert .................................";
+
+    const double tolerance = 1.0E-14;
+
+    double A[16] = {10.0,     -0.001,    -0.002,    0.0,
+                    -0.001,    8.0,      -0.003,   -0.001,
+                    -0.002,   -0.003,    12.0,      0.0,
+                     0.0,     -0.001,     0.0,      9.0};
+    double C[16];
+    for (int i=0; i<16; ++i) {
+        C[i] = A[i];
+    }
+
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Decompose(A, 4));
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Invert(A, 4));
+
+    for (int row=0; row<4; ++row) {
+        for (int col=0; col<4; ++col) {
+            double result = 0.0;
+            for (int k=0; k<4; ++k) {
+                result += C[row*4 + k] * A[k*4 + col];
+            }
+            const double expected = (row == col) ? 1.0 : 0.0;
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, result, tolerance);
+        }
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests exceptions thrown for an un-conditioned matrix, solution without a valid
+///           decomposition, and the unsupported row subset decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSparse::testErrors()
+{
+    std::cout << "\n UtCholeskyLduSparse 07: testErrors .................................";
+
+    double x[2] = {0.0, 0.0};
+    double b[2] = {1.0, 1.0};
+
+    /// - Solve before any decomposition.
+    CPPUNIT_ASSERT_THROW(tArticle.Solve(0, b, x, 2), TsNumericalException);
+
+    /// - Un-conditioned (not positive definite) matrix, and no solution after the failure.
+    double A[4] = {1.0, -1.1,
+                  -1.1,  1.0};
+    CPPUNIT_ASSERT_THROW(tArticle.Decompose(A, 2), TsNumericalException);
+    CPPUNIT_ASSERT_THROW(tArticle.Solve(A, b, x, 2), TsNumericalException);
+
+    /// - Solution size doesn't match the decomposition.
+    A[1] = -0.5;
+    A[2] = -0.5;
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Decompose(A, 2));
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Solve(A, b, x, 2));
+    CPPUNIT_ASSERT_THROW(tArticle.Solve(A, b, x, 1), TsNumericalException);
+
+    /// - Row subset decomposition isn't supported.
+    std::vector<int> rows;
+    rows.push_back(0);
+    rows.push_back(1);
+    CholeskyLdu* solver = &tArticle;
+    CPPUNIT_ASSERT_THROW(solver->Decompose(A, 2, rows), TsNumericalException);
+
+    /// - Rank-1 updates are not supported.
+    double z[2] = {1.0, -1.0};
+    CPPUNIT_ASSERT_THROW(solver->Update(A, z, 1.0, 2), TsNumericalException);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests decomposition from the caller's CSR arrays gives the same solution as from the
+///           SparseCsrMatrix, and shares its analysis re-use.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLduSparse::testCsrArrays()
+{
+    std::cout << "\n UtCholeskyLduSparse 08: testCsrArrays ..............................";
+
+    const int size = 6;
+    const int n    = size * size;
+    SparseCsrMatrix     matrix;
+    std::vector<double> dense;
+    loadGrid(matrix, dense, size);
+
+    std::vector<double> b(n);
+    for (int i = 0; i < n; ++i) {
+        b[i] = std::cos(0.2 * i) * 5.0;
+    }
+
+    /// - Solve from the SparseCsrMatrix for the expected solution.
+    std::vector<double> expected(n, 0.0);
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Decompose(matrix));
+    CPPUNIT_ASSERT_NO_THROW(tArticle.Solve(0, &b[0], &expected[0], n));
+
+    /// - Solve from copies of the arrays, so nothing refers back to the matrix object.
+    const std::vector<int>    rowStart(matrix.getRowStart(), matrix.getRowStart() + n + 1);
+    const std::vector<int>    columns(matrix.getColumnIndex(),
+                                      matrix.getColumnIndex() + matrix.getNnz());
+    std::vector<double>       values(matrix.getValues(), matrix.getValues() + matrix.getNnz());
+    CholeskyLduSparse   article;
+    std::vector<double> x(n, 0.0);
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(n, &rowStart[0], &columns[0], &values[0]));
+    CPPUNIT_ASSERT_NO_THROW(article.Solve(0, &b[0], &x[0], n));
+    CPPUNIT_ASSERT(1 == article.getAnalysisCount());
+    CPPUNIT_ASSERT(tArticle.getFactorNnz() == article.getFactorNnz());
+    for (int i = 0; i < n; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[i], x[i], 1.0E-13 * std::max(1.0, fabs(expected[i])));
+    }
+
+    /// - New values in the same pattern re-use the analysis.
+    for (int row = 0; row < n; ++row) {
+        values[matrix.getDiagonalSlots()[row]] += 1.0;
+    }
+    CPPUNIT_ASSERT_NO_THROW(article.Decompose(n, &rowStart[0], &columns[0], &values[0]));
+    CPPUNIT_ASSERT(1 == article.getAnalysisCount());
+
+    /// - Un-conditioned values throw, and the arrays are left unchanged.
+    values[matrix.getDiagonalSlots()[0]] = -1.0;
+    CPPUNIT_ASSERT_THROW(article.Decompose(n, &rowStart[0], &columns[0], &values[0]),
+                         TsNumericalException);
+    CPPUNIT_ASSERT(-1.0 == values[matrix.getDiagonalSlots()[0]]);
+
+    std::cout << "... Pass";
+}
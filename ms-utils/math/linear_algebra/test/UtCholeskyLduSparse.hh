@@ -0,0 +1,75 @@
+#ifndef UtCholeskyLduSparse_EXISTS
+#define UtCholeskyLduSparse_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_UTILITIES_MATH_LINEAR_ALGEBRA_CHOLESKY_LDU_SPARSE Sparse Cholesky LDU Unit Tests
+/// @ingroup  UT_UTILITIES_MATH_LINEAR_ALGEBRA
+///
+/// @details  Unit Tests for the CholeskyLduSparse class.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <iostream>
+
+#include "math/linear_algebra/CholeskyLduSparse.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Utilities unit tests.
+////
+/// @details  This class provides the unit tests for the CholeskyLduSparse class within the
+///           CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtCholeskyLduSparse : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this Utilities unit test.
+        UtCholeskyLduSparse();
+        /// @brief    Default destructs this Utilities unit test.
+        virtual ~UtCholeskyLduSparse();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests default construction.
+        void testDefaultConstruction();
+        /// @brief    Tests [A]{x} = {b} using decomposition of a dense matrix.
+        void testDenseSolution();
+        /// @brief    Tests [A]{x} = {b} using decomposition of a sparse matrix.
+        void testSparseSolution();
+        /// @brief    Tests the fill-reducing ordering.
+        void testOrdering();
+        /// @brief    Tests the analysis is only repeated when the pattern changes.
+        void testAnalysisReuse();
+        /// @brief    Tests [A] * inverse[A] = [I].
+        void testInvert();
+        /// @brief    Tests error conditions.
+        void testErrors();
+        /// @brief    Tests decomposition directly from the CSR arrays.
+        void testCsrArrays();
+    private:
+        CholeskyLduSparse tArticle;             /**< (--) Unit under test. */
+        CPPUNIT_TEST_SUITE(UtCholeskyLduSparse);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testDenseSolution);
+        CPPUNIT_TEST(testSparseSolution);
+        CPPUNIT_TEST(testOrdering);
+        CPPUNIT_TEST(testAnalysisReuse);
+        CPPUNIT_TEST(testInvert);
+        CPPUNIT_TEST(testErrors);
+        CPPUNIT_TEST(testCsrArrays);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief Loads a conductance network on a size x size grid of nodes.
+        void loadGrid(SparseCsrMatrix& matrix, std::vector<double>& dense, const int size);
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtCholeskyLduSparse(const UtCholeskyLduSparse& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtCholeskyLduSparse& operator =(const UtCholeskyLduSparse& that);
+};
+
+///@}
+
+#endif
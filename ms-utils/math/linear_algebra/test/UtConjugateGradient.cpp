@@ -0,0 +1,330 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    ((math/linear_algebra/ConjugateGradient.o)
+     (math/linear_algebra/CholeskyLdu.o))
+***************************************************************************************************/
+
+#include "UtConjugateGradient.hh"
+#include "math/linear_algebra/CholeskyLdu.hh"
+#include <cmath>
+#include <iostream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Preconditioned Conjugate Gradient Solver unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtConjugateGradient::UtConjugateGradient()
+    :
+    tArticle()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Preconditioned Conjugate Gradient Solver unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtConjugateGradient::~UtConjugateGradient()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtConjugateGradient::setUp()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtConjugateGradient::tearDown()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] A (--) The admittance matrix.
+/// @param[in]  n (--) Number of nodes.
+///
+/// @details  Builds the admittance matrix of a network of conductors: a chain through all nodes,
+///           plus pseudo-random conductors between other node pairs, and conductances to ground on
+///           every fourth node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtConjugateGradient::buildNetwork(std::vector<double>& A, const int n) const
+{
+    A.assign(n * n, 0.0);
+    unsigned int seed = 54321u;
+    for (int i = 0; i < n; ++i) {
+        for (int link = 0; link < 3; ++link) {
+            int j = i + 1;
+            if (link > 0) {
+                seed = seed * 1103515245u + 12345u;
+                j = static_cast<int>((seed >> 8) % static_cast<unsigned int>(n));
+            }
+            if (j < n and j != i) {
+                seed = seed * 1103515245u + 12345u;
+                const double g = 0.1 + 10.0 * ((seed >> 8) % 1000u) / 1000.0;
+                A[i*n + j] -= g;
+                A[j*n + i] -= g;
+                A[i*n + i] += g;
+                A[j*n + j] += g;
+            }
+        }
+        if (0 == i % 4) {
+            A[i*n + i] += 1.0 + i;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] x (--) The solution.
+/// @param[in]  A (--) The matrix.
+/// @param[in]  b (--) The right-hand side vector.
+///
+/// @details  Solves [A]{x} = {b} with the dense Cholesky LDU solver, for comparison.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtConjugateGradient::solveDirect(std::vector<double>& x, const std::vector<double>& A,
+                                      const std::vector<double>& b) const
+{
+    const int n = static_cast<int>(b.size());
+    std::vector<double> ldu(A);
+    std::vector<double> rhs(b);
+    x.assign(n, 0.0);
+    CholeskyLdu cholesky;
+    cholesky.Decompose(&ldu[0], n);
+    cholesky.Solve(&ldu[0], &rhs[0], &x[0], n);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests default construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtConjugateGradient::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtConjugateGradient 01: testDefaultConstruction ....................";
+
+    CPPUNIT_ASSERT(ConjugateGradient::JACOBI == tArticle.mPreconditioner);
+    CPPUNIT_ASSERT(ConjugateGradient::JACOBI == tArticle.mApplied);
+    CPPUNIT_ASSERT(0   == tArticle.mSize);
+    CPPUNIT_ASSERT(tArticle.mRowStart.empty());
+    CPPUNIT_ASSERT(tArticle.mValues.empty());
+    CPPUNIT_ASSERT(tArticle.mLowerValues.empty());
+    CPPUNIT_ASSERT(0.0 == tArticle.mResidual);
+    CPPUNIT_ASSERT(ConjugateGradient::JACOBI == tArticle.getPreconditioner());
+    CPPUNIT_ASSERT(ConjugateGradient::JACOBI == tArticle.getAppliedPreconditioner());
+    CPPUNIT_ASSERT(0   == tArticle.getSize());
+    CPPUNIT_ASSERT(0.0 == tArticle.getResidual());
+
+    /// - Solving with no matrix does nothing.
+    CPPUNIT_ASSERT(0 == tArticle.solve(0, 0, 10, 1.0E-12));
+
+    /// - Test new/delete for code coverage.
+    ConjugateGradient* article = new ConjugateGradient();
+    delete article;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests loading the matrix from dense & sparse storage, and building the
+///           preconditioners.  For a tri-diagonal matrix the incomplete Cholesky factor has no
+///           dropped fill, so it equals the complete Cholesky factor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtConjugateGradient::testSetMatrix()
+{
+    std::cout << "\n UtConjugateGradient 02: testSetMatrix ..............................";
+
+    const double A[9] = { 4.0, -1.0,  0.0,
+                         -1.0,  4.0, -1.0,
+                          0.0, -1.0,  4.0};
+    tArticle.setMatrix(A, 3);
+    CPPUNIT_ASSERT(3 == tArticle.getSize());
+    const int expectedRowStart[4] = {0, 2, 5, 7};
+    const int expectedColumns[7]  = {0, 1, 0, 1, 2, 1, 2};
+    const double expectedValues[7] = {4.0, -1.0, -1.0, 4.0, -1.0, -1.0, 4.0};
+    for (int i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT(expectedRowStart[i] == tArticle.mRowStart[i]);
+    }
+    for (int i = 0; i < 7; ++i) {
+        CPPUNIT_ASSERT(expectedColumns[i] == tArticle.mColumns[i]);
+        CPPUNIT_ASSERT(expectedValues[i]  == tArticle.mValues[i]);
+    }
+    CPPUNIT_ASSERT(0.25 == tArticle.mInverseDiagonal[1]);
+    CPPUNIT_ASSERT(ConjugateGradient::JACOBI == tArticle.getAppliedPreconditioner());
+    CPPUNIT_ASSERT(tArticle.mLowerValues.empty());
+
+    /// - Selecting incomplete Cholesky builds the factor for the current matrix.
+    tArticle.setPreconditioner(ConjugateGradient::INCOMPLETE_CHOLESKY);
+    CPPUNIT_ASSERT(ConjugateGradient::INCOMPLETE_CHOLESKY == tArticle.getPreconditioner());
+    CPPUNIT_ASSERT(ConjugateGradient::INCOMPLETE_CHOLESKY == tArticle.getAppliedPreconditioner());
+    const int expectedLowerStart[4]   = {0, 1, 3, 5};
+    const int expectedLowerColumns[5] = {0, 0, 1, 1, 2};
+    const double l11 = std::sqrt(3.75);
+    const double expectedLower[5] = {2.0, -0.5, l11, -1.0 / l11, std::sqrt(4.0 - 1.0 / 3.75)};
+    for (int i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT(expectedLowerStart[i] == tArticle.mLowerStart[i]);
+    }
+    for (int i = 0; i < 5; ++i) {
+        CPPUNIT_ASSERT(expectedLowerColumns[i] == tArticle.mLowerColumns[i]);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedLower[i], tArticle.mLowerValues[i], 1.0E-15);
+    }
+
+    /// - Loading the same matrix from sparse storage gives the same result, including the stored
+    ///   zero in the sparse pattern.
+    std::vector<int> positions;
+    positions.push_back(1);
+    positions.push_back(5);
+    positions.push_back(2);
+    SparseCsrMatrix sparse;
+    sparse.buildPattern(3, positions);
+    sparse.fromDense(A);
+    tArticle.setMatrix(sparse);
+    CPPUNIT_ASSERT(3 == tArticle.getSize());
+    CPPUNIT_ASSERT(9 == tArticle.mValues.size());
+    CPPUNIT_ASSERT(ConjugateGradient::INCOMPLETE_CHOLESKY == tArticle.getAppliedPreconditioner());
+    CPPUNIT_ASSERT(6 == tArticle.mLowerValues.size());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedLower[4], tArticle.mLowerValues[5], 1.0E-15);
+
+    /// - An empty sparse matrix.
+    SparseCsrMatrix empty;
+    tArticle.setMatrix(empty);
+    CPPUNIT_ASSERT(0 == tArticle.getSize());
+    CPPUNIT_ASSERT(1 == tArticle.mRowStart.size());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests solutions with both preconditioners against the direct solver, for several
+///           network sizes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtConjugateGradient::testSolve()
+{
+    std::cout << "\n UtConjugateGradient 03: testSolve ..................................";
+
+    const int sizes[4] = {1, 5, 40, 200};
+    for (int s = 0; s < 4; ++s) {
+        const int n = sizes[s];
+        std::vector<double> A;
+        buildNetwork(A, n);
+        std::vector<double> b(n);
+        for (int i = 0; i < n; ++i) {
+            b[i] = std::sin(1.0 + i);
+        }
+        std::vector<double> expected;
+        solveDirect(expected, A, b);
+
+        int iterations[2] = {0, 0};
+        for (int p = 0; p < 2; ++p) {
+            tArticle.setPreconditioner(static_cast<ConjugateGradient::Preconditioner>(p));
+            tArticle.setMatrix(&A[0], n);
+            CPPUNIT_ASSERT(p == tArticle.getAppliedPreconditioner());
+            std::vector<double> x(n, 0.0);
+            iterations[p] = tArticle.solve(&x[0], &b[0], 1000, 1.0E-13);
+            CPPUNIT_ASSERT(0 < iterations[p]);
+            CPPUNIT_ASSERT(1.0E-13 >= tArticle.getResidual());
+            for (int i = 0; i < n; ++i) {
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[i], x[i],
+                                             1.0E-9 * std::max(1.0, std::fabs(expected[i])));
+            }
+        }
+
+        /// - Incomplete Cholesky takes fewer iterations than Jacobi on the larger networks.
+        if (n >= 40) {
+            CPPUNIT_ASSERT(iterations[1] < iterations[0]);
+        }
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that a converged initial estimate takes no iterations, that a nearby estimate
+///           takes fewer iterations than a cold start, and the solution of a zero vector.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtConjugateGradient::testWarmStart()
+{
+    std::cout << "\n UtConjugateGradient 04: testWarmStart ..............................";
+
+    const int n = 100;
+    std::vector<double> A;
+    buildNetwork(A, n);
+    std::vector<double> b(n);
+    for (int i = 0; i < n; ++i) {
+        b[i] = std::cos(0.5 * i);
+    }
+    tArticle.setPreconditioner(ConjugateGradient::INCOMPLETE_CHOLESKY);
+    tArticle.setMatrix(&A[0], n);
+
+    /// - Cold start, then re-solve from the solution.
+    std::vector<double> x(n, 0.0);
+    const int cold = tArticle.solve(&x[0], &b[0], 1000, 1.0E-12);
+    CPPUNIT_ASSERT(0 < cold);
+    std::vector<double> saved(x);
+    CPPUNIT_ASSERT(0 == tArticle.solve(&x[0], &b[0], 1000, 1.0E-12));
+    for (int i = 0; i < n; ++i) {
+        CPPUNIT_ASSERT(saved[i] == x[i]);
+    }
+
+    /// - A small change to {b} from the last solution converges faster than from zero.
+    b[n/2] += 0.01;
+    const int warm = tArticle.solve(&x[0], &b[0], 1000, 1.0E-12);
+    CPPUNIT_ASSERT(0 < warm and warm < cold);
+
+    /// - A zero {b} gives a zero solution with no iterations.
+    std::vector<double> zero(n, 0.0);
+    CPPUNIT_ASSERT(0 == tArticle.solve(&x[0], &zero[0], 1000, 1.0E-12));
+    for (int i = 0; i < n; ++i) {
+        CPPUNIT_ASSERT(0.0 == x[i]);
+    }
+    CPPUNIT_ASSERT(0.0 == tArticle.getResidual());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests failures to converge from the iteration limit and from matrices that aren't
+///           positive definite, and the fall-back to Jacobi when incomplete Cholesky breaks down.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtConjugateGradient::testFailures()
+{
+    std::cout << "\n UtConjugateGradient 05: testFailures ...............................";
+
+    /// - Iteration limit.
+    const int n = 40;
+    std::vector<double> A;
+    buildNetwork(A, n);
+    std::vector<double> b(n, 1.0);
+    std::vector<double> x(n, 0.0);
+    tArticle.setMatrix(&A[0], n);
+    CPPUNIT_ASSERT(-1 == tArticle.solve(&x[0], &b[0], 1, 1.0E-12));
+    CPPUNIT_ASSERT(1.0E-12 < tArticle.getResidual());
+
+    /// - An indefinite matrix breaks down the incomplete Cholesky factorization, falls back to
+    ///   Jacobi, and loses positive curvature in the iterations.
+    const double indefinite[4] = {1.0, 2.0,
+                                  2.0, 1.0};
+    tArticle.setPreconditioner(ConjugateGradient::INCOMPLETE_CHOLESKY);
+    tArticle.setMatrix(indefinite, 2);
+    CPPUNIT_ASSERT(ConjugateGradient::INCOMPLETE_CHOLESKY == tArticle.getPreconditioner());
+    CPPUNIT_ASSERT(ConjugateGradient::JACOBI              == tArticle.getAppliedPreconditioner());
+    CPPUNIT_ASSERT(tArticle.mLowerValues.empty());
+    double x2[2] = {0.0, 0.0};
+    const double b2[2] = {1.0, 0.0};
+    CPPUNIT_ASSERT(-1 == tArticle.solve(x2, b2, 10, 1.0E-12));
+
+    /// - A negative diagonal gets a unit Jacobi factor, and fails.
+    const double negative[1] = {-1.0};
+    tArticle.setPreconditioner(ConjugateGradient::JACOBI);
+    tArticle.setMatrix(negative, 1);
+    CPPUNIT_ASSERT(1.0 == tArticle.mInverseDiagonal[0]);
+    double x1[1] = {0.0};
+    const double b1[1] = {1.0};
+    CPPUNIT_ASSERT(-1 == tArticle.solve(x1, b1, 10, 1.0E-12));
+
+    std::cout << "... Pass";
+}
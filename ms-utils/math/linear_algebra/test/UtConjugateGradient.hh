@@ -0,0 +1,89 @@
+#ifndef UtConjugateGradient_EXISTS
+#define UtConjugateGradient_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_UTILITIES_MATH_LINEAR_ALGEBRA_CONJUGATE_GRADIENT Conjugate Gradient Unit Tests
+/// @ingroup  UT_UTILITIES_MATH_LINEAR_ALGEBRA
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the ConjugateGradient class.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <vector>
+
+#include "math/linear_algebra/ConjugateGradient.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from ConjugateGradient and befriend UtConjugateGradient.
+///
+/// @details  Class derived from the unit under test.  It just has a default constructor and
+///           destructor, but it befriends the unit test case driver class to allow it access to
+///           protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyConjugateGradient : public ConjugateGradient
+{
+    public:
+        FriendlyConjugateGradient() : ConjugateGradient() {;}
+        virtual ~FriendlyConjugateGradient() {;}
+        friend class UtConjugateGradient;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Preconditioned Conjugate Gradient Solver unit tests.
+///
+/// @details  This class provides the unit tests for the ConjugateGradient class within the CPPUnit
+///           framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtConjugateGradient : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this unit test.
+        UtConjugateGradient();
+        /// @brief    Default destructs this unit test.
+        virtual ~UtConjugateGradient();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests default construction.
+        void testDefaultConstruction();
+        /// @brief    Tests loading the matrix and building the preconditioners.
+        void testSetMatrix();
+        /// @brief    Tests solutions against the direct solver.
+        void testSolve();
+        /// @brief    Tests warm starts and the special cases.
+        void testWarmStart();
+        /// @brief    Tests failures to converge.
+        void testFailures();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtConjugateGradient);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testSetMatrix);
+        CPPUNIT_TEST(testSolve);
+        CPPUNIT_TEST(testWarmStart);
+        CPPUNIT_TEST(testFailures);
+        CPPUNIT_TEST_SUITE_END();
+
+        FriendlyConjugateGradient tArticle; /**< (--) Test article. */
+
+        /// @brief Builds the admittance matrix of a test network of conductors.
+        void buildNetwork(std::vector<double>& A, const int n) const;
+        /// @brief Solves the given system with the direct solver.
+        void solveDirect(std::vector<double>& x, const std::vector<double>& A,
+                         const std::vector<double>& b) const;
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtConjugateGradient(const UtConjugateGradient& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtConjugateGradient& operator =(const UtConjugateGradient& that);
+};
+
+///@}
+
+#endif
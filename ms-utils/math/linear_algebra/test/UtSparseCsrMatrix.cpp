@@ -0,0 +1,218 @@
+/************************** TRICK HEADER ***********************************************************
+ LIBRARY DEPENDENCY:
+    ((math/linear_algebra/SparseCsrMatrix.o))
+***************************************************************************************************/
+
+#include "UtSparseCsrMatrix.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Sparse CSR Matrix unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtSparseCsrMatrix::UtSparseCsrMatrix()
+    :
+    tArticle()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Sparse CSR Matrix unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtSparseCsrMatrix::~UtSparseCsrMatrix()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtSparseCsrMatrix::setUp()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test as part of the CPPUNIT framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtSparseCsrMatrix::tearDown()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Loads the test article with the pattern of this 4x4 matrix, given as a conductor
+///           between nodes 0-1, a conductor between nodes 1-3 given only by its upper position, a
+///           duplicate of the 0-1 position, and some out-of-bounds positions to be ignored:
+///               [x x . .]
+///               [x x . x]
+///               [. . x .]
+///               [. x . x]
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtSparseCsrMatrix::loadPattern()
+{
+    std::vector<int> positions;
+    positions.push_back(0);     // (0,0)
+    positions.push_back(1);     // (0,1)
+    positions.push_back(4);     // (1,0)
+    positions.push_back(5);     // (1,1)
+    positions.push_back(7);     // (1,3)
+    positions.push_back(1);     // (0,1) duplicate
+    positions.push_back(-1);    // ignored
+    positions.push_back(16);    // ignored
+    tArticle.buildPattern(4, positions);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests default construction of an empty matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtSparseCsrMatrix::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtSparseCsrMatrix . 01: testDefaultConstruction ....................";
+
+    CPPUNIT_ASSERT(0 == tArticle.getSize());
+    CPPUNIT_ASSERT(0 == tArticle.getNnz());
+    CPPUNIT_ASSERT(0 == tArticle.getRowStart());
+    CPPUNIT_ASSERT(0 == tArticle.getColumnIndex());
+    CPPUNIT_ASSERT(0 == tArticle.getDiagonalSlots());
+    CPPUNIT_ASSERT(0 == tArticle.getValues());
+    CPPUNIT_ASSERT(-1 == tArticle.findSlot(0, 0));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that the symbolic pattern is symmetric, includes the full diagonal, ignores
+///           duplicates and invalid positions, and is sorted by row then column.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtSparseCsrMatrix::testBuildPattern()
+{
+    std::cout << "\n UtSparseCsrMatrix . 02: testBuildPattern ...........................";
+
+    loadPattern();
+
+    CPPUNIT_ASSERT(4 == tArticle.getSize());
+    CPPUNIT_ASSERT(8 == tArticle.getNnz());
+
+    const int expectedRowStart[5]    = {0, 2, 5, 6, 8};
+    const int expectedColumnIndex[8] = {0, 1, 0, 1, 3, 2, 1, 3};
+    const int expectedDiagonal[4]    = {0, 3, 5, 7};
+    for (int i = 0; i < 5; ++i) {
+        CPPUNIT_ASSERT(expectedRowStart[i] == tArticle.getRowStart()[i]);
+    }
+    for (int i = 0; i < 8; ++i) {
+        CPPUNIT_ASSERT(expectedColumnIndex[i] == tArticle.getColumnIndex()[i]);
+        CPPUNIT_ASSERT(0.0 == tArticle.getValues()[i]);
+    }
+    for (int i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT(expectedDiagonal[i] == tArticle.getDiagonalSlots()[i]);
+    }
+
+    /// - Test re-building with a new pattern of only the diagonal.
+    std::vector<int> positions;
+    tArticle.buildPattern(3, positions);
+    CPPUNIT_ASSERT(3 == tArticle.getSize());
+    CPPUNIT_ASSERT(3 == tArticle.getNnz());
+    CPPUNIT_ASSERT(2 == tArticle.getDiagonalSlots()[2]);
+
+    /// - Test building with an invalid size gives an empty matrix.
+    tArticle.buildPattern(0, positions);
+    CPPUNIT_ASSERT(0 == tArticle.getSize());
+    CPPUNIT_ASSERT(0 == tArticle.getNnz());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the slot lookup for positions in and out of the pattern.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtSparseCsrMatrix::testFindSlot()
+{
+    std::cout << "\n UtSparseCsrMatrix . 03: testFindSlot ...............................";
+
+    loadPattern();
+
+    CPPUNIT_ASSERT( 0 == tArticle.findSlot(0, 0));
+    CPPUNIT_ASSERT( 1 == tArticle.findSlot(0, 1));
+    CPPUNIT_ASSERT( 4 == tArticle.findSlot(1, 3));
+    CPPUNIT_ASSERT( 6 == tArticle.findSlot(3, 1));
+    CPPUNIT_ASSERT( 7 == tArticle.findSlot(3, 3));
+    CPPUNIT_ASSERT(-1 == tArticle.findSlot(0, 2));
+    CPPUNIT_ASSERT(-1 == tArticle.findSlot(2, 3));
+    CPPUNIT_ASSERT(-1 == tArticle.findSlot(-1, 0));
+    CPPUNIT_ASSERT(-1 == tArticle.findSlot(0, 4));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests conversion of values to and from a dense matrix, and zeroing the values.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtSparseCsrMatrix::testDenseConversion()
+{
+    std::cout << "\n UtSparseCsrMatrix . 04: testDenseConversion ........................";
+
+    loadPattern();
+
+    /// - Load values from a dense matrix, including a value outside the pattern that is ignored.
+    const double A[16] = { 2.0, -1.0,  9.0,  0.0,
+                          -1.0,  4.0,  0.0, -3.0,
+                           0.0,  0.0,  5.0,  0.0,
+                           0.0, -3.0,  0.0,  6.0};
+    tArticle.fromDense(A);
+    const double expectedValues[8] = {2.0, -1.0, -1.0, 4.0, -3.0, 5.0, -3.0, 6.0};
+    for (int i = 0; i < 8; ++i) {
+        CPPUNIT_ASSERT(expectedValues[i] == tArticle.getValues()[i]);
+    }
+
+    /// - Expand back to a dense matrix over garbage values.
+    double B[16];
+    for (int i = 0; i < 16; ++i) {
+        B[i] = 99.0;
+    }
+    tArticle.toDense(B);
+    for (int i = 0; i < 16; ++i) {
+        if (2 == i) {
+            CPPUNIT_ASSERT(0.0 == B[i]);
+        } else {
+            CPPUNIT_ASSERT(A[i] == B[i]);
+        }
+    }
+
+    /// - Test zeroing the values.
+    tArticle.zero();
+    for (int i = 0; i < 8; ++i) {
+        CPPUNIT_ASSERT(0.0 == tArticle.getValues()[i]);
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the matrix-vector multiply against the dense product.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtSparseCsrMatrix::testMultiply()
+{
+    std::cout << "\n UtSparseCsrMatrix . 05: testMultiply ...............................";
+
+    loadPattern();
+
+    const double A[16] = { 2.0, -1.0,  0.0,  0.0,
+                          -1.0,  4.0,  0.0, -3.0,
+                           0.0,  0.0,  5.0,  0.0,
+                           0.0, -3.0,  0.0,  6.0};
+    tArticle.fromDense(A);
+
+    const double x[4] = {1.0, 2.0, 3.0, 4.0};
+    double       y[4] = {0.0, 0.0, 0.0, 0.0};
+    tArticle.multiply(y, x);
+    for (int row = 0; row < 4; ++row) {
+        double expected = 0.0;
+        for (int col = 0; col < 4; ++col) {
+            expected += A[row*4 + col] * x[col];
+        }
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, y[row], 0.0);
+    }
+
+    std::cout << "... Pass";
+}
@@ -0,0 +1,66 @@
+#ifndef UtSparseCsrMatrix_EXISTS
+#define UtSparseCsrMatrix_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_UTILITIES_MATH_LINEAR_ALGEBRA_SPARSE_CSR_MATRIX Sparse CSR Matrix Unit Tests
+/// @ingroup  UT_UTILITIES_MATH_LINEAR_ALGEBRA
+///
+/// @details  Unit Tests for the SparseCsrMatrix class.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <iostream>
+
+#include "math/linear_algebra/SparseCsrMatrix.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Utilities unit tests.
+////
+/// @details  This class provides the unit tests for the SparseCsrMatrix class within the
+///           CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtSparseCsrMatrix : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this Utilities unit test.
+        UtSparseCsrMatrix();
+        /// @brief    Default destructs this Utilities unit test.
+        virtual ~UtSparseCsrMatrix();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests default construction.
+        void testDefaultConstruction();
+        /// @brief    Tests building the symbolic pattern.
+        void testBuildPattern();
+        /// @brief    Tests the slot lookup.
+        void testFindSlot();
+        /// @brief    Tests conversion to and from dense storage.
+        void testDenseConversion();
+        /// @brief    Tests the matrix-vector multiply.
+        void testMultiply();
+    private:
+        SparseCsrMatrix tArticle;                /**< (--) Unit under test. */
+        CPPUNIT_TEST_SUITE(UtSparseCsrMatrix);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testBuildPattern);
+        CPPUNIT_TEST(testFindSlot);
+        CPPUNIT_TEST(testDenseConversion);
+        CPPUNIT_TEST(testMultiply);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief Loads the test article with the pattern of a 4x4 test matrix.
+        void loadPattern();
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtSparseCsrMatrix(const UtSparseCsrMatrix& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtSparseCsrMatrix& operator =(const UtSparseCsrMatrix& that);
+};
+
+///@}
+
+#endif
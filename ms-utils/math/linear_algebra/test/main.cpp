@@ -14,7 +14,11 @@ LIBRARY DEPENDENCY:
 #include <cppunit/ui/text/TestRunner.h>
 
 #include "UtCholeskyLdu.hh"
+#include "UtCholeskyLduSimd.hh"
+#include "UtCholeskyLduSparse.hh"
+#include "UtConjugateGradient.hh"
 #include "UtSor.hh"
+#include "UtSparseCsrMatrix.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param    argc  int     --  not used
@@ -43,7 +47,11 @@ int main(int argc, char** argv) {
     CppUnit::TextTestRunner runner;
 
     runner.addTest( UtCholeskyLdu::suite() );
+    runner.addTest( UtCholeskyLduSimd::suite() );
+    runner.addTest( UtCholeskyLduSparse::suite() );
+    runner.addTest( UtConjugateGradient::suite() );
     runner.addTest( UtSor::suite() );
+    runner.addTest( UtSparseCsrMatrix::suite() );
 
     runner.run(testresult);
     // Output results in compiler format
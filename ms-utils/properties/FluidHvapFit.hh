@@ -58,6 +58,8 @@ class FluidHvapFit : public TsApproximation {
         double mBeta;  /**< (--) trick_chkpnt_io(**) Third coefficient for curve fit model. */
         /// @brief Returns the model fit for the specified variables.
         virtual double evaluate(const double x, const double y = 0.0);
+        /// @brief Returns the model fit at each of an array of points.
+        virtual void evaluateBatch(const double* x, const double* y, double* out, const int n);
     private:
         /// @brief Copy constructor unavailable since declared private and not implemented.
         FluidHvapFit(const FluidHvapFit&);
@@ -80,4 +82,20 @@ inline double FluidHvapFit::evaluate(const double x, const double y __attribute_
     return mA * exp(-mAlpha * x) * pow((1.0 - x), mBeta);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x    (--)  Array of first independent variables for curve fit.
+/// @param[in]    y    (--)  Array of second independent variables for curve fit.
+/// @param[out]   out  (--)  Array of fitted variables at the specified inputs.
+/// @param[in]    n    (--)  Number of points.
+///
+/// @details  Returns this heat of vaporization model fit at each point, with the inline model so
+///           the loop can be vectorized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void FluidHvapFit::evaluateBatch(const double* x, const double* y, double* out, const int n)
+{
+    for (int i = 0; i < n; ++i) {
+        out[i] = FluidHvapFit::evaluate(x[i], y[i]);
+    }
+}
+
 #endif
@@ -30,6 +30,7 @@
       (math/approximation/QuadraticRootFit.o)
       (math/approximation/QuotientFit.o)
       (math/approximation/TsBilinearInterpolatorReverse.o)
+      (math/approximation/TsTabulatedFit.o)
       (properties/FluidTsatFit.o)
       (properties/FluidHvapFit.o)
       (properties/FluidPropertiesDataWaterPvt.o)
@@ -41,6 +42,7 @@
 */
 
 #include "FluidProperties.hh"
+#include <sstream>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] type                  Type of fluid (from FluidType enum)
@@ -1240,6 +1242,13 @@ DefinedFluidProperties::DefinedFluidProperties()
     mProperties[FluidProperties::GUNNS_NTO]         = &mPropertiesNTO;
     mProperties[FluidProperties::GUNNS_MMH]         = &mPropertiesMMH;
     mProperties[FluidProperties::GUNNS_HYDRAZINE]   = &mPropertiesHYDRAZINE;
+
+    /// - No approximations are tabulated until enableTabulation is called.
+    for (int i = 0; i < FluidProperties::NO_FLUID; ++i) {
+        for (int k = 0; k < NUM_TABULATED; ++k) {
+            mAnalytic[i][k] = 0;
+        }
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1249,3 +1258,134 @@ DefinedFluidProperties::~DefinedFluidProperties()
 {
     // nothing to do
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  tolerance  (--) Relative error tolerance of the tables against the analytic fits.
+/// @param[in]  maxPoints  (--) Maximum number of table points in each variable.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Builds a table of each costly density, viscosity, thermal conductivity, Prandtl number
+///           and pressure approximation over its valid range, and points the fluid properties at
+///           the tables that meet the tolerance.  A variable whose range is positive and spans at
+///           least two decades is spaced logarithmically.  This must be called before any network
+///           initializes with these properties, since the networks keep pointers to the
+///           approximations.  Calling it again rebuilds the tables from the analytic fits.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void DefinedFluidProperties::enableTabulation(const double tolerance, const int maxPoints)
+{
+    disableTabulation();
+
+    for (int i = 0; i < FluidProperties::NO_FLUID; ++i) {
+        for (int k = 0; k < NUM_TABULATED; ++k) {
+            TsApproximation*& fit = approximation(mProperties[i], static_cast<TabulatedProperty>(k));
+            if (isCostly(fit)) {
+                const TsTabulatedFit::Spacing spacingX =
+                        (fit->getMinX() > 0.0 and fit->getMaxX() >= 100.0 * fit->getMinX())
+                        ? TsTabulatedFit::LOGARITHMIC : TsTabulatedFit::UNIFORM;
+                const TsTabulatedFit::Spacing spacingY =
+                        (fit->getMinY() > 0.0 and fit->getMaxY() >= 100.0 * fit->getMinY())
+                        ? TsTabulatedFit::LOGARITHMIC : TsTabulatedFit::UNIFORM;
+                mTables[i][k].init(*fit, tolerance, maxPoints, spacingX, spacingY,
+                                   "DefinedFluidProperties table");
+                if (mTables[i][k].isWithinTolerance()) {
+                    mAnalytic[i][k] = fit;
+                    fit             = &mTables[i][k];
+                }
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Points the fluid properties back at the analytic approximations.  The tables are kept
+///           for the report.  Like enableTabulation, this must not be called after any network has
+///           initialized with these properties.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void DefinedFluidProperties::disableTabulation()
+{
+    for (int i = 0; i < FluidProperties::NO_FLUID; ++i) {
+        for (int k = 0; k < NUM_TABULATED; ++k) {
+            if (mAnalytic[i][k]) {
+                approximation(mProperties[i], static_cast<TabulatedProperty>(k)) = mAnalytic[i][k];
+                mAnalytic[i][k] = 0;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  type      (--) Type of fluid.
+/// @param[in]  property  (--) Tabulated property.
+///
+/// @return   bool (--) True if the property of the fluid is currently evaluated from a table.
+///
+/// @details  Returns whether the analytic approximation of the property has been replaced.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool DefinedFluidProperties::isTabulated(const FluidProperties::FluidType& type,
+                                         const TabulatedProperty property) const
+{
+    return 0 <= type and type < FluidProperties::NO_FLUID and 0 <= property
+       and property < NUM_TABULATED and 0 != mAnalytic[type][property];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   std::string (--) One line per table with its size, error and whether it is used.
+///
+/// @details  Lists each table built by the last enableTabulation by fluid type number and property,
+///           with its number of points in each variable and its largest relative error against
+///           the analytic approximation.  Tables that didn't meet the tolerance are listed as
+///           analytic, since their approximation wasn't replaced.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string DefinedFluidProperties::getTabulationReport() const
+{
+    static const char* const names[NUM_TABULATED] = {
+        "density", "viscosity", "thermal conductivity", "Prandtl number", "pressure"};
+
+    std::ostringstream report;
+    for (int i = 0; i < FluidProperties::NO_FLUID; ++i) {
+        for (int k = 0; k < NUM_TABULATED; ++k) {
+            const TsTabulatedFit& table = mTables[i][k];
+            if (table.isInitialized()) {
+                report << "fluid " << i << " " << names[k] << ": " << table.getSizeX() << " x "
+                       << table.getSizeY() << " points, max error " << table.getMaxError()
+                       << (mAnalytic[i][k] ? ", tabulated" : ", analytic") << "\n";
+            }
+        }
+    }
+    return report.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  fluid     (--) Fluid properties.
+/// @param[in]  property  (--) Tabulated property.
+///
+/// @return   TsApproximation*& (--) Reference to the fluid's approximation pointer for the property.
+///
+/// @details  Maps the tabulated property enumeration to the fluid properties' members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsApproximation*& DefinedFluidProperties::approximation(FluidProperties* fluid,
+                                                        const TabulatedProperty property)
+{
+    switch (property) {
+        case VISCOSITY:            return fluid->mViscosity;
+        case THERMAL_CONDUCTIVITY: return fluid->mThermalConductivity;
+        case PRANDTL_NUMBER:       return fluid->mPrandtlNumber;
+        case PRESSURE:             return fluid->mPressure;
+        default:                   return fluid->mDensity;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  fit  (--) Approximation to check.
+///
+/// @return   bool (--) True if the approximation costs more to evaluate than a table.
+///
+/// @details  The bilinear interpolators search their breakpoints and the power fits call pow, so a
+///           table is cheaper.  The other fits used here are short polynomials or a single quotient
+///           or product, and are cheaper than a table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool DefinedFluidProperties::isCostly(TsApproximation* fit)
+{
+    return 0 != dynamic_cast<TsBilinearInterpolator*>(fit) or 0 != dynamic_cast<PowerFit*>(fit);
+}
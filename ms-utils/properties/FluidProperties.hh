@@ -48,6 +48,7 @@ ASSUMPTIONS AND LIMITATIONS:
 #include "math/approximation/QuadraticRootFit.hh"
 #include "math/approximation/QuotientFit.hh"
 #include "math/approximation/TsBilinearInterpolatorReverse.hh"
+#include "math/approximation/TsTabulatedFit.hh"
 #include "properties/FluidTsatFit.hh"
 #include "properties/FluidHvapFit.hh"
 #include "FluidPropertiesDataWaterPvt.hh"
@@ -67,6 +68,7 @@ class FluidProperties {
     TS_MAKE_SIM_COMPATIBLE(FluidProperties);
     public:
         friend class DefinedFluidProperties;
+        friend class PolyFluidPropertyEngine;
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief    Enumeration of the types of Fluids.
         ///
@@ -211,16 +213,44 @@ class FluidProperties {
 /// @brief    Class for the Defined Fluid Properties.
 ///
 /// @details  Provides the Fluid Properties for a set of liquids and gases.
+///
+///           Tabulation is an opt-in mode, for use before any network initializes with these
+///           properties, that replaces the real-gas and liquid table lookups and the power
+///           fits of the density, viscosity, thermal conductivity, Prandtl number and pressure with
+///           regular-grid tables (TsTabulatedFit).  These are sampled from the analytic
+///           approximations over their valid ranges, and evaluate by index arithmetic instead of a
+///           table search or a call to pow.  The polynomial, quotient & product fits cost less than
+///           a table and are left analytic.  A table is only used if it meets the error tolerance
+///           against its analytic approximation, and getTabulationReport lists the size & error of
+///           each table.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class DefinedFluidProperties {
     TS_MAKE_SIM_COMPATIBLE(DefinedFluidProperties);
     public:
+        /// @brief Enumeration of the fluid properties that can be tabulated.
+        enum TabulatedProperty {
+            DENSITY              = 0, ///< Density as a function of temperature & pressure.
+            VISCOSITY            = 1, ///< Dynamic viscosity as a function of temperature.
+            THERMAL_CONDUCTIVITY = 2, ///< Thermal conductivity as a function of temperature.
+            PRANDTL_NUMBER       = 3, ///< Prandtl number as a function of temperature.
+            PRESSURE             = 4, ///< Pressure as a function of temperature & density.
+            NUM_TABULATED        = 5  ///< Number of tabulated properties - Keep this last!
+        };
         /// @brief Default constructs a Fluid Properties.
         DefinedFluidProperties();
         /// @brief Default destructs a Fluid Properties.
         virtual ~DefinedFluidProperties();
         /// @brief returns a pointer to the properties of the specified fluid type.
         FluidProperties* getProperties(const FluidProperties::FluidType& type) const;
+        /// @brief Replaces the costlier approximations with tables that meet the given tolerance.
+        void             enableTabulation(const double tolerance = 1.0e-3, const int maxPoints = 257);
+        /// @brief Restores the analytic approximations replaced by tables.
+        void             disableTabulation();
+        /// @brief Returns whether the specified property of the specified fluid is tabulated.
+        bool             isTabulated(const FluidProperties::FluidType& type,
+                                     const TabulatedProperty property) const;
+        /// @brief Returns the size & error of each table built by the last enableTabulation.
+        std::string      getTabulationReport() const;
     protected:
         const double      mGasK;                           /**< (J/mol/K) Universal gas constant */
         QuotientFit       mDensityCO;                      /**< (--) CO density curve fit */
@@ -544,6 +574,8 @@ class DefinedFluidProperties {
         FluidProperties   mPropertiesMMH;                  /**< (--) MMH fluid properties (liquid) */
         FluidProperties   mPropertiesHYDRAZINE;            /**< (--) HYDRAZINE fluid properties (liquid) */
         FluidProperties*  mProperties[FluidProperties::NO_FLUID]; /**< (--) Array of pointers to the defined Fluid Properties */
+        TsTabulatedFit    mTables[FluidProperties::NO_FLUID][NUM_TABULATED];   /**< (--) trick_chkpnt_io(**) Tables of the costlier approximations */
+        TsApproximation*  mAnalytic[FluidProperties::NO_FLUID][NUM_TABULATED]; /**< (--) trick_chkpnt_io(**) Analytic approximations replaced by tables, or null */
         static const double mHeTemperatureScale[12]; /**< (K)     Helium real-gas density table temperature scale */
         static const double mHePressureScale[12];    /**< (kPa)   Helium real-gas density table pressure scale */
         static const double mHeDensityTable[144];    /**< (kg/m3) Helium real-gas density table */
@@ -627,6 +659,11 @@ class DefinedFluidProperties {
         /// @details  Assignment operator unavailable since declared private and not implemented.
         ////////////////////////////////////////////////////////////////////////////////////////////
         DefinedFluidProperties& operator =(const DefinedFluidProperties&);
+        /// @brief Returns the fluid's approximation pointer for the specified property.
+        static TsApproximation*& approximation(FluidProperties* fluid,
+                                               const TabulatedProperty property);
+        /// @brief Returns whether an approximation costs more to evaluate than a table.
+        static bool isCostly(TsApproximation* fit);
 };
 
 /// @}
@@ -73,6 +73,8 @@ class FluidTsatFit : public TsApproximation {
         double mA;     /**< (--) trick_chkpnt_io(**) Quadratic equation term (a).   */
         /// @brief Returns the model fit for the specified variables.
         virtual double evaluate(const double x, const double y = 0.0) ;
+        /// @brief Returns the model fit at each of an array of points.
+        virtual void evaluateBatch(const double* x, const double* y, double* out, const int n);
     private:
         /// @brief Copy constructor unavailable since declared private and not implemented.
         FluidTsatFit(const FluidTsatFit&);
@@ -96,5 +98,20 @@ inline double FluidTsatFit::evaluate(const double x, const double y __attribute_
     return (mB - sqrt(mB2 - mC4 * (mA - log10(x)))) * mC2;
 }
 
-#endif
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]    x    (--)  Array of first independent variables for curve fit.
+/// @param[in]    y    (--)  Array of second independent variables for curve fit.
+/// @param[out]   out  (--)  Array of fitted variables at the specified inputs.
+/// @param[in]    n    (--)  Number of points.
+///
+/// @details  Returns this saturation temperature model fit at each point, with the inline model so
+///           the loop can be vectorized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void FluidTsatFit::evaluateBatch(const double* x, const double* y, double* out, const int n)
+{
+    for (int i = 0; i < n; ++i) {
+        out[i] = FluidTsatFit::evaluate(x[i], y[i]);
+    }
+}
 
+#endif
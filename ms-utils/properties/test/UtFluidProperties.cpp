@@ -1083,3 +1083,110 @@ void UtFluidProperties::testSaturationCurveConsistency()
 
     std::cout << "... Pass" << std::endl;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the opt-in tabulation of the costlier approximations.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtFluidProperties::testTabulation()
+{
+    std::cout << "\n Fluid Properties 15: Tabulation                                        ";
+
+    /// - Verify nothing is tabulated by default.
+    CPPUNIT_ASSERT(mArticle->getTabulationReport().empty());
+    for (int i = 0; i < FluidProperties::NO_FLUID; ++i) {
+        for (int k = 0; k < DefinedFluidProperties::NUM_TABULATED; ++k) {
+            CPPUNIT_ASSERT(not mArticle->isTabulated(static_cast<FluidProperties::FluidType>(i),
+                    static_cast<DefinedFluidProperties::TabulatedProperty>(k)));
+        }
+    }
+
+    /// - Save the analytic values at points over the valid ranges.
+    const double tolerance = 1.0e-3;
+    FluidProperties* pg30  = mArticle->getProperties(FluidProperties::GUNNS_PG30);
+    FluidProperties* pvt   = mArticle->getProperties(FluidProperties::GUNNS_WATER_PVT);
+    FluidProperties* co    = mArticle->getProperties(FluidProperties::GUNNS_CO);
+    double viscosity[40];
+    double prandtl[40];
+    double density[40][40];
+    for (int i = 0; i < 40; ++i) {
+        const double t = 270.0 + 2.0 * i;
+        viscosity[i]   = pg30->getViscosity(t);
+        prandtl[i]     = pg30->getPrandtlNumber(t);
+        for (int j = 0; j < 40; ++j) {
+            density[i][j] = pvt->getDensity(t, 1.0 + 25.0 * j);
+        }
+    }
+
+    /// - Enable tabulation and verify the power fits & table lookups are tabulated within the
+    ///   tolerance, and the cheaper fits are not.
+    mArticle->enableTabulation(tolerance, 257);
+    CPPUNIT_ASSERT(mArticle->isTabulated(FluidProperties::GUNNS_PG30,
+                                         DefinedFluidProperties::VISCOSITY));
+    CPPUNIT_ASSERT(mArticle->isTabulated(FluidProperties::GUNNS_PG30,
+                                         DefinedFluidProperties::PRANDTL_NUMBER));
+    CPPUNIT_ASSERT(mArticle->isTabulated(FluidProperties::GUNNS_WATER_PVT,
+                                         DefinedFluidProperties::DENSITY));
+    CPPUNIT_ASSERT(not mArticle->isTabulated(FluidProperties::GUNNS_PG30,
+                                             DefinedFluidProperties::THERMAL_CONDUCTIVITY));
+    CPPUNIT_ASSERT(not mArticle->isTabulated(FluidProperties::GUNNS_CO,
+                                             DefinedFluidProperties::DENSITY));
+    CPPUNIT_ASSERT(&mArticle->mViscosityPG30
+                   == mArticle->mAnalytic[FluidProperties::GUNNS_PG30][DefinedFluidProperties::VISCOSITY]);
+    CPPUNIT_ASSERT(not mArticle->isTabulated(FluidProperties::NO_FLUID,
+                                             DefinedFluidProperties::DENSITY));
+    for (int i = 0; i < 40; ++i) {
+        const double t = 270.0 + 2.0 * i;
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(viscosity[i], pg30->getViscosity(t),
+                                     tolerance * viscosity[i]);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(prandtl[i], pg30->getPrandtlNumber(t),
+                                     tolerance * prandtl[i]);
+        for (int j = 0; j < 40; ++j) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(density[i][j], pvt->getDensity(t, 1.0 + 25.0 * j),
+                                         tolerance * density[i][j]);
+        }
+    }
+    CPPUNIT_ASSERT(co == mArticle->getProperties(FluidProperties::GUNNS_CO));
+
+    /// - Verify every table in use met the tolerance, and the report lists each table built.
+    int built = 0;
+    int used  = 0;
+    for (int i = 0; i < FluidProperties::NO_FLUID; ++i) {
+        for (int k = 0; k < DefinedFluidProperties::NUM_TABULATED; ++k) {
+            const TsTabulatedFit& table = mArticle->mTables[i][k];
+            if (table.isInitialized()) {
+                ++built;
+            }
+            if (mArticle->isTabulated(static_cast<FluidProperties::FluidType>(i),
+                    static_cast<DefinedFluidProperties::TabulatedProperty>(k))) {
+                ++used;
+                CPPUNIT_ASSERT(table.isWithinTolerance());
+                CPPUNIT_ASSERT(tolerance >= table.getMaxError());
+            }
+        }
+    }
+    const std::string report = mArticle->getTabulationReport();
+    int lines = 0;
+    for (unsigned int c = 0; c < report.size(); ++c) {
+        if ('\n' == report[c]) {
+            ++lines;
+        }
+    }
+    CPPUNIT_ASSERT(built == lines);
+    CPPUNIT_ASSERT(0 < used and used < built);
+    CPPUNIT_ASSERT(std::string::npos != report.find("fluid 19 viscosity: "));
+    CPPUNIT_ASSERT(std::string::npos != report.find(", analytic"));
+
+    /// - Verify disabling restores the analytic values exactly.
+    mArticle->disableTabulation();
+    CPPUNIT_ASSERT(not mArticle->isTabulated(FluidProperties::GUNNS_PG30,
+                                             DefinedFluidProperties::VISCOSITY));
+    for (int i = 0; i < 40; ++i) {
+        const double t = 270.0 + 2.0 * i;
+        CPPUNIT_ASSERT(viscosity[i] == pg30->getViscosity(t));
+        for (int j = 0; j < 40; ++j) {
+            CPPUNIT_ASSERT(density[i][j] == pvt->getDensity(t, 1.0 + 25.0 * j));
+        }
+    }
+
+    std::cout << "... Pass" << std::endl;
+}
@@ -67,6 +67,7 @@ class UtFluidProperties: public CppUnit::TestFixture
         void testH2Table();
         void testWaterPvtTable();
         void testSaturationCurveConsistency();
+        void testTabulation();
     private:
         CPPUNIT_TEST_SUITE(UtFluidProperties);
         CPPUNIT_TEST(testConstruction);
@@ -83,6 +84,7 @@ class UtFluidProperties: public CppUnit::TestFixture
         CPPUNIT_TEST(testH2Table);
         CPPUNIT_TEST(testWaterPvtTable);
         CPPUNIT_TEST(testSaturationCurveConsistency);
+        CPPUNIT_TEST(testTabulation);
         CPPUNIT_TEST_SUITE_END();
         /// --  Pointer to the friendly test article
         FriendlyDefinedFluidProperties* mArticle;
@@ -24,18 +24,31 @@ PROGRAMMERS:
    )
 */
 
-#include <iostream>
-#include <sstream>
-#include <cstdlib>
-#include <string>
 #include <algorithm>
-#include <execinfo.h>
-#include <pthread.h>
+#include <cstring>
+#include <sched.h>
+#include <string>
 
 #include "TsHsMsgQueue.hh"
 
 using namespace std;
 
+/// @brief Number of times a non-blocking insert retries a slot that another thread is still
+///        writing or removing, before dropping its message.
+static const int MAX_INSERT_RETRIES = 1000;
+
+/// @brief Loads the value, ordered before all memory reads & writes after it.
+static inline unsigned long loadAcquire(const volatile unsigned long& value)
+{
+    return __atomic_load_n(&value, __ATOMIC_ACQUIRE);
+}
+
+/// @brief Stores the value, ordered after all memory reads & writes before it.
+static inline void storeRelease(volatile unsigned long& target, const unsigned long value)
+{
+    __atomic_store_n(&target, value, __ATOMIC_RELEASE);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details   Default constructor.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -47,23 +60,39 @@ TsHsMsgQueueNode::TsHsMsgQueueNode() :
     mSubsys(TS_HS_UNKNOWN),
     mText(),
     mMet(),
-    mTimestamp(0L),
-    mNext(0)
+    mTimestamp(0L)
 {
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Default constructor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsHsMsgQueueSlot::TsHsMsgQueueSlot() :
+    mSequence(0),
+    mLine(0),
+    mType(TS_HS_DEBUG),
+    mMet(),
+    mTimestamp(0L)
+{
+    mFile[0]     = '\0';
+    mFunction[0] = '\0';
+    mSubsys[0]   = '\0';
+    mText[0]     = '\0';
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details   Default constructor.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TsHsMsgQueue::TsHsMsgQueue(void) :
-    mAllocation(0),
-    mAllocatedSize(0),
-    mTail(0),
-    mHead(0),
-    mMutex(),
+    mSlots(0),
+    mCapacity(0),
+    mEnqueuePos(0),
+    mDequeuePos(0),
     mBlocking(false),
-    mTryLockFailures(0),
-    mOverflowCount(0)
+    mDropCount(0),
+    mOverflowCount(0),
+    mTruncationCount(0),
+    mHighWaterMark(0)
 {
 }
 
@@ -74,16 +103,16 @@ TsHsMsgQueue::TsHsMsgQueue(void) :
 /// @param[in] blocking (--) True if user is willing to allow insertMsg to block.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TsHsMsgQueue::TsHsMsgQueue(int size, bool blocking) :
-    mAllocation(0),
-    mAllocatedSize(0),
-    mTail(0),
-    mHead(0),
-    mMutex(),
+    mSlots(0),
+    mCapacity(0),
+    mEnqueuePos(0),
+    mDequeuePos(0),
     mBlocking(blocking),
-    mTryLockFailures(0),
-    mOverflowCount(0)
+    mDropCount(0),
+    mOverflowCount(0),
+    mTruncationCount(0),
+    mHighWaterMark(0)
 {
-    pthread_mutex_init(&mMutex, NULL);
     allocQueue(size);
 }
 
@@ -92,7 +121,7 @@ TsHsMsgQueue::TsHsMsgQueue(int size, bool blocking) :
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TsHsMsgQueue::~TsHsMsgQueue()
 {
-    delete [] mAllocation;
+    delete [] mSlots;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -100,28 +129,23 @@ TsHsMsgQueue::~TsHsMsgQueue()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 int TsHsMsgQueue::getCapacity() const
 {
-    if (mAllocatedSize == 0)
-        return 0;
-
-    // The tail node is never used to store data.
-    return mAllocatedSize-1;
+    return mCapacity;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details   Return the current size of the queue.
+/// @details   Return the current size of the queue. This includes slots claimed by inserting
+///            threads that haven't finished writing them yet.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 int TsHsMsgQueue::getSize() const
 {
-    if (mHead == 0 || mTail == 0 || mAllocatedSize == 0)
+    const unsigned long dequeuePos = mDequeuePos;
+    const unsigned long enqueuePos = mEnqueuePos;
+    if (enqueuePos <= dequeuePos)
        return 0;
 
-    if (mHead <= mTail)
-       return mTail-mHead;
-    else
-       return mAllocatedSize - (mHead-mTail);
+    return static_cast<int>(min(enqueuePos - dequeuePos, static_cast<unsigned long>(mCapacity)));
 }
 
-
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details   Initializes (or re-initializes) the queue.
 ///
@@ -137,8 +161,9 @@ void TsHsMsgQueue::initialize(int size, bool blocking)
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details   Inserts a message request at the tail of the queue. If queue overflows, the oldest
 ///            message will be silently overwritten. A counter is kept to record how many time
-///            this happens. Inserts can be blocking or not. If not blocking then messages will
-///            be dropped if a lock cannot be achieved.
+///            this happens. Inserts can be blocking or not. If not blocking then the message will
+///            be dropped if the queue is full and its oldest message is still being inserted by
+///            another thread. The message is copied into a preallocated slot, without allocating.
 ///
 /// @param[in] file       (--) Source file name invoking 'send'; typically __FILE__ macro is used.
 /// @param[in] line       (--) Line in file invoking 'send'; typically __LINE__ macro is used.
@@ -159,58 +184,181 @@ void TsHsMsgQueue::insertMsg(
     TS_TIMER_TYPE      met,
     unsigned long      timestamp)
 {
-    if (mBlocking)
+    unsigned long pos = 0;
+    TsHsMsgQueueSlot* slot = claimInsertSlot(pos);
+    if (slot == 0)
     {
-        pthread_mutex_lock(&mMutex);
+        __sync_fetch_and_add(&mDropCount, 1);
+        return;
     }
-    else
+
+    // Write the message into the claimed slot. The file name keeps its end, which is the part
+    // that identifies it.
+    copyField(slot->mFile,     TsHsMsgQueueSlot::FILE_SIZE,     file,     true);
+    copyField(slot->mFunction, TsHsMsgQueueSlot::FUNCTION_SIZE, function, false);
+    copyField(slot->mSubsys,   TsHsMsgQueueSlot::SUBSYS_SIZE,   subsys,   false);
+    copyField(slot->mText,     TsHsMsgQueueSlot::TEXT_SIZE,     mtext,    false);
+    const bool truncated = file.size()     >= TsHsMsgQueueSlot::FILE_SIZE
+             || function.size() >= TsHsMsgQueueSlot::FUNCTION_SIZE
+             || subsys.size()   >= TsHsMsgQueueSlot::SUBSYS_SIZE
+             || mtext.size()    >= TsHsMsgQueueSlot::TEXT_SIZE;
+    slot->mLine      = line;
+    slot->mType      = type;
+    slot->mMet       = met;
+    slot->mTimestamp = timestamp;
+
+    // Publish the slot to the removing thread.
+    storeRelease(slot->mSequence, pos + 1);
+
+    if (truncated)
     {
-        if (pthread_mutex_trylock(&mMutex) != 0) // non-0 means lock failed
-        {
-            mTryLockFailures++;
-            return;
-        }
+        __sync_fetch_and_add(&mTruncationCount, 1);
     }
+    raiseToMax(mHighWaterMark, getSize());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Claims the slot for the next enqueue position by advancing mEnqueuePos with a
+///            compare-and-swap. A slot is free for position pos when its sequence equals pos. If
+///            the queue is full, the oldest message is removed and discarded to make room, as an
+///            overflow. If the oldest message is itself still being written, the insert yields
+///            the processor to its writer and retries. If the slot's message has been removed but
+///            the slot isn't released yet, the insert retries. A blocking insert retries until it
+///            gets a slot, and a non-blocking insert gives up after a limited number of retries.
+///
+/// @param[out] pos     (--) The claimed enqueue position.
+///
+/// @return Returns the claimed slot, or null if the insert should be dropped.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsHsMsgQueueSlot* TsHsMsgQueue::claimInsertSlot(unsigned long& pos)
+{
+    if (mCapacity == 0)
+        return 0;
 
-    // Insert message at tail of queue
-    mTail->mFile      = file;
-    mTail->mLine      = line;
-    mTail->mFunction  = function;
-    mTail->mType      = type;
-    mTail->mSubsys    = subsys;
-    mTail->mText      = mtext;
-    mTail->mMet       = met;
-    mTail->mTimestamp = timestamp;
-
-    // If we have filled the queue, overwrite the oldest node by moving the read pointer
-    if (isFull())
+    int retries = 0;
+    pos = mEnqueuePos;
+    for (;;)
     {
-        //cout << "overwriting message '" << mtext << "'" << endl;
-        mHead = mHead->mNext;
-        mOverflowCount++;
+        TsHsMsgQueueSlot* slot = &mSlots[pos % mCapacity];
+        const long diff = static_cast<long>(loadAcquire(slot->mSequence) - pos);
+        if (diff == 0)
+        {
+            // The slot is free for this position: try to claim it.
+            const unsigned long prev = __sync_val_compare_and_swap(&mEnqueuePos, pos, pos + 1);
+            if (prev == pos)
+                return slot;
+            pos = prev;
+        }
+        else if (diff < 0)
+        {
+            // The slot still holds the message from the previous lap. If the queue is full,
+            // discard the oldest message to make room. Otherwise another thread has removed the
+            // slot's message and is about to release it, so give that thread the processor and
+            // retry.
+            unsigned long oldest = 0;
+            if (mEnqueuePos - mDequeuePos < static_cast<unsigned long>(mCapacity))
+            {
+                if (!mBlocking && ++retries > MAX_INSERT_RETRIES)
+                    return 0;
+                sched_yield();
+            }
+            else if (claimRemoveSlot(oldest) != 0)
+            {
+                storeRelease(mSlots[oldest % mCapacity].mSequence, oldest + mCapacity);
+                __sync_fetch_and_add(&mOverflowCount, 1);
+            }
+            else
+            {
+                // The oldest message is still being written, by a thread that may have been
+                // preempted, so give it the processor.
+                if (!mBlocking && ++retries > MAX_INSERT_RETRIES)
+                    return 0;
+                sched_yield();
+            }
+            pos = mEnqueuePos;
+        }
+        else
+        {
+            // Another thread claimed this position first.
+            pos = mEnqueuePos;
+        }
     }
-    //else
-    //    cout << "inserting message '" << mtext << "'" << endl;
+}
 
-    // Update the tail pointer
-    mTail = mTail->mNext;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Claims the slot at the dequeue position by advancing mDequeuePos with a
+///            compare-and-swap, if its message is ready. The caller must release the slot for the
+///            next lap by storing pos + capacity in its sequence when done with it.
+///
+/// @param[out] pos     (--) The claimed dequeue position.
+///
+/// @return Returns the claimed slot, or null if the oldest message isn't ready or none exists.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsHsMsgQueueSlot* TsHsMsgQueue::claimRemoveSlot(unsigned long& pos)
+{
+    if (mCapacity == 0)
+        return 0;
 
-    pthread_mutex_unlock(&mMutex);
+    pos = mDequeuePos;
+    for (;;)
+    {
+        TsHsMsgQueueSlot* slot = &mSlots[pos % mCapacity];
+        const long diff = static_cast<long>(loadAcquire(slot->mSequence) - (pos + 1));
+        if (diff == 0)
+        {
+            const unsigned long prev = __sync_val_compare_and_swap(&mDequeuePos, pos, pos + 1);
+            if (prev == pos)
+                return slot;
+            pos = prev;
+        }
+        else if (diff < 0)
+        {
+            // Empty, or the oldest message is still being written.
+            return 0;
+        }
+        else
+        {
+            // Another thread removed this position first.
+            pos = mDequeuePos;
+        }
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details   Inserts a message request at the tail of the queue. If queue overflows, the oldest
-///            message will be silently overwritten. A counter is kept to record how many time
-///            this happens. Inserts can be blocking or not. If not blocking then messages will
-///            be dropped if a lock cannot be achieved.
+/// @details   Copies the string into the field, truncating it to fit with a terminating null.
 ///
-/// @param[in] node     (--) node to add to queue.
+/// @param[out] field   (--) The slot field to copy into.
+/// @param[in]  size    (--) The size of the field, including the terminating null.
+/// @param[in]  value   (--) The string to copy.
+/// @param[in]  keepEnd (--) True to keep the end of a truncated string instead of its start.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void TsHsMsgQueue::insertMsg(TsHsMsgQueueNode& node)
+void TsHsMsgQueue::copyField(char* field, const int size, const std::string& value,
+                             const bool keepEnd)
 {
-    insertMsg(node.mFile, node.mLine, node.mFunction, node.mType, node.mSubsys, node.mText, node.mMet, node.mTimestamp);
+    const std::string::size_type length =
+            min(value.size(), static_cast<std::string::size_type>(size - 1));
+    const std::string::size_type offset = keepEnd ? value.size() - length : 0;
+    memcpy(field, value.data() + offset, length);
+    field[length] = '\0';
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Raises the counter to the value with a compare-and-swap, if the value is higher.
+///
+/// @param[in,out] counter (--) The counter to raise.
+/// @param[in]     value   (--) The new value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgQueue::raiseToMax(volatile int& counter, const int value)
+{
+    int current = counter;
+    while (value > current)
+    {
+        const int prev = __sync_val_compare_and_swap(&counter, current, value);
+        if (prev == current)
+            break;
+        current = prev;
+    }
+}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details   Removes a message request from the head of the queue and places it in node. If
@@ -222,121 +370,97 @@ void TsHsMsgQueue::insertMsg(TsHsMsgQueueNode& node)
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 bool TsHsMsgQueue::removeMsg(TsHsMsgQueueNode& node)
 {
+    unsigned long pos = 0;
+    TsHsMsgQueueSlot* slot = claimRemoveSlot(pos);
+
     // Return false if the the queue is empty
-    if (isEmpty())
+    if (slot == 0)
         return false;
 
-    pthread_mutex_lock(&mMutex);
-
     // Copy message at head of queue to return node
-    node.mFile      = mHead->mFile;
-    node.mLine      = mHead->mLine;
-    node.mFunction  = mHead->mFunction;
-    node.mType      = mHead->mType;
-    node.mSubsys    = mHead->mSubsys;
-    node.mText      = mHead->mText;
-    node.mMet       = mHead->mMet;
-    node.mTimestamp = mHead->mTimestamp;
-
-    // Update the head pointer
-    mHead = mHead->mNext;
-
-    pthread_mutex_unlock(&mMutex);
+    node.mFile      = slot->mFile;
+    node.mLine      = slot->mLine;
+    node.mFunction  = slot->mFunction;
+    node.mType      = slot->mType;
+    node.mSubsys    = slot->mSubsys;
+    node.mText      = slot->mText;
+    node.mMet       = slot->mMet;
+    node.mTimestamp = slot->mTimestamp;
+
+    // Release the slot for the next lap of inserts.
+    storeRelease(slot->mSequence, pos + mCapacity);
 
     return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details   Allocates memory for the queue. If size is <1, a queue big enough to hold 1 message
-///            will be allocated.
+///            will be allocated. This is not thread-safe, and must not be called while other
+///            threads are using the queue.
 ///
 /// @param[in] size     (--) The maximum number of messages the queue can hold before overflow occurs.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void TsHsMsgQueue::allocQueue(int size)
 {
-    // Internal size is one-greater than user-requested size. Minimum internal size is 2.
-    int new_allocated_size = max(size+1, 2);
+    // Minimum size is 1.
+    int new_capacity = max(size, 1);
 
     // Don't re-allocate a queue that's the same size as the original, just reuse the original.
-    if (new_allocated_size == mAllocatedSize)
+    if (new_capacity == mCapacity)
         return;
 
-    mAllocatedSize = new_allocated_size;
-
     // If this is a re-allocation, then clean up original first
-    delete [] mAllocation;
-
-    //cout << "allocating queue physical size= " << mAllocatedSize << endl;
-
-    // Allocate memory, hook up nodes, and set up head/tail pointers
-    mTail = mAllocation = new TsHsMsgQueueNode[mAllocatedSize];
-
-    for (int i = 0 ; i < mAllocatedSize-1 ; i++)
+    delete [] mSlots;
+
+    // Allocate memory and set each slot free for its first lap.
+    mSlots      = new TsHsMsgQueueSlot[new_capacity];
+    mCapacity   = new_capacity;
+    mEnqueuePos = 0;
+    mDequeuePos = 0;
+    for (int i = 0 ; i < mCapacity ; i++)
     {
-        mTail[i].mNext = &mTail[i+1];
+        mSlots[i].mSequence = i;
     }
-    mTail[mAllocatedSize-1].mNext = mTail;
-    mHead = mTail;
+    __sync_synchronize();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details   Reallocates memory for the queue. Copies outstanding request from original queue to
-///            resized queue. If resized queue is smaller, older request will be discarded.
+///            resized queue. If resized queue is smaller, older request will be discarded. This is
+///            not thread-safe, and must not be called while other threads are using the queue.
 ///
 /// @param[in] size     (--) The maximum number of messages the queue can hold before overflow occurs.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void TsHsMsgQueue::reallocQueue(int size)
 {
     // If there is no previous queue, then this is not a re-alloc. Just alloc instead.
-    if (mAllocatedSize == 0)
+    if (mCapacity == 0)
     {
         allocQueue(size);
         return;
     }
 
-    // Internal size is one-greater than user-requested size. Minimum internal size is 2.
-    int new_allocated_size = max(size+1, 2);
-
     // If the queue is already the requested size, use the existing queue.
-    if (new_allocated_size == mAllocatedSize)
+    if (max(size, 1) == mCapacity)
         return;
 
-    // Make a clone of the original queue
-    TsHsMsgQueue temp_queue;
-    temp_queue.clone(*this);
+    // Move the outstanding requests out of the original queue.
+    TsHsMsgQueueNode* pending = new TsHsMsgQueueNode[mCapacity];
+    int numPending = 0;
+    while (removeMsg(pending[numPending]) == true)
+    {
+        ++numPending;
+    }
 
-    // Transform the original queue into a new queue, preserving most of the non-pointer fields.
-    mAllocation      = 0;
-    mAllocatedSize   = 0;
-    mTail            = 0;
-    mHead            = 0;
     allocQueue(size);
 
-    //cout << "reallocating queue physical size= " << mAllocatedSize << endl;
-
     // Copy request from old queue to new queue. If new queue is smaller, then older request
     // will be discarded when queue wraps.
-
-    TsHsMsgQueueNode node;
-    while (temp_queue.removeMsg(node) == true)
+    for (int i = 0; i < numPending; ++i)
     {
-        insertMsg(node);
+        const TsHsMsgQueueNode& node = pending[i];
+        insertMsg(node.mFile, node.mLine, node.mFunction, node.mType, node.mSubsys, node.mText,
+                  node.mMet, node.mTimestamp);
     }
+    delete [] pending;
 }
-
-////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details   Make a shallow copy of a queue
-/// @param[in] original     (--) The source queue to clone from.
-////////////////////////////////////////////////////////////////////////////////////////////////////
-void TsHsMsgQueue::clone(const TsHsMsgQueue& original)
-{
-    mAllocation      = original.mAllocation;
-    mAllocatedSize   = original.mAllocatedSize;
-    mTail            = original.mTail;
-    mHead            = original.mHead;
-    mMutex           = original.mMutex;
-    mBlocking        = original.mBlocking;
-    mTryLockFailures = original.mTryLockFailures;
-    mOverflowCount   = original.mOverflowCount;
-}
-
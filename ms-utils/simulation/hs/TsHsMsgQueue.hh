@@ -17,10 +17,11 @@ REQUIREMENTS:
 - (TBD)
 
 REFERENCE:
-- (TBD)
+- (D. Vyukov, Bounded MPMC queue, 1024cores.net)
 
 ASSUMPTIONS AND LIMITATIONS:
-- (TBD)
+- (Message fields longer than their fixed slot sizes are truncated on insert.)
+- (Uses the GCC __sync and __atomic builtins.)
 
 LIBRARY DEPENDENCY:
 - ((TsHsMsgQueue.o))
@@ -35,7 +36,6 @@ PROGRAMMERS:
 
 #include <cstdlib>
 #include <string>
-#include <pthread.h>
 
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "TS_hs_msg_types.h"
@@ -59,20 +59,56 @@ public:
     std::string       mText;       // ** (--) The text to log, e.g. description of the error
     TS_TIMER_TYPE     mMet;        // ** (--) MET time related to logging event
     unsigned long     mTimestamp;  // ** (--) Unix time stamp related to logging event
-    TsHsMsgQueueNode* mNext;       // ** (--) Pointer to next node
 private:
     TsHsMsgQueueNode(const TsHsMsgQueueNode&);
     const TsHsMsgQueueNode& operator=(const TsHsMsgQueueNode&);
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief   Preallocated message slot used internally by TsHsMsgQueue. The message strings are
+///          held in fixed-size character arrays so that inserting a message never allocates.
+///
+/// @details mSequence is the slot's turn in the ring: it equals the enqueue position when the
+///          slot is free for that position, and the position + 1 once the message is written and
+///          ready to remove.
+//////////////////////////////////////////////////////////////////////////////////////////////////
+class TsHsMsgQueueSlot
+{
+    TS_MAKE_SIM_COMPATIBLE(TsHsMsgQueueSlot);
+public:
+    /// @brief Sizes of the fixed message fields, including the terminating null.
+    enum {FILE_SIZE = 128, FUNCTION_SIZE = 64, SUBSYS_SIZE = 16, TEXT_SIZE = 1024};
+    TsHsMsgQueueSlot();
+    volatile unsigned long mSequence;               // ** (--) Ring position this slot is ready for
+    char              mFile[FILE_SIZE];             // ** (--) Name of file logging the message
+    int               mLine;                        // ** (--) Number of line logging the message
+    char              mFunction[FUNCTION_SIZE];     // ** (--) Name of function logging the message
+    TS_HS_MSG_TYPE    mType;                        // ** (--) Severity of message
+    char              mSubsys[SUBSYS_SIZE];         // ** (--) Subsystem issuing message
+    char              mText[TEXT_SIZE];             // ** (--) The text to log
+    TS_TIMER_TYPE     mMet;                         // ** (--) MET time related to logging event
+    unsigned long     mTimestamp;                   // ** (--) Unix time stamp of logging event
+private:
+    TsHsMsgQueueSlot(const TsHsMsgQueueSlot&);
+    const TsHsMsgQueueSlot& operator=(const TsHsMsgQueueSlot&);
+};
+
 //////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief   A queue which allows logging input/output to be decoupled from the main thread.
 ///
-/// @details This is a fixed size circular queue. On overflow the queue will overwrite the oldest
-///          message. The queue is thread-safe, i.e. protected by a mutex. Inserts can be
-///          blocking or non-blocking. If non-blocking, messages will be skipped (not output) if
-///          a thread fails to get a lock during the operation. Removals are always
-///          blocking, since the main thread is not doing the removing.
+/// @details This is a fixed size circular queue of preallocated message slots. On overflow the
+///          queue will overwrite the oldest message. The queue is thread-safe without a mutex:
+///          inserting threads claim slots with an atomic compare-and-swap on the enqueue position,
+///          and the removing thread claims them the same way on the dequeue position, so any
+///          number of model threads can insert concurrently with the helper thread removing, and
+///          an insert never waits on a lock held by another thread.
+///
+///          When the queue is full, the inserting thread overwrites the oldest message by removing
+///          and discarding it, counted in getOverflows. If the oldest message is still being
+///          written by another inserting thread, the insert yields to it and retries; a
+///          non-blocking insert drops its own message after a limited number of retries, counted
+///          in getDrops.  Message fields that don't fit their slot are truncated, counted in
+///          getTruncations.  The most messages ever held at once is kept in getHighWaterMark.
 //////////////////////////////////////////////////////////////////////////////////////////////////
 class TsHsMsgQueue
 {
@@ -105,17 +141,26 @@ public:
     /// @brief Removes a message request from the head of the queue.
     bool removeMsg(TsHsMsgQueueNode& node);
 
-    /// @brief Returns the number of messages skipped due to lock failures.
-    int getLockFailures() const { return mTryLockFailures; }
+    /// @brief Returns the number of messages dropped on insert, for the old mutex-based API.
+    int getLockFailures() const { return mDropCount; }
+
+    /// @brief Returns the number of messages dropped on insert while the queue was full.
+    int getDrops() const { return mDropCount; }
 
     /// @brief Returns the number of messages overwritten due to overflow.
     int getOverflows() const { return mOverflowCount; }
 
+    /// @brief Returns the number of messages with fields truncated to fit their slot.
+    int getTruncations() const { return mTruncationCount; }
+
+    /// @brief Returns the most messages the queue has held at once.
+    int getHighWaterMark() const { return mHighWaterMark; }
+
     /// @brief Returns true if the queue is empty.
-    bool isEmpty() const { return mHead == mTail; }
+    bool isEmpty() const { return mEnqueuePos == mDequeuePos; }
 
     /// @brief Returns true if the queue is full.
-    bool isFull() const { return mTail->mNext == mHead; }
+    bool isFull() const { return mCapacity > 0 && getSize() >= mCapacity; }
 
     /// @brief Return the capacity of the queue.
     int getCapacity() const;
@@ -137,23 +182,29 @@ protected:
     /// @brief Change the queue size while preserving as many outstanding request as possible.
     void reallocQueue(int size);
 
-    /// @brief Make a shallow copy of a queue
-    void clone(const TsHsMsgQueue& original);
+    /// @brief Claims the next slot to insert into, making room if the queue is full.
+    TsHsMsgQueueSlot* claimInsertSlot(unsigned long& pos);
 
-    /// @brief Inserts a message request at the tail of the queue.
-    void insertMsg(TsHsMsgQueueNode& node);
+    /// @brief Claims the oldest ready slot to remove from, if any.
+    TsHsMsgQueueSlot* claimRemoveSlot(unsigned long& pos);
+
+    /// @brief Copies a string into a fixed-size slot field, truncating if necessary.
+    void copyField(char* field, const int size, const std::string& value, const bool keepEnd);
 
-    TsHsMsgQueueNode* mAllocation;        // ** (--) Points to the top of the block of memory allocation.
-    int               mAllocatedSize;     // *o (--) trick_chkpnt_io(*io) Number of nodes allocated
+    /// @brief Atomically raises a counter to the given value if it's higher.
+    static void raiseToMax(volatile int& counter, const int value);
 
-    TsHsMsgQueueNode* mTail;              // ** (--) Points to next node to insert
-    TsHsMsgQueueNode* mHead;              // ** (--) Points to next node to remove
+    TsHsMsgQueueSlot* mSlots;             // ** (--) Preallocated ring of message slots.
+    int               mCapacity;          // *o (--) trick_chkpnt_io(*io) Number of slots allocated
 
-    pthread_mutex_t   mMutex;             // ** (--) Place holder for mutex
+    volatile unsigned long mEnqueuePos;   // ** (--) Ring position of the next slot to insert
+    volatile unsigned long mDequeuePos;   // ** (--) Ring position of the next slot to remove
 
     bool              mBlocking;          //    (--) If the queue is busy, we can choose to block, or we can choose to discard the message.
-    int               mTryLockFailures;   // *o (--) trick_chkpnt_io(*io) Number of messages skipped due to mutex conflicts.
-    int               mOverflowCount;     // *o (--) trick_chkpnt_io(*io) Number of messages dropped due to queue overflow.
+    volatile int      mDropCount;         // *o (--) trick_chkpnt_io(*io) Number of messages dropped on insert while the queue was busy.
+    volatile int      mOverflowCount;     // *o (--) trick_chkpnt_io(*io) Number of messages dropped due to queue overflow.
+    volatile int      mTruncationCount;   // *o (--) trick_chkpnt_io(*io) Number of messages with truncated fields.
+    volatile int      mHighWaterMark;     // *o (--) trick_chkpnt_io(*io) Most messages held at once.
 
 private:
     TsHsMsgQueue(const TsHsMsgQueue&);
@@ -23,21 +23,21 @@ LIBRARY DEPENDENCY:
 PROGRAMMERS:
    (((Wesley A. White) (Tietronix Software) (August 2011)))
 **************************************************************************************************/
-#include <iostream>
-#include <sstream>
-
-#include "sim_services/Message/include/message_proto.h"
 #include "TsHsMsgStdFilter.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details   Constructor
+/// @details   Constructor. Allocates the table and rings for the default history and count.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TsHsMsgStdFilter::TsHsMsgStdFilter() :
-    mMessageMap(),
+    mEntries(),
+    mTimes(),
+    mRingSize(0),
+    mNumEntries(0),
     mTryLockFailures(0),
     mResourceLock()
 {
     pthread_mutex_init(&mResourceLock, NULL);
+    resize(mHistory, mCount);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -48,11 +48,12 @@ TsHsMsgStdFilter::TsHsMsgStdFilter() :
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void TsHsMsgStdFilter::restart()
 {
-    // Clear the message history
-    if (mMessageMap.size() > 0)
+    // Clear the message history, keeping the table and rings allocated
+    for (unsigned int i = 0; i < mEntries.size(); ++i)
     {
-        mMessageMap.clear();
+        mEntries[i].mUsed = false;
     }
+    mNumEntries = 0;
 
     // Reset try-lock failure count. Maybe we should checkpoint and restore this value?
     mTryLockFailures = 0;
@@ -68,44 +69,245 @@ void TsHsMsgStdFilter::restart()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TsHsMsgStdFilter::~TsHsMsgStdFilter()
 {
-    // Empty
+    pthread_mutex_destroy(&mResourceLock);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Hashes the message call site and text with 64-bit FNV-1a. A separator is hashed
+///            after each string so that, for example, subsystem "ab" with text "c" differs from
+///            subsystem "a" with text "bc".
+///
+/// @param[in] file   (--) Source file name invoking 'send'.
+/// @param[in] line   (--) Line in file invoking 'send'.
+/// @param[in] subsys (--) The subsystem that is logging the message.
+/// @param[in] mtext  (--) The message text.
+///
+/// @return    The hash value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned long long TsHsMsgStdFilter::hashMessage(
+        const std::string& file,
+        const int          line,
+        const std::string& subsys,
+        const std::string& mtext)
+{
+    const unsigned long long prime = 1099511628211ULL;
+    unsigned long long hash = 14695981039346656037ULL;
+
+    hash = hashString(hash, file);
+    for (unsigned int i = 0; i < sizeof(line); ++i)
+    {
+        hash = (hash ^ ((static_cast<unsigned int>(line) >> (8 * i)) & 0xff)) * prime;
+    }
+    hash = hashString(hash, subsys);
+    hash = hashString(hash, mtext);
+
+    return hash;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Continues a 64-bit FNV-1a hash with the characters of a string and a separator.
+///
+/// @param[in] hash (--) The hash so far.
+/// @param[in] str  (--) The characters of this string are added to the hash value.
+///
+/// @return    The hash value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned long long TsHsMsgStdFilter::hashString(unsigned long long hash, const std::string& str)
+{
+    const unsigned long long prime = 1099511628211ULL;
+    const char* str_ptr = str.data();
+    const char* str_end = str_ptr + str.size();
+
+    while (str_ptr != str_end)
+    {
+        hash = (hash ^ static_cast<unsigned char>(*str_ptr)) * prime;
+        str_ptr++;
+    }
+
+    return (hash ^ static_cast<unsigned char>('|')) * prime;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Reallocates the table to the smallest power of 2 that is at least twice the history,
+///            so it is never more than half full, and the rings to hold count times. The messages
+///            in the table and their display times are kept. This is only done when the history
+///            or count are raised above the allocated sizes, never when they are lowered.
+///
+/// @param[in] history (--) Maximum number of unique messages to track.
+/// @param[in] count   (--) Number of display times to hold for each message.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgStdFilter::resize(int history, int count)
+{
+    int tableSize = 8;
+    while (tableSize < 2 * history)
+    {
+        tableSize *= 2;
+    }
+    const int ringSize = (count > 1) ? count : 1;
+
+    std::vector<TsHsMsgFilterEntry> oldEntries(tableSize);
+    std::vector<double>             oldTimes(tableSize * ringSize);
+    mEntries.swap(oldEntries);
+    mTimes.swap(oldTimes);
+    const int oldRingSize = mRingSize;
+    mRingSize   = ringSize;
+    mNumEntries = 0;
+
+    for (unsigned int i = 0; i < mEntries.size(); ++i)
+    {
+        mEntries[i].mUsed = false;
+    }
+
+    // Re-insert the old messages, with their times moved to the front of their new rings. Keep
+    // the newest times if the new rings are smaller.
+    for (unsigned int i = 0; i < oldEntries.size(); ++i)
+    {
+        const TsHsMsgFilterEntry& oldEntry = oldEntries[i];
+        if (oldEntry.mUsed)
+        {
+            const int index = findEntry(oldEntry.mHash, oldEntry.mLine, oldEntry.mTextLength);
+            TsHsMsgFilterEntry& entry = mEntries[index];
+            entry           = oldEntry;
+            entry.mFirst    = 0;
+            entry.mNumTimes = 0;
+
+            const int skip = (oldEntry.mNumTimes > mRingSize) ? oldEntry.mNumTimes - mRingSize : 0;
+            for (int j = skip; j < oldEntry.mNumTimes; ++j)
+            {
+                mTimes[index * mRingSize + entry.mNumTimes++] =
+                        oldTimes[i * oldRingSize + (oldEntry.mFirst + j) % oldRingSize];
+            }
+            ++mNumEntries;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Probes the table from the hash's home index until it finds the message or an empty
+///            entry. An entry only matches if its line and text length also match, so a different
+///            message with the same hash gets its own entry. The table is never full, so the
+///            search always ends.
+///
+/// @param[in] hash       (--) The message hash to find.
+/// @param[in] line       (--) Line of the message call site.
+/// @param[in] textLength (--) Length of the message text.
+///
+/// @return    The table index holding the message, or the empty index where the message belongs.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int TsHsMsgStdFilter::findEntry(unsigned long long hash, int line, unsigned int textLength) const
+{
+    const unsigned long long mask = mEntries.size() - 1;
+    unsigned long long index = hash & mask;
+
+    while (mEntries[index].mUsed && (mEntries[index].mHash != hash ||
+                                     mEntries[index].mLine != line ||
+                                     mEntries[index].mTextLength != textLength))
+    {
+        index = (index + 1) & mask;
+    }
+
+    return static_cast<int>(index);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details       Removes times from the deque which precede the current interval of interest.
+/// @details       Removes times from the ring which precede the current interval of interest.
 ///
-/// @param[in,out] times         (--) The deque containing times that a particular message occurred.
+/// @param[in]     index         (--) Table index of the entry holding times that a particular
+///                                   message occurred.
 /// @param[in]     intervalStart (--) We are not interested in times earlier that this.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void TsHsMsgStdFilter::purgeTimes(TsHsTimesDeque& times, double intervalStart)
+void TsHsMsgStdFilter::purgeTimes(int index, double intervalStart)
 {
-    while (!times.empty() && times.front() < intervalStart)
+    TsHsMsgFilterEntry& entry = mEntries[index];
+    const double*       times = &mTimes[index * mRingSize];
+
+    while (entry.mNumTimes > 0 && times[entry.mFirst] < intervalStart)
+    {
+        entry.mFirst = (entry.mFirst + 1) % mRingSize;
+        --entry.mNumTimes;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details       Adds a display time to the back of an entry's ring. If the ring is full, this
+///                replaces the oldest time.
+///
+/// @param[in]     index     (--) Table index of the entry.
+/// @param[in]     timestamp (--) The display time to add.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgStdFilter::addTime(int index, double timestamp)
+{
+    TsHsMsgFilterEntry& entry = mEntries[index];
+
+    if (entry.mNumTimes < mRingSize)
     {
-        times.pop_front();
+        mTimes[index * mRingSize + (entry.mFirst + entry.mNumTimes) % mRingSize] = timestamp;
+        ++entry.mNumTimes;
     }
+    else
+    {
+        mTimes[index * mRingSize + entry.mFirst] = timestamp;
+        entry.mFirst = (entry.mFirst + 1) % mRingSize;
+    }
+    entry.mLastTime = timestamp;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details Finds and removes the oldest message in the map.
+/// @details Finds and removes the oldest message in the table, which is the message whose most
+///          recent display time is the earliest.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void TsHsMsgStdFilter::purgeMessages()
 {
-    if (mMessageMap.size() == 0)
+    if (mNumEntries == 0)
     {
         return;
     }
 
-    TsHsMessageMap::iterator oldest = mMessageMap.begin();
+    int oldest = -1;
+
+    for (unsigned int i = 0; i < mEntries.size(); ++i)
+    {
+        if (mEntries[i].mUsed && (oldest < 0 || mEntries[i].mLastTime < mEntries[oldest].mLastTime))
+        {
+            oldest = i;
+        }
+    }
+
+    removeEntry(oldest);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Removes the message at a table index. Since the table uses linear probing, each
+///          following message up to the next empty entry is moved back into the vacated entry if
+///          that lies between the message's home index and its current index, so that it can
+///          still be found.
+///
+/// @param[in] index (--) Table index of the message to remove.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgStdFilter::removeEntry(int index)
+{
+    const unsigned long long mask = mEntries.size() - 1;
+    unsigned long long hole = index;
+
+    unsigned long long next = (hole + 1) & mask;
 
-    for (TsHsMessageMap::iterator iter = ++oldest; iter != mMessageMap.end(); iter++)
+    while (mEntries[next].mUsed)
     {
-        if ((*iter).second.back() < (*oldest).second.back())
+        const unsigned long long home = mEntries[next].mHash & mask;
+        if (((next - home) & mask) >= ((next - hole) & mask))
         {
-            oldest = iter;
+            mEntries[hole] = mEntries[next];
+            for (int j = 0; j < mRingSize; ++j)
+            {
+                mTimes[hole * mRingSize + j] = mTimes[next * mRingSize + j];
+            }
+            hole = next;
         }
+        next = (next + 1) & mask;
     }
 
-    mMessageMap.erase(oldest);
+    mEntries[hole].mUsed = false;
+    --mNumEntries;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -135,8 +337,6 @@ bool TsHsMsgStdFilter::shouldSendMessage(
         const std::string& mtext
         )
 {
-    typedef std::pair< std::string,TsHsTimesDeque > TsHsMessageMapPair;
-
     if (!mEnabled)
     {
         return true;
@@ -147,8 +347,10 @@ bool TsHsMsgStdFilter::shouldSendMessage(
         // Wait for resource
         if (pthread_mutex_lock(&mResourceLock) != 0) // non-0 means lock failed
         {
-            // This should never happen. If we wait, we should eventually get the lock.
-            message_publish(MSG_ERROR, "TsHsMsgStdFilter::shouldSendMessage failed to get resource lock\n");
+            // This should never happen. If we wait, we should eventually get the lock. Count it
+            // with the try-lock failures, which the H&S manager reports at shutdown.
+            ++mTryLockFailures;
+            return false;
         }
     }
     else
@@ -172,45 +374,59 @@ bool TsHsMsgStdFilter::shouldSendMessage(
         return false;
     }
 
-    // Construct a message string to present to the filter. This doesn't have to
-    // be identical to the message string that actually gets output to the log.
-    std::ostringstream oss;
-    oss << file << "|" << line << "|" << subsys << "|" << mtext << std::ends;
-    std::string message(oss.str());
+    // The history and count can be raised at run-time, so grow the table and rings to suit.
+    if (2 * mHistory > static_cast<int>(mEntries.size()) || mCount > mRingSize)
+    {
+        resize(mHistory, mCount);
+    }
 
-    // Attempt to locate this message in the message map.
-    TsHsMessageMap::iterator iter = mMessageMap.find(message);
+    // Hash the message to present to the filter, and attempt to locate it in the table.
+    const unsigned long long hash       = hashMessage(file, line, subsys, mtext);
+    const unsigned int       textLength = static_cast<unsigned int>(mtext.size());
+    int index = findEntry(hash, line, textLength);
 
-    if (iter == mMessageMap.end())
+    if (!mEntries[index].mUsed)
     {
-        // The message was not found in map. If the map is full, bump the oldest message.
+        // The message was not found in the table. If the table is full, bump the oldest message.
         // Insert the new message/time. Return a value indicating the message should be displayed.
 
-        while (static_cast<int>(mMessageMap.size()) >= mHistory)
+        if (mNumEntries >= mHistory)
         {
-            purgeMessages();
+            while (mNumEntries >= mHistory && mNumEntries > 0)
+            {
+                purgeMessages();
+            }
+
+            // Removing messages may have moved the new message's empty entry.
+            index = findEntry(hash, line, textLength);
         }
 
-        TsHsTimesDeque times;
-        times.push_back(timestamp);
-        mMessageMap.insert(TsHsMessageMapPair(message, times));
+        TsHsMsgFilterEntry& entry = mEntries[index];
+        entry.mHash       = hash;
+        entry.mFirst      = 0;
+        entry.mNumTimes   = 0;
+        entry.mLine       = line;
+        entry.mTextLength = textLength;
+        entry.mUsed       = true;
+        ++mNumEntries;
+        addTime(index, timestamp);
 
         pthread_mutex_unlock(&mResourceLock);
         return true;
     }
     else
     {
-        // The message was found in map. Compute the beginning of the interval
-        // and get rid of any times that precede it. If the deque is not full,
-        // add the new time to it. Otherwise, if the deque is full, then the count has
-        // been reached or exceeded, so suppress the message.
+        // The message was found in the table. Compute the beginning of the interval
+        // and get rid of any times that precede it. If the ring has fewer than count
+        // times, add the new time to it. Otherwise the count has been reached or
+        // exceeded, so suppress the message.
 
         double interval_start = timestamp - mInterval;
-        purgeTimes((*iter).second, interval_start);
+        purgeTimes(index, interval_start);
 
-        if (static_cast<int>((*iter).second.size()) < mCount)
+        if (mEntries[index].mNumTimes < mCount)
         {
-            (*iter).second.push_back(timestamp);
+            addTime(index, timestamp);
             pthread_mutex_unlock(&mResourceLock);
             return true;
         }
@@ -221,6 +437,4 @@ bool TsHsMsgStdFilter::shouldSendMessage(
             return false;
         }
     }
-    pthread_mutex_unlock(&mResourceLock);
-    return false; // compiler thinks it can get here so it wants a value returned
 }
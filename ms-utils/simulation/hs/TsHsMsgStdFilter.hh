@@ -22,12 +22,25 @@ PROGRAMMERS:
 @{
 */
 
-#include <deque>
-#include <map>
+#include <string>
+#include <vector>
 #include <pthread.h>
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "TsHsMsgFilter.hh"
 
+/// @brief An entry in the message filter's hash table, tracking the recent display times of one
+///        unique message.  The times are held in a ring in the filter's times array.
+struct TsHsMsgFilterEntry
+{
+    unsigned long long mHash;       // ** (--) Hash of the message call site and text
+    double             mLastTime;   // ** (s)  Most recent display time of the message
+    int                mFirst;      // ** (--) Index in the ring of the oldest display time
+    int                mNumTimes;   // ** (--) Number of display times in the ring
+    int                mLine;       // ** (--) Line of the message call site, checked with the hash
+    unsigned int       mTextLength; // ** (--) Length of the message text, checked with the hash
+    bool               mUsed;       // ** (--) True if this entry holds a message
+};
+
 //////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief   Provides "standard" message filters which include a redundancy filter and a
 ///          category filter.
@@ -38,49 +51,46 @@ PROGRAMMERS:
 ///          See TsHsMsgFilter documentation for an overview. Detailed implementation information
 ///          follows.
 ///
-/// @details <b>Design:</b> Recently displayed messages are stored in a map. The
-///          message itself if the map key. The map value is a deque of display times for that
+/// @details <b>Design:</b> Recently displayed messages are stored in an open-addressing hash
+///          table with linear probing. A message is keyed by a 64-bit FNV-1a hash of its file,
+///          line, subsystem and text, so no key string is built. Each entry also keeps the
+///          message's line and text length, which must match as well as the hash, so two
+///          different messages are only filtered as one if they have the same line, text length
+///          and 64-bit hash. Each table entry owns a fixed-size ring of display times for that
 ///          message. Message counts are not added for suppressed messages.
 ///
 /// @details <b>Algorithm:</b> When the filter is presented a message, the message is located in the
-///          map (inserted if necessary). Its display times deque is obtained and the display
-///          time is added as follows. The deque is purged of any display times outside of the
-///          current interval. If the deque contains more than 'count' items, the filter
-///          returns a value indicating that the message should be suppressed. If the deque
-///          contains fewer than 'count' items the time is added to the back of the deque and
-///          the filter returns a value indicating that the message should be displayed.
+///          table (inserted if necessary). The ring of display times is purged of any times
+///          outside of the current interval. If the ring contains 'count' or more times, the
+///          filter returns a value indicating that the message should be suppressed. Otherwise
+///          the time is added to the ring and the filter returns a value indicating that the
+///          message should be displayed.
 ///
 /// @details <b>Memory Usage:</b> The filter is designed to limit the amount of memory used in a
 ///          'worst-case' scenario in which the filter is bombarded with a large number of
 ///          unique messages. This could happen, for example, if a programmer includes a
 ///          time-field or other rapidly changing value in the code which creates his/her
-///          message strings. At most H unique messages will be tracked at any one time. For
-///          each message at most C display times will be stored. Therefore the maximum size
-///          of the filter is roughly given by \n
+///          message strings. At most H unique messages will be tracked at any one time, in a
+///          table of T entries, the smallest power of 2 at least 2H, so the table is at most
+///          half full. Each entry has a ring of C display times. The size of the filter is
+///          therefore \n
 ///
-///          deque_overhead_size = sizeof(TsHsTimesDeque) = 80 bytes \n
-///          deque_size          = deque_overhead_size + (C * sizeof(double) = 80+(C*8) bytes \n
-///          map_node_size       = sizeof(std::_Rb_tree_node_base) = 32 bytes \n
-///          map_overhead_size   = sizeof(TsHsMessageMap) = 48 bytes \n
-///          map_size           ~= map_overhead_size + H*[max_message_size + deque_size + map_node_size] \n
+///          filter_size ~= T * [sizeof(TsHsMsgFilterEntry) + (C * sizeof(double))] \n
+///                       = T * [40 + (C * 8)] bytes \n
 ///
-///          Example (C=2, H=20, max_message_size=256): \n
+///          Example (C=2, H=25, T=64): \n
 ///
-///          deque_size = 80+(2*8) = 96 bytes \n
-///          map_size = 48+20[256+96+32] = 7728 bytes \n
+///          filter_size = 64[40+(2*8)] = 3584 bytes \n
 ///
-/// @details Currently the filter does not truncate strings to any max length. However, the
-///          average length of messages tends to be running around 129 bytes.
+/// @details The table and rings are allocated when the filter is constructed, and reallocated
+///          only when the history or count are raised above their allocated sizes. Presenting a
+///          message to the filter makes no heap allocations and formats no strings.
 ///
-/// @details <b>Processor Usage:</b> Deque insertion/deletion operations are performed in amortized
-///          constant time.Map search, insertion, and deletion operations are performed in
-///          O(log n) time. Finding and removing the oldest message in the map requires
-///          (worst-case) iterating through all the maps elements. This is performed in O(n) time.
-///          Therefore worst-case performance is O(n), which is not bad considering the filter
-///          will work effectively with fairly small values of n=H. For example, it is very
-///          likely that for n=H=20, the 20th message will probably be outside of the interval
-///          of interest well before it is deleted, therefore its deletion will have no impact
-///          on the performance of the filter.
+/// @details <b>Processor Usage:</b> Hashing the message is linear in its length. Table search,
+///          insertion and removal are performed in constant expected time, since the table is
+///          at most half full, and ring insertion and purging in constant time. Finding and
+///          removing the oldest message, when a new message arrives with the table full,
+///          requires iterating through the table. This is performed in O(T) time.
 ///
 /// @see TsHsMsgFilter for more information.
 //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -112,18 +122,35 @@ public:
 
 protected:
 
-    // Make reading the STL stuff more comprehensible with some typedefs
+    /// @brief Returns the hash of a message's call site and text.
+    static unsigned long long hashMessage(const std::string& file, const int line,
+                                          const std::string& subsys, const std::string& mtext);
+
+    /// @brief Continues a hash with the characters of a string.
+    static unsigned long long hashString(unsigned long long hash, const std::string& str);
 
-    typedef std::deque< double > TsHsTimesDeque;
-    typedef std::map< std::string, TsHsTimesDeque > TsHsMessageMap;
+    /// @brief Reallocates the table and rings for the given history and count, keeping messages.
+    void resize(int history, int count);
 
-    /// @brief Removes times from a times deque if the times precede the interval start time
-    void purgeTimes(TsHsTimesDeque& times, double intervalStart);
+    /// @brief Returns the table index holding the message, or the empty index where it belongs.
+    int findEntry(unsigned long long hash, int line, unsigned int textLength) const;
 
-    /// @brief Find and remove the oldest message in the message map
+    /// @brief Removes times from an entry's ring if the times precede the interval start time
+    void purgeTimes(int index, double intervalStart);
+
+    /// @brief Adds a display time to an entry's ring
+    void addTime(int index, double timestamp);
+
+    /// @brief Find and remove the oldest message in the table
     void purgeMessages();
 
-    TsHsMessageMap  mMessageMap;       // ** (--)  Tracks which messages have been displayed and when
+    /// @brief Removes the message at a table index, shifting back the messages probed after it.
+    void removeEntry(int index);
+
+    std::vector<TsHsMsgFilterEntry> mEntries; // ** (--) Table of messages displayed and when
+    std::vector<double>             mTimes;   // ** (s)  Rings of display times, mRingSize per entry
+    int             mRingSize;         // ** (--)  Capacity of each entry's ring of display times
+    int             mNumEntries;       // ** (--)  Number of messages in the table
     int             mTryLockFailures;  // ** (--)  Number of times trylock failed to get the lock (== number of dropped messages)
     pthread_mutex_t mResourceLock;     // ** (--)  Mutex which controls access to database files
 
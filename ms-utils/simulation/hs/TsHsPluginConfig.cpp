@@ -29,6 +29,8 @@ TsHsPluginConfig::TsHsPluginConfig() :
     mEnabled(false),
     mOverwrite(true),
     mPath(""),
-    mBlocking(false)
+    mBlocking(false),
+    mFlushInterval(1.0),
+    mFlushSize(256)
 {
 }
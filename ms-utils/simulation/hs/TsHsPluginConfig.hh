@@ -44,6 +44,8 @@ struct TsHsPluginConfig
     bool        mOverwrite;     //    (--) Reuse plugin target (e.g. overwrite file vs. create a new timestamped one)
     std::string mPath;          //    (--) Path to file to which the plugin writes
     bool        mBlocking;      //    (--) This plugin will wait when needed resources are busy
+    double      mFlushInterval; //    (s)  Longest time a buffering plugin holds messages
+    int         mFlushSize;     //    (--) Buffered messages that trigger a buffering plugin write
 };
 
 /// @}
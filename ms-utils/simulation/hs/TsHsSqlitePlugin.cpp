@@ -29,6 +29,8 @@ PROGRAMMERS:
 #include <cstdlib>
 #include <cstring>
 #include <cmath>
+#include <cerrno>
+#include <ctime>
 #include <sqlite3.h>
 #include "sim_services/Message/include/message_proto.h"
 #include "simulation/timer/TS_timer.h"
@@ -48,16 +50,46 @@ TsHsSqlitePlugin::TsHsSqlitePlugin(int id) :
     mDatabaseHandle(0),
     mTryLockFailures(0),
     mResourceLock(),
-    mBlocking(false)
+    mBlocking(false),
+    mFlushInterval(1.0),
+    mFlushSize(256),
+    mMaxPending(4096),
+    mInsertMsgStmt(0),
+    mUpdateMsgStmt(0),
+    mInsertTimeStmt(0),
+    mPending(),
+    mWriting(),
+    mPendingCount(0),
+    mOverflows(0),
+    mWriteErrors(0),
+    mWrittenCount(0),
+    mWriter(),
+    mWriterRunning(false),
+    mStopRequested(false),
+    mFlushCond(),
+    mSpaceCond()
 {
     pthread_mutex_init(&mResourceLock, NULL);
+    pthread_cond_init(&mFlushCond, NULL);
+    pthread_cond_init(&mSpaceCond, NULL);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details Destructor
+/// @details Destructor.  Writes any pending messages and closes the database, if the plugin wasn't
+///          shut down.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TsHsSqlitePlugin::~TsHsSqlitePlugin()
 {
+    stopWriter();
+    if (mDatabaseHandle)
+    {
+        finalizeStatements();
+        sqlite3_close(mDatabaseHandle);
+        mDatabaseHandle = 0;
+    }
+    pthread_cond_destroy(&mSpaceCond);
+    pthread_cond_destroy(&mFlushCond);
+    pthread_mutex_destroy(&mResourceLock);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -71,6 +103,12 @@ void TsHsSqlitePlugin::configure(const TsHsPluginConfig& configData)
     mFilename  = configData.mPath;
     mOverwrite = configData.mOverwrite;
     mBlocking  = configData.mBlocking;
+
+    // The pending buffer holds several batches, so the writer can fall behind briefly during a
+    // message storm before callers have to wait or messages are discarded.
+    mFlushInterval = (configData.mFlushInterval > 0.0) ? configData.mFlushInterval : 1.0;
+    mFlushSize     = (configData.mFlushSize > 0) ? configData.mFlushSize : 1;
+    mMaxPending    = 16 * mFlushSize;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -174,9 +212,259 @@ bool TsHsSqlitePlugin::init(void)
         handleSqlError(__FILE__, __LINE__, &sql_error, true);
     }
 
+    // Prepare the statements used to write messages and start the writer
+    if (!mDatabaseHandle || !prepareStatements())
+    {
+        return false;
+    }
+
+    startWriter();
+
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Prepares the statements that insert a message entry, update its count and insert its
+///          timestamp entry, so each message is written by binding values instead of compiling SQL.
+///
+/// @return  True if the statements were prepared, else false.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsSqlitePlugin::prepareStatements()
+{
+    finalizeStatements();
+
+    // insert the hash-message entry (if it's already there, carry on)
+    const char* insert_msg_command =
+            "INSERT OR IGNORE INTO messages VALUES (?1, ?2, ?3, ?4, ?5, ?6, 0, ?7);";
+    // increment the count
+    const char* update_msg_command =
+            "UPDATE messages SET count = count + 1, last_time = ?1 WHERE id = ?2;";
+    // insert the timestamp entry
+    const char* insert_time_command =
+            "INSERT INTO timestamps VALUES (?1, ?2, ?3);";
+
+    if (sqlite3_prepare_v2(mDatabaseHandle, insert_msg_command, -1, &mInsertMsgStmt, NULL)
+            != SQLITE_OK ||
+        sqlite3_prepare_v2(mDatabaseHandle, update_msg_command, -1, &mUpdateMsgStmt, NULL)
+            != SQLITE_OK ||
+        sqlite3_prepare_v2(mDatabaseHandle, insert_time_command, -1, &mInsertTimeStmt, NULL)
+            != SQLITE_OK)
+    {
+        message_publish(MSG_ERROR, "TsHsSqlitePlugin error preparing statements: %s\n", sqlite3_errmsg(mDatabaseHandle));
+        finalizeStatements();
+        return false;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Finalizes the prepared statements, which must be done before closing the database.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsSqlitePlugin::finalizeStatements()
+{
+    // sqlite3_finalize is a harmless no-op on a null statement
+    sqlite3_finalize(mInsertMsgStmt);
+    sqlite3_finalize(mUpdateMsgStmt);
+    sqlite3_finalize(mInsertTimeStmt);
+    mInsertMsgStmt  = 0;
+    mUpdateMsgStmt  = 0;
+    mInsertTimeStmt = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Starts the background writer thread.  If the thread can't be started, messages are
+///          written by the calling thread as they are issued, as this plugin used to do.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsSqlitePlugin::startWriter()
+{
+    if (mWriterRunning)
+    {
+        return;
+    }
+
+    mStopRequested = false;
+    if (pthread_create(&mWriter, NULL, writerThread, this) == 0)
+    {
+        mWriterRunning = true;
+    }
+    else
+    {
+        message_publish(MSG_WARNING, "TsHsSqlitePlugin could not start its writer thread, messages will be written as issued\n");
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Requests the writer thread to stop and waits for it to write the pending messages and
+///          exit.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsSqlitePlugin::stopWriter()
+{
+    if (!mWriterRunning)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&mResourceLock);
+    mStopRequested = true;
+    pthread_cond_signal(&mFlushCond);
+    pthread_mutex_unlock(&mResourceLock);
+
+    pthread_join(mWriter, NULL);
+
+    // Release any callers still waiting for room, they will now write their own messages
+    pthread_mutex_lock(&mResourceLock);
+    mWriterRunning = false;
+    pthread_cond_broadcast(&mSpaceCond);
+    pthread_mutex_unlock(&mResourceLock);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Entry point of the background writer thread.
+///
+/// @param[in] plugin (--) The plugin whose messages the thread writes.
+///
+/// @return  Always null.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void* TsHsSqlitePlugin::writerThread(void* plugin)
+{
+    static_cast<TsHsSqlitePlugin*>(plugin)->writerLoop();
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Waits until the flush size is reached, the flush interval has passed or a stop is
+///          requested, then swaps the pending buffer for the writing buffer and writes the batch
+///          with the lock released, so callers can keep buffering messages during the write.
+///          Returns once a stop is requested and all pending messages have been written.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsSqlitePlugin::writerLoop()
+{
+    pthread_mutex_lock(&mResourceLock);
+
+    while (true)
+    {
+        struct timespec deadline;
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        const double interval = floor(mFlushInterval);
+        deadline.tv_sec  += static_cast<time_t>(interval);
+        deadline.tv_nsec += static_cast<long>((mFlushInterval - interval) * 1.0e9);
+        if (deadline.tv_nsec >= 1000000000L)
+        {
+            deadline.tv_sec  += 1;
+            deadline.tv_nsec -= 1000000000L;
+        }
+
+        while (!mStopRequested && mPendingCount < mFlushSize)
+        {
+            if (pthread_cond_timedwait(&mFlushCond, &mResourceLock, &deadline) == ETIMEDOUT)
+            {
+                break;
+            }
+        }
+
+        if (mPendingCount > 0)
+        {
+            const int count = mPendingCount;
+            mPending.swap(mWriting);
+            mPendingCount = 0;
+            pthread_cond_broadcast(&mSpaceCond);
+            pthread_mutex_unlock(&mResourceLock);
+
+            writeBatch(mWriting, count);
+
+            pthread_mutex_lock(&mResourceLock);
+            mWrittenCount += count;
+        }
+        else if (mStopRequested)
+        {
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&mResourceLock);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Steps a prepared statement to completion and resets it for its next use.
+///
+/// @param[in] statement (--) The prepared statement, with its values bound.
+///
+/// @return  True if the statement completed, else false.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsSqlitePlugin::stepStatement(sqlite3_stmt* statement)
+{
+    const bool done = (sqlite3_step(statement) == SQLITE_DONE);
+    sqlite3_reset(statement);
+    return done;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Writes a batch of messages to the database in a single transaction.  Each message
+///          inserts its message entry if new, increments the entry's count and inserts a timestamp
+///          entry.  The message text is bound without copying, since the batch outlives the write.
+///
+/// @param[in] batch (--) The messages to write.
+/// @param[in] count (--) The number of messages at the front of the batch to write.
+///
+/// @return  True if all the messages were written, else false.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsSqlitePlugin::writeBatch(const std::vector<TsHsSqliteMsg>& batch, int count)
+{
+    char* sql_error = 0;
+    int   failures  = 0;
+
+    sqlite3_exec(mDatabaseHandle, "BEGIN TRANSACTION;", NULL, NULL, &sql_error);
+    handleSqlError(__FILE__, __LINE__, &sql_error, false);
+    mTransactionOpen = true;
+
+    for (int i = 0; i < count; ++i)
+    {
+        const TsHsSqliteMsg& message = batch[i];
+
+        // Use a hash function to generate a unique database key value.
+        long long int msg_hash;
+        msg_hash = hashString(0, message.mFile);
+        msg_hash = 101 * msg_hash + message.mLine;
+        msg_hash = hashString(msg_hash, message.mSubsys);
+        msg_hash = hashString(msg_hash, message.mText);
+
+        // This is not optimal - for new entries, we should just insert (skip the update)
+        sqlite3_bind_int64(mInsertMsgStmt, 1, msg_hash);
+        sqlite3_bind_text (mInsertMsgStmt, 2, message.mFile.c_str(),   -1, SQLITE_STATIC);
+        sqlite3_bind_int  (mInsertMsgStmt, 3, message.mLine);
+        sqlite3_bind_int  (mInsertMsgStmt, 4, message.mType);
+        sqlite3_bind_text (mInsertMsgStmt, 5, message.mSubsys.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_text (mInsertMsgStmt, 6, message.mText.c_str(),   -1, SQLITE_STATIC);
+        sqlite3_bind_int  (mInsertMsgStmt, 7, message.mMet);
+
+        sqlite3_bind_int  (mUpdateMsgStmt, 1, message.mMet);
+        sqlite3_bind_int64(mUpdateMsgStmt, 2, msg_hash);
+
+        sqlite3_bind_int64(mInsertTimeStmt, 1, msg_hash);
+        sqlite3_bind_int  (mInsertTimeStmt, 2, message.mMet);
+        sqlite3_bind_int64(mInsertTimeStmt, 3, static_cast<sqlite3_int64>(message.mTimestamp));
+
+        if (!stepStatement(mInsertMsgStmt) || !stepStatement(mUpdateMsgStmt) ||
+            !stepStatement(mInsertTimeStmt))
+        {
+            // Only report the first failure in the batch, the rest likely have the same cause.
+            if (failures == 0)
+            {
+                message_publish(MSG_ERROR, "TsHsSqlitePlugin sqlite error: %s\n", sqlite3_errmsg(mDatabaseHandle));
+            }
+            ++failures;
+        }
+    }
+
+    sqlite3_exec(mDatabaseHandle, "COMMIT;", NULL, NULL, &sql_error);
+    handleSqlError(__FILE__, __LINE__, &sql_error, false);
+    mTransactionOpen = false;
+
+    mWriteErrors += failures;
+    return (failures == 0);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details Restarts a plugin.
 ///
@@ -231,20 +519,33 @@ void TsHsSqlitePlugin::shutdown(void)
         return;
     }
 
-    // Wait on any threads that may still be logging messages
+    // Let the writer write the pending messages, then wait on any threads that may still be
+    // logging messages
+
+    stopWriter();
 
     if (pthread_mutex_lock(&mResourceLock) == 0) // 0 means lock granted
     {
+        finalizeStatements();
         sqlite3_close(mDatabaseHandle);
+        mDatabaseHandle = 0;
         pthread_mutex_unlock(&mResourceLock);
     }
 
-    mDatabaseHandle = 0;
-
     if (mTryLockFailures > 0)
     {
         message_publish(MSG_WARNING, "TsHsSqlitePlugin skipped %d messages due to mutex conflicts\n", mTryLockFailures);
     }
+
+    if (mOverflows > 0)
+    {
+        message_publish(MSG_WARNING, "TsHsSqlitePlugin skipped %d messages due to a full buffer\n", mOverflows);
+    }
+
+    if (mWriteErrors > 0)
+    {
+        message_publish(MSG_WARNING, "TsHsSqlitePlugin failed to write %d messages\n", mWriteErrors);
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -270,7 +571,8 @@ long long int TsHsSqlitePlugin::hashString(long long int salt __attribute__((unu
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details Log a health and status message to a SQLite database file.
+/// @details Log a health and status message to a SQLite database file.  The message is copied into
+///          the pending buffer and written later by the writer thread.
 ///
 /// @param[in] file      (--) name of file which initiated logging the message.
 /// @param[in] line      (--) line of file which initiated logging the message.
@@ -303,73 +605,71 @@ bool TsHsSqlitePlugin::msg(
         return false;
     }
 
-    // Use a hash function to generate a unique database key value.
-    long long int msg_hash;
-    msg_hash = hashString(0, file);
-    msg_hash = 101 * msg_hash + line;
-    msg_hash = hashString(msg_hash, subsys);
-    msg_hash = hashString(msg_hash, mtext);
-
-    // This is not optimal - for new entries, we should just insert (skip the update)
-    const char* insert_command_template =
-            // insert the hash-message entry (if it's already there, carry on)
-            "INSERT OR IGNORE INTO messages VALUES (%lld, '%q', %d, %d, '%q', '%q', 0, %d);"
-            // increment the count
-            "UPDATE messages SET count = count + 1, last_time = %d WHERE id = %lld;"
-            // insert the timestamp entry
-            "INSERT INTO timestamps VALUES (%lld, %d, %d);";
-
-    // Fill-in the command template to produce a complete SQL command
-
-    int met_seconds = static_cast<int> (floor(met.seconds));
-
-    char* insert_command = sqlite3_mprintf(insert_command_template,
-            msg_hash, file.c_str(), line, type, subsys.c_str(), mtext.c_str(), met_seconds, // INSERT
-            met_seconds, msg_hash,                                  // UPDATE
-            msg_hash, met_seconds, timestamp);                      // INSERT
-
     if (mBlocking)
     {
         // We will wait if necessary, no messages will be lost.
-        if (pthread_mutex_lock(&mResourceLock) == 0) // 0 means lock granted
+        if (pthread_mutex_lock(&mResourceLock) != 0) // 0 means lock granted
         {
-            insertMessage(insert_command);
-            pthread_mutex_unlock(&mResourceLock);
+            return true;
+        }
+
+        while (mWriterRunning && mPendingCount >= mMaxPending)
+        {
+            pthread_cond_wait(&mSpaceCond, &mResourceLock);
         }
     }
     else
     {
-        // Don't wait. Discard message if resource conflict.
-        if (pthread_mutex_trylock(&mResourceLock) == 0) // 0 means lock granted
+        // Don't wait. Discard message if resource conflict or the buffer is full.
+        if (pthread_mutex_trylock(&mResourceLock) != 0) // 0 means lock granted
         {
-            insertMessage(insert_command);
-            pthread_mutex_unlock(&mResourceLock);
-            sqlite3_free(insert_command);
+            mTryLockFailures++;
+            return true;
         }
-        else
+
+        if (mWriterRunning && mPendingCount >= mMaxPending)
         {
-            mTryLockFailures++;
+            mOverflows++;
+            pthread_mutex_unlock(&mResourceLock);
+            return true;
         }
     }
 
-    return true;
-}
+    // The database may have been closed while this caller waited
+    if (!mDatabaseHandle)
+    {
+        pthread_mutex_unlock(&mResourceLock);
+        return false;
+    }
 
-////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details Log a health and status message to a SQLite database file.
-///
-/// @param[in] insertCommand (--) sql command to insert message into database.
-////////////////////////////////////////////////////////////////////////////////////////////////////
-bool TsHsSqlitePlugin::insertMessage(char* insertCommand)
-{
-    // todo: try catch here to ensure resource unlocks if exception
-    char* sql_error;
-    // Execute the SQL command to insert the new message into the database
-    sqlite3_exec(mDatabaseHandle, "BEGIN TRANSACTION;", NULL, NULL, &sql_error);
-    sqlite3_exec(mDatabaseHandle, insertCommand, NULL, NULL, &sql_error);
-    sqlite3_exec(mDatabaseHandle, "COMMIT;", NULL, NULL, &sql_error);
-    handleSqlError(__FILE__, __LINE__, &sql_error, false);
+    // Assign into an existing buffer entry when there is one, to reuse its string storage
+    if (mPendingCount == static_cast<int>(mPending.size()))
+    {
+        mPending.push_back(TsHsSqliteMsg());
+    }
+
+    TsHsSqliteMsg& message = mPending[mPendingCount++];
+    message.mFile      = file;
+    message.mLine      = line;
+    message.mType      = type;
+    message.mSubsys    = subsys;
+    message.mMet       = static_cast<int> (floor(met.seconds));
+    message.mTimestamp = timestamp;
+    message.mText      = mtext;
+
+    if (!mWriterRunning)
+    {
+        // There is no writer thread, so write the message now
+        writeBatch(mPending, mPendingCount);
+        mWrittenCount += mPendingCount;
+        mPendingCount = 0;
+    }
+    else if (mPendingCount >= mFlushSize)
+    {
+        pthread_cond_signal(&mFlushCond);
+    }
+
+    pthread_mutex_unlock(&mResourceLock);
 
     return true;
 }
-
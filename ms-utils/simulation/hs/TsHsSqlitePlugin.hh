@@ -16,7 +16,8 @@ REFERENCE:
 - (TBD)
 
 ASSUMPTIONS AND LIMITATIONS:
-- (TBD)
+- (Messages are buffered in memory and written by a background thread, one transaction per batch, so
+   they reach the database up to the configured flush interval after they are issued.)
 
 LIBRARY DEPENDENCY:
 - (
@@ -30,12 +31,35 @@ PROGRAMMERS:
 */
 
 #include <string>
+#include <vector>
 #include <sqlite3.h>
 #include <pthread.h>
 #include "TsHsOutputPlugin.hh"
 #include "TsHsPluginConfig.hh"
 
+/// @brief A health & status message buffered by the SQLite plugin until it is written.
+struct TsHsSqliteMsg
+{
+    std::string    mFile;      // ** (--) Name of file which issued the message
+    int            mLine;      // ** (--) Line of file which issued the message
+    TS_HS_MSG_TYPE mType;      // ** (--) Type of message
+    std::string    mSubsys;    // ** (--) Subsystem from which the message originated
+    int            mMet;       // ** (s)  Whole seconds of the mission-elapsed time of the message
+    unsigned long  mTimestamp; // ** (--) Unix timestamp of the message
+    std::string    mText;      // ** (--) Message text
+};
+
 /// @brief An output plugin used to log messages to an SQLite database.
+///
+/// @details Messages are copied into a pending buffer and written by a background writer thread,
+///          so the thread issuing a message never waits on the database.  The writer swaps the
+///          pending buffer for its own and writes the batch with prepared statements in a single
+///          transaction, when the flush interval has passed or the flush size has been reached.
+///          The buffers keep their capacity between batches, so once they have grown to the size
+///          of a typical batch, messages are buffered without further allocation.
+///
+///          If the pending buffer fills faster than the writer can empty it, a blocking plugin
+///          waits for room and a non-blocking plugin discards the message.
 class TsHsSqlitePlugin: public TsHsOutputPlugin
 {
 public:
@@ -70,7 +94,29 @@ public:
 
 protected:
 
-    bool insertMessage(char* insertCommand);
+    /// @brief Prepares the SQL statements used to write messages.
+    bool prepareStatements();
+
+    /// @brief Finalizes the SQL statements used to write messages.
+    void finalizeStatements();
+
+    /// @brief Starts the background writer thread.
+    void startWriter();
+
+    /// @brief Stops the background writer thread, after it has written all pending messages.
+    void stopWriter();
+
+    /// @brief Entry point of the background writer thread.
+    static void* writerThread(void* plugin);
+
+    /// @brief Writes batches of pending messages until stopped.
+    void writerLoop();
+
+    /// @brief Writes a batch of messages to the database in a single transaction.
+    bool writeBatch(const std::vector<TsHsSqliteMsg>& batch, int count);
+
+    /// @brief Steps and resets a prepared statement.
+    bool stepStatement(sqlite3_stmt* statement);
 
     /// @brief Displays the error message and, if fatal, close the database.
     void handleSqlError(const std::string&, int, char**, bool);
@@ -91,6 +137,23 @@ protected:
     int             mTryLockFailures;  // ** (--) Number of times trylock failed to get the lock (== number of dropped messages)
     pthread_mutex_t mResourceLock;     // ** (--) Mutex which controls access to database files
     bool            mBlocking;         // ** (--) Wait on mutex if true, else skip message
+    double          mFlushInterval;    // ** (s)  Longest time messages are buffered before writing
+    int             mFlushSize;        // ** (--) Number of buffered messages that triggers a write
+    int             mMaxPending;       // ** (--) Maximum number of buffered messages
+    sqlite3_stmt*   mInsertMsgStmt;    // ** (--) Prepared statement inserting a message entry
+    sqlite3_stmt*   mUpdateMsgStmt;    // ** (--) Prepared statement updating a message entry count
+    sqlite3_stmt*   mInsertTimeStmt;   // ** (--) Prepared statement inserting a timestamp entry
+    std::vector<TsHsSqliteMsg> mPending; // ** (--) Messages waiting to be written
+    std::vector<TsHsSqliteMsg> mWriting; // ** (--) Messages being written by the writer thread
+    int             mPendingCount;     // ** (--) Number of messages in mPending
+    int             mOverflows;        // ** (--) Number of messages discarded for a full buffer
+    int             mWriteErrors;      // ** (--) Number of messages that failed to be written
+    int             mWrittenCount;     // ** (--) Number of messages the writer has finished writing
+    pthread_t       mWriter;           // ** (--) Background writer thread
+    bool            mWriterRunning;    // ** (--) True while the writer thread is running
+    bool            mStopRequested;    // ** (--) Requests the writer thread to stop
+    pthread_cond_t  mFlushCond;        // ** (--) Signals the writer thread to write messages
+    pthread_cond_t  mSpaceCond;        // ** (--) Signals blocked callers that the buffer has room
 
 private:
 
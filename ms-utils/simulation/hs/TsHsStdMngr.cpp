@@ -395,16 +395,23 @@ void TsHsStdMngr::shutdown()
         message_publish(MSG_WARNING, "TsHsMsgStdFilter skipped %d messages due to mutex conflicts\n", lock_failures);
     }
 
-    lock_failures = mMsgQueue.getLockFailures();
-    if (lock_failures > 0)
+    int queue_drops = mMsgQueue.getDrops();
+    if (queue_drops > 0)
     {
-        message_publish(MSG_WARNING, "TsHsMsgQueue skipped %d messages due to mutex conflicts\n", lock_failures);
+        message_publish(MSG_WARNING, "TsHsMsgQueue dropped %d messages while the queue was busy\n", queue_drops);
     }
 
     int queue_overwrites = mMsgQueue.getOverflows();
     if (queue_overwrites > 0)
     {
-        message_publish(MSG_WARNING, "TsHsMsgQueue overwrote %d messages due to queue overflow\n", queue_overwrites);
+        message_publish(MSG_WARNING, "TsHsMsgQueue overwrote %d messages due to queue overflow, high-water mark %d of %d\n",
+                queue_overwrites, mMsgQueue.getHighWaterMark(), mMsgQueue.getCapacity());
+    }
+
+    int queue_truncations = mMsgQueue.getTruncations();
+    if (queue_truncations > 0)
+    {
+        message_publish(MSG_WARNING, "TsHsMsgQueue truncated %d messages to fit the queue slots\n", queue_truncations);
     }
 
     mPluginMngr.shutdown();
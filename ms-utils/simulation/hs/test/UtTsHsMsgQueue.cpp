@@ -16,9 +16,38 @@ PROGRAMMERS:
 )
 *******************************************************************************/
 
+#include <cstdlib>
+#include <pthread.h>
+#include <sstream>
 #include <string>
+#include <vector>
 #include "UtTsHsMsgQueue.hh"
 
+/// @brief Arguments to a test producer thread.
+struct UtTsHsMsgQueueProducer
+{
+    TsHsMsgQueue* mQueue;     // Queue to insert into
+    int           mId;        // Producer number, sent in the message line
+    int           mCount;     // Number of messages to insert
+    volatile int* mDone;      // Count of producers finished inserting
+};
+
+/// @brief Test producer thread: inserts numbered messages, with the producer id as the line.
+static void* utTsHsMsgQueueProduce(void* arg)
+{
+    UtTsHsMsgQueueProducer* producer = static_cast<UtTsHsMsgQueueProducer*>(arg);
+    TS_TIMER_TYPE met = {0, 0, 0, 0, 0, 0.0, 0};
+    for (int i = 0; i < producer->mCount; ++i)
+    {
+        std::ostringstream text;
+        text << i;
+        producer->mQueue->insertMsg(__FILE__, producer->mId, __func__, TS_HS_WARNING,
+                                    TS_HS_GENERIC, text.str(), met, 0);
+    }
+    __sync_fetch_and_add(producer->mDone, 1);
+    return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details Required by cppunit. Called at the beginning of each testXXX method.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -173,5 +202,126 @@ void UtTsHsMsgQueue::testQueueReinitializationUpsize()
     CPPUNIT_ASSERT_EQUAL(false, msgQueue->removeMsg(node) ); // empty remove fails
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test that message fields longer than their slots are truncated, keeping the end of the
+///          file name and the start of the other fields, and counted.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgQueue::testFieldTruncation()
+{
+    TS_TIMER_TYPE met = {0, 0, 0, 0, 0, 0.0, 0};
+    const std::string longFile = std::string(300, 'd') + "/TsHsMsgQueue.cpp";
+    const std::string longText = std::string(TsHsMsgQueueSlot::TEXT_SIZE + 10, 't');
+
+    msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "short", met, 0);
+    CPPUNIT_ASSERT_EQUAL(0, msgQueue->getTruncations());
+    msgQueue->insertMsg(longFile, 7, __func__, TS_HS_INFO, TS_HS_GENERIC, longText, met, 0);
+    CPPUNIT_ASSERT_EQUAL(1, msgQueue->getTruncations());
+
+    TsHsMsgQueueNode node;
+    CPPUNIT_ASSERT_EQUAL(true, msgQueue->removeMsg(node));
+    CPPUNIT_ASSERT_EQUAL(true, std::string("short") == node.mText);
+    CPPUNIT_ASSERT_EQUAL(true, std::string(__FILE__) == node.mFile);
 
+    CPPUNIT_ASSERT_EQUAL(true, msgQueue->removeMsg(node));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(TsHsMsgQueueSlot::FILE_SIZE - 1), node.mFile.size());
+    CPPUNIT_ASSERT_EQUAL(true, longFile.substr(longFile.size() - node.mFile.size()) == node.mFile);
+    CPPUNIT_ASSERT_EQUAL(true, longText.substr(0, TsHsMsgQueueSlot::TEXT_SIZE - 1) == node.mText);
+    CPPUNIT_ASSERT_EQUAL(7, node.mLine);
+}
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test that the high-water mark records the most messages held at once, including when
+///          the queue overflows.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgQueue::testHighWaterMark()
+{
+    TS_TIMER_TYPE met = {0, 0, 0, 0, 0, 0.0, 0};
+    TsHsMsgQueueNode node;
+
+    CPPUNIT_ASSERT_EQUAL(0, msgQueue->getHighWaterMark());
+    msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "1", met, 0);
+    msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "2", met, 0);
+    msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "3", met, 0);
+    CPPUNIT_ASSERT_EQUAL(3, msgQueue->getHighWaterMark());
+
+    // Removing doesn't lower the mark.
+    msgQueue->removeMsg(node);
+    msgQueue->removeMsg(node);
+    CPPUNIT_ASSERT_EQUAL(3, msgQueue->getHighWaterMark());
+    CPPUNIT_ASSERT_EQUAL(1, msgQueue->getSize());
+
+    // Overflowing holds the mark at the capacity.
+    for (int i = 0; i < 8; ++i)
+    {
+        msgQueue->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "x", met, 0);
+    }
+    CPPUNIT_ASSERT_EQUAL(5, msgQueue->getHighWaterMark());
+    CPPUNIT_ASSERT_EQUAL(true, msgQueue->isFull());
+    CPPUNIT_ASSERT_EQUAL(4, msgQueue->getOverflows());
+    CPPUNIT_ASSERT_EQUAL(0, msgQueue->getDrops());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test several threads inserting into the queue while this thread removes. Every
+///          message is either removed, overwritten or dropped, and each producer's messages are
+///          removed in the order it inserted them.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgQueue::testConcurrentInserts()
+{
+    const int numProducers = 4;
+    const int count        = 20000;
+    msgQueue->initialize(64, false);
+
+    UtTsHsMsgQueueProducer producers[numProducers];
+    pthread_t              threads[numProducers];
+    volatile int           finished = 0;
+    for (int i = 0; i < numProducers; ++i)
+    {
+        producers[i].mQueue = msgQueue;
+        producers[i].mId    = i;
+        producers[i].mCount = count;
+        producers[i].mDone  = &finished;
+        CPPUNIT_ASSERT_EQUAL(0, pthread_create(&threads[i], 0, utTsHsMsgQueueProduce,
+                                               &producers[i]));
+    }
+
+    // Remove until all the producers are done, then once more to get their last messages.
+    std::vector<int> last(numProducers, -1);
+    int  removed = 0;
+    bool ordered = true;
+    bool done    = false;
+    TsHsMsgQueueNode node;
+    while (true)
+    {
+        if (msgQueue->removeMsg(node))
+        {
+            const bool valid = node.mLine >= 0 && node.mLine < numProducers;
+            const int  value = atoi(node.mText.c_str());
+            ordered = ordered && valid && value > last[node.mLine];
+            if (valid)
+            {
+                last[node.mLine] = value;
+            }
+            ++removed;
+        }
+        else if (done)
+        {
+            break;
+        }
+        else
+        {
+            done = (numProducers == finished);
+        }
+    }
+    for (int i = 0; i < numProducers; ++i)
+    {
+        pthread_join(threads[i], 0);
+    }
+
+    CPPUNIT_ASSERT_EQUAL(true, ordered);
+    CPPUNIT_ASSERT_EQUAL(numProducers * count,
+                         removed + msgQueue->getOverflows() + msgQueue->getDrops());
+    CPPUNIT_ASSERT_EQUAL(true, msgQueue->isEmpty());
+    CPPUNIT_ASSERT(msgQueue->getHighWaterMark() <= 64);
+    CPPUNIT_ASSERT(msgQueue->getHighWaterMark() > 0);
+}
@@ -41,6 +41,9 @@ public:
     void testOrdinaryOverflow();
     void testQueueReinitializationDownsize();
     void testQueueReinitializationUpsize();
+    void testFieldTruncation();
+    void testHighWaterMark();
+    void testConcurrentInserts();
 
 private:
 
@@ -51,6 +54,9 @@ private:
     CPPUNIT_TEST(testOrdinaryOverflow);
     CPPUNIT_TEST(testQueueReinitializationDownsize);
     CPPUNIT_TEST(testQueueReinitializationUpsize);
+    CPPUNIT_TEST(testFieldTruncation);
+    CPPUNIT_TEST(testHighWaterMark);
+    CPPUNIT_TEST(testConcurrentInserts);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -19,6 +19,7 @@ PROGRAMMERS:
 )
 *******************************************************************************/
 
+#include <sstream>
 #include "UtTsHsMsgStdFilter.hh"
 #include "TsHsMsgStdFilter.hh"
 
@@ -248,3 +249,111 @@ void UtTsHsMsgStdFilter::testTypeFilter()
 
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test that messages are still tracked when the history and count are raised past the
+///          filter's initial table and ring sizes, and after many messages have been bumped from
+///          the table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgStdFilter::testTableGrowth()
+{
+    msgFilter->setInterval(10);
+    msgFilter->setCount(1);
+    msgFilter->setHistory(100); // More messages than the initial table holds
+
+    std::vector<std::string> messages;
+    for (int i = 0; i < 100; ++i)
+    {
+        std::ostringstream oss;
+        oss << "M" << i;
+        messages.push_back(oss.str());
+    }
+
+    // 100 unique messages are all displayed, then their duplicates are all suppressed.
+    for (int i = 0; i < 100; ++i)
+    {
+        msgFilter->shouldSendMessage(1.00, "file", 123, TS_HS_WARNING, "subsys", messages[i]);
+    }
+    for (int i = 0; i < 100; ++i)
+    {
+        msgFilter->shouldSendMessage(2.00, "file", 123, TS_HS_WARNING, "subsys", messages[i]);
+    }
+
+    CPPUNIT_ASSERT_EQUAL(200, msgFilter->getMessagesProcessed());
+    CPPUNIT_ASSERT_EQUAL(100, msgFilter->getMessagesSuppressed());
+
+    // Raising the count keeps the display times so far, so 2 more of each are displayed.
+    msgFilter->setCount(3);
+    for (double time = 3.00; time < 5.50; time += 1.0)
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            msgFilter->shouldSendMessage(time, "file", 123, TS_HS_WARNING, "subsys", messages[i]);
+        }
+    }
+
+    CPPUNIT_ASSERT_EQUAL(500, msgFilter->getMessagesProcessed());
+    CPPUNIT_ASSERT_EQUAL(200, msgFilter->getMessagesSuppressed());
+
+    // Lowering the history bumps the old messages as new ones arrive.  The new messages are still
+    // found after all the removals, so only their 4th time in the interval is suppressed.
+    msgFilter->setHistory(10);
+    const double times[] = {6.0, 6.5, 6.6, 6.7};
+    for (int t = 0; t < 4; ++t)
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            msgFilter->shouldSendMessage(times[t], "file", 456, TS_HS_WARNING, "subsys",
+                                         messages[i]);
+        }
+    }
+
+    CPPUNIT_ASSERT_EQUAL(540, msgFilter->getMessagesProcessed());
+    CPPUNIT_ASSERT_EQUAL(210, msgFilter->getMessagesSuppressed());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Tests that a message whose hash collides with a different message in the table is
+///          not filtered as that message, since its line and text length don't match.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgStdFilter::testHashCollision()
+{
+    FriendlyTsHsMsgStdFilter article;
+    article.init();
+    article.setInterval(10);
+    article.setCount(1);
+
+    CPPUNIT_ASSERT(article.shouldSendMessage(1.00, "file", 10, TS_HS_WARNING, "subsys", "abc"));
+
+    // Move message A into the table under message B's hash, as if their hashes had collided.
+    const unsigned long long hashA =
+            FriendlyTsHsMsgStdFilter::hashMessage("file", 10, "subsys", "abc");
+    const unsigned long long hashB =
+            FriendlyTsHsMsgStdFilter::hashMessage("file", 20, "subsys", "abcd");
+    const int indexA = article.findEntry(hashA, 10, 3);
+    CPPUNIT_ASSERT(article.mEntries[indexA].mUsed);
+
+    TsHsMsgFilterEntry entry = article.mEntries[indexA];
+    std::vector<double> times(article.mTimes.begin() + indexA * article.mRingSize,
+                              article.mTimes.begin() + (indexA + 1) * article.mRingSize);
+    article.removeEntry(indexA);
+
+    const int indexB = article.findEntry(hashB, 10, 3);
+    CPPUNIT_ASSERT(!article.mEntries[indexB].mUsed);
+    entry.mHash = hashB;
+    article.mEntries[indexB] = entry;
+    for (int j = 0; j < article.mRingSize; ++j)
+    {
+        article.mTimes[indexB * article.mRingSize + j] = times[j];
+    }
+    ++article.mNumEntries;
+
+    // Message B isn't suppressed by message A's entry, and gets its own entry.
+    CPPUNIT_ASSERT(article.shouldSendMessage(2.00, "file", 20, TS_HS_WARNING, "subsys", "abcd"));
+    CPPUNIT_ASSERT_EQUAL(2, article.mNumEntries);
+    CPPUNIT_ASSERT_EQUAL(0, article.getMessagesSuppressed());
+
+    // Message B is found and suppressed on its repeat, and message A's entry is kept.
+    CPPUNIT_ASSERT(!article.shouldSendMessage(3.00, "file", 20, TS_HS_WARNING, "subsys", "abcd"));
+    CPPUNIT_ASSERT_EQUAL(indexB, article.findEntry(hashB, 10, 3));
+    CPPUNIT_ASSERT_EQUAL(1, article.getMessagesSuppressed());
+}
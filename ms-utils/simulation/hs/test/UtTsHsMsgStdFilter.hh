@@ -24,7 +24,16 @@ PROGRAMMERS:
 #include <cppunit/extensions/HelperMacros.h>
 #include <cppunit/TestFixture.h>
 
-class TsHsMsgStdFilter;
+#include "TsHsMsgStdFilter.hh"
+
+/// @brief Inherit from TsHsMsgStdFilter and befriend UtTsHsMsgStdFilter to expose its members.
+class FriendlyTsHsMsgStdFilter : public TsHsMsgStdFilter
+{
+public:
+    FriendlyTsHsMsgStdFilter() : TsHsMsgStdFilter() {}
+    virtual ~FriendlyTsHsMsgStdFilter() {}
+    friend class UtTsHsMsgStdFilter;
+};
 
 /// @brief Unit test for TsHsMsgStdFilter, i.e. the health and status message filter
 class UtTsHsMsgStdFilter: public CppUnit::TestFixture
@@ -42,6 +51,8 @@ public:
     void testSettersRuntime();
     void testRedundancyFilter();
     void testTypeFilter();
+    void testTableGrowth();
+    void testHashCollision();
 
 private:
 
@@ -52,6 +63,8 @@ private:
     CPPUNIT_TEST(testSettersRuntime);
     CPPUNIT_TEST(testRedundancyFilter);
     CPPUNIT_TEST(testTypeFilter);
+    CPPUNIT_TEST(testTableGrowth);
+    CPPUNIT_TEST(testHashCollision);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -0,0 +1,338 @@
+/********************************* TRICK HEADER *******************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+    (Unit test class for TsHsSqlitePlugin class)
+
+LIBRARY DEPENDENCY:
+(
+    (simulation/hs/TsHsSqlitePlugin.o)
+)
+
+PROGRAMMERS:
+(
+    ((agent) (agent@local) (October 2026))
+)
+*******************************************************************************/
+
+#include <cstdio>
+#include <ctime>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <sqlite3.h>
+#include "TS_hs_msg_types.h"
+#include "UtTsHsSqlitePlugin.hh"
+
+/// @brief Database file written by the tests.
+static const char* UT_TS_HS_SQLITE_DB = "UtTsHsSqlitePlugin.db";
+
+/// @brief Returns the monotonic wall clock time in seconds.
+static double utTsHsSqliteClock()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<double>(now.tv_sec) + 1.0e-9 * static_cast<double>(now.tv_nsec);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Required by cppunit. Called at the beginning of each testXXX method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::setUp()
+{
+    remove(UT_TS_HS_SQLITE_DB);
+    plugin = new FriendlyTsHsSqlitePlugin(0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Required by cppunit. Called at the end of each testXXX method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::tearDown()
+{
+    delete plugin;
+    remove(UT_TS_HS_SQLITE_DB);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Configures the plugin to write the test database with the given flush settings.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::configure(FriendlyTsHsSqlitePlugin* article, int flushSize,
+                                   double flushInterval)
+{
+    TsHsPluginConfig config;
+    config.mEnabled       = true;
+    config.mOverwrite     = true;
+    config.mPath          = UT_TS_HS_SQLITE_DB;
+    config.mBlocking      = true;
+    config.mFlushSize     = flushSize;
+    config.mFlushInterval = flushInterval;
+    article->configure(config);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Sends the given number of messages from the given line, each with a different text.
+///          The line is also in the text, since the text alone keys the message entries.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::sendMsgs(FriendlyTsHsSqlitePlugin* article, int count, int line)
+{
+    TS_TIMER_TYPE met = {0, 0, 0, 0, 0, 0.0, 0};
+    for (int i = 0; i < count; ++i)
+    {
+        std::ostringstream text;
+        text << "line " << line << " message " << i;
+        CPPUNIT_ASSERT(article->msg(__FILE__, line, __func__, TS_HS_WARNING, TS_HS_GENERIC, met, 0,
+                                    text.str()));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Waits up to the timeout for the writer to have written the given number of messages.
+///
+/// @return  True if the messages were written in time.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool UtTsHsSqlitePlugin::waitForWritten(FriendlyTsHsSqlitePlugin* article, int count,
+                                        double timeout)
+{
+    const double start = utTsHsSqliteClock();
+    while (true)
+    {
+        pthread_mutex_lock(&article->mResourceLock);
+        const int written = article->mWrittenCount;
+        pthread_mutex_unlock(&article->mResourceLock);
+        if (written >= count)
+        {
+            return true;
+        }
+        if (utTsHsSqliteClock() - start > timeout)
+        {
+            return false;
+        }
+        usleep(1000);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Returns the number of messages buffered and not yet taken by the writer.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int UtTsHsSqlitePlugin::pendingCount(FriendlyTsHsSqlitePlugin* article)
+{
+    pthread_mutex_lock(&article->mResourceLock);
+    const int pending = article->mPendingCount;
+    pthread_mutex_unlock(&article->mResourceLock);
+    return pending;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Runs a query returning a single integer on the test database, through a separate
+///          connection.  Only called while the writer is idle, so it doesn't contend for the file.
+///
+/// @return  The query result.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int UtTsHsSqlitePlugin::queryInt(const std::string& sql)
+{
+    sqlite3*      db        = 0;
+    sqlite3_stmt* statement = 0;
+    int           result    = -1;
+    CPPUNIT_ASSERT_EQUAL(SQLITE_OK, sqlite3_open_v2(UT_TS_HS_SQLITE_DB, &db, SQLITE_OPEN_READONLY,
+                                                    NULL));
+    if (sqlite3_prepare_v2(db, sql.c_str(), -1, &statement, NULL) == SQLITE_OK &&
+        sqlite3_step(statement) == SQLITE_ROW)
+    {
+        result = sqlite3_column_int(statement, 0);
+    }
+    sqlite3_finalize(statement);
+    sqlite3_close(db);
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test the flush interval & size configuration keys and their defaults.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::testConfig()
+{
+    // Configuration defaults
+    TsHsPluginConfig config;
+    CPPUNIT_ASSERT_EQUAL(1.0, config.mFlushInterval);
+    CPPUNIT_ASSERT_EQUAL(256, config.mFlushSize);
+
+    // Plugin defaults before configuration
+    CPPUNIT_ASSERT_EQUAL(1.0,  plugin->mFlushInterval);
+    CPPUNIT_ASSERT_EQUAL(256,  plugin->mFlushSize);
+    CPPUNIT_ASSERT_EQUAL(4096, plugin->mMaxPending);
+    CPPUNIT_ASSERT(0 == plugin->mInsertMsgStmt);
+    CPPUNIT_ASSERT(!plugin->mWriterRunning);
+
+    // Configured values, with room for several batches
+    config.mEnabled       = true;
+    config.mPath          = UT_TS_HS_SQLITE_DB;
+    config.mBlocking      = true;
+    config.mFlushInterval = 0.25;
+    config.mFlushSize     = 32;
+    plugin->configure(config);
+    CPPUNIT_ASSERT_EQUAL(true,                    plugin->mEnabled);
+    CPPUNIT_ASSERT_EQUAL(std::string(UT_TS_HS_SQLITE_DB), plugin->mFilename);
+    CPPUNIT_ASSERT_EQUAL(true,                    plugin->mBlocking);
+    CPPUNIT_ASSERT_EQUAL(0.25,                    plugin->mFlushInterval);
+    CPPUNIT_ASSERT_EQUAL(32,                      plugin->mFlushSize);
+    CPPUNIT_ASSERT_EQUAL(16 * 32,                 plugin->mMaxPending);
+
+    // Invalid values fall back to a 1 second interval and writing every message
+    config.mFlushInterval = 0.0;
+    config.mFlushSize     = -5;
+    plugin->configure(config);
+    CPPUNIT_ASSERT_EQUAL(1.0, plugin->mFlushInterval);
+    CPPUNIT_ASSERT_EQUAL(1,   plugin->mFlushSize);
+    CPPUNIT_ASSERT_EQUAL(16,  plugin->mMaxPending);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test messages are buffered below the flush size and written when it is reached, with
+///          stored row counts checked after each flush and after shutdown.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::testBatchSize()
+{
+    // A long flush interval so only the flush size triggers writes
+    configure(plugin, 10, 60.0);
+    CPPUNIT_ASSERT(plugin->init());
+    CPPUNIT_ASSERT(plugin->mWriterRunning);
+
+    // Below the flush size, nothing is written
+    sendMsgs(plugin, 9, 1);
+    usleep(100000);
+    CPPUNIT_ASSERT_EQUAL(9, pendingCount(plugin));
+    CPPUNIT_ASSERT_EQUAL(0, plugin->mWrittenCount);
+    CPPUNIT_ASSERT_EQUAL(0, queryInt("SELECT COUNT(*) FROM timestamps;"));
+
+    // Reaching the flush size writes the batch
+    sendMsgs(plugin, 1, 2);
+    CPPUNIT_ASSERT(waitForWritten(plugin, 10, 5.0));
+    CPPUNIT_ASSERT_EQUAL(0,  pendingCount(plugin));
+    CPPUNIT_ASSERT_EQUAL(10, queryInt("SELECT COUNT(*) FROM timestamps;"));
+    CPPUNIT_ASSERT_EQUAL(10, queryInt("SELECT COUNT(*) FROM messages;"));
+
+    // Above the flush size, the writer takes all the buffered messages
+    sendMsgs(plugin, 15, 3);
+    CPPUNIT_ASSERT(waitForWritten(plugin, 25, 5.0));
+    CPPUNIT_ASSERT_EQUAL(0,  pendingCount(plugin));
+    CPPUNIT_ASSERT_EQUAL(25, queryInt("SELECT COUNT(*) FROM timestamps;"));
+
+    // Below the flush size again, messages stay buffered until shutdown writes them
+    sendMsgs(plugin, 4, 4);
+    usleep(100000);
+    CPPUNIT_ASSERT_EQUAL(4,  pendingCount(plugin));
+    CPPUNIT_ASSERT_EQUAL(25, queryInt("SELECT COUNT(*) FROM timestamps;"));
+    plugin->shutdown();
+    CPPUNIT_ASSERT(!plugin->mWriterRunning);
+    CPPUNIT_ASSERT(0 == plugin->mDatabaseHandle);
+    CPPUNIT_ASSERT_EQUAL(29, plugin->mWrittenCount);
+    CPPUNIT_ASSERT_EQUAL(0,  plugin->mWriteErrors);
+    CPPUNIT_ASSERT_EQUAL(0,  plugin->mOverflows);
+    CPPUNIT_ASSERT_EQUAL(29, queryInt("SELECT COUNT(*) FROM timestamps;"));
+    CPPUNIT_ASSERT_EQUAL(29, queryInt("SELECT SUM(count) FROM messages;"));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test messages below the flush size are written once the flush interval has passed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::testFlushInterval()
+{
+    configure(plugin, 1000, 0.2);
+    CPPUNIT_ASSERT(plugin->init());
+
+    const double start = utTsHsSqliteClock();
+    sendMsgs(plugin, 3, 1);
+    CPPUNIT_ASSERT(waitForWritten(plugin, 3, 5.0));
+    CPPUNIT_ASSERT(utTsHsSqliteClock() - start < 5.0);
+    CPPUNIT_ASSERT_EQUAL(0, pendingCount(plugin));
+    CPPUNIT_ASSERT_EQUAL(3, queryInt("SELECT COUNT(*) FROM timestamps;"));
+
+    // The next interval writes the next messages
+    sendMsgs(plugin, 2, 2);
+    CPPUNIT_ASSERT(waitForWritten(plugin, 5, 5.0));
+    CPPUNIT_ASSERT_EQUAL(5, queryInt("SELECT COUNT(*) FROM timestamps;"));
+
+    plugin->shutdown();
+    CPPUNIT_ASSERT_EQUAL(5, plugin->mWrittenCount);
+    CPPUNIT_ASSERT_EQUAL(5, queryInt("SELECT COUNT(*) FROM timestamps;"));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test shutdown writes all buffered messages before closing the database, and messages
+///          issued after shutdown are refused.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::testShutdownFlush()
+{
+    configure(plugin, 100, 60.0);
+    CPPUNIT_ASSERT(plugin->init());
+
+    sendMsgs(plugin, 50, 1);
+    CPPUNIT_ASSERT_EQUAL(50, pendingCount(plugin));
+    plugin->shutdown();
+    CPPUNIT_ASSERT_EQUAL(0,  plugin->mPendingCount);
+    CPPUNIT_ASSERT_EQUAL(50, plugin->mWrittenCount);
+    CPPUNIT_ASSERT_EQUAL(50, queryInt("SELECT COUNT(*) FROM timestamps;"));
+    CPPUNIT_ASSERT_EQUAL(50, queryInt("SELECT COUNT(*) FROM messages;"));
+
+    TS_TIMER_TYPE met = {0, 0, 0, 0, 0, 0.0, 0};
+    CPPUNIT_ASSERT(!plugin->msg(__FILE__, __LINE__, __func__, TS_HS_WARNING, TS_HS_GENERIC, met, 0,
+                                "after shutdown"));
+    CPPUNIT_ASSERT_EQUAL(50, queryInt("SELECT COUNT(*) FROM timestamps;"));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test destroying a plugin that wasn't shut down writes all buffered messages.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::testDestructorFlush()
+{
+    FriendlyTsHsSqlitePlugin* article = new FriendlyTsHsSqlitePlugin(1);
+    configure(article, 100, 60.0);
+    CPPUNIT_ASSERT(article->init());
+
+    sendMsgs(article, 30, 1);
+    CPPUNIT_ASSERT_EQUAL(30, pendingCount(article));
+    delete article;
+    CPPUNIT_ASSERT_EQUAL(30, queryInt("SELECT COUNT(*) FROM timestamps;"));
+    CPPUNIT_ASSERT_EQUAL(30, queryInt("SELECT SUM(count) FROM messages;"));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test the prepared statements are reused for every batch, and repeated messages update
+///          their single message entry.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsSqlitePlugin::testStatementReuse()
+{
+    configure(plugin, 5, 60.0);
+    CPPUNIT_ASSERT(plugin->init());
+    sqlite3_stmt* insertMsg  = plugin->mInsertMsgStmt;
+    sqlite3_stmt* updateMsg  = plugin->mUpdateMsgStmt;
+    sqlite3_stmt* insertTime = plugin->mInsertTimeStmt;
+    CPPUNIT_ASSERT(0 != insertMsg);
+    CPPUNIT_ASSERT(0 != updateMsg);
+    CPPUNIT_ASSERT(0 != insertTime);
+
+    // Three batches of the same message
+    TS_TIMER_TYPE met = {0, 0, 0, 0, 0, 0.0, 0};
+    for (int i = 0; i < 15; ++i)
+    {
+        CPPUNIT_ASSERT(plugin->msg(__FILE__, 1, __func__, TS_HS_WARNING, TS_HS_GENERIC, met, 0,
+                                   "repeated"));
+    }
+    CPPUNIT_ASSERT(waitForWritten(plugin, 15, 5.0));
+
+    CPPUNIT_ASSERT(insertMsg  == plugin->mInsertMsgStmt);
+    CPPUNIT_ASSERT(updateMsg  == plugin->mUpdateMsgStmt);
+    CPPUNIT_ASSERT(insertTime == plugin->mInsertTimeStmt);
+    CPPUNIT_ASSERT(!sqlite3_stmt_busy(insertMsg));
+    CPPUNIT_ASSERT(!sqlite3_stmt_busy(updateMsg));
+    CPPUNIT_ASSERT(!sqlite3_stmt_busy(insertTime));
+    CPPUNIT_ASSERT_EQUAL(1,  queryInt("SELECT COUNT(*) FROM messages;"));
+    CPPUNIT_ASSERT_EQUAL(15, queryInt("SELECT count FROM messages;"));
+    CPPUNIT_ASSERT_EQUAL(15, queryInt("SELECT COUNT(*) FROM timestamps;"));
+
+    // Shutdown finalizes the statements
+    plugin->shutdown();
+    CPPUNIT_ASSERT(0 == plugin->mInsertMsgStmt);
+    CPPUNIT_ASSERT(0 == plugin->mUpdateMsgStmt);
+    CPPUNIT_ASSERT(0 == plugin->mInsertTimeStmt);
+}
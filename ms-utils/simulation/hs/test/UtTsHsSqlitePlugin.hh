@@ -0,0 +1,82 @@
+/********************************* TRICK HEADER *******************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+    (Unit test class for TsHsSqlitePlugin class)
+
+LIBRARY DEPENDENCY:
+(
+    (simulation/hs/TsHsSqlitePlugin.o)
+)
+
+PROGRAMMERS:
+(
+    ((agent) (agent@local) (October 2026))
+)
+*******************************************************************************/
+#ifndef UtTsHsSqlitePlugin_EXISTS
+#define UtTsHsSqlitePlugin_EXISTS
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include <string>
+#include "TsHsSqlitePlugin.hh"
+
+/// @brief Inherit from TsHsSqlitePlugin and befriend UtTsHsSqlitePlugin to expose its members.
+class FriendlyTsHsSqlitePlugin : public TsHsSqlitePlugin
+{
+public:
+    FriendlyTsHsSqlitePlugin(int id) : TsHsSqlitePlugin(id) {}
+    virtual ~FriendlyTsHsSqlitePlugin() {}
+    friend class UtTsHsSqlitePlugin;
+};
+
+/// @brief Unit test for TsHsSqlitePlugin, i.e. the health and status SQLite output plugin
+class UtTsHsSqlitePlugin: public CppUnit::TestFixture
+{
+public:
+
+    // Ctor not really needed here, but gets rid of some compiler warnings
+    UtTsHsSqlitePlugin() : CppUnit::TestFixture(), plugin(0) {}
+
+    void setUp();
+    void tearDown();
+
+    void testConfig();
+    void testBatchSize();
+    void testFlushInterval();
+    void testShutdownFlush();
+    void testDestructorFlush();
+    void testStatementReuse();
+
+private:
+
+    CPPUNIT_TEST_SUITE(UtTsHsSqlitePlugin);
+
+    CPPUNIT_TEST(testConfig);
+    CPPUNIT_TEST(testBatchSize);
+    CPPUNIT_TEST(testFlushInterval);
+    CPPUNIT_TEST(testShutdownFlush);
+    CPPUNIT_TEST(testDestructorFlush);
+    CPPUNIT_TEST(testStatementReuse);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // Helpers
+    void configure(FriendlyTsHsSqlitePlugin* article, int flushSize, double flushInterval);
+    void sendMsgs(FriendlyTsHsSqlitePlugin* article, int count, int line);
+    bool waitForWritten(FriendlyTsHsSqlitePlugin* article, int count, double timeout);
+    int  pendingCount(FriendlyTsHsSqlitePlugin* article);
+    int  queryInt(const std::string& sql);
+
+    // Data members
+    FriendlyTsHsSqlitePlugin* plugin;
+
+    // Disable these to prevent compiler warnings about them being not implemented
+    UtTsHsSqlitePlugin(const UtTsHsSqlitePlugin&);
+    const UtTsHsSqlitePlugin& operator=(const UtTsHsSqlitePlugin&);
+};
+
+#endif /* UtTsHsSqlitePlugin_EXISTS */
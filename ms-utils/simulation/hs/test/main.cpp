@@ -20,6 +20,7 @@ PROGRAMMERS:
 #include "UT_TS_hs.hh"
 #include "UtTsHsMsgStdFilter.hh"
 #include "UtTsHsMsgQueue.hh"
+#include "UtTsHsSqlitePlugin.hh"
 
 #include <cppunit/XmlOutputter.h>
 #include <cppunit/TestResult.h>
@@ -49,6 +50,7 @@ int main(int argc, char** argv) {
     runner.addTest(UT_TS_hs::suite());
     runner.addTest(UtTsHsMsgStdFilter::suite());
     runner.addTest(UtTsHsMsgQueue::suite());
+    runner.addTest(UtTsHsSqlitePlugin::suite());
 
     runner.run(testresult);
     // Output results in compiler format
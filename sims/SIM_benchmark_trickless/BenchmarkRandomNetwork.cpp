@@ -0,0 +1,214 @@
+/**
+@file
+@brief     GUNNS Benchmark Random Network implementation.
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((core/network/GunnsNetworkBase.o)
+   (core/GunnsBasicCapacitor.o)
+   (core/GunnsBasicConductor.o)
+   (core/GunnsBasicPotential.o))
+*/
+
+#include "BenchmarkRandomNetwork.hh"
+#include "core/GunnsMacros.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <sstream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name  (--)  Name of the network for H&S messages.
+///
+/// @details  Default constructs this Benchmark Random Network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+BenchmarkRandomNetwork::BenchmarkRandomNetwork(const std::string& name)
+    :
+    GunnsNetworkBase(name, 0, 0),
+    mNumNodes(100),
+    mNumIslands(1),
+    mDegree(3.0),
+    mSeed(1),
+    mNodes(0),
+    mConductors(0),
+    mCapacitors(0),
+    mPotentials(0),
+    mNumConductors(0),
+    mDitherCount(0),
+    mSolverConfig(name + ".netSolver", 1.0, 1.0E-6, 1, 1),
+    mRandom(1)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Benchmark Random Network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+BenchmarkRandomNetwork::~BenchmarkRandomNetwork()
+{
+    TS_DELETE_ARRAY(mPotentials);
+    TS_DELETE_ARRAY(mCapacitors);
+    TS_DELETE_ARRAY(mConductors);
+    TS_DELETE_ARRAY(mNodes);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  range  (--)  Upper limit of the returned value, exclusive.
+///
+/// @returns  int  (--)  The next random integer in [0, range).
+///
+/// @details  Advances the linear congruential generator and scales its high bits into the range.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int BenchmarkRandomNetwork::nextRandom(const int range)
+{
+    mRandom = mRandom * 1103515245u + 12345u;
+    return static_cast<int>((static_cast<double>(mRandom >> 8) / 16777216.0) * range);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  island  (--)  Index of the island.
+/// @param[out] first   (--)  Index of the first node in the island.
+/// @param[out] size    (--)  Number of nodes in the island.
+///
+/// @details  Islands are contiguous ranges of nodes, with any remainder nodes in the last island.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkRandomNetwork::getIsland(const int island, int& first, int& size) const
+{
+    const int nominal = mNumNodes / mNumIslands;
+    first = island * nominal;
+    size  = (island == mNumIslands - 1) ? mNumNodes - first : nominal;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name  (--)  Name of the network for H&S messages.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Checks the parameters, then allocates and initializes the nodes, with ground last.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkRandomNetwork::initNodes(const std::string& name)
+{
+    if (mNumNodes < 1 or mNumIslands < 1 or mNumIslands > mNumNodes or mDegree < 0.0) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "invalid size, islands or degree.");
+    }
+
+    TS_DELETE_ARRAY(mNodes);
+    TS_NEW_CLASS_ARRAY_EXT(mNodes, mNumNodes + 1, GunnsBasicNode, (), name + ".mNodes");
+    netNodeList.mNumNodes = mNumNodes + 1;
+    netNodeList.mNodes    = mNodes;
+    netNumLocalNodes      = mNumNodes + 1;
+    for (int i = 0; i < mNumNodes; ++i) {
+        mNodes[i].initialize(name + createNodeName(i), 300.0);
+    }
+    mNodes[mNumNodes].initialize(name + ".GROUND");
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Generates the links from the seed and initializes them and the solver.  Each island
+///           gets a spanning tree joining each node to a random earlier node in the island, then
+///           extra conductors between random pairs of distinct nodes in the islands in turn, until
+///           the network has the average degree.  Islands of a single node get no conductors.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkRandomNetwork::initNetwork()
+{
+    const int ground = mNumNodes;
+    mRandom      = mSeed;
+    mDitherCount = 0;
+
+    /// - Size the conductors from the degree: a tree of size-1 conductors spans each island.
+    const int treeConductors = mNumNodes - mNumIslands;
+    const int totalConductors = static_cast<int>(0.5 * mDegree * mNumNodes + 0.5);
+    const int extraConductors = (mNumNodes > mNumIslands and totalConductors > treeConductors)
+                              ? totalConductors - treeConductors : 0;
+    mNumConductors = treeConductors + extraConductors;
+
+    TS_DELETE_ARRAY(mPotentials);
+    TS_DELETE_ARRAY(mCapacitors);
+    TS_DELETE_ARRAY(mConductors);
+    TS_NEW_CLASS_ARRAY_EXT(mConductors, mNumConductors, GunnsBasicConductor, (),
+                           mName + ".mConductors");
+    TS_NEW_CLASS_ARRAY_EXT(mCapacitors, mNumNodes,      GunnsBasicCapacitor, (),
+                           mName + ".mCapacitors");
+    TS_NEW_CLASS_ARRAY_EXT(mPotentials, mNumIslands,    GunnsBasicPotential, (),
+                           mName + ".mPotentials");
+
+    GunnsBasicConductorConfigData condConfig(mName + ".mConductors", &netNodeList, 1.0);
+    GunnsBasicConductorInputData  condInput(false, 0.0);
+    GunnsBasicCapacitorConfigData capConfig(mName + ".mCapacitors", &netNodeList);
+    GunnsBasicCapacitorInputData  capInput(false, 0.0, 1.0, 300.0);
+    GunnsBasicPotentialConfigData potConfig(mName + ".mPotentials", &netNodeList, 1.0);
+    GunnsBasicPotentialInputData  potInput(false, 0.0, 300.0);
+
+    netLinks.clear();
+    int link = 0;
+    for (int island = 0; island < mNumIslands; ++island) {
+        int first = 0;
+        int size  = 0;
+        getIsland(island, first, size);
+        for (int node = 1; node < size; ++node) {
+            std::ostringstream linkName;
+            linkName << mName << ".mConductors_" << link;
+            condConfig.mName = linkName.str();
+            mConductors[link++].initialize(condConfig, condInput, netLinks,
+                                           first + nextRandom(node), first + node);
+        }
+
+        /// - The island's boundary potential differs by island, so they carry different flows.
+        std::ostringstream potName;
+        potName << mName << ".mPotentials_" << island;
+        potConfig.mName = potName.str();
+        potInput.mSourcePotential = 250.0 + nextRandom(100);
+        mPotentials[island].initialize(potConfig, potInput, netLinks, ground, first);
+    }
+
+    for (int extra = 0; extra < extraConductors; ++extra) {
+        int first = 0;
+        int size  = 0;
+        for (int island = extra % mNumIslands; ; island = (island + 1) % mNumIslands) {
+            getIsland(island, first, size);
+            if (size > 1) {
+                break;
+            }
+        }
+        const int port0 = nextRandom(size);
+        const int port1 = (port0 + 1 + nextRandom(size - 1)) % size;
+        std::ostringstream linkName;
+        linkName << mName << ".mConductors_" << link;
+        condConfig.mName = linkName.str();
+        mConductors[link++].initialize(condConfig, condInput, netLinks, first + port0,
+                                       first + port1);
+    }
+
+    for (int node = 0; node < mNumNodes; ++node) {
+        std::ostringstream linkName;
+        linkName << mName << ".mCapacitors_" << node;
+        capConfig.mName = linkName.str();
+        mCapacitors[node].initialize(capConfig, capInput, netLinks, node, ground);
+    }
+
+    /// - Initialize the solver, only if this is not a sub-network.
+    if (not netIsSubNetwork) {
+        mSolverConfig.mName = mName + ".netSolver";
+        netSolver.initializeNodes(netNodeList);
+        netSolver.initialize(mSolverConfig, netLinks);
+        if (mNumIslands > 1) {
+            netSolver.setIslandMode(Gunns::SOLVE);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] timeStep (s) Integration time step.
+///
+/// @details  Restores the last dithered conductor and raises the next one's conductivity by 1%, so
+///           the admittance matrix changes every step, cycling through all the conductors.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkRandomNetwork::stepSpottersPre(const double timeStep)
+{
+    if (mNumConductors > 0) {
+        mConductors[mDitherCount % mNumConductors].setDefaultConductivity(1.0);
+        ++mDitherCount;
+        mConductors[mDitherCount % mNumConductors].setDefaultConductivity(1.01);
+    }
+}
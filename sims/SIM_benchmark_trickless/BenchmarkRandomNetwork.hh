@@ -0,0 +1,87 @@
+#ifndef BenchmarkRandomNetwork_EXISTS
+#define BenchmarkRandomNetwork_EXISTS
+
+/**
+@file
+@brief     GUNNS Benchmark Random Network declarations.
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE: (A GUNNS basic network generated from a seed, with a given number of nodes, islands and
+          average node degree, for benchmarking the solver on reproducible network topologies.)
+
+REFERENCE: ()
+
+ASSUMPTIONS AND LIMITATIONS:
+  ((The same parameters and seed always generate the same network on any platform, since the
+    generator is a fixed linear congruential sequence rather than the C library rand.))
+
+LIBRARY DEPENDENCY:
+  ((BenchmarkRandomNetwork.o))
+
+PROGRAMMERS:
+  ((agent) (agent@local) (2026-10) (Initial))
+*/
+
+#include "core/network/GunnsNetworkBase.hh"
+#include "core/GunnsBasicCapacitor.hh"
+#include "core/GunnsBasicConductor.hh"
+#include "core/GunnsBasicNode.hh"
+#include "core/GunnsBasicPotential.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Benchmark Random Network
+///
+/// @details  A basic network of capacitive nodes split evenly into islands.  Each island's nodes
+///           are joined by a random spanning tree of conductors, plus random extra conductors
+///           within the island up to the average node degree, so the degree sets the admittance
+///           matrix sparsity.  The first node of each island is held by a potential link to
+///           ground, and every node has a capacitor to ground.  Each step one conductor is
+///           dithered in conductivity, so the admittance matrix changes and is re-decomposed every
+///           major step as in a network with non-linear links.
+///
+///           Set the parameters before calling initialize.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class BenchmarkRandomNetwork : public GunnsNetworkBase
+{
+    TS_MAKE_SIM_COMPATIBLE(BenchmarkRandomNetwork);
+
+    public:
+        int                           mNumNodes;       /**< (--) Number of non-ground nodes. */
+        int                           mNumIslands;     /**< (--) Number of islands to split into. */
+        double                        mDegree;         /**< (--) Mean conductors per node. */
+        unsigned int                  mSeed;           /**< (--) Random generator seed. */
+        GunnsBasicNode*               mNodes;          /**< (--) Network nodes, ground last. */
+        GunnsBasicConductor*          mConductors;     /**< (--) Conductor links. */
+        GunnsBasicCapacitor*          mCapacitors;     /**< (--) Capacitor links, one per node. */
+        GunnsBasicPotential*          mPotentials;     /**< (--) Potential links, one per island. */
+        int                           mNumConductors;  /**< (--) Number of conductor links. */
+        int                           mDitherCount;    /**< (--) Count of dithered steps. */
+        GunnsConfigData               mSolverConfig;   /**< (--) Network solver config data. */
+        /// @brief  Default constructor.
+        BenchmarkRandomNetwork(const std::string& name = "");
+        /// @brief  Default destructor.
+        virtual ~BenchmarkRandomNetwork();
+        /// @brief  Allocates and initializes the network nodes.
+        virtual void initNodes(const std::string& name);
+        /// @brief  Generates and initializes the network links and solver.
+        virtual void initNetwork();
+        /// @brief  Dithers one conductor before the solver step.
+        virtual void stepSpottersPre(const double timeStep);
+
+    protected:
+        unsigned int                  mRandom;         /**< (--) Random generator state. */
+        /// @brief  Returns the next random integer in [0, range).
+        int  nextRandom(const int range);
+        /// @brief  Returns the first node and number of nodes in the given island.
+        void getIsland(const int island, int& first, int& size) const;
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        BenchmarkRandomNetwork(const BenchmarkRandomNetwork&);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        BenchmarkRandomNetwork& operator =(const BenchmarkRandomNetwork&);
+};
+
+#endif
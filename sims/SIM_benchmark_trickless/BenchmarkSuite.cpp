@@ -0,0 +1,376 @@
+/**
+@file
+@brief     GUNNS Benchmark Suite implementation.
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((BenchmarkRandomNetwork.o)
+   (core/Gunns.o)
+   (core/GunnsInfraFunctions.o)
+   (aspects/thermal/network/ThermalNetwork.o)
+   (sims/networks/basic/timing/TimingBasic.o)
+   (sims/networks/electrical/PvArrayRegTest.o)
+   (sims/networks/electrical/test/TestElectSarNetwork.o))
+*/
+
+#include "BenchmarkSuite.hh"
+#include "BenchmarkRandomNetwork.hh"
+#include "../networks/basic/timing/TimingBasic.hh"
+#include "../networks/electrical/PvArrayRegTest.hh"
+#include "../networks/electrical/test/TestElectSarNetwork.hh"
+#include "aspects/thermal/network/ThermalNetwork.hh"
+#include "core/GunnsInfraFunctions.hh"
+#include <algorithm>
+#include <cfloat>
+#include <fstream>
+#include <iomanip>
+#include <set>
+#include <sstream>
+#include <utility>
+
+/// @brief  JSON names of the step phases, in Gunns::StepPhase order.
+static const char* const PHASE_NAMES[Gunns::NUM_STEP_PHASES] =
+        {"link_step", "build", "decompose", "solve", "orchestrate"};
+
+/// @brief  Returns the JSON name of the matrix storage mode.
+static const char* storageName(const Gunns::MatrixStorage storage)
+{
+    return (Gunns::SPARSE == storage) ? "sparse" : "dense";
+}
+
+/// @brief  Returns the JSON name of the island mode.
+static const char* islandModeName(const Gunns::IslandMode mode)
+{
+    switch (mode) {
+        case Gunns::FIND:  return "find";
+        case Gunns::SOLVE: return "solve";
+        default:           return "off";
+    }
+}
+
+/// @brief  Returns the root of the node in the union-find parent array, compressing the path.
+static int findRoot(std::vector<int>& parent, int node)
+{
+    while (parent[node] != node) {
+        parent[node] = parent[parent[node]];
+        node         = parent[node];
+    }
+    return node;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  steps      (--)  Nominal number of timed major steps per case.
+/// @param[in]  gunnsHome  (--)  Path to the GUNNS repository, for the shipped network files.
+///
+/// @details  Constructs this Benchmark Suite.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+BenchmarkSuite::BenchmarkSuite(const int steps, const std::string& gunnsHome)
+    :
+    mSteps(std::max(1, steps)),
+    mGunnsHome(gunnsHome),
+    mResults()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Benchmark Suite.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+BenchmarkSuite::~BenchmarkSuite()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Runs the generated then the shipped cases, with the solver phase timers switched to
+///           the wall clock for the duration.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkSuite::run()
+{
+    const bool wallClock = GunnsInfraFunctions::mWallClock;
+    GunnsInfraFunctions::mWallClock = true;
+    mResults.clear();
+    runGenerated();
+    runShipped();
+    GunnsInfraFunctions::mWallClock = wallClock;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Runs the TimingBasic grids and the BenchmarkRandomNetwork networks.  The random
+///           networks cover small to large sizes, sparse (degree 3) and denser (degree 8)
+///           connectivity, and one to many islands, in the storage and island modes suited to them.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkSuite::runGenerated()
+{
+    struct GridCase {
+        int                  mSize;
+        Gunns::MatrixStorage mStorage;
+        Gunns::IslandMode    mIslandMode;
+    };
+    const GridCase grids[] = {
+        {10, Gunns::DENSE,  Gunns::OFF},
+        {20, Gunns::DENSE,  Gunns::SOLVE},
+        {30, Gunns::SPARSE, Gunns::OFF},
+        {40, Gunns::SPARSE, Gunns::SOLVE}
+    };
+    for (unsigned int i = 0; i < sizeof(grids) / sizeof(grids[0]); ++i) {
+        std::ostringstream name;
+        name << "grid_n" << grids[i].mSize << "_" << storageName(grids[i].mStorage)
+             << "_" << islandModeName(grids[i].mIslandMode);
+        std::string networkName = name.str();
+        TimingBasic network(networkName);
+        network.N = grids[i].mSize;
+        network.initialize(networkName);
+        runCase(name.str(), "generated", network, grids[i].mStorage, grids[i].mIslandMode);
+    }
+
+    struct RandomCase {
+        int                  mNodes;
+        double               mDegree;
+        int                  mIslands;
+        Gunns::MatrixStorage mStorage;
+        Gunns::IslandMode    mIslandMode;
+    };
+    const RandomCase randoms[] = {
+        {  50, 3.0,  1, Gunns::DENSE,  Gunns::OFF},
+        { 200, 3.0,  1, Gunns::DENSE,  Gunns::OFF},
+        { 200, 8.0,  1, Gunns::DENSE,  Gunns::OFF},
+        { 200, 3.0,  1, Gunns::SPARSE, Gunns::OFF},
+        { 200, 3.0,  4, Gunns::DENSE,  Gunns::SOLVE},
+        { 500, 3.0,  1, Gunns::SPARSE, Gunns::OFF},
+        { 500, 8.0,  1, Gunns::SPARSE, Gunns::OFF},
+        { 500, 3.0,  8, Gunns::SPARSE, Gunns::SOLVE},
+        {1000, 3.0, 16, Gunns::SPARSE, Gunns::SOLVE}
+    };
+    for (unsigned int i = 0; i < sizeof(randoms) / sizeof(randoms[0]); ++i) {
+        std::ostringstream name;
+        name << "random_n" << randoms[i].mNodes << "_d" << randoms[i].mDegree
+             << "_i" << randoms[i].mIslands << "_" << storageName(randoms[i].mStorage)
+             << "_" << islandModeName(randoms[i].mIslandMode);
+        BenchmarkRandomNetwork network(name.str());
+        network.mNumNodes   = randoms[i].mNodes;
+        network.mDegree     = randoms[i].mDegree;
+        network.mNumIslands = randoms[i].mIslands;
+        network.mSeed       = 1 + i;
+        network.initialize();
+        runCase(name.str(), "generated", network, randoms[i].mStorage, randoms[i].mIslandMode);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Runs the sims/networks electrical examples and the ThermalNetwork unit test network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkSuite::runShipped()
+{
+    {
+        TestElectSarNetwork network("TestElectSarNetwork");
+        network.initialize();
+        runCase("TestElectSarNetwork", "shipped", network, Gunns::DENSE, Gunns::OFF);
+    }
+    {
+        PvArrayRegTest network("PvArrayRegTest");
+        network.initialize();
+        runCase("PvArrayRegTest", "shipped", network, Gunns::DENSE, Gunns::OFF);
+    }
+
+    const std::string path = mGunnsHome + "/aspects/thermal/network/test/";
+    if (not std::ifstream((path + "ThermNodes_base.xml").c_str())) {
+        std::cerr << "BenchmarkSuite: skipping ThermalNetwork cases, can't find " << path
+                  << "ThermNodes_base.xml; set GUNNS_HOME." << std::endl;
+        return;
+    }
+    for (int batch = 0; batch < 2; ++batch) {
+        const std::string name = batch ? "ThermalNetwork_base_radbatch" : "ThermalNetwork_base";
+        ThermalNetwork network(name);
+        network.mConfig.cNodeFile = path + "ThermNodes_base.xml";
+        network.mConfig.cCondFile = path + "ThermLinksCond_base.xml";
+        network.mConfig.cRadFile  = path + "ThermLinksRad_base.xml";
+        network.mConfig.cHtrFile  = path + "HtrRegistry_base.xml";
+        network.mConfig.cPanFile  = path + "ThermLinksPan_base.xml";
+        network.mConfig.cEtcFile  = path + "ThermLinksEtc_base.xml";
+        network.setRadiationBatch(1 == batch);
+        network.initialize();
+        runCase(name, "shipped", network, Gunns::DENSE, Gunns::OFF);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]     name        (--)  Case name.
+/// @param[in]     source      (--)  "generated" or "shipped".
+/// @param[in,out] network     (--)  The initialized network to time.
+/// @param[in]     storage     (--)  Admittance matrix storage mode to run in.
+/// @param[in]     islandMode  (--)  Island mode to run in.
+///
+/// @details  Large networks are run for proportionally fewer steps, so the dense cases don't
+///           dominate the suite run time.  The phase times not covered by any phase, such as the
+///           spotters and minor step bookkeeping, are reported as "other".
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class NETWORK>
+void BenchmarkSuite::runCase(const std::string& name, const std::string& source,
+                             NETWORK& network, const Gunns::MatrixStorage storage,
+                             const Gunns::IslandMode islandMode)
+{
+    network.netSolver.setMatrixStorage(storage);
+    network.netSolver.setIslandMode(islandMode);
+
+    const double dt     = 0.1;
+    const int    warmup = 5;
+    for (int step = 0; step < warmup; ++step) {
+        network.update(dt);
+    }
+
+    Result result;
+    result.mName       = name;
+    result.mSource     = source;
+    result.mStorage    = storage;
+    result.mIslandMode = islandMode;
+    result.mSteps      = std::max(10, mSteps * 100 / std::max(100,
+                                                   network.netSolver.getNetworkSize()));
+    result.mOther      = 0.0;
+    result.mStep       = 0.0;
+    result.mStepMin    = DBL_MAX;
+    result.mStepMax    = 0.0;
+    for (int phase = 0; phase < Gunns::NUM_STEP_PHASES; ++phase) {
+        result.mPhase[phase] = 0.0;
+    }
+    measureTopology(network.netSolver, result);
+
+    for (int step = 0; step < result.mSteps; ++step) {
+        network.update(dt);
+        const double stepTime = network.netSolver.getStepTime();
+        double       phaseSum = 0.0;
+        for (int phase = 0; phase < Gunns::NUM_STEP_PHASES; ++phase) {
+            const double phaseTime = network.netSolver.getPhaseTime(
+                    static_cast<Gunns::StepPhase>(phase));
+            result.mPhase[phase] += phaseTime;
+            phaseSum             += phaseTime;
+        }
+        result.mOther   += std::max(0.0, stepTime - phaseSum);
+        result.mStep    += stepTime;
+        result.mStepMin  = std::min(result.mStepMin, stepTime);
+        result.mStepMax  = std::max(result.mStepMax, stepTime);
+    }
+
+    for (int phase = 0; phase < Gunns::NUM_STEP_PHASES; ++phase) {
+        result.mPhase[phase] /= result.mSteps;
+    }
+    result.mOther /= result.mSteps;
+    result.mStep  /= result.mSteps;
+    mResults.push_back(result);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]     solver  (--)  The network solver, after at least one step.
+/// @param[in,out] result  (--)  Result to store the node, link, island and non-zero counts in.
+///
+/// @details  Reads each link's node map & current admittance matrix.  Each distinct pair of
+///           non-ground nodes with a non-zero off-diagonal admittance term is a pair of non-zeros
+///           in the network admittance matrix, and joins the two nodes' islands.  The diagonal is
+///           counted as all non-zero.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkSuite::measureTopology(const Gunns& solver, Result& result)
+{
+    const int        size  = solver.getNetworkSize();
+    const int        links = solver.getNumLinks();
+    GunnsBasicLink** link  = solver.getLinks();
+
+    std::vector<int> parent(size);
+    for (int node = 0; node < size; ++node) {
+        parent[node] = node;
+    }
+    std::set<std::pair<int, int> > pairs;
+    for (int i = 0; i < links; ++i) {
+        const int     ports = link[i]->getNumberPorts();
+        const int*    map   = link[i]->getNodeMap();
+        const double* a     = link[i]->getAdmittanceMatrix();
+        if (not a) {
+            continue;
+        }
+        for (int row = 0; row < ports; ++row) {
+            for (int col = row + 1; col < ports; ++col) {
+                const int node0 = map[row];
+                const int node1 = map[col];
+                if (node0 == node1 or node0 >= size or node1 >= size
+                        or (0.0 == a[row * ports + col] and 0.0 == a[col * ports + row])) {
+                    continue;
+                }
+                pairs.insert(std::make_pair(std::min(node0, node1), std::max(node0, node1)));
+                parent[findRoot(parent, node0)] = findRoot(parent, node1);
+            }
+        }
+    }
+
+    int islands = 0;
+    for (int node = 0; node < size; ++node) {
+        if (findRoot(parent, node) == node) {
+            ++islands;
+        }
+    }
+    result.mNodes    = size;
+    result.mLinks    = links;
+    result.mIslands  = islands;
+    result.mNonZeros = size + 2 * static_cast<int>(pairs.size());
+    result.mDensity  = (size > 0) ? static_cast<double>(result.mNonZeros) / size / size : 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  out  (--)  Stream to write to.
+///
+/// @details  Writes one line per case with the mean step and phase times in microseconds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkSuite::printSummary(std::ostream& out) const
+{
+    out << "Benchmark suite: mean wall time per major step (us), " << mSteps
+        << " nominal steps" << std::endl;
+    out << std::left << std::setw(36) << "case" << std::right << std::setw(7) << "nodes"
+        << std::setw(5) << "isl" << std::setw(8) << "density";
+    for (int phase = 0; phase < Gunns::NUM_STEP_PHASES; ++phase) {
+        out << std::setw(12) << PHASE_NAMES[phase];
+    }
+    out << std::setw(10) << "other" << std::setw(11) << "step" << std::endl;
+
+    for (unsigned int i = 0; i < mResults.size(); ++i) {
+        const Result& r = mResults[i];
+        out << std::left << std::setw(36) << r.mName << std::right << std::setw(7) << r.mNodes
+            << std::setw(5) << r.mIslands << std::fixed << std::setprecision(3)
+            << std::setw(8) << r.mDensity << std::setprecision(1);
+        for (int phase = 0; phase < Gunns::NUM_STEP_PHASES; ++phase) {
+            out << std::setw(12) << 1.0E6 * r.mPhase[phase];
+        }
+        out << std::setw(10) << 1.0E6 * r.mOther << std::setw(11) << 1.0E6 * r.mStep << std::endl;
+        out.unsetf(std::ios::floatfield);
+    }
+    out << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  out  (--)  Stream to write to.
+///
+/// @details  Writes the results as a JSON object with the suite settings and an array of cases.
+///           Times are in microseconds.  The case names are generated here and need no escaping.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void BenchmarkSuite::writeJson(std::ostream& out) const
+{
+    out << "{\n  \"suite\": \"gunns_trickless\",\n  \"version\": 1,\n  \"steps\": " << mSteps
+        << ",\n  \"units\": \"us\",\n  \"cases\": [";
+    for (unsigned int i = 0; i < mResults.size(); ++i) {
+        const Result& r = mResults[i];
+        out << (i ? ",\n" : "\n") << std::setprecision(6)
+            << "    {\"name\": \"" << r.mName << "\", \"source\": \"" << r.mSource
+            << "\", \"storage\": \"" << storageName(r.mStorage)
+            << "\", \"island_mode\": \"" << islandModeName(r.mIslandMode)
+            << "\",\n     \"nodes\": " << r.mNodes << ", \"links\": " << r.mLinks
+            << ", \"islands\": " << r.mIslands << ", \"nonzeros\": " << r.mNonZeros
+            << ", \"density\": " << r.mDensity << ", \"steps\": " << r.mSteps
+            << ",\n     \"phases_us\": {";
+        for (int phase = 0; phase < Gunns::NUM_STEP_PHASES; ++phase) {
+            out << "\"" << PHASE_NAMES[phase] << "\": " << 1.0E6 * r.mPhase[phase] << ", ";
+        }
+        out << "\"other\": " << 1.0E6 * r.mOther << "},\n     \"step_us\": " << 1.0E6 * r.mStep
+            << ", \"step_min_us\": " << 1.0E6 * r.mStepMin
+            << ", \"step_max_us\": " << 1.0E6 * r.mStepMax << "}";
+    }
+    out << "\n  ]\n}" << std::endl;
+}
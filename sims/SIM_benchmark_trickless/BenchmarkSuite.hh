@@ -0,0 +1,116 @@
+#ifndef BenchmarkSuite_EXISTS
+#define BenchmarkSuite_EXISTS
+
+/**
+@file
+@brief     GUNNS Benchmark Suite declarations.
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE: (Runs a fixed corpus of generated and shipped GUNNS networks and reports the solver's
+          per-phase step timings as JSON, for tracking performance regressions between builds.)
+
+REFERENCE: ()
+
+ASSUMPTIONS AND LIMITATIONS:
+  ((Timings are wall-clock and include whatever else the host is doing, so results should be
+    compared between runs on the same idle host.)
+   (The shipped thermal case reads the ThermalNetwork unit test XML files from the GUNNS_HOME
+    given to the constructor, and is skipped if they can't be found.))
+
+LIBRARY DEPENDENCY:
+  ((BenchmarkSuite.o))
+
+PROGRAMMERS:
+  ((agent) (agent@local) (2026-10) (Initial))
+*/
+
+#include "core/Gunns.hh"
+#include <iostream>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Benchmark Suite
+///
+/// @details  Each case constructs and initializes a fresh network, sets its matrix storage and
+///           island mode, runs some warm-up steps, then times major steps with the solver's
+///           wall-clock phase timers.  The corpus is:
+///           - generated: TimingBasic N x N grids split into two islands, and
+///             BenchmarkRandomNetwork networks over a range of sizes, degrees and island counts,
+///             all from fixed seeds so every run builds the same networks.
+///           - shipped: the sims/networks electrical example networks and a ThermalNetwork read
+///             from the thermal network unit test XML files, with and without the radiation batch.
+///
+///           Each case also records the network's node & link counts, and the number of islands
+///           and admittance matrix density seen after the warm-up steps.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class BenchmarkSuite
+{
+    public:
+        /// @brief  Results of one benchmark case.  Times are averages per major step, in seconds.
+        struct Result
+        {
+            std::string          mName;       /**< (--) Case name. */
+            std::string          mSource;     /**< (--) "generated" or "shipped". */
+            Gunns::MatrixStorage mStorage;    /**< (--) Admittance matrix storage mode. */
+            Gunns::IslandMode    mIslandMode; /**< (--) Island mode. */
+            int                  mNodes;      /**< (--) Number of nodes, excluding ground. */
+            int                  mLinks;      /**< (--) Number of network links. */
+            int                  mIslands;    /**< (--) Number of islands, including lone nodes. */
+            int                  mNonZeros;   /**< (--) Number of admittance matrix non-zeros. */
+            double               mDensity;    /**< (--) Fraction of admittance matrix non-zeros. */
+            int                  mSteps;      /**< (--) Number of timed major steps. */
+            double               mPhase[Gunns::NUM_STEP_PHASES]; /**< (s) Mean phase times. */
+            double               mOther;      /**< (s) Mean step time not in any phase. */
+            double               mStep;       /**< (s) Mean step time. */
+            double               mStepMin;    /**< (s) Minimum step time. */
+            double               mStepMax;    /**< (s) Maximum step time. */
+        };
+        /// @brief  Constructs the suite with the number of steps and the GUNNS_HOME path.
+        BenchmarkSuite(const int steps, const std::string& gunnsHome);
+        /// @brief  Default destructor.
+        virtual ~BenchmarkSuite();
+        /// @brief  Runs all the cases in the corpus.
+        void run();
+        /// @brief  Writes a table of the results.
+        void printSummary(std::ostream& out) const;
+        /// @brief  Writes the results as JSON.
+        void writeJson(std::ostream& out) const;
+        /// @brief  Returns the results of the cases run.
+        const std::vector<Result>& getResults() const;
+
+    protected:
+        int                 mSteps;     /**< (--) Nominal number of timed steps per case. */
+        std::string         mGunnsHome; /**< (--) Path to the GUNNS repository. */
+        std::vector<Result> mResults;   /**< (--) Results of the cases run. */
+        /// @brief  Runs the generated corpus.
+        void runGenerated();
+        /// @brief  Runs the shipped corpus.
+        void runShipped();
+        /// @brief  Times the given initialized network and appends its result.
+        template <class NETWORK>
+        void runCase(const std::string& name, const std::string& source, NETWORK& network,
+                     const Gunns::MatrixStorage storage, const Gunns::IslandMode islandMode);
+        /// @brief  Counts the islands and admittance matrix non-zeros of the solver's links.
+        static void measureTopology(const Gunns& solver, Result& result);
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        BenchmarkSuite(const BenchmarkSuite&);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        BenchmarkSuite& operator =(const BenchmarkSuite&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  const std::vector<Result>&  (--)  Results of the cases run.
+///
+/// @details  Returns mResults.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const std::vector<BenchmarkSuite::Result>& BenchmarkSuite::getResults() const
+{
+    return mResults;
+}
+
+#endif
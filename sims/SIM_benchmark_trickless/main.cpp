@@ -0,0 +1,988 @@
+/*
+ * @copyright Copyright 2026 United States Government as represented by the Administrator of the
+ *            National Aeronautics and Space Administration.  All Rights Reserved.
+ *
+ * Trick-less benchmarks of the GUNNS solver.
+ *
+ * Usage: ./benchmark [steps]
+ *        ./benchmark suite [steps] [json_file]
+ *   steps:     number of timed major steps per case, default 200.
+ *   json_file: file to write the suite results to, default benchmark_suite.json.
+ *
+ * The suite mode runs the regression corpus in BenchmarkSuite instead of the comparisons below:
+ * generated grid & random networks and the shipped example networks, reporting the solver's
+ * per-phase step times as JSON.  The shipped thermal network files are found from the GUNNS_HOME
+ * environment variable, default ../..
+ *
+ * Each case constructs and initializes a fresh network, runs some warm-up steps, then reports the
+ * average wall time per major step.  The networks are TimingBasic N x N grids from
+ * sims/networks/basic/timing, which split into two islands.
+ *
+ * Cases:
+ *   - Admittance matrix storage: DENSE vs. SPARSE matrix rebuild and full step.
+ *   - Incremental admittance: SPARSE storage matrix build time with a few conductors changing each
+ *     step, for the full rebuild vs. the incremental build.
+ *   - Island detection: the legacy column sweep vs. union-find, with static and toggling topology.
+ *   - Parallel islands: SOLVE island mode full step time on 1, 2 and 4 island threads.
+ *   - Fluid properties: PolyFluid mixture density, pressure & specific enthalpy by the legacy
+ *     per-constituent virtual calls vs. the packed property engine.
+ *   - Interpolator lookup: TsLinearInterpolator by the legacy hinted linear cell search vs. the
+ *     breakpoint index, for uniform & non-uniform tables with sequential & random inputs.
+ *   - H&S message queue: insert time and lost messages with contending model threads, for the
+ *     legacy mutex-guarded queue vs. the lock-free TsHsMsgQueue ring buffer.
+ *   - H&S message filter: messages per second through the redundancy filter in warning storms, for
+ *     the legacy string-keyed map vs. the hashed TsHsMsgStdFilter table.
+ */
+
+#include <algorithm>
+#include <cfloat>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <deque>
+#include <pthread.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "BenchmarkSuite.hh"
+#include "../networks/basic/timing/TimingBasic.hh"
+#include "core/GunnsInfraFunctions.hh"
+#include "aspects/fluid/fluid/PolyFluid.hh"
+#include "math/approximation/TsLinearInterpolator.hh"
+#include "properties/FluidProperties.hh"
+#include "simulation/hs/TsHsMsgQueue.hh"
+#include "simulation/hs/TsHsMsgStdFilter.hh"
+
+/// @brief Returns the monotonic wall clock time in seconds.
+static double wallClock()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<double>(now.tv_sec) + 1.0E-9 * static_cast<double>(now.tv_nsec);
+}
+
+/// @brief Options for one benchmark case.
+struct BenchmarkCase
+{
+    int                  mGridSize;   // N of the N x N TimingBasic grid
+    Gunns::MatrixStorage mStorage;    // admittance matrix storage mode
+    bool                 mDummyMode;  // true to step in DUMMY mode, which skips decomposition & solve
+    Gunns::IslandMode    mIslandMode; // island mode
+    bool                 mToggle;     // true to open & close a split conductor on alternate steps
+    int                  mThreads;    // number of island threads
+};
+
+/// @brief Runs one case and returns the average wall time per major step in seconds.  The final
+///        potential vector is returned in potentials for comparison between cases.
+static double runCase(const BenchmarkCase& bc, const int steps, std::vector<double>& potentials)
+{
+    std::string name = "bench";
+    TimingBasic network(name);
+    network.N = bc.mGridSize;
+    network.initialize(name);
+    network.netSolver.setMatrixStorage(bc.mStorage);
+    network.netSolver.setIslandMode(bc.mIslandMode);
+    network.netSolver.setIslandThreads(bc.mThreads);
+    if (bc.mDummyMode) {
+        network.netSolver.setDummyMode();
+    }
+
+    /// - The first row's split conductor joins the two islands when closed.
+    const int N      = bc.mGridSize;
+    const int split  = N/2 - 1;
+
+    const int    warmup = 5;
+    const double dt     = 0.1;
+    for (int step = 0; step < warmup; ++step) {
+        network.update(dt);
+    }
+    const double start = wallClock();
+    for (int step = 0; step < steps; ++step) {
+        if (bc.mToggle) {
+            network.mCond[split].setDefaultConductivity((step % 2) ? 0.0 : 1.0);
+        }
+        network.update(dt);
+    }
+    const double elapsed = wallClock() - start;
+
+    const int     size = network.netSolver.getNetworkSize();
+    const double* p    = network.netSolver.getPotentialVector();
+    potentials.assign(p, p + size);
+    return elapsed / steps;
+}
+
+/// @brief Compares admittance matrix rebuild and full step times in DENSE and SPARSE storage over
+///        a range of network sizes.
+static void benchmarkMatrixStorage(const int steps)
+{
+    std::cout << "Admittance matrix storage: DENSE vs. SPARSE, TimingBasic N x N grid" << std::endl;
+    std::cout << "  rebuild: DUMMY mode, link step + matrix build only" << std::endl;
+    std::cout << "  full:    NORMAL mode, including decomposition & solve" << std::endl;
+    std::cout << std::setw(6)  << "N" << std::setw(8) << "nodes" << std::setw(10) << "phase"
+              << std::setw(14) << "DENSE (us)" << std::setw(14) << "SPARSE (us)"
+              << std::setw(10) << "speedup" << std::setw(12) << "max |dx|" << std::endl;
+
+    const int gridSizes[] = {10, 20, 30, 40, 50};
+    const int numGrids    = sizeof(gridSizes) / sizeof(gridSizes[0]);
+    for (int grid = 0; grid < numGrids; ++grid) {
+        for (int phase = 0; phase < 2; ++phase) {
+            const bool dummy = (0 == phase);
+
+            /// - Limit the slow dense decomposition cases to fewer steps.
+            int caseSteps = steps;
+            if (not dummy) {
+                caseSteps = std::max(1, steps * 100 / (gridSizes[grid] * gridSizes[grid]));
+            }
+
+            BenchmarkCase dense  = {gridSizes[grid], Gunns::DENSE,  dummy, Gunns::OFF, false, 1};
+            BenchmarkCase sparse = {gridSizes[grid], Gunns::SPARSE, dummy, Gunns::OFF, false, 1};
+            std::vector<double> denseP;
+            std::vector<double> sparseP;
+            const double denseTime  = runCase(dense,  caseSteps, denseP);
+            const double sparseTime = runCase(sparse, caseSteps, sparseP);
+
+            double maxDelta = 0.0;
+            for (unsigned int i = 0; i < denseP.size() and i < sparseP.size(); ++i) {
+                maxDelta = std::max(maxDelta, std::fabs(denseP[i] - sparseP[i]));
+            }
+
+            std::cout << std::setw(6)  << gridSizes[grid]
+                      << std::setw(8)  << denseP.size()
+                      << std::setw(10) << (dummy ? "rebuild" : "full")
+                      << std::fixed << std::setprecision(1)
+                      << std::setw(14) << 1.0E6 * denseTime
+                      << std::setw(14) << 1.0E6 * sparseTime
+                      << std::setprecision(2)
+                      << std::setw(10) << denseTime / sparseTime
+                      << std::scientific << std::setprecision(1)
+                      << std::setw(12) << maxDelta << std::endl;
+            std::cout.unsetf(std::ios::floatfield);
+        }
+    }
+    std::cout << std::endl;
+}
+
+/// @brief Runs a NORMAL mode SPARSE storage case with a few conductors changing each step, with the
+///        given incremental admittance refresh limit, or the full rebuild for zero.  Returns the
+///        average build phase time per major step in seconds, the final potential vector in
+///        potentials and the number of network links in numLinks.
+static double runIncrementalCase(const int N, const int refreshLimit, const int steps,
+                                 std::vector<double>& potentials, int& numLinks)
+{
+    std::string name = "bench";
+    TimingBasic network(name);
+    network.N = N;
+    network.initialize(name);
+    network.netSolver.setMatrixStorage(Gunns::SPARSE);
+    if (refreshLimit > 0) {
+        network.netSolver.setIncrementalAdmittance(refreshLimit);
+    }
+
+    /// - A horizontal, a vertical and a boundary conductor change, leaving the islands intact.
+    const int changed[] = {0, N*(N-1) + N/2, network.N_COND - 1};
+    const int numChanged = sizeof(changed) / sizeof(changed[0]);
+
+    const int    warmup = 5;
+    const double dt     = 0.1;
+    for (int step = 0; step < warmup; ++step) {
+        network.update(dt);
+    }
+    double buildTime = 0.0;
+    for (int step = 0; step < steps; ++step) {
+        for (int i = 0; i < numChanged; ++i) {
+            network.mCond[changed[i]].setDefaultConductivity((step % 2) ? 0.5 : 1.0);
+        }
+        network.update(dt);
+        buildTime += network.netSolver.getPhaseTime(Gunns::PHASE_BUILD);
+    }
+
+    const int     size = network.netSolver.getNetworkSize();
+    const double* p    = network.netSolver.getPotentialVector();
+    potentials.assign(p, p + size);
+    numLinks = network.netSolver.getNumLinks();
+    return buildTime / steps;
+}
+
+/// @brief Compares the SPARSE storage admittance matrix build time of the full rebuild and the
+///        incremental build, in large networks where only a few links change each step.
+static void benchmarkIncrementalAdmittance(const int steps)
+{
+    std::cout << "Incremental admittance: SPARSE storage, TimingBasic N x N grid, 3 links changing"
+              << std::endl;
+    std::cout << "  build phase time per step: source vector, matrix build & conditioning"
+              << std::endl;
+    std::cout << std::setw(6)  << "N" << std::setw(8) << "nodes" << std::setw(8) << "links"
+              << std::setw(14) << "full (us)" << std::setw(14) << "incr (us)"
+              << std::setw(10) << "speedup" << std::setw(12) << "max |dx|" << std::endl;
+
+    /// - The solver's phase times use the wall clock for the duration.
+    const bool wallClock = GunnsInfraFunctions::mWallClock;
+    GunnsInfraFunctions::mWallClock = true;
+
+    const int gridSizes[] = {20, 30, 40, 50};
+    const int numGrids    = sizeof(gridSizes) / sizeof(gridSizes[0]);
+    for (int grid = 0; grid < numGrids; ++grid) {
+        const int N = gridSizes[grid];
+        std::vector<double> fullP;
+        std::vector<double> incrP;
+        int          numLinks = 0;
+        const double fullTime = runIncrementalCase(N, 0,   steps, fullP, numLinks);
+        const double incrTime = runIncrementalCase(N, 100, steps, incrP, numLinks);
+
+        double maxDelta = 0.0;
+        for (unsigned int i = 0; i < fullP.size() and i < incrP.size(); ++i) {
+            maxDelta = std::max(maxDelta, std::fabs(fullP[i] - incrP[i]));
+        }
+
+        std::cout << std::setw(6)  << N
+                  << std::setw(8)  << fullP.size()
+                  << std::setw(8)  << numLinks
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(14) << 1.0E6 * fullTime
+                  << std::setw(14) << 1.0E6 * incrTime
+                  << std::setprecision(2)
+                  << std::setw(10) << fullTime / incrTime
+                  << std::scientific << std::setprecision(1)
+                  << std::setw(12) << maxDelta << std::endl;
+        std::cout.unsetf(std::ios::floatfield);
+    }
+    std::cout << std::endl;
+    GunnsInfraFunctions::mWallClock = wallClock;
+}
+
+/// @brief Legacy island merge: moves all nodes on the from island to the to island.
+static void legacyMerge(std::vector<int>& islands, const int from, const int to)
+{
+    if (from != to) {
+        for (unsigned int node = 0; node < islands.size(); ++node) {
+            if (from == islands[node]) islands[node] = to;
+        }
+    }
+}
+
+/// @brief Legacy island detection, for comparison: sweeps the upper triangle of the dense
+///        admittance matrix and merges islands down each column, with an O(n) merge per join.
+static void legacyIslands(const double* A, const int n, std::vector<int>& islands)
+{
+    for (int node = 0; node < n; ++node) {
+        islands[node] = node;
+    }
+    for (int row = 0; row < n-1; ++row) {
+        for (int col = row+1, a = row*n+col; col < n; col++, a++) {
+            if (A[a] != 0.0) {
+                int minNum = std::min(islands[col], islands[row]);
+                for (int row2 = row+1, a2 = row2*n+col; row2 < col; row2++, a2 += n) {
+                    if (A[a2] != 0.0 and islands[row2] < minNum) {
+                        minNum = islands[row2];
+                    }
+                }
+                for (int row2 = row+1, a2 = row2*n+col; row2 < col; row2++, a2 += n) {
+                    if (A[a2] != 0.0) {
+                        legacyMerge(islands, islands[row2], minNum);
+                    }
+                }
+                legacyMerge(islands, islands[row], minNum);
+                legacyMerge(islands, islands[col], minNum);
+            }
+        }
+    }
+}
+
+/// @brief Compares island detection costs over a range of network sizes.  The legacy column sweep
+///        is timed by itself on the network's dense admittance matrix, which is what it added to
+///        every admittance matrix rebuild.  The union-find is timed within the DUMMY mode step with
+///        SPARSE storage, in island modes OFF and FIND, with a static topology (no island changes)
+///        and with a split conductor toggling every step (alternating incremental joins and full
+///        rebuilds).
+static void benchmarkIslands(const int steps)
+{
+    std::cout << "Island detection: legacy column sweep vs. union-find, TimingBasic N x N grid"
+              << std::endl;
+    std::cout << "  legacy: one column sweep of the dense admittance matrix" << std::endl;
+    std::cout << "  steps:  DUMMY mode, SPARSE storage, static or toggled split conductor"
+              << std::endl;
+    std::cout << std::setw(6)  << "N" << std::setw(8) << "nodes" << std::setw(14) << "legacy (us)"
+              << std::setw(12) << "OFF (us)" << std::setw(12) << "FIND (us)"
+              << std::setw(14) << "OFF tgl (us)" << std::setw(14) << "FIND tgl (us)" << std::endl;
+
+    const int gridSizes[] = {10, 20, 30, 40, 50};
+    const int numGrids    = sizeof(gridSizes) / sizeof(gridSizes[0]);
+    for (int grid = 0; grid < numGrids; ++grid) {
+        const int N = gridSizes[grid];
+
+        /// - Capture a dense admittance matrix of the split network for the legacy sweep.
+        std::string name = "bench";
+        TimingBasic network(name);
+        network.N = N;
+        network.initialize(name);
+        network.netSolver.setDummyMode();
+        network.update(0.1);
+        const int     n = network.netSolver.getNetworkSize();
+        const double* a = network.netSolver.getAdmittanceMatrix();
+        const std::vector<double> matrix(a, a + n*n);
+        std::vector<int> islands(n);
+
+        const int    legacySteps = std::max(1, steps * 100 / (N * N));
+        const double start       = wallClock();
+        for (int step = 0; step < legacySteps; ++step) {
+            legacyIslands(&matrix[0], n, islands);
+        }
+        const double legacyTime = (wallClock() - start) / legacySteps;
+
+        BenchmarkCase off        = {N, Gunns::SPARSE, true, Gunns::OFF,  false, 1};
+        BenchmarkCase find       = {N, Gunns::SPARSE, true, Gunns::FIND, false, 1};
+        BenchmarkCase offToggle  = {N, Gunns::SPARSE, true, Gunns::OFF,  true,  1};
+        BenchmarkCase findToggle = {N, Gunns::SPARSE, true, Gunns::FIND, true,  1};
+        std::vector<double> p;
+        const double offTime        = runCase(off,        steps, p);
+        const double findTime       = runCase(find,       steps, p);
+        const double offToggleTime  = runCase(offToggle,  steps, p);
+        const double findToggleTime = runCase(findToggle, steps, p);
+
+        std::cout << std::setw(6)  << N
+                  << std::setw(8)  << n
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(14) << 1.0E6 * legacyTime
+                  << std::setw(12) << 1.0E6 * offTime
+                  << std::setw(12) << 1.0E6 * findTime
+                  << std::setw(14) << 1.0E6 * offToggleTime
+                  << std::setw(14) << 1.0E6 * findToggleTime << std::endl;
+        std::cout.unsetf(std::ios::floatfield);
+    }
+    std::cout << std::endl;
+}
+
+/// @brief Compares full step times in SOLVE island mode with DENSE storage, with the islands
+///        decomposed & solved serially and on 2 & 4 threads.  The TimingBasic grid has two equal
+///        islands, so 2 threads is the most that can help.
+static void benchmarkParallelIslands(const int steps)
+{
+    std::cout << "Parallel islands: SOLVE island mode, DENSE storage, TimingBasic N x N grid"
+              << std::endl;
+    std::cout << std::setw(6)  << "N" << std::setw(8) << "nodes" << std::setw(14) << "1 thrd (us)"
+              << std::setw(14) << "2 thrd (us)" << std::setw(14) << "4 thrd (us)"
+              << std::setw(10) << "speedup" << std::setw(12) << "max |dx|" << std::endl;
+
+    const int gridSizes[] = {10, 20, 30};
+    const int numGrids    = sizeof(gridSizes) / sizeof(gridSizes[0]);
+    for (int grid = 0; grid < numGrids; ++grid) {
+        const int N         = gridSizes[grid];
+        const int caseSteps = std::max(1, steps * 100 / (N * N));
+
+        BenchmarkCase serial = {N, Gunns::DENSE, false, Gunns::SOLVE, false, 1};
+        BenchmarkCase two    = {N, Gunns::DENSE, false, Gunns::SOLVE, false, 2};
+        BenchmarkCase four   = {N, Gunns::DENSE, false, Gunns::SOLVE, false, 4};
+        std::vector<double> serialP;
+        std::vector<double> twoP;
+        std::vector<double> fourP;
+        const double serialTime = runCase(serial, caseSteps, serialP);
+        const double twoTime    = runCase(two,    caseSteps, twoP);
+        const double fourTime   = runCase(four,   caseSteps, fourP);
+
+        double maxDelta = 0.0;
+        for (unsigned int i = 0; i < serialP.size(); ++i) {
+            maxDelta = std::max(maxDelta, std::fabs(serialP[i] - twoP[i]));
+            maxDelta = std::max(maxDelta, std::fabs(serialP[i] - fourP[i]));
+        }
+
+        std::cout << std::setw(6)  << N
+                  << std::setw(8)  << serialP.size()
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(14) << 1.0E6 * serialTime
+                  << std::setw(14) << 1.0E6 * twoTime
+                  << std::setw(14) << 1.0E6 * fourTime
+                  << std::setprecision(2)
+                  << std::setw(10) << serialTime / twoTime
+                  << std::scientific << std::setprecision(1)
+                  << std::setw(12) << maxDelta << std::endl;
+        std::cout.unsetf(std::ios::floatfield);
+    }
+    std::cout << std::endl;
+}
+
+/// @brief Computes a PolyFluid's density, pressure & specific enthalpy at the given temperature by
+///        the legacy loops of virtual curve fit calls over the constituents, and returns their sum.
+static double legacyFluidProperties(const std::vector<const FluidProperties*>& properties,
+                                    const std::vector<double>& massFractions,
+                                    const std::vector<double>& moleFractions,
+                                    const double temperature, const double pressure,
+                                    const double density, double* result)
+{
+    double rho = 0.0;
+    double p   = 0.0;
+    double cp  = 0.0;
+    for (unsigned int i = 0; i < properties.size(); ++i) {
+        if (std::fabs(moleFractions[i]) > DBL_EPSILON) {
+            rho += properties[i]->getDensity(temperature, pressure * moleFractions[i]);
+        }
+    }
+    for (unsigned int i = 0; i < properties.size(); ++i) {
+        if (std::fabs(massFractions[i]) > DBL_EPSILON) {
+            p  += properties[i]->getPressure(temperature, density * massFractions[i]);
+        }
+    }
+    for (unsigned int i = 0; i < properties.size(); ++i) {
+        if (std::fabs(massFractions[i]) > DBL_EPSILON) {
+            cp += properties[i]->getSpecificHeat(temperature) * massFractions[i];
+        }
+    }
+    result[0] = rho;
+    result[1] = p;
+    result[2] = cp * temperature;
+    return result[0] + result[1] + result[2];
+}
+
+/// @brief Compares PolyFluid mixture property evaluation by the legacy per-constituent virtual
+///        curve fit calls against the packed property engine, for air and liquid water.  Each
+///        call computes density, pressure & specific enthalpy over a sweep of temperatures.
+static void benchmarkFluidProperties(const int steps)
+{
+    std::cout << "Fluid properties: PolyFluid density + pressure + specific enthalpy per call"
+              << std::endl;
+    std::cout << std::setw(8)  << "fluid" << std::setw(8) << "consts"
+              << std::setw(14) << "legacy (ns)" << std::setw(14) << "engine (ns)"
+              << std::setw(10) << "speedup" << std::setw(12) << "max |dx|" << std::endl;
+
+    DefinedFluidProperties properties;
+    const FluidProperties::FluidType airTypes[]   = {FluidProperties::GUNNS_N2,
+                                                     FluidProperties::GUNNS_O2,
+                                                     FluidProperties::GUNNS_CO2,
+                                                     FluidProperties::GUNNS_H2O};
+    double                           airMass[]    = {0.755, 0.232, 0.005, 0.008};
+    const FluidProperties::FluidType waterTypes[] = {FluidProperties::GUNNS_WATER};
+    double                           waterMass[]  = {1.0};
+
+    const char*                       names[]     = {"air", "water"};
+    const FluidProperties::FluidType* types[]     = {airTypes, waterTypes};
+    double*                           fractions[] = {airMass, waterMass};
+    const int                         sizes[]     = {4, 1};
+    const double                      pressures[] = {101.325, 200.0};
+    const double                      densities[] = {1.2, 998.0};
+
+    const int calls = steps * 1000;
+    for (int fluid = 0; fluid < 2; ++fluid) {
+        const int n = sizes[fluid];
+        PolyFluidConfigData config(&properties, types[fluid], n);
+        PolyFluidInputData  input(294.261, pressures[fluid], 0.0, 1.0, fractions[fluid]);
+        PolyFluid           poly(config, input);
+
+        std::vector<const FluidProperties*> fits(n);
+        std::vector<double>                 massFractions(n);
+        std::vector<double>                 moleFractions(n);
+        for (int i = 0; i < n; ++i) {
+            fits[i]          = properties.getProperties(types[fluid][i]);
+            massFractions[i] = poly.getMassFraction(types[fluid][i]);
+            moleFractions[i] = poly.getMoleFraction(types[fluid][i]);
+        }
+
+        const double p   = pressures[fluid];
+        const double rho = densities[fluid];
+        double legacy[3];
+        double legacySum = 0.0;
+        double start     = wallClock();
+        for (int call = 0; call < calls; ++call) {
+            const double t = 280.0 + 0.001 * (call % 40000);
+            legacySum += legacyFluidProperties(fits, massFractions, moleFractions, t, p, rho,
+                                               legacy);
+        }
+        const double legacyTime = (wallClock() - start) / calls;
+
+        double engineSum = 0.0;
+        double maxDelta  = 0.0;
+        start = wallClock();
+        for (int call = 0; call < calls; ++call) {
+            const double t = 280.0 + 0.001 * (call % 40000);
+            engineSum += poly.computeDensity(t, p) + poly.computePressure(t, rho)
+                       + poly.computeSpecificEnthalpy(t);
+        }
+        const double engineTime = (wallClock() - start) / calls;
+
+        for (int call = 0; call < 40000; call += 97) {
+            const double t = 280.0 + 0.001 * call;
+            legacyFluidProperties(fits, massFractions, moleFractions, t, p, rho, legacy);
+            maxDelta = std::max(maxDelta, std::fabs(legacy[0] - poly.computeDensity(t, p)));
+            maxDelta = std::max(maxDelta, std::fabs(legacy[1] - poly.computePressure(t, rho)));
+            maxDelta = std::max(maxDelta, std::fabs(legacy[2] - poly.computeSpecificEnthalpy(t)));
+        }
+
+        std::cout << std::setw(8)  << names[fluid]
+                  << std::setw(8)  << n
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(14) << 1.0E9 * legacyTime
+                  << std::setw(14) << 1.0E9 * engineTime
+                  << std::setprecision(2)
+                  << std::setw(10) << legacyTime / engineTime
+                  << std::scientific << std::setprecision(1)
+                  << std::setw(12) << maxDelta << std::endl;
+        std::cout.unsetf(std::ios::floatfield);
+
+        /// - Keep the sums live so the loops aren't optimized away.
+        if (legacySum != legacySum or engineSum != engineSum) {
+            std::cout << "NaN result" << std::endl;
+        }
+    }
+    std::cout << std::endl;
+}
+
+/// @brief Legacy interpolation, for comparison: searches linearly for the cell from the previous
+///        call's cell, then interpolates.
+static double legacyInterpolate(const std::vector<double>& x, const std::vector<double>& z,
+                                const double v, int& cell)
+{
+    const int size = static_cast<int>(x.size());
+    if (v >= x[cell+1]) {
+        for (++cell; cell < size-1; ++cell) {
+            if (x[cell] > v) {
+                break;
+            }
+        }
+        --cell;
+    } else if (v < x[cell] and cell > 0) {
+        for (--cell; cell > 0; --cell) {
+            if (x[cell] <= v) {
+                break;
+            }
+        }
+    }
+    return z[cell] + (z[cell+1] - z[cell]) * (v - x[cell]) / (x[cell+1] - x[cell]);
+}
+
+/// @brief Compares TsLinearInterpolator lookups by the legacy hinted linear cell search against
+///        the breakpoint index, on uniform and geometrically spaced tables of several sizes.  The
+///        sequential inputs ramp slowly, as a state does from step to step, and the random inputs
+///        jump anywhere in the table, as after a command change or Monte Carlo reset.
+static void benchmarkInterpolators(const int steps)
+{
+    std::cout << "Interpolator lookup: TsLinearInterpolator per call, legacy search vs. index"
+              << std::endl;
+    std::cout << "  legacy: inline search & interpolation" << std::endl;
+    std::cout << "  index:  TsApproximation::get, including input bounding & the virtual call"
+              << std::endl;
+    std::cout << std::setw(8)  << "points" << std::setw(10) << "spacing"
+              << std::setw(12) << "inputs" << std::setw(14) << "legacy (ns)"
+              << std::setw(14) << "index (ns)" << std::setw(10) << "speedup"
+              << std::setw(12) << "max |dx|" << std::endl;
+
+    const int calls = steps * 1000;
+    std::vector<double> inputs(4096);
+    const int sizes[]  = {11, 101, 1001};
+    const int numSizes = sizeof(sizes) / sizeof(sizes[0]);
+    for (int size = 0; size < numSizes; ++size) {
+        const int n = sizes[size];
+        for (int spacing = 0; spacing < 2; ++spacing) {
+            const bool uniform = (0 == spacing);
+            std::vector<double> x(n);
+            std::vector<double> z(n);
+            for (int i = 0; i < n; ++i) {
+                const double f = static_cast<double>(i) / (n - 1);
+                x[i] = uniform ? 100.0 * f : 100.0 * (std::pow(1.0E3, f) - 1.0) / (1.0E3 - 1.0);
+                z[i] = std::sin(0.1 * x[i]);
+            }
+            TsLinearInterpolator table(&x[0], &z[0], n, 0.0, 100.0);
+
+            for (int pattern = 0; pattern < 2; ++pattern) {
+                const bool sequential = (0 == pattern);
+                unsigned int seed = 12345;
+                for (unsigned int i = 0; i < inputs.size(); ++i) {
+                    if (sequential) {
+                        inputs[i] = 50.0 - 50.0 * std::cos(6.283185307179586 * i / inputs.size());
+                    } else {
+                        seed = seed * 1103515245u + 12345u;
+                        inputs[i] = 100.0 * (seed >> 8) / 16777216.0;
+                    }
+                }
+                const unsigned int mask = static_cast<unsigned int>(inputs.size()) - 1;
+
+                int    cell      = 0;
+                double legacySum = 0.0;
+                double start     = wallClock();
+                for (int call = 0; call < calls; ++call) {
+                    legacySum += legacyInterpolate(x, z, inputs[call & mask], cell);
+                }
+                const double legacyTime = (wallClock() - start) / calls;
+
+                double indexSum = 0.0;
+                start = wallClock();
+                for (int call = 0; call < calls; ++call) {
+                    indexSum += table.get(inputs[call & mask]);
+                }
+                const double indexTime = (wallClock() - start) / calls;
+
+                double maxDelta = 0.0;
+                for (unsigned int i = 0; i < inputs.size(); ++i) {
+                    maxDelta = std::max(maxDelta, std::fabs(
+                            legacyInterpolate(x, z, inputs[i], cell) - table.get(inputs[i])));
+                }
+
+                std::cout << std::setw(8)  << n
+                          << std::setw(10) << (uniform ? "uniform" : "geometric")
+                          << std::setw(12) << (sequential ? "sequential" : "random")
+                          << std::fixed << std::setprecision(1)
+                          << std::setw(14) << 1.0E9 * legacyTime
+                          << std::setw(14) << 1.0E9 * indexTime
+                          << std::setprecision(2)
+                          << std::setw(10) << legacyTime / indexTime
+                          << std::scientific << std::setprecision(1)
+                          << std::setw(12) << maxDelta << std::endl;
+                std::cout.unsetf(std::ios::floatfield);
+
+                /// - Keep the sums live so the loops aren't optimized away.
+                if (legacySum != legacySum or indexSum != indexSum) {
+                    std::cout << "NaN result" << std::endl;
+                }
+            }
+        }
+    }
+    std::cout << std::endl;
+}
+
+/// @brief The legacy H&S message queue: a ring of std::string nodes guarded by a mutex, where a
+///        non-blocking insert drops the message if the mutex is busy.
+class LegacyMsgQueue
+{
+    public:
+        struct Node {
+            std::string   mFile;
+            int           mLine;
+            std::string   mFunction;
+            std::string   mSubsys;
+            std::string   mText;
+            TS_TIMER_TYPE mMet;
+        };
+        explicit LegacyMsgQueue(const int size)
+            : mNodes(size + 1), mHead(0), mTail(0), mLockFailures(0), mOverflows(0), mHighWater(0)
+        {
+            pthread_mutex_init(&mMutex, 0);
+        }
+        ~LegacyMsgQueue()
+        {
+            pthread_mutex_destroy(&mMutex);
+        }
+        void insert(const std::string& file, const int line, const std::string& function,
+                    const std::string& subsys, const std::string& text, const TS_TIMER_TYPE& met)
+        {
+            if (pthread_mutex_trylock(&mMutex) != 0) {
+                __sync_fetch_and_add(&mLockFailures, 1);
+                return;
+            }
+            Node& node     = mNodes[mTail];
+            node.mFile     = file;
+            node.mLine     = line;
+            node.mFunction = function;
+            node.mSubsys   = subsys;
+            node.mText     = text;
+            node.mMet      = met;
+            mTail = (mTail + 1) % mNodes.size();
+            if (mTail == mHead) {
+                mHead = (mHead + 1) % mNodes.size();
+                ++mOverflows;
+            }
+            const int size = static_cast<int>((mTail + mNodes.size() - mHead) % mNodes.size());
+            mHighWater = std::max(mHighWater, size);
+            pthread_mutex_unlock(&mMutex);
+        }
+        bool remove(Node& node)
+        {
+            if (mHead == mTail) {
+                return false;
+            }
+            pthread_mutex_lock(&mMutex);
+            const bool found = (mHead != mTail);
+            if (found) {
+                node  = mNodes[mHead];
+                mHead = (mHead + 1) % mNodes.size();
+            }
+            pthread_mutex_unlock(&mMutex);
+            return found;
+        }
+        std::vector<Node>     mNodes;
+        volatile unsigned int mHead;
+        volatile unsigned int mTail;
+        volatile int          mLockFailures;
+        int                   mOverflows;
+        int                   mHighWater;
+        pthread_mutex_t       mMutex;
+};
+
+/// @brief Shared state of one message queue contention case.
+struct MsgQueueCase
+{
+    LegacyMsgQueue* mLegacy;    // legacy queue, or null to use mQueue
+    TsHsMsgQueue*   mQueue;     // lock-free queue
+    int             mMessages;  // messages each producer inserts
+    volatile int    mRunning;   // number of producers still inserting
+    volatile int    mRemoved;   // messages removed by the consumer
+    double          mInsertTime; // total producer insert wall time (s)
+    pthread_mutex_t mTimeMutex; // guards mInsertTime
+};
+
+/// @brief Producer thread: inserts messages like a model thread issuing warnings in a burst.
+static void* msgQueueProducer(void* arg)
+{
+    MsgQueueCase* mc = static_cast<MsgQueueCase*>(arg);
+    const TS_TIMER_TYPE met = {1, 0, 0, 0, 0, 0.0, 0};
+    const std::string file  = "aspects/fluid/source/GunnsFluidExampleModel.cpp";
+    const std::string func  = "updateState";
+    const std::string text  = "pressure out of range, limiting flow to the maximum allowed value";
+    const double start = wallClock();
+    for (int i = 0; i < mc->mMessages; ++i) {
+        if (mc->mLegacy) {
+            mc->mLegacy->insert(file, i, func, "GUNNS", text, met);
+        } else {
+            mc->mQueue->insertMsg(file, i, func, TS_HS_WARNING, "GUNNS", text, met, 0);
+        }
+    }
+    const double elapsed = wallClock() - start;
+    pthread_mutex_lock(&mc->mTimeMutex);
+    mc->mInsertTime += elapsed;
+    pthread_mutex_unlock(&mc->mTimeMutex);
+    __sync_fetch_and_sub(&mc->mRunning, 1);
+    return 0;
+}
+
+/// @brief Consumer thread: removes messages like the H&S helper thread until the producers are done
+///        and the queue is empty.
+static void* msgQueueConsumer(void* arg)
+{
+    MsgQueueCase* mc = static_cast<MsgQueueCase*>(arg);
+    LegacyMsgQueue::Node legacyNode;
+    TsHsMsgQueueNode     node;
+    for (;;) {
+        const bool running = (mc->mRunning > 0);
+        const bool found   = mc->mLegacy ? mc->mLegacy->remove(legacyNode)
+                                         : mc->mQueue->removeMsg(node);
+        if (found) {
+            ++mc->mRemoved;
+        } else if (not running) {
+            break;
+        }
+    }
+    return 0;
+}
+
+/// @brief Compares H&S message inserts from 1 to 8 contending producer threads, with a helper
+///        thread removing, for the legacy mutex queue and the lock-free TsHsMsgQueue.  Each
+///        producer inserts a burst of messages into a queue smaller than the burst, so both
+///        overflow; the legacy queue also drops messages whenever its mutex is busy.
+static void benchmarkMsgQueue(const int steps)
+{
+    std::cout << "H&S message queue: non-blocking inserts from contending threads, 1 consumer"
+              << std::endl;
+    std::cout << "  lost = overwritten on overflow + dropped on insert" << std::endl;
+    std::cout << std::setw(9)  << "threads" << std::setw(10) << "queue"
+              << std::setw(13) << "insert (ns)" << std::setw(10) << "removed"
+              << std::setw(10) << "overflow" << std::setw(10) << "dropped"
+              << std::setw(8)  << "high" << std::endl;
+
+    const int capacity    = 4000;
+    const int messages    = steps * 100;
+    const int threads[]   = {1, 2, 4, 8};
+    const int numThreads  = sizeof(threads) / sizeof(threads[0]);
+    for (int t = 0; t < numThreads; ++t) {
+        for (int lockFree = 0; lockFree < 2; ++lockFree) {
+            LegacyMsgQueue legacy(capacity);
+            TsHsMsgQueue   queue(capacity, false);
+            MsgQueueCase   mc;
+            mc.mLegacy     = lockFree ? 0 : &legacy;
+            mc.mQueue      = &queue;
+            mc.mMessages   = messages;
+            mc.mRunning    = threads[t];
+            mc.mRemoved    = 0;
+            mc.mInsertTime = 0.0;
+            pthread_mutex_init(&mc.mTimeMutex, 0);
+
+            pthread_t consumer;
+            std::vector<pthread_t> producers(threads[t]);
+            pthread_create(&consumer, 0, msgQueueConsumer, &mc);
+            for (int i = 0; i < threads[t]; ++i) {
+                pthread_create(&producers[i], 0, msgQueueProducer, &mc);
+            }
+            for (int i = 0; i < threads[t]; ++i) {
+                pthread_join(producers[i], 0);
+            }
+            pthread_join(consumer, 0);
+            pthread_mutex_destroy(&mc.mTimeMutex);
+
+            const int overflows = lockFree ? queue.getOverflows()     : legacy.mOverflows;
+            const int drops     = lockFree ? queue.getDrops()         : legacy.mLockFailures;
+            const int highWater = lockFree ? queue.getHighWaterMark() : legacy.mHighWater;
+            std::cout << std::setw(9)  << threads[t]
+                      << std::setw(10) << (lockFree ? "lockfree" : "legacy")
+                      << std::fixed << std::setprecision(1)
+                      << std::setw(13) << 1.0E9 * mc.mInsertTime / (messages * threads[t])
+                      << std::setw(10) << mc.mRemoved << std::setw(10) << overflows
+                      << std::setw(10) << drops << std::setw(8) << highWater << std::endl;
+            std::cout.unsetf(std::ios::floatfield);
+        }
+    }
+    std::cout << std::endl;
+}
+
+/// @brief The legacy H&S redundancy filter: a map keyed by a formatted file|line|subsys|text string
+///        to a deque of display times, guarded by a mutex.
+class LegacyMsgFilter
+{
+    public:
+        LegacyMsgFilter(const int interval, const int count, const int history)
+            : mMap(), mInterval(interval), mCount(count), mHistory(history), mSuppressed(0)
+        {
+            pthread_mutex_init(&mMutex, 0);
+        }
+        ~LegacyMsgFilter()
+        {
+            pthread_mutex_destroy(&mMutex);
+        }
+        bool shouldSendMessage(const double timestamp, const std::string& file, const int line,
+                               const std::string& subsys, const std::string& text)
+        {
+            pthread_mutex_lock(&mMutex);
+            std::ostringstream oss;
+            oss << file << "|" << line << "|" << subsys << "|" << text << std::ends;
+            const std::string message(oss.str());
+            Map::iterator iter = mMap.find(message);
+            bool send = true;
+            if (iter == mMap.end()) {
+                while (static_cast<int>(mMap.size()) >= mHistory) {
+                    Map::iterator oldest = mMap.begin();
+                    for (Map::iterator it = ++oldest; it != mMap.end(); ++it) {
+                        if (it->second.back() < oldest->second.back()) {
+                            oldest = it;
+                        }
+                    }
+                    mMap.erase(oldest);
+                }
+                mMap.insert(std::make_pair(message, std::deque<double>(1, timestamp)));
+            } else {
+                std::deque<double>& times = iter->second;
+                while (not times.empty() and times.front() < timestamp - mInterval) {
+                    times.pop_front();
+                }
+                if (static_cast<int>(times.size()) < mCount) {
+                    times.push_back(timestamp);
+                } else {
+                    ++mSuppressed;
+                    send = false;
+                }
+            }
+            pthread_mutex_unlock(&mMutex);
+            return send;
+        }
+        typedef std::map<std::string, std::deque<double> > Map;
+        Map             mMap;
+        int             mInterval;
+        int             mCount;
+        int             mHistory;
+        int             mSuppressed;
+        pthread_mutex_t mMutex;
+};
+
+/// @brief Compares messages per second through the legacy and TsHsMsgStdFilter redundancy filters
+///        with their default settings (60 s interval, count 2, history 25), for storms of:
+///        - repeat: 10 call sites each repeating the same warning, so nearly all are suppressed,
+///        - churn:  warnings with a changing value in the text, so every message is new and bumps
+///                  the oldest from the history.
+///        Messages are issued 1 ms apart in sim time.  The legacy filter's search for the oldest
+///        message skips the first in its map, which is never bumped, so it suppresses a few churn
+///        messages that the hashed filter displays.
+static void benchmarkMsgFilter(const int steps)
+{
+    std::cout << "H&S message filter: warning storms, 1 ms apart" << std::endl;
+    std::cout << std::setw(9)  << "storm" << std::setw(10) << "filter"
+              << std::setw(13) << "msgs/s (M)" << std::setw(12) << "suppressed" << std::endl;
+
+    const int messages = steps * 1000;
+    const std::string file   = "aspects/fluid/conductor/GunnsFluidValve.cpp";
+    const std::string subsys = "GUNNS";
+
+    std::vector<std::string> repeatTexts;
+    std::vector<std::string> churnTexts;
+    for (int i = 0; i < 10; ++i) {
+        std::ostringstream oss;
+        oss << "network.valve" << i << " position command out of range, limited to 1.0.";
+        repeatTexts.push_back(oss.str());
+    }
+    for (int i = 0; i < 1000; ++i) {
+        std::ostringstream oss;
+        oss << "network.valve" << i % 10 << " flow rate " << 1.0E-3 * i << " exceeds its limit.";
+        churnTexts.push_back(oss.str());
+    }
+
+    for (int storm = 0; storm < 2; ++storm) {
+        const std::vector<std::string>& texts = storm ? churnTexts : repeatTexts;
+        for (int hashed = 0; hashed < 2; ++hashed) {
+            LegacyMsgFilter  legacy(60, 2, 25);
+            TsHsMsgStdFilter filter;
+            filter.setBlocking(true);
+
+            const double start = wallClock();
+            for (int i = 0; i < messages; ++i) {
+                const int         index = i % texts.size();
+                const std::string& text = texts[index];
+                const int          line = 100 + index % 10;
+                if (hashed) {
+                    filter.shouldSendMessage(1.0E-3 * i, file, line, TS_HS_WARNING, subsys, text);
+                } else {
+                    legacy.shouldSendMessage(1.0E-3 * i, file, line, subsys, text);
+                }
+            }
+            const double elapsed = wallClock() - start;
+
+            std::cout << std::setw(9)  << (storm ? "churn" : "repeat")
+                      << std::setw(10) << (hashed ? "hashed" : "legacy")
+                      << std::fixed << std::setprecision(2)
+                      << std::setw(13) << 1.0E-6 * messages / elapsed
+                      << std::setw(12) << (hashed ? filter.getMessagesSuppressed()
+                                                  : legacy.mSuppressed) << std::endl;
+            std::cout.unsetf(std::ios::floatfield);
+        }
+    }
+    std::cout << std::endl;
+}
+
+/// @brief Runs the regression suite, prints its summary and writes its JSON results to the file.
+static int runSuite(const int steps, const std::string& jsonFile)
+{
+    const char* gunnsHome = std::getenv("GUNNS_HOME");
+    BenchmarkSuite suite(steps, gunnsHome ? gunnsHome : "../..");
+    suite.run();
+    suite.printSummary(std::cout);
+
+    std::ofstream json(jsonFile.c_str());
+    if (not json) {
+        std::cerr << "can't open " << jsonFile << " for writing." << std::endl;
+        return 1;
+    }
+    suite.writeJson(json);
+    std::cout << "Wrote " << jsonFile << std::endl;
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 1 and 0 == std::strcmp(argv[1], "suite")) {
+        const int steps = (argc > 2) ? std::max(1, std::atoi(argv[2])) : 200;
+        return runSuite(steps, (argc > 3) ? argv[3] : "benchmark_suite.json");
+    }
+
+    int steps = 200;
+    if (argc > 1) {
+        steps = std::max(1, std::atoi(argv[1]));
+    }
+
+    std::cout << std::endl;
+    benchmarkMatrixStorage(steps);
+    benchmarkIncrementalAdmittance(steps);
+    benchmarkIslands(steps);
+    benchmarkParallelIslands(steps);
+    benchmarkFluidProperties(steps);
+    benchmarkInterpolators(steps);
+    benchmarkMsgQueue(steps);
+    benchmarkMsgFilter(steps);
+    return 0;
+}